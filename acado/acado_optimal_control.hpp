@@ -45,3 +45,4 @@
 #include <acado/optimization_algorithm/real_time_algorithm.hpp>
 #include <acado/optimization_algorithm/parameter_estimation_algorithm.hpp>
 #include <acado/optimization_algorithm/multi_objective_algorithm.hpp>
+#include <acado/optimization_algorithm/multi_start_algorithm.hpp>
@@ -55,7 +55,9 @@ ACADOcsparse::ACADOcsparse()
 	nDense = 0;
 	index1 = 0;
 	index2 = 0;
+	entryPos = 0;
 	x = 0;
+	A = 0;
 	S = 0;
 	N = 0;
 	TOL = 1e-14;
@@ -70,6 +72,18 @@ ACADOcsparse::ACADOcsparse(const ACADOcsparse &arg)
 	nDense = arg.nDense;
 	index1 = 0;
 	index2 = 0;
+	entryPos = 0;
+
+	if (arg.index1 != 0 && arg.index2 != 0)
+	{
+		index1 = new int[nDense];
+		index2 = new int[nDense];
+		for (run1 = 0; run1 < nDense; run1++)
+		{
+			index1[run1] = arg.index1[run1];
+			index2[run1] = arg.index2[run1];
+		}
+	}
 
 	if (arg.x == 0)
 		x = 0;
@@ -80,9 +94,42 @@ ACADOcsparse::ACADOcsparse(const ACADOcsparse &arg)
 			x[run1] = arg.x[run1];
 	}
 
+	A = 0;
 	S = 0;
 	N = 0;
 
+	// The sparsity pattern and its symbolic analysis are shared by all
+	// copies, only the numeric factorization has to be redone.
+	if (arg.A != 0)
+	{
+		A = cs_spalloc(dim, dim, nDense, 1, 0);
+		for (run1 = 0; run1 <= dim; run1++)
+			A->p[run1] = arg.A->p[run1];
+		for (run1 = 0; run1 < nDense; run1++)
+		{
+			A->i[run1] = arg.A->i[run1];
+			A->x[run1] = arg.A->x[run1];
+		}
+
+		entryPos = new int[nDense];
+		for (run1 = 0; run1 < nDense; run1++)
+			entryPos[run1] = arg.entryPos[run1];
+	}
+
+	if (arg.S != 0)
+	{
+		S = (css*) cs_calloc(1, sizeof(css));
+		S->m2  = arg.S->m2;
+		S->lnz = arg.S->lnz;
+		S->unz = arg.S->unz;
+		if (arg.S->q != 0)
+		{
+			S->q = (int*) cs_malloc(dim, sizeof(int));
+			for (run1 = 0; run1 < dim; run1++)
+				S->q[run1] = arg.S->q[run1];
+		}
+	}
+
 	TOL = arg.TOL;
 	printLevel = arg.printLevel;
 }
@@ -96,21 +143,8 @@ ACADOcsparse::~ACADOcsparse()
 	if (x != 0)
 		delete[] x;
 
-	if (S != 0)
-		cs_free(S);
-	if (N != 0)
-	{
-
-		if (N->L != 0)
-			cs_spfree(N->L);
-		if (N->U != 0)
-			cs_spfree(N->U);
-		if (N->pinv != 0)
-			free(N->pinv);
-		if (N->B != 0)
-			free(N->B);
-		free(N);
-	}
+	clearFactorization();
+	clearPattern();
 }
 
 ACADOcsparse* ACADOcsparse::clone() const
@@ -127,7 +161,7 @@ returnValue ACADOcsparse::solve(double *b)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 	if (nDense <= 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
-	if (S == 0)
+	if (S == 0 || N == 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
 	// CASE: LU
@@ -148,15 +182,15 @@ returnValue ACADOcsparse::solveTranspose(double *b)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 	if (nDense <= 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
-	if (S == 0)
+	if (S == 0 || N == 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
 	// CASE: LU
 
-	cs_ipvec(N->pinv, b, x, dim); /* x = b(p) */
+	cs_pvec(S->q, b, x, dim); /* x = b(q) */
 	cs_utsolve(N->U, x); /* x = U'\x */
 	cs_ltsolve(N->L, x); /* x = L'\x */
-	cs_ipvec(S->q, x, b, dim); /* b(q) = x */
+	cs_pvec(N->pinv, x, b, dim); /* b = x(p) */
 
 	return SUCCESSFUL_RETURN;
 }
@@ -183,6 +217,10 @@ returnValue ACADOcsparse::setNumberOfEntries(const int &nDense_)
 
 returnValue ACADOcsparse::setIndices(const int *rowIdx_, const int *colIdx_)
 {
+	// A new sparsity pattern invalidates the symbolic analysis.
+	clearFactorization();
+	clearPattern();
+
 	if (index1 != 0)
 		delete[] index1;
 	if (index2 != 0)
@@ -204,25 +242,37 @@ returnValue ACADOcsparse::setIndices(const int *rowIdx_, const int *colIdx_)
 returnValue ACADOcsparse::setMatrix(double *A_)
 {
 	int run1;
-	int order = 0;
+	int order = 1;
 
 	if (dim <= 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 	if (nDense <= 0)
 		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
-	cs *C, *D;
-	C = cs_spalloc(0, 0, 1, 1, 1);
+	if (A == 0)
+		if (setupPattern() != SUCCESSFUL_RETURN)
+			return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
 	for (run1 = 0; run1 < nDense; run1++)
-		cs_entry(C, index1[run1], index2[run1], A_[run1]);
+		A->x[entryPos[run1]] = A_[run1];
+
+	// SYMBOLIC ANALYSIS (ONCE PER SPARSITY PATTERN):
+	// ----------------------------------------------
+	if (S == 0)
+		S = cs_sqr(order, A, 0);
+
+	if (S == 0)
+		return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+
+	// NUMERIC FACTORIZATION:
+	// ----------------------
+	if (N != 0)
+		N = cs_nfree(N);
 
-	D = cs_compress(C);
-	S = cs_sqr(order, D, 0);
-	N = cs_lu(D, S, TOL);
+	N = cs_lu(A, S, TOL);
 
-	cs_spfree(C);
-	cs_spfree(D);
+	if (N == 0)
+		return ACADOERROR(RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR);
 
 	return SUCCESSFUL_RETURN;
 }
@@ -248,6 +298,67 @@ returnValue ACADOcsparse::setPrintLevel(PrintLevel printLevel_)
 	return SUCCESSFUL_RETURN;
 }
 
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue ACADOcsparse::setupPattern()
+{
+	int run1;
+
+	if (index1 == 0 || index2 == 0)
+		return RET_MEMBER_NOT_INITIALISED;
+
+	clearPattern();
+
+	A = cs_spalloc(dim, dim, nDense, 1, 0);
+	entryPos = new int[nDense];
+
+	// COUNT THE ENTRIES PER COLUMN:
+	// -----------------------------
+	for (run1 = 0; run1 <= dim; run1++)
+		A->p[run1] = 0;
+	for (run1 = 0; run1 < nDense; run1++)
+		A->p[index2[run1] + 1]++;
+	for (run1 = 0; run1 < dim; run1++)
+		A->p[run1 + 1] += A->p[run1];
+
+	// SCATTER THE ROW INDICES:
+	// ------------------------
+	int *next = new int[dim];
+	for (run1 = 0; run1 < dim; run1++)
+		next[run1] = A->p[run1];
+
+	for (run1 = 0; run1 < nDense; run1++)
+	{
+		entryPos[run1] = next[index2[run1]]++;
+		A->i[entryPos[run1]] = index1[run1];
+		A->x[entryPos[run1]] = 0.0;
+	}
+	delete[] next;
+
+	return SUCCESSFUL_RETURN;
+}
+
+void ACADOcsparse::clearFactorization()
+{
+	if (S != 0)
+		S = cs_sfree(S);
+	if (N != 0)
+		N = cs_nfree(N);
+}
+
+void ACADOcsparse::clearPattern()
+{
+	if (A != 0)
+		A = cs_spfree(A);
+	if (entryPos != 0)
+	{
+		delete[] entryPos;
+		entryPos = 0;
+	}
+}
+
 CLOSE_NAMESPACE_ACADO
 
 #else // __MATLAB__
@@ -45,6 +45,7 @@
 // ---------------------
    struct cs_numeric ;
    struct cs_symbolic;
+   struct cs_sparse  ;
 
 
 
@@ -111,6 +112,14 @@ class ACADOcsparse : public SparseSolver{
         /** Sets the non-zero elements of the matrix A. The double* A  \n
          *  is assumed to contain  nDense  entries corresponding to    \n
          *  non-zero elements of A.                                    \n
+         *                                                             \n
+         *  The symbolic analysis (fill-reducing ordering) is only     \n
+         *  performed once per sparsity pattern, i.e. after each call  \n
+         *  to setIndices(). Subsequent calls only refactorize A       \n
+         *  numerically.                                               \n
+         *                                                             \n
+         *  \return SUCCESSFUL_RETURN                                  \n
+         *          RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR             \n
          */
         virtual returnValue setMatrix( double *A_ );
 
@@ -168,6 +177,21 @@ class ACADOcsparse : public SparseSolver{
     //
     protected:
 
+        /** Builds the compressed-column structure of A from the index \n
+         *  lists and the map from the entries to their positions.     \n
+         *                                                             \n
+         *  \return SUCCESSFUL_RETURN                                  \n
+         */
+        returnValue setupPattern( );
+
+        /** Frees the symbolic and numeric factorizations.             \n
+         */
+        void clearFactorization( );
+
+        /** Frees the compressed-column structure of A.                \n
+         */
+        void clearPattern( );
+
 
 
     //
@@ -181,6 +205,7 @@ class ACADOcsparse : public SparseSolver{
     int                dim;          // dimension of the matrix A
     int             nDense;          // number of non-zero entries in A
     int   *index1, *index2;          // and the associated indices
+    int          *entryPos;          // positions of the entries in the compressed matrix
 
 
 
@@ -191,6 +216,7 @@ class ACADOcsparse : public SparseSolver{
 
     // AUXILIARY VARIABLES:
     // --------------------
+    cs_sparse           *A;          // the matrix A in compressed-column form
     cs_symbolic         *S;          // pointer to a struct, which contains symbolic information about the matrix
     cs_numeric          *N;          // pointer to a struct, which contains numeric information about the matrix
 
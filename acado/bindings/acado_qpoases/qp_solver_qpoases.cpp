@@ -210,20 +210,16 @@ returnValue QPsolver_qpOASES::getPrimalSolution( DVector& xOpt ) const
 	if ( qp == 0 )
 		return ACADOERROR( RET_INITIALIZE_FIRST );
 
+	// the solution is written directly into xOpt, whose storage is
+	// reused if it has the right dimension already
 	uint dim = qp->getNV( );
-	double* xOptTmp = new double[dim];
+	if ( xOpt.getDim( ) != dim )
+		xOpt.init( dim );
 
-	if ( qp->getPrimalSolution( xOptTmp ) == qpOASES::SUCCESSFUL_RETURN )
-	{
-		xOpt = DVector(dim, xOptTmp);
-		delete[] xOptTmp;
+	if ( qp->getPrimalSolution( xOpt.data( ) ) == qpOASES::SUCCESSFUL_RETURN )
 		return SUCCESSFUL_RETURN;
-	}
 	else
-	{
-		delete[] xOptTmp;
 		return ACADOERROR( RET_QP_NOT_SOLVED );
-	}
 }
 
 
@@ -233,19 +229,13 @@ returnValue QPsolver_qpOASES::getDualSolution( DVector& yOpt ) const
 		return ACADOERROR( RET_INITIALIZE_FIRST );
 
 	uint dim = qp->getNV( ) + qp->getNC( );
-	double* yOptTmp = new double[dim];
+	if ( yOpt.getDim( ) != dim )
+		yOpt.init( dim );
 
-	if ( qp->getDualSolution( yOptTmp ) == qpOASES::SUCCESSFUL_RETURN )
-	{
-		yOpt = DVector(dim, yOptTmp);
-		delete[] yOptTmp;
+	if ( qp->getDualSolution( yOpt.data( ) ) == qpOASES::SUCCESSFUL_RETURN )
 		return SUCCESSFUL_RETURN;
-	}
 	else
-	{
-		delete[] yOptTmp;
 		return ACADOERROR( RET_QP_NOT_SOLVED );
-	}
 }
 
 
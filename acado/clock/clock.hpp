@@ -174,6 +174,7 @@ CLOSE_NAMESPACE_ACADO
 // collect all remaining headers of clock directory
 #include <acado/clock/real_clock.hpp>
 #include <acado/clock/simulation_clock.hpp>
+#include <acado/clock/runtime_profiler.hpp>
 
 
 #endif	// ACADO_TOOLKIT_CLOCK_HPP
@@ -0,0 +1,394 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+*    \file src/clock/runtime_profiler.cpp
+*/
+
+
+#include <acado/clock/runtime_profiler.hpp>
+
+#include <iomanip>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+RuntimeProfiler& RuntimeProfiler::instance( )
+{
+	static RuntimeProfiler profiler;
+	return profiler;
+}
+
+
+RuntimeProfiler::RuntimeProfiler( )
+{
+	enabled = BT_FALSE;
+	iteration = -1;
+	timeOrigin = 0.0;
+
+	clear( );
+}
+
+
+returnValue RuntimeProfiler::enable(	unsigned _capacity
+										)
+{
+	if ( _capacity == 0 )
+		return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+	events.resize( _capacity );
+	clear( );
+
+	timeOrigin = acadoGetTime( );
+	enabled = BT_TRUE;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue RuntimeProfiler::disable( )
+{
+	enabled = BT_FALSE;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue RuntimeProfiler::clear( )
+{
+	nextEvent = 0;
+	numRecordedEvents = 0;
+
+	totals.assign( PP_NUM_PHASES,Statistics() );
+	iterationTotals.clear( );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+unsigned RuntimeProfiler::getNumCalls(	ProfilingPhase phase
+										) const
+{
+	return totals[ phase ].calls;
+}
+
+
+double RuntimeProfiler::getTime(	ProfilingPhase phase
+									) const
+{
+	return totals[ phase ].time;
+}
+
+
+double RuntimeProfiler::getFlops(	ProfilingPhase phase
+									) const
+{
+	return totals[ phase ].flops;
+}
+
+
+unsigned RuntimeProfiler::getNumIterations( ) const
+{
+	return iterationTotals.size() / PP_NUM_PHASES;
+}
+
+
+unsigned RuntimeProfiler::getNumCalls(	int _iteration,
+										ProfilingPhase phase
+										) const
+{
+	if ( _iteration < 0 || _iteration >= (int)getNumIterations() )
+		return 0;
+
+	return iterationTotals[ _iteration * PP_NUM_PHASES + phase ].calls;
+}
+
+
+double RuntimeProfiler::getTime(	int _iteration,
+									ProfilingPhase phase
+									) const
+{
+	if ( _iteration < 0 || _iteration >= (int)getNumIterations() )
+		return 0.0;
+
+	return iterationTotals[ _iteration * PP_NUM_PHASES + phase ].time;
+}
+
+
+unsigned RuntimeProfiler::getNumEvents( ) const
+{
+	if ( numRecordedEvents < events.size() )
+		return numRecordedEvents;
+
+	return events.size();
+}
+
+
+unsigned long RuntimeProfiler::getNumDroppedEvents( ) const
+{
+	return numRecordedEvents - getNumEvents( );
+}
+
+
+returnValue RuntimeProfiler::exportCSV(	std::ostream& stream
+										) const
+{
+	stream << "phase,iteration,thread,start [s],duration [s],flops" << std::endl;
+	stream << std::scientific << std::setprecision( 9 );
+
+	for (unsigned i = 0; i < getNumEvents(); ++i)
+	{
+		const Event& e = events[ getEventIndex( i ) ];
+
+		stream	<< getPhaseName( e.phase ) << "," << e.iteration << "," << e.thread << ","
+				<< e.start << "," << e.duration << "," << e.flops << std::endl;
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue RuntimeProfiler::exportJSON(	std::ostream& stream
+											) const
+{
+	unsigned i, j;
+
+	stream << std::scientific << std::setprecision( 9 );
+	stream << "{" << std::endl;
+
+	stream << "  \"phases\": {" << std::endl;
+	for (j = 0; j < PP_NUM_PHASES; ++j)
+	{
+		stream	<< "    \"" << getPhaseName( (ProfilingPhase)j ) << "\": { \"calls\": " << totals[ j ].calls
+				<< ", \"time\": " << totals[ j ].time << ", \"flops\": " << totals[ j ].flops << " }"
+				<< (j + 1 < PP_NUM_PHASES ? "," : "") << std::endl;
+	}
+	stream << "  }," << std::endl;
+
+	stream << "  \"iterations\": [" << std::endl;
+	for (i = 0; i < getNumIterations(); ++i)
+	{
+		stream << "    { \"iteration\": " << i;
+		for (j = 0; j < PP_NUM_PHASES; ++j)
+		{
+			const Statistics& s = iterationTotals[ i * PP_NUM_PHASES + j ];
+
+			stream	<< ", \"" << getPhaseName( (ProfilingPhase)j ) << "\": { \"calls\": " << s.calls
+					<< ", \"time\": " << s.time << ", \"flops\": " << s.flops << " }";
+		}
+		stream << " }" << (i + 1 < getNumIterations() ? "," : "") << std::endl;
+	}
+	stream << "  ]," << std::endl;
+
+	stream << "  \"droppedEvents\": " << getNumDroppedEvents() << "," << std::endl;
+
+	stream << "  \"events\": [" << std::endl;
+	for (i = 0; i < getNumEvents(); ++i)
+	{
+		const Event& e = events[ getEventIndex( i ) ];
+
+		stream	<< "    { \"phase\": \"" << getPhaseName( e.phase ) << "\", \"iteration\": " << e.iteration
+				<< ", \"thread\": " << e.thread << ", \"start\": " << e.start
+				<< ", \"duration\": " << e.duration << ", \"flops\": " << e.flops << " }"
+				<< (i + 1 < getNumEvents() ? "," : "") << std::endl;
+	}
+	stream << "  ]" << std::endl;
+
+	stream << "}" << std::endl;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue RuntimeProfiler::exportChromeTrace(	std::ostream& stream
+													) const
+{
+	// complete events ("ph": "X"), time stamps and durations in microseconds
+	stream << std::fixed << std::setprecision( 3 );
+	stream << "{ \"traceEvents\": [" << std::endl;
+
+	for (unsigned i = 0; i < getNumEvents(); ++i)
+	{
+		const Event& e = events[ getEventIndex( i ) ];
+
+		stream	<< "  { \"name\": \"" << getPhaseName( e.phase ) << "\", \"cat\": \"acado\", \"ph\": \"X\""
+				<< ", \"ts\": " << 1.0e6 * e.start << ", \"dur\": " << 1.0e6 * e.duration
+				<< ", \"pid\": 0, \"tid\": " << e.thread
+				<< ", \"args\": { \"iteration\": " << e.iteration << ", \"flops\": " << e.flops << " } }"
+				<< (i + 1 < getNumEvents() ? "," : "") << std::endl;
+	}
+
+	stream << "], \"displayTimeUnit\": \"ms\" }" << std::endl;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue RuntimeProfiler::printSummary(	std::ostream& stream
+												) const
+{
+	stream << std::endl << "Runtime profile:" << std::endl;
+	stream	<< std::left << std::setw( 22 ) << "phase" << std::right
+			<< std::setw( 10 ) << "calls" << std::setw( 16 ) << "time [s]"
+			<< std::setw( 16 ) << "flops" << std::endl;
+
+	for (unsigned j = 0; j < PP_NUM_PHASES; ++j)
+	{
+		stream	<< std::left << std::setw( 22 ) << getPhaseName( (ProfilingPhase)j ) << std::right
+				<< std::setw( 10 ) << totals[ j ].calls
+				<< std::scientific << std::setprecision( 3 )
+				<< std::setw( 16 ) << totals[ j ].time
+				<< std::setw( 16 ) << totals[ j ].flops << std::endl;
+	}
+
+	if ( getNumDroppedEvents() > 0 )
+		stream << getNumDroppedEvents() << " events have been dropped from the ring buffer." << std::endl;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+const char* RuntimeProfiler::getPhaseName(	ProfilingPhase phase
+											)
+{
+	switch( phase )
+	{
+		case PP_FUNCTION_EVALUATION:
+			return "function_evaluation";
+
+		case PP_INTEGRATION:
+			return "integration";
+
+		case PP_SENSITIVITIES:
+			return "sensitivities";
+
+		case PP_CONDENSING:
+			return "condensing";
+
+		case PP_QP:
+			return "qp";
+
+		case PP_EXPANSION:
+			return "expansion";
+
+		case PP_LINE_SEARCH:
+			return "line_search";
+
+		case PP_HESSIAN_UPDATE:
+			return "hessian_update";
+
+		case PP_EXPORT_INTEGRATOR:
+			return "export_integrator";
+
+		case PP_EXPORT_SOLVER:
+			return "export_solver";
+
+		case PP_EXPORT_FILES:
+			return "export_files";
+
+		default:
+			return "unknown";
+	}
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+
+returnValue RuntimeProfiler::record(	ProfilingPhase phase,
+										double startTime,
+										double duration,
+										double flops
+										)
+{
+	if ( phase < 0 || phase >= PP_NUM_PHASES )
+		return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+	int thread = 0;
+	#ifdef _OPENMP
+	thread = omp_get_thread_num( );
+	#endif
+
+	#pragma omp critical (acado_runtime_profiler)
+	{
+		Event& e = events[ nextEvent ];
+
+		e.phase     = phase;
+		e.iteration = iteration;
+		e.thread    = thread;
+		e.start     = startTime - timeOrigin;
+		e.duration  = duration;
+		e.flops     = flops;
+
+		nextEvent = (nextEvent + 1) % events.size();
+		++numRecordedEvents;
+
+		Statistics& total = totals[ phase ];
+		total.calls++;
+		total.time  += duration;
+		total.flops += flops;
+
+		if ( iteration >= 0 )
+		{
+			if ( iteration >= (int)getNumIterations() )
+				iterationTotals.resize( (iteration + 1) * PP_NUM_PHASES );
+
+			Statistics& it = iterationTotals[ iteration * PP_NUM_PHASES + phase ];
+			it.calls++;
+			it.time  += duration;
+			it.flops += flops;
+		}
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+unsigned RuntimeProfiler::getEventIndex(	unsigned i
+											) const
+{
+	if ( numRecordedEvents < events.size() )
+		return i;
+
+	return (nextEvent + i) % events.size();
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+/*
+ *	end of file
+ */
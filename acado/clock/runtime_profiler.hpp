@@ -0,0 +1,303 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+*    \file include/acado/clock/runtime_profiler.hpp
+*/
+
+
+#ifndef ACADO_TOOLKIT_RUNTIME_PROFILER_HPP
+#define ACADO_TOOLKIT_RUNTIME_PROFILER_HPP
+
+
+#include <acado/utils/acado_utils.hpp>
+
+#include <vector>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Records wall time, call counts and flop estimates of the phases of the algorithms.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *	The class RuntimeProfiler collects a runtime profile of the optimization
+ *	algorithms per phase (see ProfilingPhase): integration, sensitivity
+ *	generation, condensing, QP solution, expansion, line search, Hessian
+ *	update and function evaluation. The SCPmethod reports its iteration
+ *	counter, such that the profile is also available per SQP iteration.
+ *	OCPexport reports the time spent on its modules, such that the profile
+ *	also shows which part of the code export dominates.
+ *
+ *	The profiler is a process-wide instance, which is disabled by default;
+ *	then, every instrumentation point costs a single branch. Once enabled,
+ *	every measurement is stored as event in a ring buffer of fixed capacity,
+ *	which overwrites the oldest events when it is full, and is accumulated
+ *	into the per-phase and per-iteration totals, which are never lost.
+ *	Events can be exported as CSV, as JSON (together with all totals) and in
+ *	the Chrome trace event format (to be loaded in chrome://tracing).
+ *
+ *	Example:
+ *	\code
+ *	RuntimeProfiler::instance().enable( );
+ *	algorithm.solve( );
+ *	std::ofstream trace( "trace.json" );
+ *	RuntimeProfiler::instance().exportChromeTrace( trace );
+ *	\endcode
+ *
+ *	\note Phases may be nested, hence the times of different phases do not add up.
+ */
+class RuntimeProfiler
+{
+	//
+	//  PUBLIC MEMBER FUNCTIONS:
+	//
+	public:
+
+		/** Returns the process-wide profiler.
+		 */
+		static RuntimeProfiler& instance( );
+
+		/** Enables profiling and clears all data recorded so far.
+		 *
+		 *	@param[in] _capacity	Number of events kept in the ring buffer.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue enable(	unsigned _capacity = 65536
+							);
+
+		/** Disables profiling, the recorded data is kept.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue disable( );
+
+		/** Returns whether profiling is enabled.
+		 *
+		 *  \return BT_TRUE iff profiling is enabled
+		 */
+		inline BooleanType isEnabled( ) const;
+
+		/** Clears all events and totals.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue clear( );
+
+
+		/** Sets the iteration to which subsequent measurements are attributed.
+		 *
+		 *	@param[in] _iteration	Iteration index (negative: no iteration).
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		inline returnValue setIteration(	int _iteration
+											);
+
+		/** Returns the iteration to which measurements are attributed.
+		 */
+		inline int getIteration( ) const;
+
+
+		/** Starts a measurement.
+		 *
+		 *  \return Current time stamp, or 0 if profiling is disabled
+		 */
+		inline double tic( ) const;
+
+		/** Finishes a measurement started by tic() and records it.
+		 *
+		 *	@param[in] phase		Measured phase.
+		 *	@param[in] startTime	Time stamp returned by tic().
+		 *	@param[in] flops		Estimated number of floating point operations (0 if unknown).
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		inline returnValue toc(	ProfilingPhase phase,
+								double startTime,
+								double flops = 0.0
+								);
+
+
+		/** Returns the number of recorded calls of a phase. */
+		unsigned getNumCalls(	ProfilingPhase phase
+								) const;
+
+		/** Returns the accumulated wall time of a phase [s]. */
+		double getTime(	ProfilingPhase phase
+						) const;
+
+		/** Returns the accumulated flop estimate of a phase. */
+		double getFlops(	ProfilingPhase phase
+							) const;
+
+		/** Returns the number of iterations with recorded data. */
+		unsigned getNumIterations( ) const;
+
+		/** Returns the number of calls of a phase within one iteration. */
+		unsigned getNumCalls(	int _iteration,
+								ProfilingPhase phase
+								) const;
+
+		/** Returns the wall time of a phase within one iteration [s]. */
+		double getTime(	int _iteration,
+						ProfilingPhase phase
+						) const;
+
+		/** Returns the number of events currently kept in the ring buffer. */
+		unsigned getNumEvents( ) const;
+
+		/** Returns the number of events overwritten in the ring buffer. */
+		unsigned long getNumDroppedEvents( ) const;
+
+
+		/** Writes all events of the ring buffer as CSV, one event per line.
+		 *
+		 *	@param[in] stream	Output stream.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue exportCSV(	std::ostream& stream
+								) const;
+
+		/** Writes the per-phase totals, the per-iteration totals and all
+		 *  events of the ring buffer as JSON.
+		 *
+		 *	@param[in] stream	Output stream.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue exportJSON(	std::ostream& stream
+								) const;
+
+		/** Writes all events of the ring buffer in the Chrome trace event format.
+		 *
+		 *	@param[in] stream	Output stream.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue exportChromeTrace(	std::ostream& stream
+										) const;
+
+		/** Prints the per-phase totals.
+		 *
+		 *	@param[in] stream	Output stream.
+		 *
+		 *  \return SUCCESSFUL_RETURN
+		 */
+		returnValue printSummary(	std::ostream& stream = std::cout
+									) const;
+
+		/** Returns the name of a phase as used in all exports. */
+		static const char* getPhaseName(	ProfilingPhase phase
+											);
+
+
+	//
+	//  PROTECTED MEMBER FUNCTIONS:
+	//
+	protected:
+
+		/** Stores one measurement (thread-safe). */
+		returnValue record(	ProfilingPhase phase,
+							double startTime,
+							double duration,
+							double flops
+							);
+
+		/** Returns the ring buffer index of the i-th oldest event. */
+		unsigned getEventIndex(	unsigned i
+								) const;
+
+
+	//
+	//  PROTECTED MEMBERS:
+	//
+	protected:
+
+		/** One recorded measurement. */
+		struct Event
+		{
+			ProfilingPhase phase;
+			int iteration;
+			int thread;
+			double start;			/**< Start time relative to the time of enabling [s]. */
+			double duration;
+			double flops;
+		};
+
+		/** Accumulated measurements. */
+		struct Statistics
+		{
+			Statistics( ) : calls( 0 ), time( 0.0 ), flops( 0.0 ) {}
+
+			unsigned calls;
+			double time;
+			double flops;
+		};
+
+		BooleanType enabled;					/**< Flag indicating whether profiling is enabled. */
+		int iteration;							/**< Iteration to which measurements are attributed. */
+		double timeOrigin;						/**< Time stamp of enabling the profiler. */
+
+		std::vector< Event > events;			/**< Ring buffer of events. */
+		unsigned nextEvent;						/**< Ring buffer position of the next event. */
+		unsigned long numRecordedEvents;		/**< Number of events recorded since clearing. */
+
+		std::vector< Statistics > totals;		/**< Totals per phase. */
+		std::vector< Statistics > iterationTotals;	/**< Totals per iteration and phase (row-major). */
+
+
+	//
+	//  PRIVATE MEMBER FUNCTIONS:
+	//
+	private:
+
+		RuntimeProfiler( );
+
+		RuntimeProfiler(	const RuntimeProfiler& rhs
+							);
+
+		RuntimeProfiler& operator=(	const RuntimeProfiler& rhs
+									);
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#include <acado/clock/runtime_profiler.ipp>
+
+
+#endif	// ACADO_TOOLKIT_RUNTIME_PROFILER_HPP
+
+
+/*
+ *	end of file
+ */
@@ -141,7 +141,7 @@ returnValue ExportAcadoFunction::exportForwardDeclaration(	std::ostream& stream,
 		return SUCCESSFUL_RETURN;
 	}
 
-	return f->exportForwardDeclarations(stream, name.c_str(), _realString.c_str());
+	return f->exportForwardDeclarations(stream, name.c_str(), _realString.c_str(), getContextParameter().c_str());
 }
 
 
@@ -157,7 +157,7 @@ returnValue ExportAcadoFunction::exportCode(	std::ostream& stream,
 	return f->exportCode(
 			stream, name.c_str(), _realString.c_str(), numX, numXA, numU, numP, numDX, numOD,
 			// TODO: Here we allocate local memory for the function, this should be extended.
-			false, false);
+			false, false, getContextParameter().c_str());
 }
 
 
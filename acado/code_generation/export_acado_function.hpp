@@ -172,7 +172,7 @@ public:
 	ExportVariable getGlobalExportVariable( ) const;
 
 	/** A helper function to check whether a function is external. */
-	bool isExternal() const;
+	virtual bool isExternal() const;
 
 protected:
 	/** The number of states that are needed to evaluate the system of differential equations.
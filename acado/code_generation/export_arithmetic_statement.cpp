@@ -39,6 +39,8 @@
 using namespace std;
 BEGIN_NAMESPACE_ACADO
 
+unsigned ExportArithmeticStatement::multiplyBlockSize = 4;
+
 //
 // PUBLIC MEMBER FUNCTIONS:
 //
@@ -228,7 +230,7 @@ returnValue ExportArithmeticStatement::exportCodeAddSubtract(	std::ostream& stre
 					if ( rhs2->isZero(i,j) == false )
 						stream  << " " << _sign << " " << rhs2->get(i, j) << ";\n";
 					else
-						stream << ";" << endl;
+						stream << ";\n";
 				}
 				else
 				{
@@ -408,74 +410,71 @@ returnValue ExportArithmeticStatement::exportCodeMultiply(	std::ostream& stream,
 			}
 		}
 	}
-//	else if ( numberOfFlops < 32768 )
-//	{
-//		//
-//		// Unroll two inner loops
-//		//
-//
-//		memAllocator->acquire( ii );
-//
-//		stream << "for (" << ii.getName() << " = 0; ";
-//		stream << ii.getName() << " < " << getNumRows() <<"; ";
-//		stream << "++" << ii.getName() << ")\n{\n";
-//
-//		for(uint j = 0; j < getNumCols( ); ++j)
-//		{
-//			allZero = true;
-//
-//			stream << lhs->get(ii,j) << " " << getAssignString();
-//
-//			for(uint k = 0; k < nColsRhs1; ++k)
-//			{
-//				kk = k;
-//				if ( transposeRhs1 == false )
-//				{
-//					iiRhs1 = ii;
-//					kkRhs1 = kk;
-//				}
-//				else
-//				{
-//					iiRhs1 = kk;
-//					kkRhs1 = ii;
-//				}
-//
-//				if ( ( rhs1->isZero(iiRhs1,kkRhs1) == false ) &&
-//					( rhs2->isZero(kk,j) == false ) )
-//				{
-//					allZero = false;
-//
-//					if ( rhs1->isOne(iiRhs1,kkRhs1) == false )
-//					{
-//						stream << sign << " " << rhs1->get(iiRhs1,kkRhs1);
-//						if ( rhs2->isOne(kk,j) == false )
-//							stream << "*" << rhs2->get(kk, j);
-//					}
-//					else
-//					{
-//						if ( rhs2->isOne(kk,j) == false )
-//							stream << " " <<  sign << " " << rhs2->get(kk,j);
-//						else
-//							stream << " " << sign << " 1.0";
-//					}
-//				}
-//			}
-//
-//			if ( ( op2 == ESO_ADD ) || ( op2 == ESO_SUBTRACT ) )
-//				stream << " + " << rhs3->get(ii,j) << ";\n";
-//
-//			if ( op2 == ESO_UNDEFINED )
-//			{
-//				if ( allZero == true )
-//					stream << " 0.0;\n";
-//				else
-//					stream << ";\n";
-//			}
-//		}
-//		stream << "\n}\n";
-//
-//		memAllocator->release( ii );
-//	}
+	else if (multiplyBlockSize > 1)
+	{
+		//
+		// Roll the loops over blocks of the result, such that every block is
+		// accumulated in local variables within a rolled inner loop
+		//
+
+		unsigned nRows = getNumRows( );
+		unsigned nCols = getNumCols( );
+		unsigned nBlockRows = multiplyBlockSize < nRows ? multiplyBlockSize : nRows;
+		unsigned nBlockCols = multiplyBlockSize < nCols ? multiplyBlockSize : nCols;
+		unsigned nFullRows = nRows - nRows % nBlockRows;
+		unsigned nFullCols = nCols - nCols % nBlockCols;
+
+		memAllocator->acquire( ii );
+		memAllocator->acquire( jj );
+		memAllocator->acquire( kk );
+
+		for (unsigned part = 0; part < 2; ++part)
+		{
+			ExportIndex rowIndex;
+			unsigned nPartRows;
+
+			if (part == 0)
+			{
+				stream << "for (" << ii.getName() << " = 0; ";
+				stream << ii.getName() << " < " << nFullRows << "; ";
+				stream << ii.getName() << " += " << nBlockRows << ")\n{\n";
+
+				rowIndex = ii;
+				nPartRows = nBlockRows;
+			}
+			else
+			{
+				if (nRows == nFullRows)
+					break;
+
+				rowIndex = nFullRows;
+				nPartRows = nRows - nFullRows;
+			}
+
+			if (nFullCols > nBlockCols)
+			{
+				stream << "for (" << jj.getName() << " = 0; ";
+				stream << jj.getName() << " < " << nFullCols << "; ";
+				stream << jj.getName() << " += " << nBlockCols << ")\n{\n";
+
+				exportCodeMultiplyBlock(stream, transposeRhs1, sign, rowIndex, nPartRows, jj, nBlockCols, kk, nColsRhs1, _realString);
+
+				stream << "}\n";
+			}
+			else
+				exportCodeMultiplyBlock(stream, transposeRhs1, sign, rowIndex, nPartRows, 0, nBlockCols, kk, nColsRhs1, _realString);
+
+			if (nCols > nFullCols)
+				exportCodeMultiplyBlock(stream, transposeRhs1, sign, rowIndex, nPartRows, nFullCols, nCols - nFullCols, kk, nColsRhs1, _realString);
+
+			if (part == 0)
+				stream << "}\n";
+		}
+
+		memAllocator->release( ii );
+		memAllocator->release( jj );
+		memAllocator->release( kk );
+	}
 	else
 	{
 		//
@@ -545,6 +544,66 @@ returnValue ExportArithmeticStatement::exportCodeMultiply(	std::ostream& stream,
 }
 
 
+returnValue ExportArithmeticStatement::exportCodeMultiplyBlock(	std::ostream& stream,
+																bool transposeRhs1,
+																const std::string& sign,
+																const ExportIndex& ii,
+																unsigned nRows,
+																const ExportIndex& jj,
+																unsigned nCols,
+																const ExportIndex& kk,
+																unsigned nInner,
+																const std::string& _realString
+																) const
+{
+	stream << "{\n";
+
+	for (unsigned i = 0; i < nRows; ++i)
+		for (unsigned j = 0; j < nCols; ++j)
+			stream << _realString << " t" << i << "_" << j << " = 0.0;\n";
+
+	stream << "for (" << kk.getName() << " = 0; ";
+	stream << kk.getName() << " < " << nInner << "; ";
+	stream << "++" << kk.getName() << ")\n{\n";
+
+	for (unsigned i = 0; i < nRows; ++i)
+		for (unsigned j = 0; j < nCols; ++j)
+		{
+			stream << "t" << i << "_" << j << " += " << sign << " ";
+
+			if ( transposeRhs1 == false )
+				stream << rhs1->get(ii + i, kk);
+			else
+				stream << rhs1->get(kk, ii + i);
+
+			stream << "*" << rhs2->get(kk, jj + j) << ";\n";
+		}
+
+	stream << "}\n";
+
+	for (unsigned i = 0; i < nRows; ++i)
+		for (unsigned j = 0; j < nCols; ++j)
+		{
+			if (lhs.isCalledByValue() == true)
+				stream << lhs.getFullName();
+			else
+				stream << lhs->get(ii + i, jj + j);
+
+			stream << " " << getAssignString() << " t" << i << "_" << j;
+
+			if (op2 == ESO_ADD)
+				stream << " + " << rhs3->get(ii + i, jj + j);
+			else if (op2 == ESO_SUBTRACT)
+				stream << " - " << rhs3->get(ii + i, jj + j);
+
+			stream << ";\n";
+		}
+
+	stream << "}\n";
+
+	return SUCCESSFUL_RETURN;
+}
+
 returnValue ExportArithmeticStatement::exportCodeAssign(	std::ostream& stream,
 															const std::string& _op,
 															const std::string& _realString,
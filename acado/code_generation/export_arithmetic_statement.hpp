@@ -131,6 +131,11 @@ class ExportArithmeticStatement : public ExportStatement
 
 		ExportArithmeticStatement& allocate( MemoryAllocatorPtr allocator );
 
+		/** Size of the register blocks used for exporting matrix multiplications
+		 *  with rolled loops; 0 selects plain loops over all elements.
+		 */
+		static unsigned multiplyBlockSize;
+
 	//
     // PROTECTED MEMBER FUNCTIONS:
     //
@@ -170,6 +175,35 @@ class ExportArithmeticStatement : public ExportStatement
 										const std::string& _intString = "int"
 										) const;
 
+		/** Exports source code for a single register block of a multiplication,
+		 *  i.e. the nRows x nCols elements of lhs starting at (ii, jj). The
+		 *  products are accumulated in local variables in a rolled loop over kk.
+		 *
+		 *	@param[in] stream			Name of file to be used to export statement.
+		 *	@param[in] transposeRhs1	Flag indicating whether rhs1 shall be transposed.
+		 *	@param[in] sign				std::string of the sign of the products ("+" or "-").
+		 *	@param[in] ii				Index of the first row of the block.
+		 *	@param[in] nRows			Number of rows of the block.
+		 *	@param[in] jj				Index of the first column of the block.
+		 *	@param[in] nCols			Number of columns of the block.
+		 *	@param[in] kk				Index of the loop over the inner dimension.
+		 *	@param[in] nInner			Inner dimension of the multiplication.
+		 *	@param[in] _realString		std::string to be used to declare real variables.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue exportCodeMultiplyBlock(	std::ostream& stream,
+												bool transposeRhs1,
+												const std::string& sign,
+												const ExportIndex& ii,
+												unsigned nRows,
+												const ExportIndex& jj,
+												unsigned nCols,
+												const ExportIndex& kk,
+												unsigned nInner,
+												const std::string& _realString
+												) const;
+
 		/** Exports source code for an assignment to given file. 
 		 *  Its appearance can be adjusted by various options.
 		 *
@@ -60,8 +60,19 @@ returnValue ExportAuxiliaryFunctions::configure( )
 	// Source file configuration
 	//
 
+	// In reentrant code, the functions take the context as (only) argument
+	string contextParameter = " ";
+	string variables = moduleName + "Variables";
+	if (ExportStatement::reentrantCode == true)
+	{
+		contextParameter = " " + ExportStatement::getContextParameter( " " );
+		variables = ExportStatement::getContextName() + "->variables";
+	}
+
 	source.dictionary[ "@MODULE_NAME@" ] = moduleName;
     source.dictionary[ "@MODULE_PREFIX@" ] = modulePrefix;
+	source.dictionary[ "@CONTEXT_PARAMETER@" ] = contextParameter;
+	source.dictionary[ "@VARIABLES@" ] = variables;
 
 	source.fillTemplate();
 
@@ -70,6 +81,7 @@ returnValue ExportAuxiliaryFunctions::configure( )
 	//
 	header.dictionary[ "@MODULE_NAME@" ] = moduleName;
     header.dictionary[ "@MODULE_PREFIX@" ] = modulePrefix;
+	header.dictionary[ "@CONTEXT_PARAMETER@" ] = contextParameter;
 
 	header.fillTemplate();
 
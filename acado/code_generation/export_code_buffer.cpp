@@ -0,0 +1,135 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/**
+ *    \file src/code_generation/export_code_buffer.cpp
+ */
+
+#include <acado/code_generation/export_code_buffer.hpp>
+
+using namespace std;
+
+BEGIN_NAMESPACE_ACADO
+
+unsigned ExportCodeBuffer::memoryLimit = 16 * 1024 * 1024;
+
+static const unsigned exportCodeBufferAreaSize = 64 * 1024;
+
+ExportCodeBuffer::ExportCodeBuffer( ) : std::streambuf( ), area( exportCodeBufferAreaSize ), file( 0 )
+{
+	setp(&area[ 0 ], &area[ 0 ] + area.size());
+}
+
+ExportCodeBuffer::~ExportCodeBuffer( )
+{
+	if (file != 0)
+		fclose( file );
+}
+
+returnValue ExportCodeBuffer::copyTo(	std::ostream& stream
+										)
+{
+	if (flushArea() != SUCCESSFUL_RETURN)
+		return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
+
+	if (file == 0)
+	{
+		stream.write(buffer.data(), buffer.size());
+	}
+	else
+	{
+		rewind( file );
+
+		size_t n;
+		while ((n = fread(&area[ 0 ], 1, area.size(), file)) > 0)
+			stream.write(&area[ 0 ], n);
+
+		if (ferror( file ) != 0)
+			return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
+
+		fseek(file, 0, SEEK_END);
+	}
+
+	return stream.good() == true ? SUCCESSFUL_RETURN : ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
+}
+
+bool ExportCodeBuffer::isSpilled( ) const
+{
+	return file != 0;
+}
+
+ExportCodeBuffer::int_type ExportCodeBuffer::overflow(	int_type ch
+														)
+{
+	if (flushArea() != SUCCESSFUL_RETURN)
+		return traits_type::eof();
+
+	if (traits_type::eq_int_type(ch, traits_type::eof()) == true)
+		return traits_type::not_eof( ch );
+
+	*pptr() = traits_type::to_char_type( ch );
+	pbump( 1 );
+
+	return ch;
+}
+
+int ExportCodeBuffer::sync( )
+{
+	return flushArea() == SUCCESSFUL_RETURN ? 0 : -1;
+}
+
+returnValue ExportCodeBuffer::flushArea( )
+{
+	size_t n = pptr() - pbase();
+	setp(&area[ 0 ], &area[ 0 ] + area.size());
+
+	if (file == 0)
+	{
+		buffer.append(&area[ 0 ], n);
+
+		if (buffer.size() <= memoryLimit)
+			return SUCCESSFUL_RETURN;
+
+		// Move the code collected so far to a temporary file; if none can be
+		// created, the code is simply kept in memory.
+		file = tmpfile();
+		if (file == 0)
+			return SUCCESSFUL_RETURN;
+
+		if (fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size())
+			return RET_UNABLE_TO_EXPORT_CODE;
+
+		string( ).swap( buffer );
+
+		return SUCCESSFUL_RETURN;
+	}
+
+	if (fwrite(&area[ 0 ], 1, n, file) != n)
+		return RET_UNABLE_TO_EXPORT_CODE;
+
+	return SUCCESSFUL_RETURN;
+}
+
+CLOSE_NAMESPACE_ACADO
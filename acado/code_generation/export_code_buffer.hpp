@@ -0,0 +1,92 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+/**
+ *    \file include/code_generation/export_code_buffer.hpp
+ */
+
+#ifndef ACADO_TOOLKIT_EXPORT_CODE_BUFFER_HPP
+#define ACADO_TOOLKIT_EXPORT_CODE_BUFFER_HPP
+
+#include <acado/utils/acado_utils.hpp>
+
+#include <cstdio>
+#include <streambuf>
+
+BEGIN_NAMESPACE_ACADO
+
+/**
+ *	\brief Stream buffer that holds exported code in memory up to a limit.
+ *
+ *	\ingroup AuxiliaryFunctionality
+ *
+ *	Exported code that cannot be written to its file right away (e.g. the body of
+ *	an exported function, which follows its local declarations) is collected in
+ *	an ExportCodeBuffer. As long as the code is shorter than memoryLimit bytes, it
+ *	is kept in memory; beyond, the buffer moves it to a temporary file and
+ *	appends all further code to this file. Hence, the memory needed to export
+ *	large functions stays bounded.
+ */
+class ExportCodeBuffer : public std::streambuf
+{
+public:
+	ExportCodeBuffer( );
+
+	virtual ~ExportCodeBuffer( );
+
+	/** Writes the collected code to a stream. */
+	returnValue copyTo(	std::ostream& stream
+						);
+
+	/** Returns whether the code has been moved to a temporary file. */
+	bool isSpilled( ) const;
+
+	/** Number of bytes kept in memory before the code is moved to a temporary file. */
+	static unsigned memoryLimit;
+
+protected:
+	virtual int_type overflow(	int_type ch
+								);
+
+	virtual int sync( );
+
+private:
+	ExportCodeBuffer(	const ExportCodeBuffer& arg
+						);
+
+	ExportCodeBuffer& operator=(	const ExportCodeBuffer& arg
+									);
+
+	/** Moves the put area to the memory buffer or the temporary file. */
+	returnValue flushArea( );
+
+	std::vector< char > area;
+	std::string buffer;
+	std::FILE* file;
+};
+
+CLOSE_NAMESPACE_ACADO
+
+#endif // ACADO_TOOLKIT_EXPORT_CODE_BUFFER_HPP
@@ -23,6 +23,7 @@
  *
  */
 #include <acado/code_generation/export_data_internal.hpp>
+#include <acado/code_generation/export_statement.hpp>
 
 BEGIN_NAMESPACE_ACADO
 
@@ -148,6 +149,16 @@ std::string ExportDataInternal::getDataStructString( ) const
 {
 	std::stringstream tmp;
 
+	// In reentrant code, variables and workspace are members of the context
+	if (ExportStatement::reentrantCode == true)
+	{
+		if (dataStruct == ACADO_VARIABLES)
+			return ExportStatement::getContextName() + "->variables";
+
+		if (dataStruct == ACADO_WORKSPACE)
+			return ExportStatement::getContextName() + "->workspace";
+	}
+
 	tmp << prefix;
 
 	if (prefix.empty() == false)
@@ -120,6 +120,7 @@ returnValue ExportExactHessianQpDunes::getCode(	ExportStatementBlock& code
 	if ( useOMP )
 	{
 		code.addDeclaration( state );
+		code.addFunction( distributeWorkspace );
 	}
 
 	code.addFunction( modelSimulation );
@@ -81,7 +81,12 @@ returnValue ExportFile::setup(	const std::string& _fileName,
 
 returnValue ExportFile::exportCode( ) const
 {
-	ofstream stream( fileName.c_str() );
+	// A large stream buffer, such that the many short writes of the
+	// statements do not turn into as many system calls
+	vector< char > streamBuffer( 1024 * 1024 );
+	ofstream stream;
+	stream.rdbuf()->pubsetbuf(&streamBuffer[ 0 ], streamBuffer.size());
+	stream.open( fileName.c_str() );
 
 	if (stream.good() == false)
 		return ACADOERROR( RET_DOES_DIRECTORY_EXISTS );
@@ -33,6 +33,7 @@
 
 #include <acado/code_generation/export_function.hpp>
 #include <acado/code_generation/export_function_call.hpp>
+#include <acado/code_generation/export_code_buffer.hpp>
 
 using namespace std;
 
@@ -235,7 +236,7 @@ returnValue ExportFunction::exportForwardDeclaration(	std::ostream& stream,
 		stream << "void";
 	}
 
-	stream << " " << name << "( ";
+	stream << " " << name << "( " << getContextParameter( functionArguments.getNumArguments() > 0 ? ", " : "" );
 	functionArguments.exportCode(stream, _realString, _intString, _precision);
 	stream << " );\n";
 
@@ -269,7 +270,7 @@ returnValue ExportFunction::exportCode(	std::ostream& stream,
 		stream << "void";
 	}
 	
-	stream << " " << name << "( ";
+	stream << " " << name << "( " << getContextParameter( functionArguments.getNumArguments() > 0 ? ", " : "" );
 	functionArguments.exportCode(stream, _realString, _intString, _precision);
 	stream << " )\n{\n";
 
@@ -284,9 +285,10 @@ returnValue ExportFunction::exportCode(	std::ostream& stream,
 		(*it)->allocate( memAllocator );
 
 	//
-	// Open a temporary file and export statements to the temporary file
+	// Export statements to a temporary buffer, which moves large bodies to a temporary file
 	//
-	stringstream ss;
+	ExportCodeBuffer body;
+	ostream ss( &body );
 	ExportStatementBlock::exportCode(ss, _realString, _intString, _precision);
 
 	//
@@ -303,9 +305,10 @@ returnValue ExportFunction::exportCode(	std::ostream& stream,
 		localVariables[ i ].exportDataDeclaration(stream, _realString, _intString, _precision);
 
 	//
-	// Copy temporary file to main file, and close te temporary file aftwarards
+	// Copy temporary buffer to main file
 	//
-	stream << ss.str();
+	if (body.copyTo( stream ) != SUCCESSFUL_RETURN)
+		return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
 
 	//
 	// Finish the export of the function
@@ -391,6 +394,11 @@ bool ExportFunction::isPrivate() const
 	return flagPrivate;
 }
 
+bool ExportFunction::isExternal() const
+{
+	return false;
+}
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
@@ -272,6 +272,9 @@ public:
 	/** Is function private? */
 	virtual bool isPrivate() const;
 
+	/** Is function external, i.e. not exported by the code generation tool? */
+	virtual bool isExternal() const;
+
 protected:
 	/** Frees internal dynamic memory to yield an empty function.
 	 *
@@ -84,6 +84,7 @@ ExportFunctionCall::ExportFunctionCall( const ExportFunctionCall& arg ) : Export
 	setName( arg.name );
 
 	functionArguments = arg.functionArguments;
+	external = arg.external;
 }
 
 
@@ -102,6 +103,7 @@ ExportFunctionCall& ExportFunctionCall::operator=( const ExportFunctionCall& arg
 		setName( arg.name );
 
 		functionArguments = arg.functionArguments;
+		external = arg.external;
 	}
 
 	return *this;
@@ -162,6 +164,7 @@ returnValue ExportFunctionCall::init(	const ExportFunction& _f,
 	clear( );
 
 	setName( _f.getName() );
+	external = _f.isExternal();
 
 	if (_f.isDefined() == false)
 	{
@@ -196,6 +199,8 @@ returnValue ExportFunctionCall::exportCode(	std::ostream& stream,
 		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
 
 	stream << name << "( ";
+	if (external == false)
+		stream << getContextArgument( functionArguments.getNumArguments() > 0 ? ", " : "" );
 	functionArguments.exportCode(stream, _realString, _intString, _precision);
 	stream << " );\n";
 
@@ -212,6 +217,7 @@ returnValue ExportFunctionCall::clear( )
 {
 	functionArguments.clear( );
 	functionArguments.doNotIncludeType( );
+	external = false;
 
 	return SUCCESSFUL_RETURN;
 }
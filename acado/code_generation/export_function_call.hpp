@@ -238,6 +238,7 @@ class ExportFunctionCall : public ExportStatement
 
 		std::string name;							/**< Name of function to be called. */
 		ExportArgumentList functionArguments;		/**< List of calling arguments. */
+		bool external;								/**< Flag indicating whether an external function is called. */
 };
 
 
@@ -359,7 +359,7 @@ returnValue ExportGaussNewtonBlockForces::setupEvaluation( )
 	ExportIndex index("index");
 	preparation.addIndex( index );
 
-	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "();\n";
+	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "(" << ExportStatement::getContextArgument( "" ) << ");\n";
 
 	preparation.addFunctionCall( evaluateObjective );
 	if( regularizeHessian.isDefined() ) preparation.addFunctionCall( regularizeHessian );
@@ -96,7 +96,7 @@ returnValue ExportGaussNewtonBlockQpDunes::setupEvaluation( )
 	ExportIndex index("index");
 	preparation.addIndex( index );
 
-	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "();\n";
+	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "(" << ExportStatement::getContextArgument( "" ) << ");\n";
 
 	preparation.addFunctionCall( evaluateObjective );
 	if( regularizeHessian.isDefined() ) preparation.addFunctionCall( regularizeHessian );
@@ -177,6 +177,22 @@ returnValue ExportGaussNewtonCN2::getCode(	ExportStatementBlock& code
 	if ( useOMP )
 	{
 		code.addDeclaration( state );
+		code.addDeclaration( W1, ACADO_LOCAL );
+		code.addDeclaration( W2, ACADO_LOCAL );
+
+		if (objValueIn.getDataStruct() == ACADO_LOCAL)
+		{
+			code.addDeclaration( objAuxVar, ACADO_LOCAL );
+			code.addDeclaration( objValueIn, ACADO_LOCAL );
+			code.addDeclaration( objValueOut, ACADO_LOCAL );
+
+			code << "#pragma omp threadprivate( ";
+			if (objAuxVar.getDim() > 0)
+				code << objAuxVar.getFullName() << ", ";
+			code << objValueIn.getFullName() << ", " << objValueOut.getFullName() << " )\n\n";
+		}
+
+		code.addFunction( distributeWorkspace );
 	}
 
 	code.addFunction( modelSimulation );
@@ -281,6 +297,8 @@ returnValue ExportGaussNewtonCN2::setupObjectiveEvaluation( void )
 	int variableObjS;
 	get(CG_USE_VARIABLE_WEIGHTING_MATRIX, variableObjS);
 
+	bool parallelObjective = setupThreadPrivateObjective();
+
 	//
 	// A loop the evaluates objective and corresponding gradients
 	//
@@ -400,6 +418,8 @@ returnValue ExportGaussNewtonCN2::setupObjectiveEvaluation( void )
 		);
 	}
 
+	if (parallelObjective == true)
+		evaluateObjective << "#pragma omp parallel for schedule(static)\n";
 	evaluateObjective.addStatement( loopObjective );
 
 	//
@@ -1321,10 +1341,17 @@ returnValue ExportGaussNewtonCN2::setupCondensing( void )
 
 	 */
 
-	W1.setup("W1", NX, NU, REAL, ACADO_WORKSPACE);
-	W2.setup("W2", NX, NU, REAL, ACADO_WORKSPACE);
+	// The columns are independent, with OpenMP they are distributed over the threads
+	// and every thread works with its own W1 and W2.
+	int useOMP;
+	get(CG_USE_OPENMP, useOMP);
+	bool parallelColumns = useOMP && ExportStatement::reentrantCode == false;
+
+	ExportStruct wStruct = parallelColumns == true ? ACADO_LOCAL : ACADO_WORKSPACE;
+	W1.setup("W1", NX, NU, REAL, wStruct);
+	W2.setup("W2", NX, NU, REAL, wStruct);
 
-	if (N <= 15)
+	if (N <= 15 && parallelColumns == false)
 	{
 		for (unsigned col = 0; col < N; ++col)
 		{
@@ -1446,6 +1473,10 @@ returnValue ExportGaussNewtonCN2::setupCondensing( void )
 				ExportIndex( col )
 		);
 
+		// The work per column decreases with the column index, hence dynamic scheduling
+		if (parallelColumns == true)
+			condensePrep	<< "#pragma omp parallel for private(" << row.getName() << ", " << offset.getName() << ", "
+							<< W1.getFullName() << ", " << W2.getFullName() << ") schedule(dynamic)\n";
 		condensePrep.addStatement( cLoop );
 		condensePrep.addLinebreak();
 
@@ -2081,7 +2112,7 @@ returnValue ExportGaussNewtonCN2::setupEvaluation( )
 	retSim.setDoc("Status of the integration module. =0: OK, otherwise the error code.");
 	preparation.setReturnValue(retSim, false);
 
-	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "();\n";
+	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "(" << ExportStatement::getContextArgument( "" ) << ");\n";
 
 	preparation.addFunctionCall( evaluateObjective );
 	if( regularizeHessian.isDefined() ) { // ALSO IN THE CASE OF CONDENSED REGULARIZATION, THIS IS CURRENTLY NECESSARY:
@@ -2112,7 +2143,7 @@ returnValue ExportGaussNewtonCN2::setupEvaluation( )
 	feedback.addLinebreak();
 
 	stringstream s;
-	s << tmp.getName() << " = " << solve.getName() << "( );" << endl;
+	s << tmp.getName() << " = " << solve.getName() << "( " << ExportStatement::getContextArgument( " " ) << ");" << endl;
 	feedback <<  s.str();
 	feedback.addLinebreak();
 
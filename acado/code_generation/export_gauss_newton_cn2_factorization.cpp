@@ -178,6 +178,7 @@ returnValue ExportGaussNewtonCn2Factorization::getCode(	ExportStatementBlock& co
 	if ( useOMP )
 	{
 		code.addDeclaration( state );
+		code.addFunction( distributeWorkspace );
 	}
 
 	code.addFunction( modelSimulation );
@@ -1784,7 +1785,7 @@ returnValue ExportGaussNewtonCn2Factorization::setupEvaluation( )
 	retSim.setDoc("Status of the integration module. =0: OK, otherwise the error code.");
 	preparation.setReturnValue(retSim, false);
 
-	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "();\n";
+	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "(" << ExportStatement::getContextArgument( "" ) << ");\n";
 
 	preparation.addFunctionCall( evaluateObjective );
 	preparation.addFunctionCall( condensePrep );
@@ -1809,7 +1810,7 @@ returnValue ExportGaussNewtonCn2Factorization::setupEvaluation( )
 	feedback.addLinebreak();
 
 	stringstream s;
-	s << tmp.getName() << " = " << solve.getName() << "( );" << endl;
+	s << tmp.getName() << " = " << solve.getName() << "( " << ExportStatement::getContextArgument( " " ) << ");" << endl;
 	feedback <<  s.str();
 	feedback.addLinebreak();
 
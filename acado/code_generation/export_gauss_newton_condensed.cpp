@@ -180,6 +180,20 @@ returnValue ExportGaussNewtonCondensed::getCode(	ExportStatementBlock& code
 	if ( useOMP )
 	{
 		code.addDeclaration( state );
+
+		if (objValueIn.getDataStruct() == ACADO_LOCAL)
+		{
+			code.addDeclaration( objAuxVar, ACADO_LOCAL );
+			code.addDeclaration( objValueIn, ACADO_LOCAL );
+			code.addDeclaration( objValueOut, ACADO_LOCAL );
+
+			code << "#pragma omp threadprivate( ";
+			if (objAuxVar.getDim() > 0)
+				code << objAuxVar.getFullName() << ", ";
+			code << objValueIn.getFullName() << ", " << objValueOut.getFullName() << " )\n\n";
+		}
+
+		code.addFunction( distributeWorkspace );
 	}
 
 	code.addFunction( modelSimulation );
@@ -290,6 +304,8 @@ returnValue ExportGaussNewtonCondensed::setupObjectiveEvaluation( void )
 		ACADOWARNINGTEXT(RET_INVALID_ARGUMENTS,
 				"Mixed control-state terms in the objective function are not supported at the moment.");
 
+	bool parallelObjective = setupThreadPrivateObjective();
+
 	//
 	// A loop the evaluates objective and corresponding gradients
 	//
@@ -442,6 +458,8 @@ returnValue ExportGaussNewtonCondensed::setupObjectiveEvaluation( void )
 		loopObjective.addLinebreak( );
 	}
 
+	if (parallelObjective == true)
+		evaluateObjective << "#pragma omp parallel for schedule(static)\n";
 	evaluateObjective.addStatement( loopObjective );
 
 	//
@@ -1487,7 +1505,12 @@ returnValue ExportGaussNewtonCondensed::setupCondensing( void )
 	//
 	// Create H11 block
 	//
-	if (N <= 20)
+	// The block rows are independent, with OpenMP they are distributed over the threads.
+	int useOMP;
+	get(CG_USE_OPENMP, useOMP);
+	bool parallelRows = useOMP && ExportStatement::reentrantCode == false;
+
+	if (N <= 20 && parallelRows == false)
 	{
 		unsigned row, col;
 
@@ -1563,6 +1586,11 @@ returnValue ExportGaussNewtonCondensed::setupCondensing( void )
 		eLoopJ.addStatement( eLoopK2 );
 
 		eLoopI.addStatement( eLoopJ );
+
+		// The work per block row decreases with the row index, hence dynamic scheduling
+		if (parallelRows == true)
+			condensePrep	<< "#pragma omp parallel for private(" << col.getName() << ", " << blk.getName() << ", "
+							<< indl.getName() << ", " << indr.getName() << ") schedule(dynamic)\n";
 		condensePrep.addStatement( eLoopI );
 
 		condensePrep.release( row ).release( col ).release( blk ).release( indl ).release( indr );
@@ -2250,7 +2278,7 @@ returnValue ExportGaussNewtonCondensed::setupEvaluation( )
 	retSim.setDoc("Status of the integration module. =0: OK, otherwise the error code.");
 	preparation.setReturnValue(retSim, false);
 
-	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "();\n";
+	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "(" << ExportStatement::getContextArgument( "" ) << ");\n";
 
 	preparation.addFunctionCall( evaluateObjective );
 	preparation.addFunctionCall( condensePrep );
@@ -2274,7 +2302,7 @@ returnValue ExportGaussNewtonCondensed::setupEvaluation( )
 	feedback.addFunctionCall( condenseFdb );
 	feedback.addLinebreak();
 
-	feedback << tmp.getName() << " = " << solve.getName() << "( );\n";
+	feedback << tmp.getName() << " = " << solve.getName() << "( " << ExportStatement::getContextArgument( " " ) << ");\n";
 	feedback.addLinebreak();
 
 	feedback.addFunctionCall( expand );
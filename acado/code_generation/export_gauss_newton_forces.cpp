@@ -134,6 +134,7 @@ returnValue ExportGaussNewtonForces::getCode(	ExportStatementBlock& code
 	if ( useOMP )
 	{
 		code.addDeclaration( state );
+		code.addFunction( distributeWorkspace );
 	}
 
 	code.addFunction( modelSimulation );
@@ -574,7 +575,7 @@ returnValue ExportGaussNewtonForces::setupObjectiveEvaluation( void )
 	if (Q1.isGiven() == true && R1.isGiven() == true && S1.isGiven() == true)
 	{
 		initialize <<
-				setStageH.getName() << "( " << objHessians[ 0 ].getFullName() << ", " << "0" << " );\n";
+				setStageH.getName() << "( " << ExportStatement::getContextArgument() << objHessians[ 0 ].getFullName() << ", " << "0" << " );\n";
 		initialize.addLinebreak();
 		if (diagHN == false)
 		{
@@ -925,7 +926,7 @@ returnValue ExportGaussNewtonForces::setupEvaluation( )
 	retSim.setDoc("Status of the integration module. =0: OK, otherwise the error code.");
 	preparation.setReturnValue(retSim, false);
 
-	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "();\n";
+	preparation	<< retSim.getFullName() << " = " << modelSimulation.getName() << "(" << ExportStatement::getContextArgument( "" ) << ");\n";
 
 	preparation.addFunctionCall( evaluateObjective );
 	preparation.addFunctionCall( evaluateConstraints );
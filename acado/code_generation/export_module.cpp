@@ -67,6 +67,9 @@ returnValue ExportModule::setupOptions( )
 	addOption( LINEAR_ALGEBRA_SOLVER,       GAUSS_LU        );
 	addOption( UNROLL_LINEAR_SOLVER,       	false	    	);
 	addOption( NUM_INTEGRATOR_STEPS,        30              );
+	addOption( MAX_NUM_INTEGRATOR_STEPS,    100             );
+	addOption( INTEGRATOR_TOLERANCE,        1.0e-6          );
+	addOption( ABSOLUTE_TOLERANCE,          1.0e-8          );
 	addOption( MEASUREMENT_GRID, 			OFFLINE_GRID	);
 	addOption( INTEGRATOR_DEBUG_MODE, 		0				);
 	addOption( IMPLICIT_INTEGRATOR_MODE,	IFTR 			);
@@ -74,6 +77,7 @@ returnValue ExportModule::setupOptions( )
 	addOption( LIFTED_GRADIENT_UPDATE, 		false			);
 	addOption( IMPLICIT_INTEGRATOR_NUM_ITS,	5				);
 	addOption( IMPLICIT_INTEGRATOR_NUM_ITS_INIT, 0			);
+	addOption( IMPLICIT_INTEGRATOR_MAX_CONTRACTION, 0.5		);
 	addOption( SPARSE_QP_SOLUTION,          FULL_CONDENSING );
 	addOption( CONDENSING_BLOCK_SIZE,       0 				);
 	addOption( FIX_INITIAL_STATE,           true         	);
@@ -94,7 +98,11 @@ returnValue ExportModule::setupOptions( )
 	addOption( CG_USE_VARIABLE_WEIGHTING_MATRIX, NO         );
 	addOption( CG_COMPUTE_COVARIANCE_MATRIX,     NO         );
 	addOption( CG_USE_OPENMP,					 NO         );
+	addOption( CG_REENTRANT_CODE,				 NO         );
+	addOption( CG_BATCH_SIZE,					 0          );
 	addOption( CG_HARDCODE_CONSTRAINT_VALUES,    YES        );
+	addOption( CG_MULTIPLY_BLOCK_SIZE,           4          );
+	addOption( CG_SPARSE_SENSITIVITIES,          NO         );
 	addOption( CG_USE_ARRIVAL_COST,              NO         );
 
 	addOption( CG_CONDENSED_HESSIAN_CHOLESKY,    EXTERNAL   );
@@ -184,7 +184,21 @@ returnValue ExportNLPSolver::setupInitialization()
 
 	initialize << (retInit == 0);
 	initialize.addLinebreak();
-	initialize	<< "memset(&" << moduleName << "Workspace, 0, sizeof( " << moduleName << "Workspace ));" << "\n";
+	string workspaceName = moduleName + "Workspace";
+	if (ExportStatement::reentrantCode == true)
+		workspaceName = ExportStatement::getContextName() + "->workspace";
+
+	// The pages of the static workspace are placed on the NUMA node of the thread
+	// which touches them first, hence the per-interval blocks are touched by the
+	// threads that own the intervals before the serial memset.
+	int useOMP;
+	get(CG_USE_OPENMP, useOMP);
+	if (useOMP && ExportStatement::reentrantCode == false)
+	{
+		distributeWorkspace.setup( "distributeWorkspace" );
+		initialize.addFunctionCall( distributeWorkspace );
+	}
+	initialize	<< "memset(&" << workspaceName << ", 0, sizeof( " << workspaceName << " ));" << "\n";
 //	initialize	<< "memset(&" << moduleName << "Variables, 0, sizeof( " << moduleName << "Variables ));" << "\n";
 
 	return SUCCESSFUL_RETURN;
@@ -292,10 +306,15 @@ returnValue ExportNLPSolver::setupSimulation( void )
 	if ( useOMP )
 	{
 
-		modelSimulation
-			<< "#pragma omp parallel for private(" << run.getName() << ", " << state.getFullName()
-				<< ") shared(" << evGx.getDataStructString() << ", "
-				<< x.getDataStructString() << ")\n";
+		if (ExportStatement::reentrantCode == true)
+			modelSimulation
+				<< "#pragma omp parallel for private(" << run.getName() << ", " << state.getFullName()
+					<< ") shared(" << ExportStatement::getContextName() << ") schedule(static)\n";
+		else
+			modelSimulation
+				<< "#pragma omp parallel for private(" << run.getName() << ", " << state.getFullName()
+					<< ") shared(" << evGx.getDataStructString() << ", "
+					<< x.getDataStructString() << ") schedule(static)\n";
 	}
 
 	if (performsSingleShooting() == false)
@@ -321,15 +340,15 @@ returnValue ExportNLPSolver::setupSimulation( void )
 	{
 		if( (ImplicitIntegratorMode)intMode == LIFTED || (ImplicitIntegratorMode)intMode == LIFTED_FEEDBACK ) {
 			loop	<< retSim.getFullName() << " = "
-					<< moduleName << "_integrate" << "(" << state.getFullName()
+					<< moduleName << "_integrate" << "(" << ExportStatement::getContextArgument() << state.getFullName()
 					<< ", " << run.getFullName() << ");\n";
 		}
 		else if (performsSingleShooting() == false)
 			loop 	<< retSim.getFullName() << " = "
-				 	 << moduleName << "_integrate" << "(" << state.getFullName() << ", 1);\n";
+				 	 << moduleName << "_integrate" << "(" << ExportStatement::getContextArgument() << state.getFullName() << ", 1);\n";
 		else
 			loop 	<< retSim.getFullName() << " = " << moduleName << "_integrate"
-					<< "(" << state.getFullName() << ", "
+					<< "(" << ExportStatement::getContextArgument() << state.getFullName() << ", "
 					<< run.getFullName() << " == 0"
 					<< ");\n";
 	}
@@ -338,11 +357,11 @@ returnValue ExportNLPSolver::setupSimulation( void )
 		if (performsSingleShooting() == false)
 			loop 	<< retSim.getFullName() << " = "
 					<< moduleName << "_integrate"
-					<< "(" << state.getFullName() << ", 1, " << run.getFullName() << ");\n";
+					<< "(" << ExportStatement::getContextArgument() << state.getFullName() << ", 1, " << run.getFullName() << ");\n";
 		else
 			loop	<< retSim.getFullName() << " = "
 					<< moduleName << "_integrate"
-					<< "(" << state.getFullName() << ", "
+					<< "(" << ExportStatement::getContextArgument() << state.getFullName() << ", "
 					<< run.getFullName() << " == 0"
 					<< ", " << run.getFullName() << ");\n";
 	}
@@ -1701,11 +1720,11 @@ returnValue ExportNLPSolver::setupAuxiliaryFunctions()
 
 	if ( integrator->equidistantControlGrid() )
 	{
-		shiftStates << moduleName << "_integrate" << "(" << state.getFullName() << ", 1);\n";
+		shiftStates << moduleName << "_integrate" << "(" << ExportStatement::getContextArgument() << state.getFullName() << ", 1);\n";
 	}
 	else
 	{
-		shiftStates << moduleName << "_integrate" << "(" << state.getFullName() << ", 1, " << toString(N - 1) << ");\n";
+		shiftStates << moduleName << "_integrate" << "(" << ExportStatement::getContextArgument() << state.getFullName() << ", 1, " << toString(N - 1) << ");\n";
 	}
 
 	shiftStates.addLinebreak( );
@@ -1745,14 +1764,14 @@ returnValue ExportNLPSolver::setupAuxiliaryFunctions()
 	if ( integrator->equidistantControlGrid() )
 	{
 		iLoop << moduleName << "_integrate"
-				<< "(" << state.getFullName() << ", "
+				<< "(" << ExportStatement::getContextArgument() << state.getFullName() << ", "
 				<< index.getFullName() << " == 0"
 				<< ");\n";
 	}
 	else
 	{
 		iLoop << moduleName << "_integrate"
-				<< "(" << state.getFullName() << ", "
+				<< "(" << ExportStatement::getContextArgument() << state.getFullName() << ", "
 				<< index.getFullName() << " == 0"
 				<< ", " << index.getFullName() << ");\n";
 	}
@@ -1765,10 +1784,70 @@ returnValue ExportNLPSolver::setupAuxiliaryFunctions()
 
 	initializeNodes.addStatement( iLoop );
 
+	setupWorkspaceDistribution();
+
 	return setupGetObjective();
 }
 
 
+returnValue ExportNLPSolver::setupWorkspaceDistribution()
+{
+	if (distributeWorkspace.getName().empty() == true)
+		return SUCCESSFUL_RETURN;
+
+	distributeWorkspace.doc( "Zero the per-interval workspace blocks from the threads which own the intervals." );
+
+	ExportIndex run( "run" );
+	distributeWorkspace.addIndex( run );
+
+	// Blocks written per shooting interval by the parallel loops, the static
+	// schedule gives each thread the same intervals in all of them.
+	ExportVariable blocks[] = { evGx, evGu, d, Dy, Q1, Q2, R1, R2, S1 };
+
+	ExportForLoop loop(run, 0, N);
+	for (unsigned i = 0; i < sizeof( blocks ) / sizeof( blocks[ 0 ] ); ++i)
+	{
+		if (blocks[ i ].getDim() == 0 || blocks[ i ].isGiven() == true)
+			continue;
+		if (blocks[ i ].getDataStruct() != ACADO_WORKSPACE || blocks[ i ].getNumRows() % N != 0)
+			continue;
+
+		unsigned blockDim = blocks[ i ].getDim() / N;
+		loop	<< "memset(&" << blocks[ i ].getFullName() << "[ " << run.getName() << " * " << toString( blockDim )
+				<< " ], 0, " << toString( blockDim ) << " * sizeof( " << blocks[ i ].getFullName() << "[ 0 ] ));\n";
+	}
+
+	distributeWorkspace << "#pragma omp parallel for schedule(static)\n";
+	distributeWorkspace.addStatement( loop );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+bool ExportNLPSolver::setupThreadPrivateObjective()
+{
+	int useOMP;
+	get(CG_USE_OPENMP, useOMP);
+	if (useOMP == 0 || ExportStatement::reentrantCode == true)
+		return false;
+
+	objValueIn.setup(objValueIn.getName(), objValueIn.getNumRows(), objValueIn.getNumCols(), REAL, ACADO_LOCAL);
+	objValueOut.setup(objValueOut.getName(), objValueOut.getNumRows(), objValueOut.getNumCols(), REAL, ACADO_LOCAL);
+
+	if (objAuxVar.getDim() > 0)
+	{
+		objAuxVar.setup(objAuxVar.getName(), objAuxVar.getNumRows(), objAuxVar.getNumCols(), REAL, ACADO_LOCAL);
+
+		if (evaluateStageCost.isExternal() == false)
+			evaluateStageCost.setGlobalExportVariable( objAuxVar );
+		if (evaluateTerminalCost.isExternal() == false)
+			evaluateTerminalCost.setGlobalExportVariable( objAuxVar );
+	}
+
+	return true;
+}
+
+
 returnValue ExportNLPSolver::setupGetObjective(  )
 {
 	if( getNY() > 0 || getNYN() > 0 ) {
@@ -2011,9 +2090,9 @@ returnValue ExportNLPSolver::setupArrivalCostCalculation()
 	updateArrivalCost.addStatement( state.getCols(indexU, indexNOD) == od.getRow( 0 ) );
 
 	if (integrator->equidistantControlGrid())
-		updateArrivalCost << moduleName << "_integrate" << "(" << state.getFullName() << ", 1);\n";
+		updateArrivalCost << moduleName << "_integrate" << "(" << ExportStatement::getContextArgument() << state.getFullName() << ", 1);\n";
 	else
-		updateArrivalCost << moduleName << "_integrate" << "(" << state.getFullName() << ", 1, " << toString(0) << ");\n";
+		updateArrivalCost << moduleName << "_integrate" << "(" << ExportStatement::getContextArgument() << state.getFullName() << ", 1, " << toString(0) << ");\n";
 	updateArrivalCost.addLinebreak( );
 
 	//
@@ -224,6 +224,16 @@ protected:
 	/** Setup main initialization code for the solver */
 	virtual returnValue setupInitialization();
 
+	/** Setup of the first touch of the per-interval workspace blocks (OpenMP only). */
+	returnValue setupWorkspaceDistribution();
+
+	/** Moves the input, output and auxiliary buffers of the stage cost evaluation to
+	 *  thread-private storage when OpenMP is used.
+	 *
+	 *	\return true if the stage cost loop can be evaluated in parallel
+	 */
+	bool setupThreadPrivateObjective();
+
 protected:
 
 	/** \name Evaluation of model dynamics. */
@@ -234,6 +244,9 @@ protected:
 
 	ExportFunction modelSimulation;
 
+	/** Zeroes the per-interval workspace blocks from the OpenMP threads which own the intervals. */
+	ExportFunction distributeWorkspace;
+
 	ExportVariable state;
 	ExportVariable x;
 	ExportVariable z;
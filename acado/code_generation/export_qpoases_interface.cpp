@@ -81,6 +81,15 @@ returnValue ExportQpOasesInterface::configure(	const std::string& _prefix,
 
 	stringstream s, ctor;
 	string solverName;
+
+	// In reentrant code, the number of working set recalculations is stored in the context
+	string nWSR = ExportStatement::fcnPrefix + _prefix + "_nWSR";
+	string contextParameter = "void";
+	if (ExportStatement::reentrantCode == true)
+	{
+		nWSR = ExportStatement::getContextName() + "->nWSR";
+		contextParameter = "struct " + ExportStatement::varPrefix + "context_* const " + ExportStatement::getContextName();
+	}
 	if (ncmax > 0)
 	{
 		solverName = "QProblem";
@@ -89,7 +98,7 @@ returnValue ExportQpOasesInterface::configure(	const std::string& _prefix,
 		if (_externalCholesky == false)
 			s << _qpR << ", ";
 		s	<< _qpg << ", " << _qpA << ", " << _qplb << ", " << _qpub << ", "
-			<< _qplbA << ", " << _qpubA << ", " << ExportStatement::fcnPrefix << _prefix << "_nWSR";
+			<< _qplbA << ", " << _qpubA << ", " << nWSR;
 
 		if ( (bool)_hotstartQP == true )
 			s << ", " << _dualSolution;
@@ -103,7 +112,7 @@ returnValue ExportQpOasesInterface::configure(	const std::string& _prefix,
 		s	<< _qpH << ", ";
 		if (_externalCholesky == false)
 			s << _qpR << ", ";
-		s	<< _qpg << ", " << _qplb << ", " << _qpub << ", " << ExportStatement::fcnPrefix << _prefix << "_nWSR";
+		s	<< _qpg << ", " << _qplb << ", " << _qpub << ", " << nWSR;
 
 		if ( (bool)_hotstartQP == true )
 			s << ", " << _dualSolution;
@@ -120,6 +129,8 @@ returnValue ExportQpOasesInterface::configure(	const std::string& _prefix,
 	qpoSource.dictionary[ "@DUAL_SOLUTION@" ] =  _dualSolution;
 	qpoSource.dictionary[ "@CTOR@" ] =  ctor.str();
 	qpoSource.dictionary[ "@SIGMA@" ] =  _sigma;
+	qpoSource.dictionary[ "@NWSR@" ] =  nWSR;
+	qpoSource.dictionary[ "@CONTEXT_PARAMETER@" ] =  contextParameter;
     qpoSource.dictionary[ "@MODULE_NAME@" ] = ExportStatement::fcnPrefix;
     qpoSource.dictionary[ "@MODULE_PREFIX@" ] = ExportStatement::varPrefix;
 
@@ -136,6 +147,7 @@ returnValue ExportQpOasesInterface::configure(	const std::string& _prefix,
     
 	qpoHeader.dictionary[ "@PREFIX@" ] =  _prefix;
 	qpoHeader.dictionary[ "@SOLVER_DEFINE@" ] =  _solverDefine;
+	qpoHeader.dictionary[ "@CONTEXT_PARAMETER@" ] =  contextParameter;
 
 	qpoHeader.dictionary[ "@NVMAX@" ] = toString( nvmax );
 
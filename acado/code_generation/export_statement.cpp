@@ -38,6 +38,7 @@ BEGIN_NAMESPACE_ACADO
 
 std::string ExportStatement::fcnPrefix = "acado";
 std::string ExportStatement::varPrefix = "ACADO";
+bool ExportStatement::reentrantCode = false;
         
 //
 // PUBLIC MEMBER FUNCTIONS:
@@ -72,6 +73,30 @@ ExportStatement& ExportStatement::operator=(	const ExportStatement& arg
 
 
 
+std::string ExportStatement::getContextName( )
+{
+	return fcnPrefix + "Context";
+}
+
+
+std::string ExportStatement::getContextArgument( const std::string& _separator )
+{
+	if (reentrantCode == false)
+		return std::string();
+
+	return getContextName() + _separator;
+}
+
+
+std::string ExportStatement::getContextParameter( const std::string& _separator )
+{
+	if (reentrantCode == false)
+		return std::string();
+
+	return varPrefix + "context* const " + getContextName() + _separator;
+}
+
+
 returnValue ExportStatement::exportDataDeclaration(	std::ostream& stream,
 													const std::string& _realString,
 													const std::string& _intString,
@@ -153,6 +153,27 @@ class ExportStatement
     public:
         static std::string fcnPrefix;
         static std::string varPrefix;
+
+        /** Flag indicating that reentrant code is exported, i.e. that all   \n
+         *  data is stored in a context struct, a pointer to which is passed \n
+         *  as first argument to every exported function.                    \n
+         */
+        static bool reentrantCode;
+
+        /** Returns the name of the context pointer (e.g. "acadoContext"). */
+        static std::string getContextName( );
+
+        /** Returns the context pointer followed by the given separator, to be \n
+         *  used as first argument of a function call; empty if non-reentrant  \n
+         *  code is exported.                                                  \n
+         */
+        static std::string getContextArgument( const std::string& _separator = ", " );
+
+        /** Returns the declaration of the context pointer followed by the     \n
+         *  given separator, to be used as first parameter of a function       \n
+         *  definition; empty if non-reentrant code is exported.               \n
+         */
+        static std::string getContextParameter( const std::string& _separator = ", " );
 };
 
 
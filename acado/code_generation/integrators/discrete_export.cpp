@@ -355,9 +355,9 @@ returnValue DiscreteTimeExport::getCode(	ExportStatementBlock& code
 		getDataDeclarations( code, ACADO_LOCAL );
 
 		stringstream s;
-		s << "#pragma omp threadprivate( "
-				<< max.getFullName() << ", "
-				<< rk_xxx.getFullName();
+		s << "#pragma omp threadprivate( ";
+		if( max.getDim() > 0 ) s << max.getFullName() << ", ";
+		s << rk_xxx.getFullName();
 		if( NX1 > 0 ) {
 			if( grid.getNumIntervals() > 1 || !equidistantControlGrid() ) s << ", " << rk_diffsPrev1.getFullName();
 			s << ", " << rk_diffsNew1.getFullName();
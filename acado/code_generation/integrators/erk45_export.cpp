@@ -0,0 +1,131 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/code_generation/erk45_export.cpp
+ */
+
+#include <acado/code_generation/integrators/erk45_export.hpp>
+
+#include <acado/code_generation/export_algorithm_factory.hpp>
+
+BEGIN_NAMESPACE_ACADO
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+ExplicitRungeKutta45Export::ExplicitRungeKutta45Export(	UserInteraction* _userInteraction,
+									const std::string& _commonHeaderName
+									) : ExplicitRungeKuttaExport( _userInteraction,_commonHeaderName )
+{
+}
+
+
+ExplicitRungeKutta45Export::ExplicitRungeKutta45Export(	const ExplicitRungeKutta45Export& arg
+									) : ExplicitRungeKuttaExport( arg )
+{
+	copy( arg );
+}
+
+
+ExplicitRungeKutta45Export::~ExplicitRungeKutta45Export( )
+{
+	clear( );
+}
+
+
+// PROTECTED:
+
+//
+// Register the integrator
+//
+
+
+IntegratorExport* createExplicitRungeKutta45Export(	UserInteraction* _userInteraction,
+													const std::string &_commonHeaderName)
+{
+	DMatrix AA(7,7);
+	DVector bb(7);
+	DVector bb4(7);
+	DVector cc(7);
+
+	AA.setZero();
+
+	AA(1,0) = 1.0/5.0;
+	AA(2,0) = 3.0/40.0;			AA(2,1) = 9.0/40.0;
+	AA(3,0) = 44.0/45.0;		AA(3,1) = -56.0/15.0;		AA(3,2) = 32.0/9.0;
+	AA(4,0) = 19372.0/6561.0;	AA(4,1) = -25360.0/2187.0;	AA(4,2) = 64448.0/6561.0;	AA(4,3) = -212.0/729.0;
+	AA(5,0) = 9017.0/3168.0;	AA(5,1) = -355.0/33.0;		AA(5,2) = 46732.0/5247.0;	AA(5,3) = 49.0/176.0;	AA(5,4) = -5103.0/18656.0;
+	AA(6,0) = 35.0/384.0;		AA(6,1) = 0.0;				AA(6,2) = 500.0/1113.0;		AA(6,3) = 125.0/192.0;	AA(6,4) = -2187.0/6784.0;	AA(6,5) = 11.0/84.0;
+
+	bb(0) = 35.0/384.0;
+	bb(1) = 0.0;
+	bb(2) = 500.0/1113.0;
+	bb(3) = 125.0/192.0;
+	bb(4) = -2187.0/6784.0;
+	bb(5) = 11.0/84.0;
+	bb(6) = 0.0;
+
+	bb4(0) = 5179.0/57600.0;
+	bb4(1) = 0.0;
+	bb4(2) = 7571.0/16695.0;
+	bb4(3) = 393.0/640.0;
+	bb4(4) = -92097.0/339200.0;
+	bb4(5) = 187.0/2100.0;
+	bb4(6) = 1.0/40.0;
+
+	cc(0) = 0.0;
+	cc(1) = 1.0/5.0;
+	cc(2) = 3.0/10.0;
+	cc(3) = 4.0/5.0;
+	cc(4) = 8.0/9.0;
+	cc(5) = 1.0;
+	cc(6) = 1.0;
+
+	int sensGen;
+	_userInteraction->get( DYNAMIC_SENSITIVITY, sensGen );
+	int liftedGen;
+	_userInteraction->get( IMPLICIT_INTEGRATOR_MODE, liftedGen );
+
+	// the step size control is only exported by the plain explicit integrator:
+	if( (ImplicitIntegratorMode)liftedGen == LIFTED || ((ExportSensitivityType)sensGen != FORWARD && (ExportSensitivityType)sensGen != NO_SENSITIVITY) )
+		ACADOERRORTEXT( RET_INVALID_OPTION, "The adaptive explicit integrator supports forward sensitivities only." );
+
+	ExplicitRungeKuttaExport* integrator = createExplicitRungeKuttaExport(_userInteraction, _commonHeaderName);
+	integrator->initializeButcherTableau(AA, bb, cc);
+	integrator->setEmbeddedWeights(bb4, 4);
+
+	return integrator;
+}
+
+CLOSE_NAMESPACE_ACADO
+
+
+
+// end of file.
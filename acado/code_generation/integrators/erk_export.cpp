@@ -46,6 +46,7 @@ ExplicitRungeKuttaExport::ExplicitRungeKuttaExport(	UserInteraction* _userIntera
 									) : RungeKuttaExport( _userInteraction,_commonHeaderName )
 {
 	is_symmetric = BT_FALSE;
+	orderEmbedded = 0;
 }
 
 
@@ -53,6 +54,13 @@ ExplicitRungeKuttaExport::ExplicitRungeKuttaExport(	const ExplicitRungeKuttaExpo
 									) : RungeKuttaExport( arg )
 {
 	copy( arg );
+
+	bbEmbedded = arg.bbEmbedded;
+	orderEmbedded = arg.orderEmbedded;
+
+	rk_hhh = arg.rk_hhh;
+	rk_dxx = arg.rk_dxx;
+	rk_err = arg.rk_err;
 }
 
 
@@ -99,6 +107,12 @@ returnValue ExplicitRungeKuttaExport::setup( )
 	rk_xxx.setup("rk_xxx", 1, inputDim+timeDep, REAL, structWspace);
 	rk_kkk.setup("rk_kkk", rkOrder, rhsDim, REAL, structWspace);
 
+	if( isAdaptive() ) {
+		rk_hhh.setup( "rk_hhh", 1, 1, REAL, structWspace, true );
+		rk_dxx.setup( "rk_dxx", 1, rhsDim, REAL, structWspace );
+		rk_err.setup( "rk_err", 1, NX, REAL, structWspace );
+	}
+
 	if ( useOMP )
 	{
 		ExportVariable auxVar;
@@ -153,6 +167,14 @@ returnValue ExplicitRungeKuttaExport::setup( )
 	}
 	integrate.addLinebreak( );
 
+	if( isAdaptive() ) {
+		setupAdaptiveLoop( run, numInt, rhsDim );
+
+		LOG( LVL_DEBUG ) << "done" << endl;
+
+		return SUCCESSFUL_RETURN;
+	}
+
     // integrator loop
 	ExportForLoop loop;
 	if( equidistantControlGrid() ) {
@@ -187,6 +209,23 @@ returnValue ExplicitRungeKuttaExport::setup( )
 }
 
 
+returnValue ExplicitRungeKuttaExport::setEmbeddedWeights( const DVector& _bb, uint _order )
+{
+	if( _bb.getDim() != bb.getDim() || _order == 0 ) return RET_INVALID_OPTION;
+
+	bbEmbedded = _bb;
+	orderEmbedded = _order;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+bool ExplicitRungeKuttaExport::isAdaptive( ) const
+{
+	return ( bbEmbedded.isEmpty() == BT_FALSE );
+}
+
+
 returnValue ExplicitRungeKuttaExport::setDifferentialEquation(	const Expression& rhs_ )
 {
 	int sensGen;
@@ -232,16 +271,31 @@ returnValue ExplicitRungeKuttaExport::setDifferentialEquation(	const Expression&
 		/*	if ( f.getDim() != f.getNX() )
 		return ACADOERROR( RET_ILLFORMED_ODE );*/
 
-		// add VDE for differential states
-		f << multipleForwardDerivative( rhs_, x, Gx );
-		/*	if ( f.getDim() != f.getNX() )
-		return ACADOERROR( RET_ILLFORMED_ODE );*/
+		int sparseSensitivities;
+		get( CG_SPARSE_SENSITIVITIES,sparseSensitivities );
 
+		if( (bool)sparseSensitivities == true ) {
+			// sensitivities that are structurally zero over the whole interval
+			// are replaced by zero seeds, such that the corresponding terms of
+			// the VDE vanish in the exported code
+			DMatrix patternX, patternU;
+			getSensitivityPattern( rhs_, patternX, patternU );
 
-		// add VDE for control inputs
-		f << multipleForwardDerivative( rhs_, x, Gu ) + forwardDerivative( rhs_, u );
-		// 	if ( f.getDim() != f.getNX() )
-		// 		return ACADOERROR( RET_ILLFORMED_ODE );
+			f << multipleForwardDerivative( rhs_, x, getSparseSeed( Gx,patternX ) );
+			f << multipleForwardDerivative( rhs_, x, getSparseSeed( Gu,patternU ) ) + forwardDerivative( rhs_, u );
+		}
+		else {
+			// add VDE for differential states
+			f << multipleForwardDerivative( rhs_, x, Gx );
+			/*	if ( f.getDim() != f.getNX() )
+			return ACADOERROR( RET_ILLFORMED_ODE );*/
+
+
+			// add VDE for control inputs
+			f << multipleForwardDerivative( rhs_, x, Gu ) + forwardDerivative( rhs_, u );
+			// 	if ( f.getDim() != f.getNX() )
+			// 		return ACADOERROR( RET_ILLFORMED_ODE );
+		}
 
 		// no free parameters yet!
 		// f << forwardDerivative( rhs_, x ) * Gp + forwardDerivative( rhs_, p );
@@ -298,6 +352,12 @@ returnValue ExplicitRungeKuttaExport::getDataDeclarations(	ExportStatementBlock&
 	declarations.addDeclaration( rk_xxx,dataStruct );
 	declarations.addDeclaration( rk_kkk,dataStruct );
 
+	if( isAdaptive() ) {
+		declarations.addDeclaration( rk_hhh,dataStruct );
+		declarations.addDeclaration( rk_dxx,dataStruct );
+		declarations.addDeclaration( rk_err,dataStruct );
+	}
+
 //	declarations.addDeclaration( reset_int,dataStruct );
 
 	return SUCCESSFUL_RETURN;
@@ -331,12 +391,17 @@ returnValue ExplicitRungeKuttaExport::getCode(	ExportStatementBlock& code
 	{
 		getDataDeclarations( code, ACADO_LOCAL );
 
-		code << "#pragma omp threadprivate( "
-				<< getAuxVariable().getFullName()  << ", "
-				<< rk_xxx.getFullName() << ", "
+		code << "#pragma omp threadprivate( ";
+		if( exportRhs && getAuxVariable().getDim() > 0 )
+			code << getAuxVariable().getFullName()  << ", ";
+		code << rk_xxx.getFullName() << ", "
 				<< rk_ttt.getFullName() << ", "
-				<< rk_kkk.getFullName()
-				<< " )\n\n";
+				<< rk_kkk.getFullName();
+		if( isAdaptive() )
+			code << ", " << rk_hhh.getFullName()
+				 << ", " << rk_dxx.getFullName()
+				 << ", " << rk_err.getFullName();
+		code << " )\n\n";
 	}
 
 	int sensGen;
@@ -347,7 +412,10 @@ returnValue ExplicitRungeKuttaExport::getCode(	ExportStatementBlock& code
 	}
 
 	double h = (grid.getLastTime() - grid.getFirstTime())/grid.getNumIntervals();
-	code.addComment(std::string("Fixed step size:") + toString(h));
+	if( isAdaptive() )
+		code.addComment(std::string("Adaptive step size, initial step size:") + toString(h));
+	else
+		code.addComment(std::string("Fixed step size:") + toString(h));
 	code.addFunction( integrate );
 
 
@@ -398,6 +466,178 @@ ExportVariable ExplicitRungeKuttaExport::getAuxVariable() const
 // PROTECTED:
 
 
+returnValue ExplicitRungeKuttaExport::getSensitivityPattern(	const Expression& rhs_,
+																DMatrix& patternX,
+																DMatrix& patternU
+																) const
+{
+	DMatrix patternA = jacobian( rhs_, x ).getSparsityPattern();
+	DMatrix patternB = jacobian( rhs_, u ).getSparsityPattern();
+
+	// The sensitivities w.r.t. the states have the structure of the reflexive
+	// transitive closure of the Jacobian pattern, independently of the number
+	// of stages and integration steps:
+	patternX = eye<double>( NX );
+
+	bool changed = true;
+	while( changed == true ) {
+		DMatrix next = patternA*patternX + patternX;
+		changed = false;
+
+		for( uint i = 0; i < NX; i++ ) {
+			for( uint j = 0; j < NX; j++ ) {
+				if( next(i,j) != 0.0 && patternX(i,j) == 0.0 ) {
+					patternX(i,j) = 1.0;
+					changed = true;
+				}
+			}
+		}
+	}
+
+	// ... while the control sensitivities propagate the control Jacobian:
+	patternU = patternX*patternB;
+
+	for( uint i = 0; i < NX; i++ )
+		for( uint j = 0; j < NU; j++ )
+			patternU(i,j) = patternU(i,j) != 0.0 ? 1.0 : 0.0;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue ExplicitRungeKuttaExport::setupAdaptiveLoop(	const ExportIndex& run,
+															const ExportVariable& numInt,
+															uint rhsDim
+															)
+{
+	const uint rkOrder = getNumStages();
+
+	int maxNumSteps;
+	get( MAX_NUM_INTEGRATOR_STEPS,maxNumSteps );
+	double relTol, absTol;
+	get( INTEGRATOR_TOLERANCE,relTol );
+	get( ABSOLUTE_TOLERANCE,absTol );
+
+	if( maxNumSteps <= 0 || relTol <= 0.0 || absTol < 0.0 ) return ACADOERROR( RET_INVALID_OPTION );
+
+	// step sizes are measured relative to the length of the integration grid,
+	// the stages are scaled by the actual step size once they are evaluated:
+	double length = grid.getLastTime() - grid.getFirstTime();
+
+	DVector bbError = bb;
+	bbError -= bbEmbedded;
+
+	ExportVariable A( "A", AA );
+	ExportVariable b( "b", DMatrix( bb ) );
+	ExportVariable e( "e", DMatrix( bbError ) );
+	ExportVariable L( "L", DMatrix( length ) );
+
+	ExportVariable stp( "rk_stp", 1, 1, REAL, ACADO_LOCAL, true );
+	ExportVariable h  ( "rk_h",   1, 1, REAL, ACADO_LOCAL, true );
+	ExportVariable rem( "rk_rem", 1, 1, REAL, ACADO_LOCAL, true );
+	ExportVariable nrm( "rk_nrm", 1, 1, REAL, ACADO_LOCAL, true );
+	ExportVariable fac( "rk_fac", 1, 1, REAL, ACADO_LOCAL, true );
+	integrate.addDeclaration( stp );
+	integrate.addDeclaration( h );
+	integrate.addDeclaration( rem );
+	integrate.addDeclaration( nrm );
+	integrate.addDeclaration( fac );
+
+	ExportIndex run2( "run2" );
+	integrate.addIndex( run2 );
+
+	const std::string lastStep = run.getName() + " == " + toString( maxNumSteps-1 );
+
+	// the step size is kept from the previous call, unless the integrator is reset:
+	integrate.addStatement( std::string( "if( " ) + reset_int.getFullName() + " || " + rk_hhh.getFullName() + " <= 0.0 ) {\n" );
+	integrate.addStatement( rk_hhh == DMatrix( 1.0/grid.getNumIntervals() ) );
+	integrate.addStatement( std::string( "}\n" ) );
+	if( equidistantControlGrid() ) {
+		integrate.addStatement( rem == DMatrix( 1.0 ) );
+	}
+	else {
+		integrate.addStatement( rem.getFullName() + " = (real_t)" + numInt.getName() + "/" + toString( grid.getNumIntervals() ) + ";\n" );
+	}
+	integrate.addStatement( error_code == 0 );
+	integrate.addLinebreak( );
+
+	// the number of steps is bounded: the last one covers the rest of the interval
+	ExportForLoop loop( run, 0, maxNumSteps );
+	loop.addStatement( stp == rk_hhh );
+	loop << "if( " << stp.getFullName() << " > " << rem.getFullName() << " - 1.0e-10 || " << lastStep << " ) "
+		 << stp.getFullName() << " = " << rem.getFullName() << ";\n";
+	loop.addStatement( h == stp*L );
+
+	for( uint run1 = 0; run1 < rkOrder; run1++ )
+	{
+		loop.addStatement( rk_xxx.getCols( 0,rhsDim ) == rk_eta.getCols( 0,rhsDim ) + A.getRow(run1)*rk_kkk );
+		if( timeDependant ) loop.addStatement( rk_xxx.getCol( inputDim ) == rk_ttt + ExportVariable( cc(run1) )*stp );
+		loop.addFunctionCall( getNameDiffsRHS(),rk_xxx,rk_kkk.getAddress(run1,0) );
+
+		ExportForLoop scale( run2, 0, rhsDim );
+		scale << rk_kkk.get( run1,run2 ) << " *= " << h.getFullName() << ";\n";
+		loop.addStatement( scale );
+	}
+	loop.addStatement( rk_dxx == (b^rk_kkk) );
+	loop.addStatement( rk_err == (e^rk_kkk.getCols( 0,NX )) );
+
+	// weighted maximum norm of the error estimate of the states
+	loop.addStatement( nrm == DMatrix( 0.0 ) );
+	ExportForLoop norm( run2, 0, NX );
+	norm << fac.getFullName() << " = fabs(" << rk_err.get( 0,run2 ) << ")/(" << toString( absTol ) << " + "
+		 << toString( relTol ) << "*fabs(" << rk_eta.get( 0,run2 ) << "));\n";
+	norm << "if( " << fac.getFullName() << " > " << nrm.getFullName() << " ) " << nrm.getFullName() << " = " << fac.getFullName() << ";\n";
+	loop.addStatement( norm );
+
+	// accept the step (states and sensitivities together)
+	loop << "if( " << nrm.getFullName() << " <= 1.0 || " << lastStep << " ) {\n";
+	loop.addStatement( rk_eta.getCols( 0,rhsDim ) += rk_dxx );
+	loop.addStatement( rk_ttt += stp );
+	loop.addStatement( rem -= stp );
+	loop << "if( " << nrm.getFullName() << " > 1.0 ) " << error_code.getFullName() << " = 1;\n";
+	loop << "}\n";
+
+	// propose the next step size
+	loop << fac.getFullName() << " = " << nrm.getFullName() << " > 1.0e-10 ? 0.9*pow(" << nrm.getFullName() << ", "
+		 << toString( -1.0/(orderEmbedded+1.0) ) << ") : 5.0;\n";
+	loop << "if( " << fac.getFullName() << " < 0.2 ) " << fac.getFullName() << " = 0.2;\n";
+	loop << "if( " << fac.getFullName() << " > 5.0 ) " << fac.getFullName() << " = 5.0;\n";
+	loop << "if( " << nrm.getFullName() << " <= 1.0 && " << stp.getFullName() << " < " << rk_hhh.getFullName() << " ) {\n";
+	loop << "if( " << stp.getFullName() << "*" << fac.getFullName() << " > " << rk_hhh.getFullName() << " ) "
+		 << rk_hhh.getFullName() << " = " << stp.getFullName() << "*" << fac.getFullName() << ";\n";
+	loop << "} else {\n";
+	loop << rk_hhh.getFullName() << " = " << stp.getFullName() << "*" << fac.getFullName() << ";\n";
+	loop << "}\n";
+	loop << "if( " << rem.getFullName() << " <= 0.0 ) break;\n";
+
+	integrate.addStatement( loop );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+Expression ExplicitRungeKuttaExport::getSparseSeed(	const Expression& G,
+														const DMatrix& pattern
+														) const
+{
+	Expression seed;
+
+	for( uint j = 0; j < G.getNumCols(); j++ ) {
+		Expression column;
+
+		for( uint i = 0; i < G.getNumRows(); i++ ) {
+			if( pattern(i,j) != 0.0 )
+				column << G(i,j);
+			else
+				column << Expression( 0.0 );
+		}
+		seed.appendCols( column );
+	}
+
+	return seed;
+}
+
+
 
 CLOSE_NAMESPACE_ACADO
 
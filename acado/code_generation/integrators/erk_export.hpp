@@ -87,6 +87,26 @@ class ExplicitRungeKuttaExport : public RungeKuttaExport
 		virtual returnValue setup( );
 
 
+		/** Sets the weights of an embedded method of lower order. The difference of both
+		 *  solutions serves as an error estimate, with which the exported integrator adapts
+		 *  its step size to the tolerances INTEGRATOR_TOLERANCE and ABSOLUTE_TOLERANCE.
+		 *
+		 *	@param[in] _bb		Weights of the embedded method.
+		 *	@param[in] _order	Order of the embedded method.
+		 *
+		 *	\return SUCCESSFUL_RETURN, \n
+		 *	        RET_INVALID_OPTION
+		 */
+		returnValue setEmbeddedWeights( const DVector& _bb, uint _order );
+
+
+		/** Returns whether the exported integrator adapts its step size.
+		 *
+		 *	\return true iff an embedded method has been set
+		 */
+		bool isAdaptive( ) const;
+
+
 		/** Assigns Differential Equation to be used by the integrator.
 		 *
 		 *	@param[in] rhs		Right-hand side expression.
@@ -209,8 +229,50 @@ class ExplicitRungeKuttaExport : public RungeKuttaExport
 		virtual ExportVariable getAuxVariable() const;
 
 
+		/** Determines the structural sparsity of the sensitivities w.r.t. \n
+		 *  the differential states and the controls over one interval.    \n
+		 *                                                                 \n
+		 *  \param rhs_      The right-hand side of the ODE.               \n
+		 *  \param patternX  Structural nonzeros of the state sensitivities.\n
+		 *  \param patternU  Structural nonzeros of the control sensitivities.\n
+		 *                                                                 \n
+		 *  \return SUCCESSFUL_RETURN                                      \n
+		 */
+		returnValue getSensitivityPattern(	const Expression& rhs_,
+											DMatrix& patternX,
+											DMatrix& patternU
+											) const;
+
+		/** Returns a copy of the seed matrix G in which all entries that  \n
+		 *  are structurally zero according to the given pattern are       \n
+		 *  replaced by zero constants.                                    \n
+		 */
+		Expression getSparseSeed(	const Expression& G,
+									const DMatrix& pattern
+									) const;
+
+		/** Exports the integrator loop with adaptive step size control.
+		 *
+		 *	@param[in] run			Index of the integrator steps.
+		 *	@param[in] numInt		Number of nominal steps (non-equidistant control grid only).
+		 *	@param[in] rhsDim		Dimension of the integrated variables.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue setupAdaptiveLoop(	const ExportIndex& run,
+										const ExportVariable& numInt,
+										uint rhsDim
+										);
+
+
     protected:
 
+		DVector bbEmbedded;					/**< Weights of the embedded method (adaptive step size only). */
+		uint orderEmbedded;					/**< Order of the embedded method. */
+
+		ExportVariable	rk_hhh;				/**< Step size of the adaptive integrator, kept between calls. */
+		ExportVariable	rk_dxx;				/**< Increment of the current step. */
+		ExportVariable	rk_err;				/**< Error estimate of the current step. */
 
 };
 
@@ -57,7 +57,9 @@ enum ExportIntegratorType{
      INT_DIRK5,				/**< Diagonally Implicit 5-stage Runge-Kutta integrator of order 5 (Continuous output). */
 
      INT_DT,				/**< An algorithm which handles the simulation and sensitivity generation for a discrete time state-space model. */
-     INT_NARX				/**< An algorithm which handles the simulation and sensitivity generation for a NARX model. */
+     INT_NARX,				/**< An algorithm which handles the simulation and sensitivity generation for a NARX model. */
+
+     INT_DOPRI45			/**< Explicit Runge-Kutta integrator of order 5 with embedded error estimate and adaptive step size (Dormand-Prince). */
 };
 
 /**  Summarizes all possible sensitivity generation types for exported integrators.  */
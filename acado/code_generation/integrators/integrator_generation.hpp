@@ -44,6 +44,7 @@
    #include <acado/code_generation/integrators/erk2_export.hpp>
    #include <acado/code_generation/integrators/erk3_export.hpp>
    #include <acado/code_generation/integrators/erk4_export.hpp>
+   #include <acado/code_generation/integrators/erk45_export.hpp>
    #include <acado/code_generation/integrators/irk_export.hpp>
    #include <acado/code_generation/integrators/gauss_legendre2_export.hpp>
    #include <acado/code_generation/integrators/gauss_legendre4_export.hpp>
@@ -59,6 +59,7 @@ ImplicitRungeKuttaExport::ImplicitRungeKuttaExport(	UserInteraction* _userIntera
 	numIts = 3; 		// DEFAULT value
 	numItsInit = 0; 	// DEFAULT value
 	REUSE = true;
+	REUSE_FACTORIZATION = false;
 	CONTINUOUS_OUTPUT = false;
 
 	solver = 0;
@@ -84,6 +85,7 @@ ImplicitRungeKuttaExport::ImplicitRungeKuttaExport( const ImplicitRungeKuttaExpo
 	outputGrids = arg.outputGrids;
     solver = arg.solver;
 	REUSE = arg.REUSE;;
+	REUSE_FACTORIZATION = arg.REUSE_FACTORIZATION;
 	CONTINUOUS_OUTPUT = arg.CONTINUOUS_OUTPUT;
 }
 
@@ -149,6 +151,10 @@ returnValue ImplicitRungeKuttaExport::setDifferentialEquation(	const Expression&
 
 		if( f.getNT() > 0 ) timeDependant = true;
 
+		patternX = rhs_.getDependencyPattern( x ).getCols( NX1,NX1+NX2-1 );
+		patternZ = rhs_.getDependencyPattern( z );
+		if( NDX2 > 0 ) patternDX = rhs_.getDependencyPattern( dx ).getCols( NX1,NX1+NX2-1 );
+
 		return (rhs.init( f,"rhs", NX,NXA,NU,NP,NDX,NOD ) &
 				diffs_rhs.init( g,"diffs", NX,NXA,NU,NP,NDX,NOD ) );
 	}
@@ -220,6 +226,10 @@ returnValue ImplicitRungeKuttaExport::getDataDeclarations(	ExportStatementBlock&
 	declarations.addDeclaration( rk_A,dataStruct );
 	declarations.addDeclaration( rk_b,dataStruct );
 	declarations.addDeclaration( rk_auxSolver,dataStruct );
+	if( REUSE_FACTORIZATION ) {
+		declarations.addDeclaration( rk_factorized,dataStruct );
+		declarations.addDeclaration( rk_newtonNorm,dataStruct );
+	}
 	declarations.addDeclaration( rk_rhsTemp,dataStruct );
 	declarations.addDeclaration( rk_diffsTemp2,dataStruct );
 	
@@ -280,9 +290,9 @@ returnValue ImplicitRungeKuttaExport::getCode(	ExportStatementBlock& code )
 		getDataDeclarations( code, ACADO_LOCAL );
 
 		stringstream s;
-		s << "#pragma omp threadprivate( "
-				<< max.getFullName() << ", "
-				<< rk_ttt.getFullName() << ", "
+		s << "#pragma omp threadprivate( ";
+		if( max.getDim() > 0 ) s << max.getFullName() << ", ";
+		s << rk_ttt.getFullName() << ", "
 				<< rk_xxx.getFullName() << ", "
 				<< rk_kkk.getFullName() << ", "
 				<< rk_rhsTemp.getFullName() << ", "
@@ -291,6 +301,7 @@ returnValue ImplicitRungeKuttaExport::getCode(	ExportStatementBlock& code )
 			s << ", " << rk_A.getFullName();
 			s << ", " << rk_b.getFullName();
 			s << ", " << rk_diffsTemp2.getFullName();
+			if( REUSE_FACTORIZATION ) s << ", " << rk_factorized.getFullName() << ", " << rk_newtonNorm.getFullName();
 			solver->appendVariableNames( s );
 		}
 		s << " )" << endl << endl;
@@ -546,6 +557,33 @@ returnValue ImplicitRungeKuttaExport::prepareOutputSystem(	ExportStatementBlock&
 }
 
 
+DMatrix ImplicitRungeKuttaExport::getNewtonMatrixPattern( ) const {
+	DMatrix pattern;
+	if( patternX.getNumRows() != NX2+NXA || patternZ.getNumCols() != NXA || (NDX2 > 0 && patternDX.getNumRows() != NX2+NXA) ) {
+		return pattern;		// e.g. an external model: no sparsity information
+	}
+
+	uint i, j, k, l;
+	pattern = zeros<double>( numStages*(NX2+NXA), numStages*(NX2+NXA) );
+	for( i = 0; i < numStages; i++ ) {
+		for( k = 0; k < NX2+NXA; k++ ) {
+			for( j = 0; j < numStages; j++ ) {
+				for( l = 0; l < NX2; l++ ) {
+					if( AA(i,j) != 0.0 && patternX(k,l) != 0.0 ) pattern( i*(NX2+NXA)+k,j*NX2+l ) = 1.0;
+					if( i == j && NDX2 == 0 && k == l ) pattern( i*(NX2+NXA)+k,j*NX2+l ) = 1.0;
+					if( i == j && NDX2 > 0 && patternDX(k,l) != 0.0 ) pattern( i*(NX2+NXA)+k,j*NX2+l ) = 1.0;
+				}
+			}
+			for( l = 0; l < NXA; l++ ) {
+				if( patternZ(k,l) != 0.0 ) pattern( i*(NX2+NXA)+k,numStages*NX2+i*NXA+l ) = 1.0;
+			}
+		}
+	}
+
+	return pattern;
+}
+
+
 DMatrix ImplicitRungeKuttaExport::formMatrix( const DMatrix& mass, const DMatrix& jacobian ) {
 	if( jacobian.getNumRows() != jacobian.getNumCols() ) {
 		return RET_UNABLE_TO_EXPORT_CODE;
@@ -604,19 +642,24 @@ returnValue ImplicitRungeKuttaExport::solveImplicitSystem( ExportStatementBlock*
 {
 	if( NX2 > 0 || NXA > 0 ) {
 
-		if( DERIVATIVES && REUSE ) block->addStatement( std::string( "if( " ) + reset_int.getFullName() + " ) {\n" );
+		if( REUSE_FACTORIZATION ) block->addStatement( std::string( "if( !" ) + rk_factorized.getFullName() + " ) {\n" );
+		else if( DERIVATIVES && REUSE ) block->addStatement( std::string( "if( " ) + reset_int.getFullName() + " ) {\n" );
 		// Initialization iterations:
 		ExportForLoop loop1( index1,0,numItsInit+1 ); // NOTE: +1 because 0 will lead to NaNs, so the minimum number of iterations is 1 at the initialization
 		ExportForLoop loop11( index2,0,numStages );
 		evaluateMatrix( &loop11, index2, index3, tmp_index, k_index, rk_A, Ah, C, true, DERIVATIVES );
 		loop1.addStatement( loop11 );
-		loop1.addStatement( det.getFullName() + " = " + ExportStatement::fcnPrefix + "_" + solver->getNameSolveFunction() + "( " + rk_A.getFullName() + ", " + rk_b.getFullName() + ", " + rk_auxSolver.getFullName() + " );\n" );
+		loop1.addStatement( det.getFullName() + " = " + ExportStatement::fcnPrefix + "_" + solver->getNameSolveFunction() + "( " + ExportStatement::getContextArgument() + rk_A.getFullName() + ", " + rk_b.getFullName() + ", " + rk_auxSolver.getFullName() + " );\n" );
 		ExportForLoop loopTemp( index3,0,numStages );
 		loopTemp.addStatement( rk_kkk.getSubMatrix( k_index+NX1,k_index+NX1+NX2,index3,index3+1 ) += rk_b.getRows( index3*NX2,index3*NX2+NX2 ) );											// differential states
 		if(NXA > 0) loopTemp.addStatement( rk_kkk.getSubMatrix( k_index+NX,k_index+NX+NXA,index3,index3+1 ) += rk_b.getRows( index3*NXA+numStages*NX2,index3*NXA+numStages*NX2+NXA ) );		// algebraic states
 		loop1.addStatement( loopTemp );
 		block->addStatement( loop1 );
-		if( DERIVATIVES && REUSE ) block->addStatement( std::string( "}\n" ) );
+		if( REUSE_FACTORIZATION ) {
+			block->addStatement( rk_factorized.getFullName() + " = 1;\n" );
+			block->addStatement( std::string( "}\n" ) );
+		}
+		else if( DERIVATIVES && REUSE ) block->addStatement( std::string( "}\n" ) );
 
 		// the rest (numIts) of the Newton iterations with reuse of the Jacobian (no evaluation or factorization needed)
 		ExportForLoop loop2( index1,0,numIts );
@@ -629,8 +672,32 @@ returnValue ImplicitRungeKuttaExport::solveImplicitSystem( ExportStatementBlock*
 		loopTemp.addStatement( rk_kkk.getSubMatrix( k_index+NX1,k_index+NX1+NX2,index3,index3+1 ) += rk_b.getRows( index3*NX2,index3*NX2+NX2 ) );														// differential states
 		if(NXA > 0) loopTemp.addStatement( rk_kkk.getSubMatrix( k_index+NX,k_index+NX+NXA,index3,index3+1 ) += rk_b.getRows( index3*NXA+numStages*NX2,index3*NXA+numStages*NX2+NXA ) );		// algebraic states
 		loop2.addStatement( loopTemp );
+		if( REUSE_FACTORIZATION ) {
+			// contraction monitor: the factorization is renewed as soon as the Newton steps stop decreasing fast enough
+			double maxContraction, absTol;
+			get( IMPLICIT_INTEGRATOR_MAX_CONTRACTION, maxContraction );
+			get( ABSOLUTE_TOLERANCE, absTol );
+
+			loop2 << rk_newtonNorm.get( 0,0 ) << " = 0.0;\n";
+			ExportForLoop loopNorm( index3,0,numStages*(NX2+NXA) );
+			loopNorm << "if( fabs(" << rk_b.get( index3,0 ) << ") > " << rk_newtonNorm.get( 0,0 ) << " ) "
+					<< rk_newtonNorm.get( 0,0 ) << " = fabs(" << rk_b.get( index3,0 ) << ");\n";
+			loop2.addStatement( loopNorm );
+			loop2 << "if( " << index1.getName() << " > 0 && " << rk_newtonNorm.get( 0,0 ) << " > " << toString( absTol )
+					<< " && " << rk_newtonNorm.get( 0,0 ) << " > " << toString( maxContraction ) << "*" << rk_newtonNorm.get( 0,1 ) << " ) "
+					<< rk_factorized.getFullName() << " = 0;\n";
+			loop2 << rk_newtonNorm.get( 0,1 ) << " = " << rk_newtonNorm.get( 0,0 ) << ";\n";
+		}
 		block->addStatement( loop2 );
 
+		if( REUSE_FACTORIZATION ) {
+			// the monitor tripped: continue with fresh Newton iterations
+			block->addStatement( std::string( "if( !" ) + rk_factorized.getFullName() + " ) {\n" );
+			block->addStatement( loop1 );
+			block->addStatement( rk_factorized.getFullName() + " = 1;\n" );
+			block->addStatement( std::string( "}\n" ) );
+		}
+
 		if( DERIVATIVES ) {
 			// solution calculated --> evaluate and save the necessary derivatives in rk_diffsTemp and update the matrix rk_A:
 			ExportForLoop loop3( index2,0,numStages );
@@ -1094,6 +1161,9 @@ returnValue ImplicitRungeKuttaExport::setup( )
 		case LIFTED:
 			REUSE = true;
 			break;
+		case INEXACT_NEWTON:
+			REUSE = true;
+			break;
 		default:
 			return ACADOERROR( RET_INVALID_OPTION );
 	}
@@ -1109,6 +1179,9 @@ returnValue ImplicitRungeKuttaExport::setup( )
 	if (newNumItsInit >= 0) {
 		numItsInit = newNumItsInit;
 	}
+
+	REUSE_FACTORIZATION = ( (ImplicitIntegratorMode) intMode == INEXACT_NEWTON );
+	if( REUSE_FACTORIZATION && numIts < 2 ) return ACADOERRORTEXT( RET_INVALID_OPTION, "The INEXACT_NEWTON mode needs at least 2 Newton iterations to monitor their contraction." );
 	
 	int debugMode;
 	get( INTEGRATOR_DEBUG_MODE, debugMode );
@@ -1141,6 +1214,8 @@ returnValue ImplicitRungeKuttaExport::setup( )
 	rk_xxx = ExportVariable( "rk_xxx", 1, inputDim+NDX+timeDep, REAL, structWspace );
 	rk_kkk = ExportVariable( "rk_kkk", NX+NXA, numStages, REAL, structWspace );
 	rk_A = ExportVariable( "rk_A", numStages*(NX2+NXA), numStages*(NX2+NXA), REAL, structWspace );
+	rk_factorized = ExportVariable( "rk_factorized", 1, 1, INT, structWspace, true );
+	rk_newtonNorm = ExportVariable( "rk_newtonNorm", 1, 2, REAL, structWspace );
 	if ( (bool)debugMode == true && useOMP ) {
 		return ACADOERROR( RET_INVALID_OPTION );
 	}
@@ -1286,6 +1361,16 @@ returnValue ImplicitRungeKuttaExport::setup( )
 				return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
 			}
 			break;
+		case SPARSE_LU:
+			if( (ImplicitIntegratorMode) intMode == LIFTED ) return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
+			solver = new ExportSparseLU( userInteraction,commonHeaderName );
+			solver->init( (NX2+NXA)*numStages );
+			dynamic_cast<ExportSparseLU *>(solver)->setSparsityPattern( getNewtonMatrixPattern() );
+			if( (ExportSensitivityType)sensGen == SYMMETRIC || (ExportSensitivityType)sensGen == FORWARD_OVER_BACKWARD || (ExportSensitivityType)sensGen == BACKWARD || gradientUpdate ) solver->setTranspose( true ); // BACKWARD propagation
+			solver->setReuse( true ); 	// IFTR method
+			if( solver->setup() != SUCCESSFUL_RETURN ) return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
+			rk_auxSolver = solver->getGlobalExportVariable( 1 );
+			break;
 		case HOUSEHOLDER_QR:
 			solver = new ExportHouseholderQR( userInteraction,commonHeaderName );
 			solver->init( (NX2+NXA)*numStages );
@@ -1595,12 +1680,17 @@ returnValue ImplicitRungeKuttaExport::copy(	const ImplicitRungeKuttaExport& arg
 	grid = arg.grid;
 	outputGrids = arg.outputGrids;
 	solver = arg.solver;
+	patternX = arg.patternX;
+	patternZ = arg.patternZ;
+	patternDX = arg.patternDX;
 
 	// ExportVariables
 	rk_ttt = arg.rk_ttt;
 	rk_xxx = arg.rk_xxx;
 	rk_kkk = arg.rk_kkk;
 	rk_A = arg.rk_A;
+	rk_factorized = arg.rk_factorized;
+	rk_newtonNorm = arg.rk_newtonNorm;
 	debug_mat = arg.debug_mat;
 	rk_b = arg.rk_b;
 	rk_diffK = arg.rk_diffK;
@@ -1629,6 +1719,7 @@ returnValue ImplicitRungeKuttaExport::copy(	const ImplicitRungeKuttaExport& arg
 	fullRhs = arg.fullRhs;
 	
 	REUSE = arg.REUSE;
+	REUSE_FACTORIZATION = arg.REUSE_FACTORIZATION;
 	CONTINUOUS_OUTPUT = arg.CONTINUOUS_OUTPUT;
 	
 	DD = arg.DD;
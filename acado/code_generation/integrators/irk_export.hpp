@@ -336,6 +336,14 @@ class ImplicitRungeKuttaExport : public RungeKuttaExport
 		virtual DMatrix formMatrix( const DMatrix& mass, const DMatrix& jacobian );
 
 
+		/** Returns the structural sparsity of the matrix of the Newton iterations, as assembled in evaluateMatrix.
+		 *	The matrix is empty (dense) when the sparsity of the model Jacobians is unknown.
+		 *
+		 *	\return The structural nonzeros of the matrix of the Newton iterations
+		 */
+		DMatrix getNewtonMatrixPattern( ) const;
+
+
 		/** Exports the code needed to solve the system of collocation equations for the linear input system.
 		 *
 		 *	@param[in] block			The block to which the code will be exported.
@@ -517,6 +525,7 @@ class ImplicitRungeKuttaExport : public RungeKuttaExport
     protected:
     
 		bool REUSE;						/**< This boolean is true when the IFTR method is used instead of the IFT method. */
+		bool REUSE_FACTORIZATION;		/**< This boolean is true when the factorization is kept across integration steps and calls (INEXACT_NEWTON). */
 		bool CONTINUOUS_OUTPUT;			/**< This boolean is true when continuous output needs to be provided. */
 
 		uint numIts;							/**< This is the performed number of Newton iterations. */
@@ -529,6 +538,10 @@ class ImplicitRungeKuttaExport : public RungeKuttaExport
 
 		ExportLinearSolver* solver;				/**< This is the exported linear solver that is used by the implicit Runge-Kutta method. */
 
+		DMatrix patternX;						/**< Dependency of the implicit equations on the differential states. */
+		DMatrix patternZ;						/**< Dependency of the implicit equations on the algebraic states. */
+		DMatrix patternDX;						/**< Dependency of the implicit equations on the differential state derivatives. */
+
 		DMatrix DD;								/**< This matrix is used for the initialization of the variables for the next integration step. */
 		DMatrix coeffs;							/**< This matrix contains coefficients of polynomials that are used to evaluate the continuous output (see evaluatePolynomial). */
 
@@ -561,6 +574,8 @@ class ImplicitRungeKuttaExport : public RungeKuttaExport
 		ExportVariable	rk_A;					/**< Variable containing the matrix of the linear system. */
 		ExportVariable	rk_b;					/**< Variable containing the right-hand side of the linear system. */
 		ExportVariable  rk_auxSolver;			/**< Variable containing auxiliary values for the exported linear solver. */
+		ExportVariable  rk_factorized;			/**< Variable indicating whether rk_A contains a factorization that can be reused (INEXACT_NEWTON). */
+		ExportVariable  rk_newtonNorm;			/**< Variable containing the norms of the current and the previous Newton step (INEXACT_NEWTON). */
 		ExportVariable 	rk_rhsTemp;				/**< Variable containing intermediate results of evaluations of the right-hand side expression. */
 
 		ExportAcadoFunction lin_output;
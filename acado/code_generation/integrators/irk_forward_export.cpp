@@ -174,9 +174,9 @@ returnValue ForwardIRKExport::getCode(	ExportStatementBlock& code )
 		getDataDeclarations( code, ACADO_LOCAL );
 
 		stringstream s;
-		s << "#pragma omp threadprivate( "
-				<< max.getFullName() << ", "
-				<< rk_ttt.getFullName() << ", "
+		s << "#pragma omp threadprivate( ";
+		if( max.getDim() > 0 ) s << max.getFullName() << ", ";
+		s << rk_ttt.getFullName() << ", "
 				<< rk_xxx.getFullName() << ", "
 				<< rk_kkk.getFullName() << ", "
 				<< rk_diffK.getFullName() << ", "
@@ -192,6 +192,7 @@ returnValue ForwardIRKExport::getCode(	ExportStatementBlock& code )
 			if( grid.getNumIntervals() > 1 || !equidistantControlGrid() ) s << ", " << rk_diffsPrev2.getFullName();
 			s << ", " << rk_diffsNew2.getFullName();
 			s << ", " << rk_diffsTemp2.getFullName();
+			if( REUSE_FACTORIZATION ) s << ", " << rk_factorized.getFullName() << ", " << rk_newtonNorm.getFullName();
 			solver->appendVariableNames( s );
 		}
 		if( NX3 > 0 ) {
@@ -800,7 +801,7 @@ returnValue ForwardIRKExport::sensitivitiesImplicitSystem( ExportStatementBlock*
 		block->addStatement( loop1 );
 		if( STATES && (number == 1 || NX1 == 0) ) {
 			block->addStatement( std::string( "if( 0 == " ) + index1.getName() + " ) {\n" );	// factorization of the new matrix rk_A not yet calculated!
-			block->addStatement( det.getFullName() + " = " + ExportStatement::fcnPrefix + "_" + solver->getNameSolveFunction() + "( " + rk_A.getFullName() + ", " + rk_b.getFullName() + ", " + rk_auxSolver.getFullName() + " );\n" );
+			block->addStatement( det.getFullName() + " = " + ExportStatement::fcnPrefix + "_" + solver->getNameSolveFunction() + "( " + ExportStatement::getContextArgument() + rk_A.getFullName() + ", " + rk_b.getFullName() + ", " + rk_auxSolver.getFullName() + " );\n" );
 			block->addStatement( std::string( "}\n else {\n" ) );
 		}
 		block->addFunctionCall( solver->getNameSolveReuseFunction(),rk_A.getAddress(0,0),rk_b.getAddress(0,0),rk_auxSolver.getAddress(0,0) );
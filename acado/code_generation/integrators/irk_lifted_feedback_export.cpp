@@ -600,7 +600,7 @@ returnValue FeedbackLiftedIRKExport::getCode(   ExportStatementBlock& code )
     if( liftMode == 2 ) {
         loop->addStatement( std::string("if(") + run.getName() + " == 0) {\n" );
     }
-    loop->addStatement( determinant.getFullName() + " = " + ExportStatement::fcnPrefix + "_" + solver->getNameSolveFunction() + "( " + rk_A.getFullName() + ", " + rk_auxSolver.getFullName() + " );\n" );
+    loop->addStatement( determinant.getFullName() + " = " + ExportStatement::fcnPrefix + "_" + solver->getNameSolveFunction() + "( " + ExportStatement::getContextArgument() + rk_A.getFullName() + ", " + rk_auxSolver.getFullName() + " );\n" );
     if( liftMode == 2 ) loop->addStatement( std::string("}\n") );
     loop->addFunctionCall( solver->getNameSolveReuseFunction(),rk_A.getAddress(0,0),rk_b.getAddress(0,0),rk_auxSolver.getAddress(0,0) );
 
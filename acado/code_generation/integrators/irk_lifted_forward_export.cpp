@@ -299,9 +299,9 @@ returnValue ForwardLiftedIRKExport::getCode(	ExportStatementBlock& code )
 		getDataDeclarations( code, ACADO_LOCAL );
 
 		stringstream s;
-		s << "#pragma omp threadprivate( "
-				<< max.getFullName() << ", "
-				<< rk_ttt.getFullName() << ", "
+		s << "#pragma omp threadprivate( ";
+		if( max.getDim() > 0 ) s << max.getFullName() << ", ";
+		s << rk_ttt.getFullName() << ", "
 				<< rk_xxx.getFullName() << ", "
 				<< rk_kkk.getFullName() << ", "
 				<< rk_diffK.getFullName() << ", "
@@ -853,10 +853,10 @@ returnValue ForwardLiftedIRKExport::solveImplicitSystem( ExportStatementBlock* b
 				block->addStatement( loop01 );
 
 				if( NDX2 > 0 ) {
-					block->addStatement( det.getFullName() + " = " + ExportStatement::fcnPrefix + "_" + solver->getNameSolveFunction() + "( " + rk_A.getFullName() + ", " + rk_I.getFullName() + ", " + rk_auxSolver.getFullName() + " );\n" );
+					block->addStatement( det.getFullName() + " = " + ExportStatement::fcnPrefix + "_" + solver->getNameSolveFunction() + "( " + ExportStatement::getContextArgument() + rk_A.getFullName() + ", " + rk_I.getFullName() + ", " + rk_auxSolver.getFullName() + " );\n" );
 				}
 				else {
-					block->addStatement( det.getFullName() + " = " + ExportStatement::fcnPrefix + "_" + solver->getNameSolveFunction() + "( " + rk_A.getFullName() + ", " + rk_auxSolver.getFullName() + " );\n" );
+					block->addStatement( det.getFullName() + " = " + ExportStatement::fcnPrefix + "_" + solver->getNameSolveFunction() + "( " + ExportStatement::getContextArgument() + rk_A.getFullName() + ", " + rk_auxSolver.getFullName() + " );\n" );
 				}
 			}
 			else {
@@ -864,7 +864,7 @@ returnValue ForwardLiftedIRKExport::solveImplicitSystem( ExportStatementBlock* b
 				evaluateMatrix( &loop01, index2, index3, tmp_index, k_index, rk_A, Ah, C, true, false );
 				block->addStatement( loop01 );
 
-				block->addStatement( det.getFullName() + " = " + ExportStatement::fcnPrefix + "_" + solver->getNameSolveFunction() + "( " + rk_A.getFullName() + ", " + rk_auxSolver.getFullName() + " );\n" );
+				block->addStatement( det.getFullName() + " = " + ExportStatement::fcnPrefix + "_" + solver->getNameSolveFunction() + "( " + ExportStatement::getContextArgument() + rk_A.getFullName() + ", " + rk_auxSolver.getFullName() + " );\n" );
 			}
 
 			if( !equidistantControlGrid() || grid.getNumIntervals() > 1 ) {
@@ -886,7 +886,7 @@ returnValue ForwardLiftedIRKExport::solveImplicitSystem( ExportStatementBlock* b
 //				}
 //			}
 			block->addStatement( loop1 );
-			block->addStatement( det.getFullName() + " = " + ExportStatement::fcnPrefix + "_" + solver->getNameSolveFunction() + "( " + rk_A.getFullName() + ", " + rk_auxSolver.getFullName() + " );\n" );
+			block->addStatement( det.getFullName() + " = " + ExportStatement::fcnPrefix + "_" + solver->getNameSolveFunction() + "( " + ExportStatement::getContextArgument() + rk_A.getFullName() + ", " + rk_auxSolver.getFullName() + " );\n" );
 		}
 
 //		// IF DEBUG MODE:
@@ -42,6 +42,7 @@
 #include <acado/code_generation/integrators/erk2_export.hpp>
 #include <acado/code_generation/integrators/erk3_export.hpp>
 #include <acado/code_generation/integrators/erk4_export.hpp>
+#include <acado/code_generation/integrators/erk45_export.hpp>
 
 #include <acado/code_generation/integrators/gauss_legendre2_export.hpp>
 #include <acado/code_generation/integrators/gauss_legendre4_export.hpp>
@@ -71,6 +72,7 @@ RegisterExportedIntegrators::RegisterExportedIntegrators()
 	IntegratorExportFactory::instance().registerAlgorithm(INT_RK2, createExplicitRungeKutta2Export);
 	IntegratorExportFactory::instance().registerAlgorithm(INT_RK3, createExplicitRungeKutta3Export);
 	IntegratorExportFactory::instance().registerAlgorithm(INT_RK4, createExplicitRungeKutta4Export);
+	IntegratorExportFactory::instance().registerAlgorithm(INT_DOPRI45, createExplicitRungeKutta45Export);
 
 	IntegratorExportFactory::instance().registerAlgorithm(INT_IRK_GL2, createGaussLegendre2Export);
 	IntegratorExportFactory::instance().registerAlgorithm(INT_IRK_GL4, createGaussLegendre4Export);
@@ -44,6 +44,7 @@
    #include <acado/code_generation/linear_solvers/irk_4stage_single_newton_export.hpp>
    #include <acado/code_generation/linear_solvers/gaussian_elimination_export.hpp>
    #include <acado/code_generation/linear_solvers/householder_qr_export.hpp>
+   #include <acado/code_generation/linear_solvers/sparse_lu_export.hpp>
 
 // -----------------------------------------------------
 
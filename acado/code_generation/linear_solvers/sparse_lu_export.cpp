@@ -0,0 +1,466 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/code_generation/linear_solvers/sparse_lu_export.cpp
+ */
+
+#include <acado/code_generation/linear_solvers/sparse_lu_export.hpp>
+
+using namespace std;
+
+BEGIN_NAMESPACE_ACADO
+
+
+const double ExportSparseLU::pivotThreshold = 1.0e-12;
+
+
+/** Searches an augmenting path from the given column, for the maximum transversal. */
+static bool findAugmentingPath(	const DMatrix& pattern,
+								uint col,
+								vector<bool>& visited,
+								vector<int>& rowMatch
+								)
+{
+	for( uint row = 0; row < pattern.getNumRows(); row++ ) {
+		if( pattern( row,col ) == 0.0 || visited[ row ] == true )
+			continue;
+
+		visited[ row ] = true;
+		if( rowMatch[ row ] < 0 || findAugmentingPath( pattern, rowMatch[ row ], visited, rowMatch ) == true ) {
+			rowMatch[ row ] = col;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+ExportSparseLU::ExportSparseLU( UserInteraction* _userInteraction,
+								const std::string& _commonHeaderName
+								) : ExportLinearSolver( _userInteraction,_commonHeaderName )
+{
+}
+
+ExportSparseLU::~ExportSparseLU( )
+{}
+
+
+returnValue ExportSparseLU::setSparsityPattern( const DMatrix& _pattern )
+{
+	pattern = _pattern;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue ExportSparseLU::getDataDeclarations(	ExportStatementBlock& declarations,
+													ExportStruct dataStruct
+													) const
+{
+	declarations.addDeclaration( rk_bPerm,dataStruct );		// reordered right-hand side
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue ExportSparseLU::getFunctionDeclarations(	ExportStatementBlock& declarations
+														) const
+{
+	declarations.addDeclaration( solve );
+	if( REUSE ) {
+		declarations.addDeclaration( solveReuse );
+		if( TRANSPOSE ) {
+			declarations.addDeclaration( solveReuseTranspose );
+		}
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue ExportSparseLU::getCode(	ExportStatementBlock& code
+										)
+{
+	if( nRightHandSides > 0 && !REUSE ) return ACADOERROR(RET_INVALID_OPTION);
+
+	setupFactorization( solve );
+	if( nRightHandSides == 0 ) {
+		setupSubstitution( solve, b, ExportIndex( 0 ) );
+	}
+	code.addFunction( solve );
+
+	if( REUSE ) { // Also export the extra functions which reuse the factorization of the matrix A
+		if( nRightHandSides > 0 ) {
+			ExportIndex col( "i" );
+			solveReuse.addIndex( col );
+
+			ExportForLoop loop( col,0,nRightHandSides );
+			setupSubstitution( loop, b, col );
+			solveReuse.addStatement( loop );
+		}
+		else {
+			setupSubstitution( solveReuse, b, ExportIndex( 0 ) );
+		}
+		code.addFunction( solveReuse );
+
+		if( TRANSPOSE ) {
+			setupSubstitutionTranspose( solveReuseTranspose, ExportVariable( "b", dim, 1, REAL ) );
+			code.addFunction( solveReuseTranspose );
+		}
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue ExportSparseLU::appendVariableNames( stringstream& string ) {
+
+	string << ", " << rk_bPerm.getFullName();
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue ExportSparseLU::setup( )
+{
+	// Other cases are not implemented...
+	ASSERT_RETURN(nCols == nRows);
+
+	if( !pattern.isEmpty() && ( pattern.getNumRows() != dim || pattern.getNumCols() != dim ) )
+		return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+	if( setupOrdering( ) != SUCCESSFUL_RETURN )
+		return ACADOERRORTEXT( RET_INVALID_OPTION, "The sparsity pattern of the linear system is structurally singular." );
+
+	int useOMP;
+	get(CG_USE_OPENMP, useOMP);
+	ExportStruct structWspace;
+	structWspace = useOMP ? ACADO_LOCAL : ACADO_WORKSPACE;
+
+	A = ExportVariable( "A", dim, dim, REAL );
+	rk_perm = ExportVariable( "rk_perm", 1, dim, INT );
+	rk_bPerm = ExportVariable( std::string( "rk_" ) + identifier + "bPerm", dim, 1, REAL, structWspace );
+	if (nRightHandSides > 0) {
+		b = ExportVariable( "b", dim, nRightHandSides, REAL );
+		solve = ExportFunction( getNameSolveFunction(), A, rk_perm );
+	}
+	else {
+		b = ExportVariable( "b", dim, 1, REAL );
+		solve = ExportFunction( getNameSolveFunction(), A, b, rk_perm );
+	}
+	solve.setReturnValue( determinant, false );
+	solve.addLinebreak( );	// FIX: TO MAKE SURE IT GETS EXPORTED
+
+	if( REUSE ) {
+		solveReuse = ExportFunction( getNameSolveReuseFunction(), A, b, rk_perm );
+		solveReuse.addLinebreak( );	// FIX: TO MAKE SURE IT GETS EXPORTED
+		if( TRANSPOSE ) {
+			solveReuseTranspose = ExportFunction( getNameSolveTransposeReuseFunction(), A, ExportVariable( "b", dim, 1, REAL ), rk_perm );
+			solveReuseTranspose.addLinebreak( );	// FIX: TO MAKE SURE IT GETS EXPORTED
+		}
+	}
+
+	// the sparse factorization is only meaningful when unrolled
+	UNROLLING = true;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+ExportVariable ExportSparseLU::getGlobalExportVariable( const uint factor ) const {
+
+	int useOMP;
+	get(CG_USE_OPENMP, useOMP);
+	ExportStruct structWspace;
+	structWspace = useOMP ? ACADO_LOCAL : ACADO_WORKSPACE;
+
+	return ExportVariable( std::string( "rk_" ) + identifier + "perm", factor, dim, INT, structWspace );
+}
+
+
+uint ExportSparseLU::getNumNonzeros( ) const {
+
+	uint nnz = 0;
+	for( uint i = 0; i < factorPattern.size(); i++ )
+		for( uint j = 0; j < factorPattern[i].size(); j++ )
+			if( factorPattern[i][j] == true ) nnz++;
+
+	return nnz;
+}
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue ExportSparseLU::setupOrdering( )
+{
+	uint i, j, k;
+
+	if( pattern.isEmpty() )
+		pattern = ones<double>( dim,dim );
+
+	// static pivoting: permute the rows such that the diagonal is structurally nonzero
+	vector<uint> match;
+	if( computeMatching( match ) != SUCCESSFUL_RETURN )
+		return RET_INVALID_OPTION;
+
+	vector< vector<bool> > matched( dim, vector<bool>( dim,false ) );
+	for( i = 0; i < dim; i++ )
+		for( j = 0; j < dim; j++ )
+			matched[i][j] = ( pattern( match[i],j ) != 0.0 );
+
+	// fill-reducing symmetric permutation of the matched matrix
+	vector<uint> order;
+	computeMinimumDegree( matched, order );
+
+	rowOrder.resize( dim );
+	colOrder.resize( dim );
+	for( i = 0; i < dim; i++ ) {
+		rowOrder[i] = match[ order[i] ];
+		colOrder[i] = order[i];
+	}
+
+	// symbolic factorization
+	factorPattern.assign( dim, vector<bool>( dim,false ) );
+	for( i = 0; i < dim; i++ )
+		for( j = 0; j < dim; j++ )
+			factorPattern[i][j] = matched[ order[i] ][ order[j] ];
+
+	fillIn.assign( dim, vector<bool>( dim,false ) );
+	for( k = 0; k < dim; k++ ) {
+		for( i = k+1; i < dim; i++ ) {
+			if( factorPattern[i][k] == false ) continue;
+
+			for( j = k+1; j < dim; j++ ) {
+				if( factorPattern[k][j] == true && factorPattern[i][j] == false ) {
+					factorPattern[i][j] = true;
+					fillIn[i][j] = true;
+				}
+			}
+		}
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue ExportSparseLU::computeMatching( vector<uint>& _match ) const
+{
+	vector<int> rowMatch( dim,-1 );
+
+	for( uint col = 0; col < dim; col++ ) {
+		vector<bool> visited( dim,false );
+		if( findAugmentingPath( pattern, col, visited, rowMatch ) == false )
+			return RET_INVALID_OPTION;
+	}
+
+	_match.resize( dim );
+	for( uint row = 0; row < dim; row++ )
+		_match[ rowMatch[row] ] = row;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue ExportSparseLU::computeMinimumDegree(	const vector< vector<bool> >& _pattern,
+													vector<uint>& _order
+													) const
+{
+	uint i, j;
+	const uint n = _pattern.size();
+
+	// elimination graph of the symmetrized pattern
+	vector< vector<bool> > graph( n, vector<bool>( n,false ) );
+	for( i = 0; i < n; i++ )
+		for( j = 0; j < n; j++ )
+			if( i != j && ( _pattern[i][j] == true || _pattern[j][i] == true ) )
+				graph[i][j] = true;
+
+	vector<bool> eliminated( n,false );
+	_order.clear();
+
+	while( _order.size() < n ) {
+		// node of minimum degree, ties are broken by the lowest index
+		uint node = n;
+		uint minDegree = n+1;
+		for( i = 0; i < n; i++ ) {
+			if( eliminated[i] == true ) continue;
+
+			uint degree = 0;
+			for( j = 0; j < n; j++ )
+				if( graph[i][j] == true && eliminated[j] == false ) degree++;
+
+			if( degree < minDegree ) {
+				minDegree = degree;
+				node = i;
+			}
+		}
+
+		// its neighbours form a clique after the elimination
+		vector<uint> neighbours;
+		for( j = 0; j < n; j++ )
+			if( graph[node][j] == true && eliminated[j] == false ) neighbours.push_back( j );
+
+		for( i = 0; i < neighbours.size(); i++ )
+			for( j = 0; j < neighbours.size(); j++ )
+				if( i != j ) graph[ neighbours[i] ][ neighbours[j] ] = true;
+
+		eliminated[node] = true;
+		_order.push_back( node );
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+std::string ExportSparseLU::getEntry( uint i, uint j ) const
+{
+	return A.get( rowOrder[i],colOrder[j] );
+}
+
+
+returnValue ExportSparseLU::setupFactorization( ExportFunction& _solve )
+{
+	uint i, j, k;
+	ExportVariable pivot( "pivot", 1, 1, REAL, ACADO_LOCAL, true );
+	_solve.addDeclaration( pivot );
+
+	// the static row order is kept for compatibility with the other linear solvers
+	for( i = 0; i < dim; i++ )
+		_solve << rk_perm.get( 0,i ) << " = " << toString( rowOrder[i] ) << ";\n";
+
+	// entries that become nonzero during the factorization
+	for( i = 0; i < dim; i++ )
+		for( j = 0; j < dim; j++ )
+			if( fillIn[i][j] == true ) _solve << getEntry( i,j ) << " = 0.0;\n";
+	_solve.addLinebreak();
+
+	_solve.addStatement( determinant == 1 );
+	for( k = 0; k < dim; k++ ) {
+		const std::string diag = getEntry( k,k );
+
+		// rows cannot be swapped at run time: tiny pivots are replaced by the threshold
+		_solve << "if( fabs(" << diag << ") < " << toString( pivotThreshold ) << " ) "
+				<< diag << " = (" << diag << " < 0.0) ? -" << toString( pivotThreshold ) << " : " << toString( pivotThreshold ) << ";\n";
+		_solve << determinant.getFullName() << " *= " << diag << ";\n";
+		_solve << pivot.getFullName() << " = 1.0/" << diag << ";\n";
+
+		for( i = k+1; i < dim; i++ ) {
+			if( factorPattern[i][k] == false ) continue;
+
+			_solve << getEntry( i,k ) << " *= " << pivot.getFullName() << ";\n";
+			for( j = k+1; j < dim; j++ ) {
+				if( factorPattern[k][j] == true )
+					_solve << getEntry( i,j ) << " -= " << getEntry( i,k ) << "*" << getEntry( k,j ) << ";\n";
+			}
+		}
+		_solve.addLinebreak();
+	}
+	_solve << determinant.getFullName() << " = fabs(" << determinant.getFullName() << ");\n";
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue ExportSparseLU::setupSubstitution(	ExportStatementBlock& _block,
+												const ExportVariable& _b,
+												const ExportIndex& _col
+												)
+{
+	uint i, j;
+
+	for( i = 0; i < dim; i++ )
+		_block << rk_bPerm.get( i,0 ) << " = " << _b.get( ExportIndex( rowOrder[i] ),_col ) << ";\n";
+
+	// forward substitution with the unit lower triangular factor
+	for( i = 1; i < dim; i++ ) {
+		for( j = 0; j < i; j++ ) {
+			if( factorPattern[i][j] == true )
+				_block << rk_bPerm.get( i,0 ) << " -= " << getEntry( i,j ) << "*" << rk_bPerm.get( j,0 ) << ";\n";
+		}
+	}
+
+	// backward substitution with the upper triangular factor
+	for( i = dim; i > 0; i-- ) {
+		for( j = i; j < dim; j++ ) {
+			if( factorPattern[i-1][j] == true )
+				_block << rk_bPerm.get( i-1,0 ) << " -= " << getEntry( i-1,j ) << "*" << rk_bPerm.get( j,0 ) << ";\n";
+		}
+		_block << rk_bPerm.get( i-1,0 ) << " = " << rk_bPerm.get( i-1,0 ) << "/" << getEntry( i-1,i-1 ) << ";\n";
+	}
+
+	for( j = 0; j < dim; j++ )
+		_block << _b.get( ExportIndex( colOrder[j] ),_col ) << " = " << rk_bPerm.get( j,0 ) << ";\n";
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue ExportSparseLU::setupSubstitutionTranspose(	ExportStatementBlock& _block,
+														const ExportVariable& _b
+														)
+{
+	uint i, j;
+
+	for( j = 0; j < dim; j++ )
+		_block << rk_bPerm.get( j,0 ) << " = " << _b.get( colOrder[j],0 ) << ";\n";
+
+	// forward substitution with the transposed upper triangular factor
+	for( j = 0; j < dim; j++ ) {
+		for( i = 0; i < j; i++ ) {
+			if( factorPattern[i][j] == true )
+				_block << rk_bPerm.get( j,0 ) << " -= " << getEntry( i,j ) << "*" << rk_bPerm.get( i,0 ) << ";\n";
+		}
+		_block << rk_bPerm.get( j,0 ) << " = " << rk_bPerm.get( j,0 ) << "/" << getEntry( j,j ) << ";\n";
+	}
+
+	// backward substitution with the transposed unit lower triangular factor
+	for( i = dim; i > 0; i-- ) {
+		for( j = i; j < dim; j++ ) {
+			if( factorPattern[j][i-1] == true )
+				_block << rk_bPerm.get( i-1,0 ) << " -= " << getEntry( j,i-1 ) << "*" << rk_bPerm.get( j,0 ) << ";\n";
+		}
+	}
+
+	for( i = 0; i < dim; i++ )
+		_block << _b.get( rowOrder[i],0 ) << " = " << rk_bPerm.get( i,0 ) << ";\n";
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
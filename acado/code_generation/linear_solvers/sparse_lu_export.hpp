@@ -0,0 +1,196 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/code_generation/linear_solvers/sparse_lu_export.hpp
+ */
+
+
+#ifndef ACADO_TOOLKIT_EXPORT_SPARSE_LU_HPP
+#define ACADO_TOOLKIT_EXPORT_SPARSE_LU_HPP
+
+#include <acado/code_generation/linear_solvers/linear_solver_export.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/** 
+ *	\brief Allows to export a sparse LU factorization for solving linear systems of specific dimensions and sparsity.
+ *
+ *	\ingroup NumericalAlgorithms
+ *
+ *	The class ExportSparseLU allows to export an LU factorization that only operates on
+ *	the structural nonzeros of the matrix and on the fill-in they cause. The pivots are
+ *	chosen at export time (static pivoting): a maximum transversal puts structural nonzeros
+ *	on the diagonal, after which a minimum degree ordering reduces the fill-in. The matrix
+ *	is passed in the same dense row-major storage as for ExportGaussElim, such that both
+ *	solvers can be exchanged, but the exported code and its run time scale with the number
+ *	of nonzeros of the factors instead of with the cube of the dimension.
+ *
+ *	The code is always fully unrolled. Pivots that are smaller than a fixed threshold are
+ *	replaced by the threshold, because rows cannot be swapped at run time.
+ */
+class ExportSparseLU : public ExportLinearSolver
+{
+    //
+    // PUBLIC MEMBER FUNCTIONS:
+    //
+    public:
+
+        /** Default constructor. 
+		 *
+		 *	@param[in] _userInteraction		Pointer to corresponding user interface.
+		 *	@param[in] _commonHeaderName	Name of common header file to be included.
+		 */
+        ExportSparseLU(	UserInteraction* _userInteraction = 0,
+						const std::string& _commonHeaderName = ""
+						);
+
+        /** Destructor. */
+        virtual ~ExportSparseLU( );
+
+
+		/** Sets the structural sparsity of the matrix. Has to be called before setup(),
+		 *  without a pattern the matrix is assumed to be dense.
+		 *
+		 *	@param[in] _pattern		Matrix whose nonzero entries mark the structural nonzeros.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue setSparsityPattern( const DMatrix& _pattern );
+
+
+		/** Initializes code export into given file.
+		 *
+		 *	\return SUCCESSFUL_RETURN, \n
+		 *	        RET_VECTOR_DIMENSION_MISMATCH, \n
+		 *	        RET_INVALID_OPTION
+		 */
+		virtual returnValue setup( );
+
+
+		/** Adds all data declarations of the auto-generated algorithm to given list of declarations.
+		 *
+		 *	@param[in] declarations		List of declarations.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		virtual returnValue getDataDeclarations(	ExportStatementBlock& declarations,
+													ExportStruct dataStruct = ACADO_ANY
+													) const;
+
+
+		/** Adds all function (forward) declarations of the auto-generated algorithm to given list of declarations.
+		 *
+		 *	@param[in] declarations		List of declarations.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		virtual returnValue getFunctionDeclarations(	ExportStatementBlock& declarations
+														) const;
+
+
+		/** Exports source code of the auto-generated algorithm into the given directory.
+		 *
+		 *	@param[in] code				Code block containing the auto-generated algorithm.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		virtual returnValue getCode(	ExportStatementBlock& code
+										);
+
+
+		/** Appends the names of the used variables to a given stringstream.
+		 *
+		 *	@param[in] string				The string to which the names of the used variables are appended.
+		 *
+		 *	\return SUCCESSFUL_RETURN
+		 */
+		returnValue appendVariableNames( std::stringstream& string );
+
+
+		/** Returns the dimension of the auxiliary variables for the linear solver.
+		 *
+		 *  \return The dimension of the auxiliary variables for the linear solver.
+		 */
+		virtual ExportVariable getGlobalExportVariable( const uint factor ) const;
+
+
+		/** Returns the number of nonzero entries of the LU factors, including the fill-in.
+		 *
+		 *  \return The number of nonzero entries of the LU factors.
+		 */
+		uint getNumNonzeros( ) const;
+
+
+	//
+    // PROTECTED MEMBER FUNCTIONS:
+    //
+    protected:
+
+		/** Computes the row and column order of the factorization and the pattern of the factors. */
+		returnValue setupOrdering( );
+
+		/** Finds a row for each column such that the diagonal is structurally nonzero. */
+		returnValue computeMatching( std::vector<uint>& _match ) const;
+
+		/** Computes a minimum degree ordering of the symmetrized pattern of the given matrix. */
+		returnValue computeMinimumDegree( const std::vector< std::vector<bool> >& _pattern, std::vector<uint>& _order ) const;
+
+		/** Returns the entry (i,j) of the reordered matrix in its dense storage. */
+		std::string getEntry( uint i, uint j ) const;
+
+		returnValue setupFactorization( ExportFunction& _solve );
+
+		returnValue setupSubstitution( ExportStatementBlock& _block, const ExportVariable& _b, const ExportIndex& _col );
+
+		returnValue setupSubstitutionTranspose( ExportStatementBlock& _block, const ExportVariable& _b );
+
+
+    protected:
+
+		DMatrix pattern;								/**< Structural nonzeros of the matrix. */
+		std::vector<uint> rowOrder;						/**< Original row of each row of the reordered matrix. */
+		std::vector<uint> colOrder;						/**< Original column of each column of the reordered matrix. */
+		std::vector< std::vector<bool> > factorPattern;	/**< Structural nonzeros of the reordered matrix including the fill-in. */
+		std::vector< std::vector<bool> > fillIn;		/**< Entries of the reordered matrix that are only nonzero in the factors. */
+
+		// DEFINITION OF THE EXPORTVARIABLES
+		ExportVariable rk_perm;						/**< Variable containing the order of the rows. */
+		ExportVariable rk_bPerm;					/**< Variable containing the reordered right-hand side. */
+
+		static const double pivotThreshold;			/**< Smallest absolute value of a pivot. */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#endif  // ACADO_TOOLKIT_EXPORT_SPARSE_LU_HPP
+
+// end of file.
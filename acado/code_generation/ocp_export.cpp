@@ -43,6 +43,7 @@
 #include <acado/code_generation/templates/templates.hpp>
 
 #include <acado/code_generation/integrators/rk_export.hpp>
+#include <acado/clock/runtime_profiler.hpp>
 
 #include <acado/objective/objective.hpp>
 #include <acado/ocp/ocp.hpp>
@@ -78,9 +79,16 @@ returnValue OCPexport::exportCode(	const std::string& dirName,
 	get(CG_MODULE_NAME, moduleName);
     get(CG_MODULE_PREFIX, modulePrefix);
     
+	int reentrantCode;
+	get(CG_REENTRANT_CODE, reentrantCode);
+	int multiplyBlockSize;
+	get(CG_MULTIPLY_BLOCK_SIZE, multiplyBlockSize);
+
     ExportDataInternal::fcnPrefix = moduleName;
     ExportStatement::fcnPrefix = moduleName;
     ExportStatement::varPrefix = modulePrefix;
+    ExportStatement::reentrantCode = (bool)reentrantCode;
+    ExportArithmeticStatement::multiplyBlockSize = multiplyBlockSize > 0 ? multiplyBlockSize : 0;
 
 	acadoPrintCopyrightNotice( "Code Generation Tool" );
 
@@ -104,44 +112,60 @@ returnValue OCPexport::exportCode(	const std::string& dirName,
 	//
 	// Export common header
 	//
+	double profilerStart = RuntimeProfiler::instance().tic( );
+
 	if (exportAcadoHeader(dirName, commonHeaderName, _realString, _intString, _precision)
 			!= SUCCESSFUL_RETURN )
 		return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
 
+	RuntimeProfiler::instance().toc( PP_EXPORT_FILES,profilerStart );
+
 	//
-	// Export integrator
+	// Export integrator and solver. Both files are independent of each
+	// other and are written in parallel.
 	//
-	if (integrator != 0)
+	if (integrator == 0 || solver == 0)
+		return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+	returnValue integratorStatus = SUCCESSFUL_RETURN;
+	returnValue solverStatus = SUCCESSFUL_RETURN;
+
+	#pragma omp parallel sections num_threads( 2 )
 	{
-		ExportFile integratorFile(dirName + "/" + moduleName + "_integrator.c",
-				commonHeaderName, _realString, _intString, _precision);
+		#pragma omp section
+		{
+			double integratorStart = RuntimeProfiler::instance().tic( );
 
-		integrator->getCode( integratorFile );
+			ExportFile integratorFile(dirName + "/" + moduleName + "_integrator.c",
+					commonHeaderName, _realString, _intString, _precision);
 
-		if (integratorFile.exportCode( ) != SUCCESSFUL_RETURN)
-			return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
-	}
-	else
-		return ACADOERROR( RET_INVALID_ARGUMENTS );
+			integrator->getCode( integratorFile );
+			integratorStatus = integratorFile.exportCode( );
 
-	//
-	// Export solver
-	//
-	if( solver != 0 )
-	{
-		ExportFile solverFile(dirName + "/" + moduleName + "_solver.c",
-				commonHeaderName, _realString, _intString, _precision);
+			RuntimeProfiler::instance().toc( PP_EXPORT_INTEGRATOR,integratorStart );
+		}
 
-		solver->getCode( solverFile );
+		#pragma omp section
+		{
+			double solverStart = RuntimeProfiler::instance().tic( );
 
-		if ( solverFile.exportCode( ) != SUCCESSFUL_RETURN )
-			return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
+			ExportFile solverFile(dirName + "/" + moduleName + "_solver.c",
+					commonHeaderName, _realString, _intString, _precision);
+
+			solver->getCode( solverFile );
+			solverStatus = solverFile.exportCode( );
+
+			RuntimeProfiler::instance().toc( PP_EXPORT_SOLVER,solverStart );
+		}
 	}
-	else
-		return ACADOERROR( RET_INVALID_ARGUMENTS );
+
+	if (integratorStatus != SUCCESSFUL_RETURN || solverStatus != SUCCESSFUL_RETURN)
+		return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
 
 	LOG( LVL_DEBUG ) << "Export templates" << endl;
 
+	profilerStart = RuntimeProfiler::instance().tic( );
+
 	//
 	// Export auxiliary functions, always
 	//
@@ -247,6 +271,61 @@ returnValue OCPexport::exportCode(	const std::string& dirName,
         testFile.dictionary[ "@MODULE_NAME@" ] = moduleName;
         testFile.dictionary[ "@MODULE_PREFIX@" ] = modulePrefix;
 
+        if ( (bool)reentrantCode == true )
+        {
+            testFile.dictionary[ "@DATA_DECLARATIONS@" ] =
+                    "/* The solver instance, passed to all functions of the solver. */\n" +
+                    modulePrefix + "context " + moduleName + "Context;";
+            testFile.dictionary[ "@CONTEXT@" ] = "&" + moduleName + "Context";
+            testFile.dictionary[ "@VARIABLES@" ] = moduleName + "Context.variables";
+        }
+        else
+        {
+            testFile.dictionary[ "@DATA_DECLARATIONS@" ] =
+                    "/* Global variables used by the solver. */\n" +
+                    modulePrefix + "variables " + moduleName + "Variables;\n" +
+                    modulePrefix + "workspace " + moduleName + "Workspace;";
+            testFile.dictionary[ "@CONTEXT@" ] = "";
+            testFile.dictionary[ "@VARIABLES@" ] = moduleName + "Variables";
+        }
+
+        // With OpenMP, the parallel phases of the preparation step of the condensing
+        // solvers are timed separately; run the test with different OMP_NUM_THREADS
+        // to measure their scaling.
+        int useOMP;
+        get(CG_USE_OPENMP, useOMP);
+        int sparseQPsolution;
+        get(SPARSE_QP_SOLUTION, sparseQPsolution);
+        testFile.dictionary[ "@PHASE_TIMING@" ] = "";
+        if (useOMP && (bool)reentrantCode == false &&
+                ((SparseQPsolutionMethods)sparseQPsolution == FULL_CONDENSING ||
+                 (SparseQPsolutionMethods)sparseQPsolution == CONDENSING ||
+                 (SparseQPsolutionMethods)sparseQPsolution == FULL_CONDENSING_N2 ||
+                 (SparseQPsolutionMethods)sparseQPsolution == CONDENSING_N2))
+        {
+            testFile.dictionary[ "@DATA_DECLARATIONS@" ] +=
+                    "\n\n/* Phases of the preparation step, timed separately. */\n"
+                    "int " + moduleName + "_modelSimulation(  );\n"
+                    "void " + moduleName + "_evaluateObjective(  );\n"
+                    "void " + moduleName + "_condensePrep(  );";
+
+            const char* phases[] = { "modelSimulation", "evaluateObjective", "condensePrep" };
+            const char* labels[] = { "integration", "objective evaluation", "condensing" };
+
+            std::stringstream timing;
+            timing << "\n\t/* Average time of the parallel phases of the preparation step. */\n";
+            for (unsigned i = 0; i < 3; ++i)
+            {
+                timing << "\t" << moduleName << "_tic( &t );\n"
+                       << "\tfor(iter = 0; iter < NUM_STEPS; ++iter) " << moduleName << "_" << phases[ i ] << "( );\n"
+                       << "\tprintf(\"\\t" << labels[ i ] << ": %.3g microseconds\\n\", 1e6 * "
+                       << moduleName << "_toc( &t ) / NUM_STEPS);";
+                if (i < 2)
+                    timing << "\n";
+            }
+            testFile.dictionary[ "@PHASE_TIMING@" ] = timing.str();
+        }
+
         testFile.setup( DUMMY_TEST_FILE,testFileName );
         testFile.configure();
         testFile.exportCode();
@@ -454,6 +533,8 @@ returnValue OCPexport::exportCode(	const std::string& dirName,
 			return ACADOERROR( RET_UNABLE_TO_EXPORT_CODE );
 	}
 
+	RuntimeProfiler::instance().toc( PP_EXPORT_FILES,profilerStart );
+
     return SUCCESSFUL_RETURN;
 }
 
@@ -505,10 +586,14 @@ returnValue OCPexport::setup( )
 
 	ocp.setNumberIntegrationSteps( numSteps );
 	// NOTE: This function internally calls setup() function
+	double profilerStart = RuntimeProfiler::instance().tic( );
+
 	returnvalue = integrator->setModelData( ocp.getModelData() );
  	if ( returnvalue != SUCCESSFUL_RETURN )
  		return returnvalue;
 
+	RuntimeProfiler::instance().toc( PP_EXPORT_INTEGRATOR,profilerStart );
+
 	//
 	// Prepare solver export
 	//
@@ -635,11 +720,15 @@ returnValue OCPexport::setup( )
 
 	solver->setLevenbergMarquardt( levenbergMarquardt );
 
+	profilerStart = RuntimeProfiler::instance().tic( );
+
 	returnValue statusSetup;
 	statusSetup = solver->setup( );
 	if (statusSetup != SUCCESSFUL_RETURN)
 		return ACADOERRORTEXT(status, "Error in setting up solver.");
 
+	RuntimeProfiler::instance().toc( PP_EXPORT_SOLVER,profilerStart );
+
 	setStatus( BS_READY );
 
 	return SUCCESSFUL_RETURN;
@@ -691,6 +780,30 @@ returnValue OCPexport::checkConsistency( ) const
  			( (StateDiscretizationType)discretizationType != MULTIPLE_SHOOTING ) )
  		return ACADOERROR( RET_INVALID_OPTION );
 
+	int reentrantCode;
+	get( CG_REENTRANT_CODE,reentrantCode );
+	if ( (bool)reentrantCode == true )
+	{
+		int qpSolver;
+		get( QP_SOLVER,qpSolver );
+		int generateMexInterface;
+		get( GENERATE_MATLAB_INTERFACE,generateMexInterface );
+		int generateSimulinkInterface;
+		get( GENERATE_SIMULINK_INTERFACE,generateSimulinkInterface );
+
+		if ( (QPSolverName)qpSolver != QP_QPOASES || (HessianApproximationMode)hessianApproximation != GAUSS_NEWTON )
+			return ACADOERRORTEXT(RET_INVALID_OPTION,
+					"Reentrant code is only supported for Gauss-Newton based solvers using qpOASES.");
+
+		if ( (bool)generateMexInterface == true || (bool)generateSimulinkInterface == true )
+			return ACADOERRORTEXT(RET_INVALID_OPTION,
+					"MATLAB and Simulink interfaces are not available for reentrant code.");
+
+		if ( ocp.getFileNameModel().empty() == false )
+			return ACADOERRORTEXT(RET_INVALID_OPTION,
+					"Reentrant code is not supported for external model functions.");
+	}
+
 	return SUCCESSFUL_RETURN;
 }
 
@@ -788,6 +901,8 @@ returnValue OCPexport::exportAcadoHeader(	const std::string& _dirName,
 			make_pair(toString( useAC ), "Providing interface for arrival cost.");
 	options[ modulePrefix + "_COMPUTE_COVARIANCE_MATRIX" ] =
 			make_pair(toString( covCalc ), "Compute covariance matrix of the last state estimate.");
+	options[ modulePrefix + "_REENTRANT_CODE" ] =
+			make_pair(toString( (unsigned)ExportStatement::reentrantCode ), "Indicator for reentrant code, i.e. all data is stored in a context struct.");
 	options[ modulePrefix + "_QP_NV" ] =
 			make_pair(toString( solver->getNumQPvars() ), "Total number of QP optimization variables.");
 
@@ -113,10 +113,14 @@ returnValue SIMexport::exportCode(	const std::string& dirName,
     string moduleName, modulePrefix;
 	get(CG_MODULE_NAME, moduleName);
     get(CG_MODULE_PREFIX, modulePrefix);
+	int multiplyBlockSize;
+	get(CG_MULTIPLY_BLOCK_SIZE, multiplyBlockSize);
     
     ExportDataInternal::fcnPrefix = moduleName;
     ExportStatement::fcnPrefix = moduleName;
     ExportStatement::varPrefix = modulePrefix;
+    ExportStatement::reentrantCode = false;
+    ExportArithmeticStatement::multiplyBlockSize = multiplyBlockSize > 0 ? multiplyBlockSize : 0;
     
 	//
 	// Create the export folders
@@ -308,6 +312,11 @@ returnValue SIMexport::setup( )
 	}
 
 	if( !integrator->equidistantControlGrid() ) return ACADOERROR( RET_INVALID_OPTION );
+
+	int batchSize;
+	get( CG_BATCH_SIZE,batchSize );
+	if ( batchSize < 0 )
+		return ACADOERROR( RET_INVALID_OPTION );
 	
 	setStatus( BS_READY );
 
@@ -370,6 +379,9 @@ returnValue SIMexport::exportTest(	const std::string& _dirName,
 	int sensGen;
 	get( DYNAMIC_SENSITIVITY, sensGen );
 	bool DERIVATIVES = ((ExportSensitivityType) sensGen != NO_SENSITIVITY);
+	int batchSize;
+	get( CG_BATCH_SIZE, batchSize );
+	bool BATCH = TIMING && batchSize > 0;
     
    	string moduleName, modulePrefix;
 	get(CG_MODULE_NAME, moduleName);
@@ -508,7 +520,7 @@ returnValue SIMexport::exportTest(	const std::string& _dirName,
 		main.addStatement( "      		}\n" );
 	}
     main.addLinebreak( );
-    std::string integrate( "      		integrate( x" );
+    std::string integrate( "      		" + moduleName + "_integrate( x" );
     for( i = 0; i < (int)outputGrids.size(); i++ ) {
 		integrate += string(", out") + toString(i);
 	}
@@ -546,7 +558,7 @@ returnValue SIMexport::exportTest(	const std::string& _dirName,
 		main.addStatement( "      		for( j=0; j < (" + modulePrefix + "_NX+" + modulePrefix + "_NXA); j++ ) {\n" );
 		main.addStatement( "      			x[j] = xT[j];\n" );
 		main.addStatement( "      		}\n" );
-		integrate = std::string( "      		integrate( x" );
+		integrate = std::string( "      		" + moduleName + "_integrate( x" );
 		for( i = 0; i < (int)outputGrids.size(); i++ ) {
 			integrate += string(", out") + toString(i);
 		}
@@ -560,6 +572,34 @@ returnValue SIMexport::exportTest(	const std::string& _dirName,
 		main.addLinebreak( );
 		main.addStatement( "      printf( \"\\n\\n AVERAGE DURATION OF ONE INTEGRATION STEP:   %.3g μs\\n\\n\", 1e6*time/STEPS_TIMING );\n" );
 	}
+	if( BATCH == true ) {
+		// every trajectory starts from a zero workspace and a reset integrator,
+		// hence no warm start (stage values, step size, factorization) is shared
+		main.addLinebreak( );
+		main.addStatement( "      gettimeofday( &theclock,0 );\n" );
+		main.addStatement( "      start = 1.0*theclock.tv_sec + 1.0e-6*theclock.tv_usec;\n" );
+		main.addStatement( "      nil = 0;\n" );
+		main.addStatement( "      for( k = 0; k < " + modulePrefix + "_BATCH_SIZE; k++ ) {\n" );
+		main.addStatement( " 	  		" + moduleName + "Workspace = nullWork2;\n" );
+		if( !DERIVATIVES )  main.addStatement( "      		for( j=0; j < " + modulePrefix + "_NX+" + modulePrefix + "_NXA+" + modulePrefix + "_NU; j++ ) {\n" );
+		else  main.addStatement( "      		for( j=0; j < (" + modulePrefix + "_NX+" + modulePrefix + "_NXA)*(1+" + modulePrefix + "_NX+" + modulePrefix + "_NU)+" + modulePrefix + "_NU; j++ ) {\n" );
+		main.addStatement( "      			x[j] = xT[j];\n" );
+		main.addStatement( "      		}\n" );
+		main.addStatement( "      		for( i=0; i < " + modulePrefix + "_N; i++ ) {\n" );
+		integrate = std::string( "      			nil += (" + moduleName + "_integrate( x" );
+		for( i = 0; i < (int)outputGrids.size(); i++ ) {
+			integrate += string(", out") + toString(i);
+		}
+		integrate += ", i == 0 ) != 0";
+		main.addStatement( integrate + ");\n" );
+		main.addStatement( "      		}\n" );
+		main.addStatement( "      }\n" );
+		main.addStatement( "      gettimeofday( &theclock,0 );\n" );
+		main.addStatement( "      end = 1.0*theclock.tv_sec + 1.0e-6*theclock.tv_usec;\n" );
+		main.addStatement( "      time = (end-start);\n" );
+		main.addLinebreak( );
+		main.addStatement( "      printf( \" THROUGHPUT OF THE INTEGRATOR:   %.3g trajectories/s (%d failed integrations)\\n\\n\", " + modulePrefix + "_BATCH_SIZE/time, nil );\n" );
+	}
     main.addLinebreak( );
 	main.addStatement( "      return 0;\n" );
 	main.addStatement( "}\n" );
@@ -817,6 +857,9 @@ returnValue SIMexport::exportAcadoHeader(	const std::string& _dirName,
 	int useSinglePrecision;
 	get(USE_SINGLE_PRECISION, useSinglePrecision);
 
+	int batchSize;
+	get(CG_BATCH_SIZE, batchSize);
+
 	string fileName;
 	fileName = _dirName + "/" + _fileName;
 
@@ -833,6 +876,7 @@ returnValue SIMexport::exportAcadoHeader(	const std::string& _dirName,
 	options[ modulePrefix + "_NU" ]  = make_pair(toString( getNU() ),  "Number of control variables.");
 	options[ modulePrefix + "_NOD" ]  = make_pair(toString( getNOD() ),  "Number of online data values.");
 	options[ modulePrefix + "_NUMOUT" ]  = make_pair(toString( nOutV.getDim() ),  "Number of output functions.");
+	options[ modulePrefix + "_BATCH_SIZE" ]  = make_pair(toString( batchSize ),  "Number of trajectories used to measure the throughput of the integrator.");
 
 	if( !nMeasV.isEmpty() && !nOutV.isEmpty() ) {
 		std::ostringstream acado_nout;
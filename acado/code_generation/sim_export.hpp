@@ -55,6 +55,13 @@ class IntegratorExport;
  * 	of this integrator will be evaluated on accuracy of the results and the time
  * 	complexity. 
  *
+ *  Many independent trajectories, e.g. for a Monte Carlo simulation, are
+ *  integrated by a plain loop over the trajectories. The integrator keeps a
+ *  warm start in its workspace (stage values, step size, factorization), so
+ *  each trajectory starts from a zero workspace and calls integrate() with
+ *  resetIntegrator = 1 on its first interval. With CG_BATCH_SIZE > 0 the
+ *  exported test program measures the throughput of such a loop.
+ *
  *	\author Rien Quirynen
  */
 class SIMexport : public ExportModule, public ModelContainer
@@ -256,7 +256,17 @@ returnValue DenseCP::setQPsolution( const DVector &x_, const DVector &y_ ){
 
 DVector DenseCP::getMergedDualSolution( ) const
 {
-	DVector dualSolution( getNV()+getNC() );
+	DVector dualSolution;
+	getMergedDualSolution( dualSolution );
+
+	return dualSolution;
+}
+
+
+returnValue DenseCP::getMergedDualSolution( DVector& dualSolution ) const
+{
+	if ( dualSolution.getDim( ) != getNV()+getNC() )
+		dualSolution.init( getNV()+getNC() );
 
 	uint i;
 	for( i=0; i<getNV(); ++i )
@@ -275,7 +285,7 @@ DVector DenseCP::getMergedDualSolution( ) const
 			dualSolution( getNV()+i ) = (*yubA)(i);
 	}
 
-	return dualSolution;
+	return SUCCESSFUL_RETURN;
 }
 
 
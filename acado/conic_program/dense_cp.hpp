@@ -120,6 +120,15 @@ class DenseCP{
         DVector getMergedDualSolution( ) const;
 
 
+        /** Writes the dual solution of dimension nV + nC, in the format      \n
+         *  expected by setQPsolution, into the given vector, whose storage   \n
+         *  is reused if it has this dimension already.                        \n
+         *                                                                   \n
+         *  \return SUCCESSFUL_RETURN                                        \n
+         */
+        returnValue getMergedDualSolution( DVector& dualSolution ) const;
+
+
 		/** Prints CP to standard ouput stream. Various settings can
 		 *	be specified defining its output format. 
 		 *
@@ -32,6 +32,7 @@
 
 #include <acado/conic_solver/condensing_based_cp_solver.hpp>
 #include <acado/bindings/acado_qpoases/qp_solver_qpoases.hpp>
+#include <acado/clock/runtime_profiler.hpp>
 
 using namespace Eigen;
 using namespace std;
@@ -175,10 +176,12 @@ returnValue CondensingBasedCPsolver::prepareSolve(	BandedCP& cp
 
 	clock.reset( );
 	clock.start( );
+	double profilerStart = RuntimeProfiler::instance().tic( );
 
     returnValue returnvalue = condense( cp );
     if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR(returnvalue);
 
+	RuntimeProfiler::instance().toc( PP_CONDENSING,profilerStart );
 	clock.stop( );
 	setLast( LOG_TIME_CONDENSING,clock.getTime() );
 
@@ -260,10 +263,12 @@ returnValue CondensingBasedCPsolver::finalizeSolve(	BandedCP& cp
     // ------------------------------------
 	clock.reset( );
 	clock.start( );
+	double profilerStart = RuntimeProfiler::instance().tic( );
 
     returnValue returnvalue = expand( cp );
     if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR(returnvalue);
 
+	RuntimeProfiler::instance().toc( PP_EXPANSION,profilerStart );
 	clock.stop( );
 	setLast( LOG_TIME_EXPAND,clock.getTime() );
 	
@@ -446,10 +451,17 @@ returnValue CondensingBasedCPsolver::solveCPsubproblem( )
 
 	RealClock clock;
 	clock.start( );
+	double profilerStart = RuntimeProfiler::instance().tic( );
 
 // 	denseCP.print( "",PS_MATLAB );
 	returnvalue = solveQP( maxQPiter );
 
+	// rough estimate for a dense active-set solver: one factorization
+	// plus one rank-one update per iteration
+	double nV = denseCP.getNV( );
+	double nC = denseCP.getNC( );
+	RuntimeProfiler::instance().toc( PP_QP,profilerStart,
+			nV*nV*nV/3.0 + cpSolver->getNumberOfIterations( )*nV*(nV+nC) );
 	clock.stop( );
 	setLast( LOG_TIME_QP,clock.getTime() );
 
@@ -534,8 +546,8 @@ returnValue CondensingBasedCPsolver::condense(	BandedCP& cp
 		if ( condensingStatus != COS_FROZEN )
 		{
 			// generate H
-			hT       = cp.hessian*T;
-			HDense   = T^hT;
+			cp.hessian.multiply( T,hT );
+			T.multiplyTransposed( hT,HDense );
 
 			if( getNX() != 0 ) generateHessianBlockLine( getNX(), rowOffset, rowOffset1 );
 			rowOffset++;
@@ -560,7 +572,7 @@ returnValue CondensingBasedCPsolver::condense(	BandedCP& cp
 
 
 			// generate A
-			ADense   = cp.constraintGradient*T;
+			cp.constraintGradient.multiply( T,ADense );
 
 			denseCP.A.setZero();
 
@@ -578,29 +590,30 @@ returnValue CondensingBasedCPsolver::condense(	BandedCP& cp
 
 
 		// generate g
-		gDense   = (cp.objectiveGradient*T) + (d^hT);
+		cp.objectiveGradient.multiply( T,gDense );
+		d.multiplyTransposed( hT,dhT );
+		gDense  += dhT;
 		
         generateObjectiveGradient( );
 
 
 		// generate lb, ub
-        BlockMatrix dCut(4*N+1,1);
-        DMatrix tmp;
+        dCut.reset( 4*N+1,1 );
         for( run1 = 0; run1 < N; run1++ ){
-            d.getSubBlock(run1,0,tmp);
-            if( tmp.getDim() != 0 )
-                dCut.setDense(run1,0,tmp);
+            if( d.getSubBlock(run1,0).getDim() != 0 )
+                dCut.setDense(run1,0,d.getSubBlock(run1,0));
         }
 
-        lbDense  = cp.lowerBoundResiduum - dCut;
-        ubDense  = cp.upperBoundResiduum - dCut;
+        cp.lowerBoundResiduum.subtract( dCut,lbDense );
+        cp.upperBoundResiduum.subtract( dCut,ubDense );
 
         generateBoundVectors( );
 
 
 		// generate lbA, ubA
-		lbADense = cp.lowerConstraintResiduum - cp.constraintGradient*d;
-		ubADense = cp.upperConstraintResiduum - cp.constraintGradient*d;
+		cp.constraintGradient.multiply( d,Ad );
+		cp.lowerConstraintResiduum.subtract( Ad,lbADense );
+		cp.upperConstraintResiduum.subtract( Ad,ubADense );
 
         rowOffset1 = 0;
         for( run3 = 0; run3 < ADense.getNumRows(); run3++ ){
@@ -696,51 +709,36 @@ returnValue CondensingBasedCPsolver::condense(	BandedCP& cp
 
 returnValue CondensingBasedCPsolver::generateHessianBlockLine( uint nn, uint rowOffset, uint& rowOffset1 ){
 
-    uint run1, run2, run3;
+    uint run3;
 
     uint  colOffset  = 0;
     uint  colOffset1 = 0;
 
     uint N = getNumPoints();
 
-    DMatrix tmp;
-
     if( getNX() != 0 ){
-        HDense.getSubBlock( rowOffset, 0, tmp, nn, getNX() );
-
-        for( run1 = 0; run1 < nn; run1++ )
-            for( run2 = 0; run2 < getNX(); run2++ )
-                denseCP.H(rowOffset1+run1,run2) = tmp(run1,run2);
+        HDense.copySubBlock( rowOffset, 0, nn, getNX(), denseCP.H, rowOffset1, colOffset1 );
         colOffset1 += getNX();
     }
     colOffset++;
 
     for( run3 = 0; run3 < N; run3++ ){
          if( getNXA() != 0 ){
-            HDense.getSubBlock( rowOffset, colOffset, tmp, nn, getNXA() );
-            for( run1 = 0; run1 < nn; run1++ )
-                for( run2 = 0; run2 < getNXA(); run2++ )
-                    denseCP.H(rowOffset1+run1,colOffset1+run2) = tmp(run1,run2);
+            HDense.copySubBlock( rowOffset, colOffset, nn, getNXA(), denseCP.H, rowOffset1, colOffset1 );
             colOffset1 += getNXA();
         }
         colOffset  ++;
     }
 
     if( getNP() != 0 ){
-        HDense.getSubBlock( rowOffset, colOffset, tmp, nn, getNP() );
-        for( run1 = 0; run1 < nn; run1++ )
-            for( run2 = 0; run2 < getNP(); run2++ )
-                denseCP.H(rowOffset1+run1,colOffset1+run2) = tmp(run1,run2);
+        HDense.copySubBlock( rowOffset, colOffset, nn, getNP(), denseCP.H, rowOffset1, colOffset1 );
          colOffset1 += getNP();
      }
      colOffset  ++;
 
      for( run3 = 0; run3 < N-1; run3++ ){
           if( getNU() != 0 ){
-             HDense.getSubBlock( rowOffset, colOffset, tmp, nn, getNU() );
-             for( run1 = 0; run1 < nn; run1++ )
-                 for( run2 = 0; run2 < getNU(); run2++ )
-                     denseCP.H(rowOffset1+run1,colOffset1+run2) = tmp(run1,run2);
+             HDense.copySubBlock( rowOffset, colOffset, nn, getNU(), denseCP.H, rowOffset1, colOffset1 );
              colOffset1 += getNU();
          }
          colOffset  ++;
@@ -748,10 +746,7 @@ returnValue CondensingBasedCPsolver::generateHessianBlockLine( uint nn, uint row
 
      for( run3 = 0; run3 < N-1; run3++ ){
          if( getNW() != 0 ){
-              HDense.getSubBlock( rowOffset, colOffset, tmp, nn, getNW() );
-              for( run1 = 0; run1 < nn; run1++ )
-                  for( run2 = 0; run2 < getNW(); run2++ )
-                      denseCP.H(rowOffset1+run1,colOffset1+run2) = tmp(run1,run2);
+              HDense.copySubBlock( rowOffset, colOffset, nn, getNW(), denseCP.H, rowOffset1, colOffset1 );
               colOffset1 += getNW();
          }
          colOffset  ++;
@@ -765,50 +760,36 @@ returnValue CondensingBasedCPsolver::generateHessianBlockLine( uint nn, uint row
 returnValue CondensingBasedCPsolver::generateConstraintBlockLine( uint nn, uint rowOffset, uint& rowOffset1 ){
 
 
-    uint run1, run2, run3;
+    uint run3;
 
     uint  colOffset  = 0;
     uint  colOffset1 = 0;
 
     uint N = getNumPoints();
 
-    DMatrix tmp;
-
     if( getNX() != 0 ){
-        ADense.getSubBlock( rowOffset, 0, tmp, nn, getNX() );
-        for( run1 = 0; run1 < nn; run1++ )
-            for( run2 = 0; run2 < getNX(); run2++ )
-                denseCP.A(rowOffset1+run1,run2) = tmp(run1,run2);
+        ADense.copySubBlock( rowOffset, 0, nn, getNX(), denseCP.A, rowOffset1, colOffset1 );
         colOffset1 += getNX();
     }
     colOffset++;
 
     for( run3 = 0; run3 < N; run3++ ){
          if( getNXA() != 0 ){
-            ADense.getSubBlock( rowOffset, colOffset, tmp, nn, getNXA() );
-            for( run1 = 0; run1 < nn; run1++ )
-                for( run2 = 0; run2 < getNXA(); run2++ )
-                    denseCP.A(rowOffset1+run1,colOffset1+run2) = tmp(run1,run2);
+            ADense.copySubBlock( rowOffset, colOffset, nn, getNXA(), denseCP.A, rowOffset1, colOffset1 );
             colOffset1 += getNXA();
         }
         colOffset  ++;
     }
 
     if( getNP() != 0 ){
-        ADense.getSubBlock( rowOffset, colOffset, tmp, nn, getNP() );
-        for( run1 = 0; run1 < nn; run1++ )
-            for( run2 = 0; run2 < getNP(); run2++ )
-                denseCP.A(rowOffset1+run1,colOffset1+run2) = tmp(run1,run2);
+        ADense.copySubBlock( rowOffset, colOffset, nn, getNP(), denseCP.A, rowOffset1, colOffset1 );
          colOffset1 += getNP();
      }
      colOffset  ++;
 
      for( run3 = 0; run3 < N-1; run3++ ){
           if( getNU() != 0 ){
-             ADense.getSubBlock( rowOffset, colOffset, tmp, nn, getNU() );
-             for( run1 = 0; run1 < nn; run1++ )
-                 for( run2 = 0; run2 < getNU(); run2++ )
-                     denseCP.A(rowOffset1+run1,colOffset1+run2) = tmp(run1,run2);
+             ADense.copySubBlock( rowOffset, colOffset, nn, getNU(), denseCP.A, rowOffset1, colOffset1 );
              colOffset1 += getNU();
          }
          colOffset  ++;
@@ -816,10 +797,7 @@ returnValue CondensingBasedCPsolver::generateConstraintBlockLine( uint nn, uint
 
      for( run3 = 0; run3 < N-1; run3++ ){
          if( getNW() != 0 ){
-              ADense.getSubBlock( rowOffset, colOffset, tmp, nn, getNW() );
-              for( run1 = 0; run1 < nn; run1++ )
-                  for( run2 = 0; run2 < getNW(); run2++ )
-                      denseCP.A(rowOffset1+run1,colOffset1+run2) = tmp(run1,run2);
+              ADense.copySubBlock( rowOffset, colOffset, nn, getNW(), denseCP.A, rowOffset1, colOffset1 );
               colOffset1 += getNW();
          }
          colOffset  ++;
@@ -833,50 +811,36 @@ returnValue CondensingBasedCPsolver::generateConstraintBlockLine( uint nn, uint
 returnValue CondensingBasedCPsolver::generateStateBoundBlockLine( uint nn, uint rowOffset, uint& rowOffset1 ){
 
 
-    uint run1, run2, run3;
+    uint run3;
 
     uint  colOffset  = 0;
     uint  colOffset1 = 0;
 
     uint N = getNumPoints();
 
-    DMatrix tmp;
-
     if( getNX() != 0 ){
-        T.getSubBlock( rowOffset, 0, tmp, nn, getNX() );
-        for( run1 = 0; run1 < nn; run1++ )
-            for( run2 = 0; run2 < getNX(); run2++ )
-                denseCP.A(rowOffset1+run1,run2) = tmp(run1,run2);
+        T.copySubBlock( rowOffset, 0, nn, getNX(), denseCP.A, rowOffset1, colOffset1 );
         colOffset1 += getNX();
     }
     colOffset++;
 
     for( run3 = 0; run3 < N; run3++ ){
          if( getNXA() != 0 ){
-            T.getSubBlock( rowOffset, colOffset, tmp, nn, getNXA() );
-            for( run1 = 0; run1 < nn; run1++ )
-                for( run2 = 0; run2 < getNXA(); run2++ )
-                    denseCP.A(rowOffset1+run1,colOffset1+run2) = tmp(run1,run2);
+            T.copySubBlock( rowOffset, colOffset, nn, getNXA(), denseCP.A, rowOffset1, colOffset1 );
             colOffset1 += getNXA();
         }
         colOffset  ++;
     }
 
     if( getNP() != 0 ){
-        T.getSubBlock( rowOffset, colOffset, tmp, nn, getNP() );
-        for( run1 = 0; run1 < nn; run1++ )
-            for( run2 = 0; run2 < getNP(); run2++ )
-                denseCP.A(rowOffset1+run1,colOffset1+run2) = tmp(run1,run2);
+        T.copySubBlock( rowOffset, colOffset, nn, getNP(), denseCP.A, rowOffset1, colOffset1 );
          colOffset1 += getNP();
      }
      colOffset  ++;
 
      for( run3 = 0; run3 < N-1; run3++ ){
           if( getNU() != 0 ){
-             T.getSubBlock( rowOffset, colOffset, tmp, nn, getNU() );
-             for( run1 = 0; run1 < nn; run1++ )
-                 for( run2 = 0; run2 < getNU(); run2++ )
-                     denseCP.A(rowOffset1+run1,colOffset1+run2) = tmp(run1,run2);
+             T.copySubBlock( rowOffset, colOffset, nn, getNU(), denseCP.A, rowOffset1, colOffset1 );
              colOffset1 += getNU();
          }
          colOffset  ++;
@@ -884,10 +848,7 @@ returnValue CondensingBasedCPsolver::generateStateBoundBlockLine( uint nn, uint
 
      for( run3 = 0; run3 < N-1; run3++ ){
          if( getNW() != 0 ){
-              T.getSubBlock( rowOffset, colOffset, tmp, nn, getNW() );
-              for( run1 = 0; run1 < nn; run1++ )
-                  for( run2 = 0; run2 < getNW(); run2++ )
-                      denseCP.A(rowOffset1+run1,colOffset1+run2) = tmp(run1,run2);
+              T.copySubBlock( rowOffset, colOffset, nn, getNW(), denseCP.A, rowOffset1, colOffset1 );
               colOffset1 += getNW();
          }
          colOffset  ++;
@@ -900,17 +861,9 @@ returnValue CondensingBasedCPsolver::generateStateBoundBlockLine( uint nn, uint
 
 returnValue CondensingBasedCPsolver::generateConstraintVectors( uint nn, uint rowOffset, uint& rowOffset1 ){
 
-    uint run1;
-
-    DMatrix tmp;
+    lbADense.copySubBlock( rowOffset, 0, nn, denseCP.lbA, rowOffset1 );
 
-    lbADense.getSubBlock( rowOffset, 0, tmp, nn, 1 );
-    for( run1 = 0; run1 < nn; run1++ )
-        denseCP.lbA(rowOffset1+run1) = tmp(run1,0);
-
-    ubADense.getSubBlock( rowOffset, 0, tmp, nn, 1 );
-    for( run1 = 0; run1 < nn; run1++ )
-        denseCP.ubA(rowOffset1+run1) = tmp(run1,0);
+    ubADense.copySubBlock( rowOffset, 0, nn, denseCP.ubA, rowOffset1 );
 
     rowOffset1 += nn;
 
@@ -920,17 +873,9 @@ returnValue CondensingBasedCPsolver::generateConstraintVectors( uint nn, uint ro
 
 returnValue CondensingBasedCPsolver::generateStateBoundVectors( uint nn, uint rowOffset, uint& rowOffset1 ){
 
-    uint run1;
-
-    DMatrix tmp;
+    lbDense.copySubBlock( rowOffset, 0, nn, denseCP.lbA, rowOffset1 );
 
-    lbDense.getSubBlock( rowOffset, 0, tmp, nn, 1 );
-    for( run1 = 0; run1 < nn; run1++ )
-        denseCP.lbA(rowOffset1+run1) = tmp(run1,0);
-
-    ubDense.getSubBlock( rowOffset, 0, tmp, nn, 1 );
-    for( run1 = 0; run1 < nn; run1++ )
-        denseCP.ubA(rowOffset1+run1) = tmp(run1,0);
+    ubDense.copySubBlock( rowOffset, 0, nn, denseCP.ubA, rowOffset1 );
 
     rowOffset1 += nn;
 
@@ -940,57 +885,39 @@ returnValue CondensingBasedCPsolver::generateStateBoundVectors( uint nn, uint ro
 
 returnValue CondensingBasedCPsolver::generateBoundVectors( ){
 
-    uint run1, run3;
+    uint run3;
 
     uint N = getNumPoints();
 
     uint  rowOffset  = N;
     uint  rowOffset1 = 0;
 
-    DMatrix tmp;
-
     if( getNX() != 0 ){
-        lbDense.getSubBlock( 0, 0, tmp, getNX(), 1 );
-        for( run1 = 0; run1 < getNX(); run1++ )
-            denseCP.lb(rowOffset1+run1) = tmp(run1,0);
-        ubDense.getSubBlock( 0, 0, tmp, getNX(), 1 );
-        for( run1 = 0; run1 < getNX(); run1++ )
-            denseCP.ub(rowOffset1+run1) = tmp(run1,0);
+        lbDense.copySubBlock( 0, 0, getNX(), denseCP.lb, rowOffset1 );
+        ubDense.copySubBlock( 0, 0, getNX(), denseCP.ub, rowOffset1 );
         rowOffset1 += getNX();
     }
 
     for( run3 = 0; run3 < N; run3++ ){
          if( getNXA() != 0 ){
-            lbDense.getSubBlock( rowOffset, 0, tmp, getNXA(), 1 );
-            for( run1 = 0; run1 < getNXA(); run1++ )
-                denseCP.lb(rowOffset1+run1) = tmp(run1,0);
-            ubDense.getSubBlock( rowOffset, 0, tmp, getNXA(), 1 );
-            for( run1 = 0; run1 < getNXA(); run1++ )
-                denseCP.ub(rowOffset1+run1) = tmp(run1,0);
+            lbDense.copySubBlock( rowOffset, 0, getNXA(), denseCP.lb, rowOffset1 );
+            ubDense.copySubBlock( rowOffset, 0, getNXA(), denseCP.ub, rowOffset1 );
             rowOffset1 += getNXA();
         }
         rowOffset++;
     }
 
     if( getNP() != 0 ){
-        lbDense.getSubBlock( rowOffset, 0, tmp, getNP(), 1 );
-        for( run1 = 0; run1 < getNP(); run1++ )
-            denseCP.lb(rowOffset1+run1) = tmp(run1,0);
-        ubDense.getSubBlock( rowOffset, 0, tmp, getNP(), 1 );
-        for( run1 = 0; run1 < getNP(); run1++ )
-            denseCP.ub(rowOffset1+run1) = tmp(run1,0);
+        lbDense.copySubBlock( rowOffset, 0, getNP(), denseCP.lb, rowOffset1 );
+        ubDense.copySubBlock( rowOffset, 0, getNP(), denseCP.ub, rowOffset1 );
          rowOffset1 += getNP();
      }
      rowOffset++;
 
      for( run3 = 0; run3 < N-1; run3++ ){
           if( getNU() != 0 ){
-             lbDense.getSubBlock( rowOffset, 0, tmp, getNU(), 1 );
-             for( run1 = 0; run1 < getNU(); run1++ )
-                 denseCP.lb(rowOffset1+run1) = tmp(run1,0);
-             ubDense.getSubBlock( rowOffset, 0, tmp, getNU(), 1 );
-             for( run1 = 0; run1 < getNU(); run1++ )
-                 denseCP.ub(rowOffset1+run1) = tmp(run1,0);
+             lbDense.copySubBlock( rowOffset, 0, getNU(), denseCP.lb, rowOffset1 );
+             ubDense.copySubBlock( rowOffset, 0, getNU(), denseCP.ub, rowOffset1 );
              rowOffset1 += getNU();
          }
          rowOffset++;
@@ -999,12 +926,8 @@ returnValue CondensingBasedCPsolver::generateBoundVectors( ){
 
      for( run3 = 0; run3 < N-1; run3++ ){
          if( getNW() != 0 ){
-              lbDense.getSubBlock( rowOffset, 0, tmp, getNW(), 1 );
-              for( run1 = 0; run1 < getNW(); run1++ )
-                  denseCP.lb(rowOffset1+run1) = tmp(run1,0);
-              ubDense.getSubBlock( rowOffset, 0, tmp, getNW(), 1 );
-              for( run1 = 0; run1 < getNW(); run1++ )
-                  denseCP.ub(rowOffset1+run1) = tmp(run1,0);
+              lbDense.copySubBlock( rowOffset, 0, getNW(), denseCP.lb, rowOffset1 );
+              ubDense.copySubBlock( rowOffset, 0, getNW(), denseCP.ub, rowOffset1 );
               rowOffset1 += getNW();
          }
          rowOffset  ++;
@@ -1016,46 +939,36 @@ returnValue CondensingBasedCPsolver::generateBoundVectors( ){
 
 returnValue CondensingBasedCPsolver::generateObjectiveGradient( ){
 
-    uint run1, run3;
+    uint run3;
 
     uint  rowOffset  = 0;
     uint  rowOffset1 = 0;
 
     uint N = getNumPoints();
 
-    DMatrix tmp;
-
     if( getNX() != 0 ){
-        gDense.getSubBlock( 0, 0, tmp, 1, getNX() );
-        for( run1 = 0; run1 < getNX(); run1++ )
-            denseCP.g(rowOffset1+run1) = tmp(0,run1);
+        gDense.copySubBlock( 0, 0, getNX(), denseCP.g, rowOffset1 );
         rowOffset1 += getNX();
     }
     rowOffset++;
 
     for( run3 = 0; run3 < N; run3++ ){
          if( getNXA() != 0 ){
-            gDense.getSubBlock( 0, rowOffset, tmp, 1, getNXA() );
-            for( run1 = 0; run1 < getNXA(); run1++ )
-                denseCP.g(rowOffset1+run1) = tmp(0,run1);
+            gDense.copySubBlock( 0, rowOffset, getNXA(), denseCP.g, rowOffset1 );
             rowOffset1 += getNXA();
         }
         rowOffset++;
     }
 
     if( getNP() != 0 ){
-        gDense.getSubBlock( 0, rowOffset, tmp, 1, getNP() );
-        for( run1 = 0; run1 < getNP(); run1++ )
-            denseCP.g(rowOffset1+run1) = tmp(0,run1);
+        gDense.copySubBlock( 0, rowOffset, getNP(), denseCP.g, rowOffset1 );
          rowOffset1 += getNP();
      }
      rowOffset++;
 
      for( run3 = 0; run3 < N-1; run3++ ){
           if( getNU() != 0 ){
-             gDense.getSubBlock( 0, rowOffset, tmp, 1, getNU() );
-             for( run1 = 0; run1 < getNU(); run1++ )
-                 denseCP.g(rowOffset1+run1) = tmp(0,run1);
+             gDense.copySubBlock( 0, rowOffset, getNU(), denseCP.g, rowOffset1 );
              rowOffset1 += getNU();
          }
          rowOffset++;
@@ -1063,9 +976,7 @@ returnValue CondensingBasedCPsolver::generateObjectiveGradient( ){
 
      for( run3 = 0; run3 < N-1; run3++ ){
          if( getNW() != 0 ){
-              gDense.getSubBlock( 0, rowOffset, tmp, 1, getNW() );
-              for( run1 = 0; run1 < getNW(); run1++ )
-                  denseCP.g(rowOffset1+run1) = tmp(0,run1);
+              gDense.copySubBlock( 0, rowOffset, getNW(), denseCP.g, rowOffset1 );
               rowOffset1 += getNW();
          }
          rowOffset  ++;
@@ -1096,51 +1007,36 @@ returnValue CondensingBasedCPsolver::expand(	BandedCP& cp
     uint N = getNumPoints();
 
 
-	DVector denseDualSolution( denseCP.getMergedDualSolution( ) );
+	denseCP.getMergedDualSolution( denseDualSolution );
 
     if( getNX() != 0 ){
 
-        BlockMatrix primalDense;
-        primalDense.init( 3*N, 1 );
-
-        DMatrix tmp;
+        primalDense.reset( 3*N, 1 );
 
         rowCount  = 0;
         rowCount1 = 0;
 
-        tmp.init( getNX(), 1 );
-        for( run1 = 0; run1 < getNX(); run1++ )
-            tmp(run1,0) = (*denseCP.x)(run1);
-        primalDense.setDense( 0, 0, tmp );
+        primalDense.setDense( 0, 0, *denseCP.x, rowCount1, getNX() );
         rowCount1 += getNX();
         rowCount++;
 
         for( run2 = 0; run2 < N; run2++ ){
             if( getNXA() != 0 ){
-                tmp.init( getNXA(), 1 );
-                for( run1 = 0; run1 < getNXA(); run1++ )
-                    tmp(run1,0) = (*denseCP.x)(rowCount1+run1);
-                primalDense.setDense( rowCount, 0, tmp );
+                primalDense.setDense( rowCount, 0, *denseCP.x, rowCount1, getNXA() );
                 rowCount1 += getNXA();
             }
             rowCount++;
         }
 
         if( getNP() != 0 ){
-            tmp.init( getNP(), 1 );
-            for( run1 = 0; run1 < getNP(); run1++ )
-                tmp(run1,0) = (*denseCP.x)(rowCount1+run1);
-            primalDense.setDense( rowCount, 0, tmp );
+            primalDense.setDense( rowCount, 0, *denseCP.x, rowCount1, getNP() );
             rowCount1 += getNP();
         }
         rowCount++;
 
         for( run2 = 0; run2 < N-1; run2++ ){
             if( getNU() != 0 ){
-                tmp.init( getNU(), 1 );
-                for( run1 = 0; run1 < getNU(); run1++ )
-                    tmp(run1,0) = (*denseCP.x)(rowCount1+run1);
-                primalDense.setDense( rowCount, 0, tmp );
+                primalDense.setDense( rowCount, 0, *denseCP.x, rowCount1, getNU() );
                 rowCount1 += getNU();
             }
             rowCount++;
@@ -1148,22 +1044,20 @@ returnValue CondensingBasedCPsolver::expand(	BandedCP& cp
 
         for( run2 = 0; run2 < N-1; run2++ ){
             if( getNW() != 0 ){
-                tmp.init( getNW(), 1 );
-                for( run1 = 0; run1 < getNW(); run1++ )
-                    tmp(run1,0) = (*denseCP.x)(rowCount1+run1);
-                primalDense.setDense( rowCount, 0, tmp );
+                primalDense.setDense( rowCount, 0, *denseCP.x, rowCount1, getNW() );
                 rowCount1 += getNW();
             }
             rowCount++;
         }
 
-        cp.deltaX = T*primalDense + d;
-
-        BlockMatrix aux;
+        T.multiply( primalDense,cp.deltaX );
+        cp.deltaX += d;
 
-        aux = (cp.deltaX^cp.hessian) + cp.objectiveGradient;
+        cp.deltaX.multiplyTransposed( cp.hessian,aux );
+        aux += cp.objectiveGradient;
 
-        DVector aux2(N*getNX());
+        if( aux2.getDim() != N*getNX() )
+            aux2.init( N*getNX() );
         aux2.setZero();
 
         int run = 0;
@@ -1171,7 +1065,7 @@ returnValue CondensingBasedCPsolver::expand(	BandedCP& cp
 
         for( run1 = 0; run1 < (uint)cp.constraintGradient.getNumRows(); run1++ ){
             for( run2 = 0; run2 < N; run2++ ){
-                cp.constraintGradient.getSubBlock( run1, run2, tmp );
+                const DMatrix& tmp = cp.constraintGradient.getSubBlock( run1, run2 );
                 for( run3 = 0; run3 < (uint)tmp.getNumRows(); run3++ ){
                     for( run4 = 0; run4 < getNX(); run4++ ){
                         aux2(run2*getNX()+run4) += denseDualSolution(nF+run+run3)*tmp(run3,run4);
@@ -1181,7 +1075,8 @@ returnValue CondensingBasedCPsolver::expand(	BandedCP& cp
             }
         }
 
-        DVector aux3(N*getNX());
+        if( aux3.getDim() != N*getNX() )
+            aux3.init( N*getNX() );
 
         for( run2 = 0; run2 < getNX(); run2++ )
             aux3(run2) = denseDualSolution(run2);
@@ -1193,15 +1088,16 @@ returnValue CondensingBasedCPsolver::expand(	BandedCP& cp
             for( run2 = 0; run2 < getNX(); run2++ )
                 aux3((run1+1)*getNX()+run2) = denseDualSolution(run+run1*getNX()+run2);
 
-        DVector *aux4 = new DVector[N-1];
+        aux4.resize( N-1 );
 
         // aux  = x^T denseCP.H + denseCP.g      (BlockMatrix)
         // aux2 = lambda^T denseCP.A     (DVector     )
         // aux3 = lambda_bound   (DVector     )
 
         for( run1 = 0; run1 < N-1; run1++ ){
-            aux4[run1].init(getNX());
-            aux.getSubBlock( 0, run1+1, tmp );
+            if( aux4[run1].getDim() != getNX() )
+                aux4[run1].init(getNX());
+            const DMatrix& tmp = aux.getSubBlock( 0, run1+1 );
 
             for( run2 = 0; run2 < getNX(); run2++ ){
                 aux4[run1](run2) = tmp(0,run2) - aux2( (run1+1)*getNX()+run2 ) - aux3( (run1+1)*getNX()+run2 );
@@ -1210,84 +1106,55 @@ returnValue CondensingBasedCPsolver::expand(	BandedCP& cp
 
         // aux4[...] = x^T denseCP.H + denseCP.g - lambda^T denseCP.A - lambda_bound
 
-        DMatrix Gx;
-        DVector *lambdaDyn;
-        lambdaDyn = new DVector[N-1];
+        lambdaDyn.resize( N-1 );
         lambdaDyn[N-2] = aux4[N-2];
 
         for( run1 = N-2; run1 >= 1; run1-- ){
-            cp.dynGradient.getSubBlock( run1, 0,  Gx );
-            lambdaDyn[run1-1] = (Gx.transpose() * lambdaDyn[run1]) + aux4[run1-1];
+            const DMatrix& Gx = cp.dynGradient.getSubBlock( run1, 0 );
+            lambdaDyn[run1-1].noalias() = Gx.transpose() * lambdaDyn[run1];
+            lambdaDyn[run1-1] += aux4[run1-1];
         }
 
-        cp.lambdaDynamic.init( N-1, 1 );
+        cp.lambdaDynamic.reset( N-1, 1 );
 
-        for( run1 = 0; run1 < N-1; run1++ ){
-            tmp.init( lambdaDyn[run1].getDim(), 1 );
-            for( run2 = 0; run2 < lambdaDyn[run1].getDim(); run2++ )
-                tmp(run2,0) = lambdaDyn[run1].operator()(run2);
-            cp.lambdaDynamic.setDense( run1, 0, tmp );
-        }
+        for( run1 = 0; run1 < N-1; run1++ )
+            cp.lambdaDynamic.setDense( run1, 0, lambdaDyn[run1], 0, lambdaDyn[run1].getDim() );
 
 
         int dynMode;
         get( DYNAMIC_SENSITIVITY, dynMode );
 
         if( dynMode == FORWARD_SENSITIVITY_LIFTED ){
-            for( run1 = 0; run1 < N-1; run1++ ){
-                 tmp.init( lambdaDyn[run1].getDim(), 1 );
-                 tmp.setAll(1.0/((double) lambdaDyn[run1].getDim()));
-                 cp.lambdaDynamic.setDense( run1, 0, tmp );
-            }
+            for( run1 = 0; run1 < N-1; run1++ )
+                 cp.lambdaDynamic.getDense( run1, 0, lambdaDyn[run1].getDim(), 1 ).setAll(1.0/((double) lambdaDyn[run1].getDim()));
         }
-
-        delete[] lambdaDyn;
-        delete[] aux4;
     }
     else{
-        DMatrix tmp ( getNP(),1 );
-        cp.deltaX.init( 5, 1 );
-
-        for( run1 = 0; run1 < getNP(); run1++ )
-            tmp( run1, 0 ) = (*denseCP.x)(run1);
-
-        cp.deltaX.setDense( 2, 0, tmp );
+        cp.deltaX.reset( 5, 1 );
+        cp.deltaX.setDense( 2, 0, *denseCP.x, 0, getNP() );
     }
 
 
-    DMatrix tmp;
-
-    cp.lambdaConstraint.init( blockDims.getDim(), 1 );
+    cp.lambdaConstraint.reset( blockDims.getDim(), 1 );
 
     int run = 0;
     for( run1 = 0; run1 < blockDims.getDim(); run1++ ){
-        tmp.init( (int) blockDims(run1), 1 );
-
-        for( run2 = 0; run2 < blockDims(run1); run2++ ){
-            tmp(run2,0) = denseDualSolution(nF+run+run2);
-        }
-        cp.lambdaConstraint.setDense( run1, 0, tmp );
+        cp.lambdaConstraint.setDense( run1, 0, denseDualSolution, nF+run, (int) blockDims(run1) );
         run += (int) blockDims(run1);
     }
 
-    cp.lambdaBound.init(4*N+1,1);
+    cp.lambdaBound.reset(4*N+1,1);
     rowCount = 0;
 
     if( getNX() != 0 ){
-        tmp.init(getNX(),1);
-        for( run1 = 0; run1 < getNX(); run1++ )
-            tmp(run1,0) = denseDualSolution(run1);
-        cp.lambdaBound.setDense( 0, 0, tmp );
+        cp.lambdaBound.setDense( 0, 0, denseDualSolution, 0, getNX() );
         rowCount++;
     }
     rowCount1 = 0;
 
     for( run2 = 1; run2 < N; run2++ ){
         if( getNX() != 0 ){
-            tmp.init( getNX(), 1 );
-            for( run1 = 0; run1 < getNX(); run1++ )
-                tmp(run1,0) = denseDualSolution(nF+getNC()+rowCount1+run1);
-            cp.lambdaBound.setDense( rowCount, 0, tmp );
+            cp.lambdaBound.setDense( rowCount, 0, denseDualSolution, nF+getNC()+rowCount1, getNX() );
             rowCount1 += getNX();
         }
         rowCount++;
@@ -1296,30 +1163,21 @@ returnValue CondensingBasedCPsolver::expand(	BandedCP& cp
 
     for( run2 = 0; run2 < N; run2++ ){
         if( getNXA() != 0 ){
-            tmp.init( getNXA(), 1 );
-            for( run1 = 0; run1 < getNXA(); run1++ )
-                tmp(run1,0) = denseDualSolution(rowCount1+run1);
-            cp.lambdaBound.setDense( rowCount, 0, tmp );
+            cp.lambdaBound.setDense( rowCount, 0, denseDualSolution, rowCount1, getNXA() );
             rowCount1 += getNXA();
         }
         rowCount++;
     }
 
     if( getNP() != 0 ){
-        tmp.init( getNP(), 1 );
-        for( run1 = 0; run1 < getNP(); run1++ )
-            tmp(run1,0) = denseDualSolution(rowCount1+run1);
-        cp.lambdaBound.setDense( rowCount, 0, tmp );
+        cp.lambdaBound.setDense( rowCount, 0, denseDualSolution, rowCount1, getNP() );
         rowCount1 += getNP();
     }
     rowCount++;
 
     for( run2 = 0; run2 < N-1; run2++ ){
         if( getNU() != 0 ){
-            tmp.init( getNU(), 1 );
-            for( run1 = 0; run1 < getNU(); run1++ )
-                tmp(run1,0) = denseDualSolution(rowCount1+run1);
-            cp.lambdaBound.setDense( rowCount, 0, tmp );
+            cp.lambdaBound.setDense( rowCount, 0, denseDualSolution, rowCount1, getNU() );
             rowCount1 += getNU();
         }
         rowCount++;
@@ -1328,10 +1186,7 @@ returnValue CondensingBasedCPsolver::expand(	BandedCP& cp
 
     for( run2 = 0; run2 < N-1; run2++ ){
         if( getNW() != 0 ){
-            tmp.init( getNW(), 1 );
-            for( run1 = 0; run1 < getNW(); run1++ )
-                tmp(run1,0) = denseDualSolution(rowCount1+run1);
-            cp.lambdaBound.setDense( rowCount, 0, tmp );
+            cp.lambdaBound.setDense( rowCount, 0, denseDualSolution, rowCount1, getNW() );
             rowCount1 += getNW();
         }
         rowCount++;
@@ -1381,81 +1236,83 @@ returnValue CondensingBasedCPsolver::computeCondensingOperator(	BandedCP& cp
 	uint run1, run2;
 	uint N = getNumPoints();
 
-	DMatrix  Gx;
-	DMatrix   G;
-	DMatrix tmp;
+	// the blocks are referenced and the products are written into the blocks
+	// of T and d directly, which keep their storage between the iterations
 
 	for( run1 = 0; run1 < N-1; run1++ )
 	{
 			// DIFFERENTIAL STATES:
 			// --------------------
-			cp.dynGradient.getSubBlock( run1, 0,  Gx );   // Get the sensitivity G_x^i with respect to x
+			const DMatrix& Gx = cp.dynGradient.getSubBlock( run1, 0 );   // Get the sensitivity G_x^i with respect to x
 			
 		if ( condensingStatus != COS_FROZEN )
 		{
-			T             .getSubBlock( run1, 0, tmp );   // get the corresponding  C_i .
+			const DMatrix& C = T.getSubBlock( run1, 0 );   // get the corresponding  C_i .
 
-			T.setDense( run1+1, 0, Gx*tmp );		   // compute C_{i+1} := G_x^i * C_i
+			T.getDense( run1+1, 0, Gx.getNumRows(), C.getNumCols() ).noalias() = Gx*C;   // compute C_{i+1} := G_x^i * C_i
 
 			// ALGEBRAIC STATES:
 			// --------------------
 
-			cp.dynGradient.getSubBlock( run1, 1, G );
+			const DMatrix& Gxa = cp.dynGradient.getSubBlock( run1, 1 );
 
 			for( run2 = 0; run2 <= run1; run2++ ){
 
-				T.getSubBlock( run1, run2+1, tmp );
+				const DMatrix& tmp = T.getSubBlock( run1, run2+1 );
 
-				if( G.getDim() != 0 ){
+				if( Gxa.getDim() != 0 ){
 
-					if( run1 == run2 ) T.setDense( run1+1, run2+1, G      );
-					else               T.setDense( run1+1, run2+1, Gx*tmp );
+					if( run1 == run2 ) T.setDense( run1+1, run2+1, Gxa );
+					else               T.getDense( run1+1, run2+1, Gx.getNumRows(), tmp.getNumCols() ).noalias() = Gx*tmp;
 				}
 			}
 
 			// PARAMETERS:
 			// --------------------
 
-			cp.dynGradient.getSubBlock( run1, 2  ,  G  ); // Get the sensitivity G_p^i with respect to p
-			T             .getSubBlock( run1, N+1, tmp ); // get the corresponding  D_p^i.
+			const DMatrix& Gp = cp.dynGradient.getSubBlock( run1, 2 );   // Get the sensitivity G_p^i with respect to p
+			const DMatrix& Dp = T.getSubBlock( run1, N+1 );             // get the corresponding  D_p^i.
 
-			if( tmp.getDim() != 0 ){
-				if( G.getDim() != 0 )
-					T.setDense( run1+1, N+1, Gx*tmp + G );   // compute  D_p^{i+1} := G_x^i D_p^i + G_p^i
+			if( Dp.getDim() != 0 ){
+				if( Gp.getDim() != 0 ){
+					DMatrix& Dp1 = T.getDense( run1+1, N+1, Gx.getNumRows(), Dp.getNumCols() );
+					Dp1.noalias() = Gx*Dp;   // compute  D_p^{i+1} := G_x^i D_p^i + G_p^i
+					Dp1 += Gp;
+				}
 			}
 			else{
-				if( G.getDim() != 0 )
-					T.setDense( run1+1, N+1,          G );   // compute  D_p^{i+1} := G_x^i D_p^i + G_p^i
+				if( Gp.getDim() != 0 )
+					T.setDense( run1+1, N+1,          Gp );   // compute  D_p^{i+1} := G_x^i D_p^i + G_p^i
 			}
 
 			// CONTROLS:
 			// --------------------
 
-			cp.dynGradient.getSubBlock( run1, 3, G );
+			const DMatrix& Gu = cp.dynGradient.getSubBlock( run1, 3 );
 			for( run2 = 0; run2 <= run1; run2++ ){
 
-				T.getSubBlock( run1, run2+2+N, tmp );
+				const DMatrix& tmp = T.getSubBlock( run1, run2+2+N );
 
-				if( G.getDim() != 0 ){
+				if( Gu.getDim() != 0 ){
 
-					if( run1 == run2 ) T.setDense( run1+1, run2+2+N, G      );
-					else               T.setDense( run1+1, run2+2+N, Gx*tmp );
+					if( run1 == run2 ) T.setDense( run1+1, run2+2+N, Gu );
+					else               T.getDense( run1+1, run2+2+N, Gx.getNumRows(), tmp.getNumCols() ).noalias() = Gx*tmp;
 				}
 			}
 
 			// DISTURBANCES:
 			// --------------------
 
-			cp.dynGradient.getSubBlock( run1, 4, G );
+			const DMatrix& Gw = cp.dynGradient.getSubBlock( run1, 4 );
 
 			for( run2 = 0; run2 <= run1; run2++ ){
 
-				T.getSubBlock( run1, run2+1+2*N, tmp );
+				const DMatrix& tmp = T.getSubBlock( run1, run2+1+2*N );
 
-				if( G.getDim() != 0 ){
+				if( Gw.getDim() != 0 ){
 
-					if( run1 == run2 ) T.setDense( run1+1, run2+1+2*N, G      );
-					else               T.setDense( run1+1, run2+1+2*N, Gx*tmp );
+					if( run1 == run2 ) T.setDense( run1+1, run2+1+2*N, Gw );
+					else               T.getDense( run1+1, run2+1+2*N, Gx.getNumRows(), tmp.getNumCols() ).noalias() = Gx*tmp;
 				}
 			}
 		}
@@ -1463,16 +1320,19 @@ returnValue CondensingBasedCPsolver::computeCondensingOperator(	BandedCP& cp
 		// RESIDUUM:
 		// --------------------
 
-		cp.dynResiduum.getSubBlock( run1, 0,  G  );   // Get the residuum  b^i
-		d             .getSubBlock( run1, 0, tmp );   // get the corresponding  d^i.
+		const DMatrix& b  = cp.dynResiduum.getSubBlock( run1, 0 );   // Get the residuum  b^i
+		const DMatrix& di = d             .getSubBlock( run1, 0 );   // get the corresponding  d^i.
 
-		if( tmp.getDim() != 0 ){
-			if( G.getDim() != 0 )
-				d.setDense( run1+1, 0, Gx*tmp + G );   // compute  d^{i+1} := G_x^i d^i + b^i
+		if( di.getDim() != 0 ){
+			if( b.getDim() != 0 ){
+				DMatrix& d1 = d.getDense( run1+1, 0, Gx.getNumRows(), di.getNumCols() );
+				d1.noalias() = Gx*di;   // compute  d^{i+1} := G_x^i d^i + b^i
+				d1 += b;
+			}
 		}
 		else{
-			if( G.getDim() != 0 )
-				d.setDense( run1+1, 0, G );   // compute  d^{i+1} := b^i
+			if( b.getDim() != 0 )
+				d.setDense( run1+1, 0, b );   // compute  d^{i+1} := b^i
 		}
 	}
 
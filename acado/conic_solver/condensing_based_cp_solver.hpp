@@ -268,6 +268,24 @@ class CondensingBasedCPsolver: public BandedCPsolver {
         // ----------------------------------------------------------------------
 
 
+        // WORKSPACES OF THE CONDENSING AND THE EXPANSION, WHICH ARE SIZED AT
+        // THE FIRST ITERATION AND REUSED AFTERWARDS:
+        // ----------------------------------------------------------------------
+
+        BlockMatrix           dhT;           /**< d^T hT                              */
+        BlockMatrix           dCut;          /**< state offsets of d                  */
+        BlockMatrix           Ad;            /**< constraint gradient times d         */
+
+        DVector               denseDualSolution;   /**< merged dual solution of the dense QP */
+        BlockMatrix           primalDense;   /**< primal solution of the dense QP     */
+        BlockMatrix           aux;           /**< x^T H + g                           */
+        DVector               aux2;          /**< lambda^T A                          */
+        DVector               aux3;          /**< lambda_bound                        */
+        std::vector< DVector > aux4;         /**< x^T H + g - lambda^T A - lambda_bound */
+        std::vector< DVector > lambdaDyn;    /**< multipliers of the dynamics         */
+        // ----------------------------------------------------------------------
+
+
         DenseCPsolver* cpSolver;
         DenseQPsolver* cpSolverRelaxed;
 
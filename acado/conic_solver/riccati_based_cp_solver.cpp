@@ -0,0 +1,1400 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file src/conic_solver/riccati_based_cp_solver.cpp
+ *    \date 2014
+ */
+
+#include <acado/conic_solver/riccati_based_cp_solver.hpp>
+#include <acado/clock/real_clock.hpp>
+#include <acado/clock/runtime_profiler.hpp>
+
+using namespace Eigen;
+using namespace std;
+
+BEGIN_NAMESPACE_ACADO
+
+
+/** Returns whether the given bound (residuum) is finite. */
+static inline bool isFiniteBound( double bound )
+{
+	return ( fabs( bound ) < 0.5*INFTY );
+}
+
+
+/** Regularisation of the equality constraints (inverse penalty weight of the \n
+ *  proximal multiplier update).                                             \n
+ */
+static const double equalityRegularisation = 1.0e-8;
+
+
+/** Computes the lower Cholesky factor of a symmetric matrix. If the matrix is \n
+ *  not (numerically) positive definite, an increasing multiple of the     \n
+ *  identity is added.                                                      \n
+ */
+static returnValue choleskyFactor( const DMatrix& M, DMatrix& L )
+{
+	if ( M.getNumRows( ) == 0 )
+	{
+		L.init( 0,0 );
+		return SUCCESSFUL_RETURN;
+	}
+
+	double scale = 1.0 + M.diagonal( ).cwiseAbs( ).maxCoeff( );
+	double delta = 0.0;
+
+	for( uint run1 = 0; run1 < 8; run1++ )
+	{
+		LLT< DMatrix::Base > llt( M + delta*DMatrix::Base::Identity( M.getNumRows(),M.getNumCols() ) );
+
+		if ( llt.info( ) == Success )
+		{
+			L = DMatrix( llt.matrixL( ) );
+			return SUCCESSFUL_RETURN;
+		}
+
+		if ( run1 == 0 )
+			delta = 1.0e-12 * scale;
+		else
+			delta *= 100.0;
+	}
+
+	return RET_QP_SOLUTION_FAILED;
+}
+
+
+/** Solves (L L') x = b in place. */
+template< typename Derived >
+static void choleskySolve( const DMatrix& L, MatrixBase< Derived >& b )
+{
+	if ( L.getNumRows( ) == 0 )
+		return;
+
+	L.triangularView< Lower >( ).solveInPlace( b );
+	L.transpose( ).triangularView< Upper >( ).solveInPlace( b );
+}
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+RiccatiBasedCPsolver::RiccatiBasedCPsolver( ) : BandedCPsolver( )
+{
+	nConstraints = 0;
+	blockDims = 0;
+
+	isPrepared = BT_FALSE;
+	isFrozen   = BT_FALSE;
+}
+
+
+RiccatiBasedCPsolver::RiccatiBasedCPsolver(	UserInteraction* _userInteraction,
+											uint nConstraints_,
+											const DVector& blockDims_
+											) : BandedCPsolver( _userInteraction )
+{
+	nConstraints = nConstraints_;
+	blockDims = blockDims_;
+
+	isPrepared = BT_FALSE;
+	isFrozen   = BT_FALSE;
+}
+
+
+RiccatiBasedCPsolver::RiccatiBasedCPsolver( const RiccatiBasedCPsolver& rhs )
+                     :BandedCPsolver( rhs )
+{
+	*this = rhs;
+}
+
+
+RiccatiBasedCPsolver::~RiccatiBasedCPsolver( )
+{
+}
+
+
+RiccatiBasedCPsolver& RiccatiBasedCPsolver::operator=( const RiccatiBasedCPsolver& rhs )
+{
+	if ( this != &rhs )
+	{
+		BandedCPsolver::operator=( rhs );
+
+		iter         = rhs.iter;
+		nConstraints = rhs.nConstraints;
+		blockDims    = rhs.blockDims;
+
+		isPrepared   = rhs.isPrepared;
+		isFrozen     = rhs.isFrozen;
+
+		H = rhs.H;  g = rhs.g;
+		A = rhs.A;  B = rhs.B;  c = rhs.c;
+
+		lbZ = rhs.lbZ;  ubZ = rhs.ubZ;
+		C   = rhs.C;    lbC = rhs.lbC;  ubC = rhs.ubC;
+
+		blockStage  = rhs.blockStage;
+		blockOffset = rhs.blockOffset;
+
+		D = rhs.D;  lo = rhs.lo;  up = rhs.up;
+		hasLo = rhs.hasLo;  hasUp = rhs.hasUp;  isEq = rhs.isEq;
+		boundIdx = rhs.boundIdx;
+
+		z = rhs.z;  lambdaDyn = rhs.lambdaDyn;
+		tLo = rhs.tLo;  tUp = rhs.tUp;  lamLo = rhs.lamLo;  lamUp = rhs.lamUp;  yEq = rhs.yEq;
+		dz = rhs.dz;  dlambdaDyn = rhs.dlambdaDyn;
+		dtLo = rhs.dtLo;  dtUp = rhs.dtUp;  dlamLo = rhs.dlamLo;  dlamUp = rhs.dlamUp;  dyEq = rhs.dyEq;
+		rDual = rhs.rDual;  rDyn = rhs.rDyn;  rLo = rhs.rLo;  rUp = rhs.rUp;  rEq = rhs.rEq;
+
+		P = rhs.P;  K = rhs.K;  G = rhs.G;
+		LHvv = rhs.LHvv;  LP0 = rhs.LP0;
+
+		deltaX = rhs.deltaX;
+		deltaP = rhs.deltaP;
+	}
+	return *this;
+}
+
+
+BandedCPsolver* RiccatiBasedCPsolver::clone() const
+{
+	return new RiccatiBasedCPsolver(*this);
+}
+
+
+
+returnValue RiccatiBasedCPsolver::init(	const OCPiterate &iter_
+										)
+{
+	iter = iter_;
+
+	if ( ( getNX( ) == 0 ) || ( getNumPoints( ) < 2 ) )
+		return ACADOERRORTEXT( RET_BANDED_CP_INIT_FAILED, "Riccati based CP solver requires differential states and at least two nodes." );
+
+	if ( getNXA( ) != 0 )
+		return ACADOERRORTEXT( RET_BANDED_CP_INIT_FAILED, "Riccati based CP solver does not support algebraic states." );
+
+	uint N = getNumPoints( );
+
+	H.resize( N );  g.resize( N );
+	A.resize( N-1 );  B.resize( N-1 );  c.resize( N-1 );
+	lbZ.resize( N );  ubZ.resize( N );
+	C.resize( N );  lbC.resize( N );  ubC.resize( N );
+
+	D.resize( N );  lo.resize( N );  up.resize( N );
+	hasLo.resize( N );  hasUp.resize( N );  isEq.resize( N );  boundIdx.resize( N );
+
+	z.resize( N );  lambdaDyn.resize( N-1 );
+	tLo.resize( N );  tUp.resize( N );  lamLo.resize( N );  lamUp.resize( N );  yEq.resize( N );
+	dz.resize( N );  dlambdaDyn.resize( N-1 );
+	dtLo.resize( N );  dtUp.resize( N );  dlamLo.resize( N );  dlamUp.resize( N );  dyEq.resize( N );
+	rDual.resize( N );  rDyn.resize( N-1 );  rLo.resize( N );  rUp.resize( N );  rEq.resize( N );
+
+	P.resize( N );  K.resize( N-1 );  G.resize( N-1 );  LHvv.resize( N-1 );
+
+	isPrepared = BT_FALSE;
+	isFrozen   = BT_FALSE;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue RiccatiBasedCPsolver::prepareSolve(	BandedCP& cp
+												)
+{
+	RealClock clock;
+
+	int printLevel;
+	get( PRINTLEVEL,printLevel );
+
+	if ( (PrintLevel)printLevel >= HIGH )
+		cout << "--> Extracting stage-wise QP data ...\n";
+
+	clock.reset( );
+	clock.start( );
+	double profilerStart = RuntimeProfiler::instance().tic( );
+
+	returnValue returnvalue = setupStageData( cp );
+	if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR(returnvalue);
+
+	RuntimeProfiler::instance().toc( PP_CONDENSING,profilerStart );
+	clock.stop( );
+	setLast( LOG_TIME_CONDENSING,clock.getTime() );
+
+	if ( (PrintLevel)printLevel >= HIGH )
+		cout << "<-- Extracting stage-wise QP data done.\n";
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue RiccatiBasedCPsolver::solve(	BandedCP& cp
+										)
+{
+	if ( areRealTimeParametersDefined( ) == BT_FALSE )
+	{
+		returnValue returnvalue = prepareSolve( cp );
+		if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR( RET_BANDED_CP_SOLUTION_FAILED );
+	}
+
+	if ( isPrepared == BT_FALSE )
+		return ACADOERROR( RET_BANDED_CP_SOLUTION_FAILED );
+
+	int printLevel;
+	get( PRINTLEVEL,printLevel );
+
+	if ( (PrintLevel)printLevel >= HIGH )
+		cout << "--> Solving banded QP by Riccati recursion ...\n";
+
+
+	// SETUP THE INEQUALITIES (INCLUDING THE FEEDBACK DATA, IF SPECIFIED):
+	// --------------------------------------------------------------------
+	setupInequalities( );
+
+
+	// SOLVE THE QP ALLOWING THE GIVEN NUMBER OF ITERATIONS:
+	// --------------------------------------------------------------------
+	int maxQPiter;
+	get( MAX_NUM_QP_ITERATIONS, maxQPiter );
+
+	RealClock clock;
+	clock.start( );
+	double profilerStart = RuntimeProfiler::instance().tic( );
+
+	uint nIter = 0;
+	returnValue returnvalue = solveQP( maxQPiter,nIter );
+
+	RuntimeProfiler::instance().toc( PP_QP,profilerStart );
+	clock.stop( );
+	setLast( LOG_TIME_QP,clock.getTime() );
+	setLast( LOG_NUM_QP_ITERATIONS,(int)nIter );
+	setLast( LOG_TIME_RELAXED_QP,0.0 );
+	setLast( LOG_IS_QP_RELAXED, BT_FALSE );
+
+	switch( returnvalue )
+	{
+		case SUCCESSFUL_RETURN:
+			break;
+
+		case RET_QP_SOLUTION_REACHED_LIMIT:
+			ACADOWARNING( RET_QP_SOLUTION_REACHED_LIMIT );
+			break;
+
+		case RET_QP_INFEASIBLE:
+			int infeasibleQPhandling;
+			get( INFEASIBLE_QP_HANDLING,infeasibleQPhandling );
+
+			// relaxations are not available, the QP is either ignored or rejected
+			if ( (InfeasibleQPhandling)infeasibleQPhandling != IQH_IGNORE )
+			{
+				ACADOERROR( RET_QP_INFEASIBLE );
+				return ACADOERROR( RET_BANDED_CP_SOLUTION_FAILED );
+			}
+			break;
+
+		default:
+			ACADOERROR( returnvalue );
+			return ACADOERROR( RET_BANDED_CP_SOLUTION_FAILED );
+	}
+
+	if ( (PrintLevel)printLevel >= HIGH )
+		cout << "<-- Solving banded QP by Riccati recursion done.\n";
+
+	if ( areRealTimeParametersDefined( ) == BT_FALSE )
+		return finalizeSolve( cp );
+	else
+		return SUCCESSFUL_RETURN;
+}
+
+
+returnValue RiccatiBasedCPsolver::finalizeSolve(	BandedCP& cp
+												)
+{
+	RealClock clock;
+
+	clock.reset( );
+	clock.start( );
+	double profilerStart = RuntimeProfiler::instance().tic( );
+
+	returnValue returnvalue = expand( cp );
+	if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR(returnvalue);
+
+	RuntimeProfiler::instance().toc( PP_EXPANSION,profilerStart );
+	clock.stop( );
+	setLast( LOG_TIME_EXPAND,clock.getTime() );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue RiccatiBasedCPsolver::getParameters( DVector &p_  ) const
+{
+	if ( p_.getDim( ) != getNP( ) )
+		return ACADOERROR( RET_INCOMPATIBLE_DIMENSIONS );
+
+	if ( z.empty( ) == true || z[0].getDim( ) == 0 )
+		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+	p_ = z[0].segment( getNX(),getNP() );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue RiccatiBasedCPsolver::getFirstControl( DVector &u0_ ) const
+{
+	if ( u0_.getDim( ) != getNU( ) )
+		return ACADOERROR( RET_INCOMPATIBLE_DIMENSIONS );
+
+	if ( z.empty( ) == true || z[0].getDim( ) == 0 )
+		return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+	u0_ = z[0].segment( getNS(0),getNU() );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue RiccatiBasedCPsolver::setRealTimeParameters(	const DVector& DeltaX,
+														const DVector& DeltaP
+														)
+{
+	deltaX = DeltaX;
+	deltaP = DeltaP;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue RiccatiBasedCPsolver::freezeCondensing( )
+{
+	if ( isPrepared == BT_FALSE )
+		return ACADOERROR( RET_NEED_TO_CONDENSE_FIRST );
+
+	isFrozen = BT_TRUE;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue RiccatiBasedCPsolver::unfreezeCondensing( )
+{
+	isFrozen = BT_FALSE;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+BooleanType RiccatiBasedCPsolver::getStageOffset( uint column, uint stage, uint& offset ) const
+{
+	uint N    = getNumPoints( );
+	uint type = column / N;
+	uint node = column % N;
+
+	switch( type )
+	{
+		case 0:  // differential states
+			offset = 0;
+			return ( node == stage ) ? BT_TRUE : BT_FALSE;
+
+		case 2:  // parameters (copied to every stage)
+			offset = getNX( );
+			return BT_TRUE;
+
+		case 3:  // controls
+		case 4:  // disturbances
+			offset = ( type == 3 ) ? 0 : getNU( );
+
+			if ( ( stage < N-1 ) && ( node == stage ) )
+			{
+				offset += getNS( stage );
+				return BT_TRUE;
+			}
+
+			// the controls of the last interval are part of the terminal state
+			if ( ( stage == N-1 ) && ( node+2 >= N ) )
+			{
+				offset += getNX( ) + getNP( );
+				return BT_TRUE;
+			}
+			return BT_FALSE;
+
+		default: // algebraic states
+			return BT_FALSE;
+	}
+}
+
+
+uint RiccatiBasedCPsolver::getNaturalStage( uint column ) const
+{
+	return column % getNumPoints( );
+}
+
+
+returnValue RiccatiBasedCPsolver::getTermStage( const std::vector< uint >& columns, uint& stage ) const
+{
+	uint N = getNumPoints( );
+	uint run1;
+
+	// parameters are assigned to the stage of the other variables, if any
+	BooleanType onlyParameters = BT_TRUE;
+	stage = 0;
+
+	for( run1 = 0; run1 < columns.size(); run1++ )
+		if ( columns[run1] / N != 2 )
+			onlyParameters = BT_FALSE;
+
+	for( run1 = 0; run1 < columns.size(); run1++ )
+		if ( ( onlyParameters == BT_TRUE ) || ( columns[run1] / N != 2 ) )
+			if ( getNaturalStage( columns[run1] ) > stage )
+				stage = getNaturalStage( columns[run1] );
+
+	uint offset;
+	for( run1 = 0; run1 < columns.size(); run1++ )
+		if ( getStageOffset( columns[run1],stage,offset ) == BT_FALSE )
+			return ACADOERRORTEXT( RET_NOT_IMPLEMENTED_YET, "Riccati based CP solver does not support couplings between non-neighbouring nodes." );
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue RiccatiBasedCPsolver::setupStageData(	BandedCP& cp
+													)
+{
+	uint run1, run2, run3;
+
+	uint N  = getNumPoints( );
+	uint nx = getNX( );
+	uint np = getNP( );
+	uint nu = getNU( );
+	uint nw = getNW( );
+
+	DMatrix tmp;
+	std::vector< uint > columns;
+	uint stage, offsetR, offsetC;
+
+	BooleanType updateMatrices = ( ( isFrozen == BT_FALSE ) || ( isPrepared == BT_FALSE ) ) ? BT_TRUE : BT_FALSE;
+
+
+	// DYNAMICS:
+	// ---------
+	for( run1 = 0; run1 < N-1; run1++ )
+	{
+		uint nsNext = getNS( run1+1 );
+
+		if ( updateMatrices == BT_TRUE )
+		{
+			A[run1].init( nsNext,getNS( run1 ) );
+			B[run1].init( nsNext,getNV( run1 ) );
+
+			cp.dynGradient.getSubBlock( run1,0,tmp,nx,nx );
+			A[run1].block( 0,0,nx,nx ) = tmp;
+
+			if ( np > 0 )
+			{
+				cp.dynGradient.getSubBlock( run1,2,tmp,nx,np );
+				A[run1].block( 0,nx,nx,np ) = tmp;
+				A[run1].block( nx,nx,np,np ).setIdentity( );
+			}
+
+			if ( nu > 0 )
+			{
+				cp.dynGradient.getSubBlock( run1,3,tmp,nx,nu );
+				B[run1].block( 0,0,nx,nu ) = tmp;
+			}
+
+			if ( nw > 0 )
+			{
+				cp.dynGradient.getSubBlock( run1,4,tmp,nx,nw );
+				B[run1].block( 0,nu,nx,nw ) = tmp;
+			}
+
+			if ( run1 == N-2 )
+				B[run1].block( nx+np,0,nu+nw,nu+nw ).setIdentity( );
+		}
+
+		c[run1].init( nsNext );
+		cp.dynResiduum.getSubBlock( run1,0,tmp,nx,1 );
+		c[run1].segment( 0,nx ) = tmp.col( 0 );
+	}
+
+
+	// OBJECTIVE:
+	// ----------
+	for( run1 = 0; run1 < N; run1++ )
+		g[run1].init( getNS( run1 ) + getNV( run1 ) );
+
+	for( run1 = 0; run1 < 5*N; run1++ )
+	{
+		if ( cp.objectiveGradient.getNumCols( 0,run1 ) == 0 )
+			continue;
+
+		cp.objectiveGradient.getSubBlock( 0,run1,tmp );
+		stage = getNaturalStage( run1 );
+
+		if ( getStageOffset( run1,stage,offsetC ) == BT_FALSE )
+			return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
+
+		g[stage].segment( offsetC,tmp.getNumCols() ) += tmp.row( 0 ).transpose( );
+	}
+
+	if ( updateMatrices == BT_TRUE )
+	{
+		for( run1 = 0; run1 < N; run1++ )
+			H[run1].init( getNS( run1 ) + getNV( run1 ),getNS( run1 ) + getNV( run1 ) );
+
+		columns.resize( 2 );
+
+		for( run1 = 0; run1 < 5*N; run1++ )
+		{
+			for( run2 = 0; run2 < 5*N; run2++ )
+			{
+				if ( cp.hessian.getNumRows( run1,run2 ) == 0 )
+					continue;
+
+				cp.hessian.getSubBlock( run1,run2,tmp );
+				if ( tmp.isZero( 0.0 ) == true )
+					continue;
+
+				columns[0] = run1;
+				columns[1] = run2;
+
+				if ( getTermStage( columns,stage ) != SUCCESSFUL_RETURN )
+					return RET_NOT_IMPLEMENTED_YET;
+
+				getStageOffset( run1,stage,offsetR );
+				getStageOffset( run2,stage,offsetC );
+
+				H[stage].block( offsetR,offsetC,tmp.getNumRows(),tmp.getNumCols() ) += tmp;
+			}
+		}
+	}
+
+
+	// SIMPLE BOUNDS:
+	// --------------
+	for( run1 = 0; run1 < N; run1++ )
+	{
+		lbZ[run1].init( getNS( run1 ) + getNV( run1 ) );
+		ubZ[run1].init( getNS( run1 ) + getNV( run1 ) );
+		lbZ[run1].setAll( -INFTY );
+		ubZ[run1].setAll(  INFTY );
+
+		cp.lowerBoundResiduum.getSubBlock( run1,0,tmp,nx,1 );
+		lbZ[run1].segment( 0,nx ) = tmp.col( 0 );
+		cp.upperBoundResiduum.getSubBlock( run1,0,tmp,nx,1 );
+		ubZ[run1].segment( 0,nx ) = tmp.col( 0 );
+
+		if ( run1 < N-1 )
+		{
+			if ( nu > 0 )
+			{
+				cp.lowerBoundResiduum.getSubBlock( 2*N+1+run1,0,tmp,nu,1 );
+				lbZ[run1].segment( getNS( run1 ),nu ) = tmp.col( 0 );
+				cp.upperBoundResiduum.getSubBlock( 2*N+1+run1,0,tmp,nu,1 );
+				ubZ[run1].segment( getNS( run1 ),nu ) = tmp.col( 0 );
+			}
+
+			if ( nw > 0 )
+			{
+				cp.lowerBoundResiduum.getSubBlock( 3*N+1+run1,0,tmp,nw,1 );
+				lbZ[run1].segment( getNS( run1 )+nu,nw ) = tmp.col( 0 );
+				cp.upperBoundResiduum.getSubBlock( 3*N+1+run1,0,tmp,nw,1 );
+				ubZ[run1].segment( getNS( run1 )+nu,nw ) = tmp.col( 0 );
+			}
+		}
+	}
+
+	if ( np > 0 )
+	{
+		cp.lowerBoundResiduum.getSubBlock( 2*N,0,tmp,np,1 );
+		lbZ[0].segment( nx,np ) = tmp.col( 0 );
+		cp.upperBoundResiduum.getSubBlock( 2*N,0,tmp,np,1 );
+		ubZ[0].segment( nx,np ) = tmp.col( 0 );
+	}
+
+
+	// CONSTRAINTS:
+	// ------------
+	uint nBlocks = blockDims.getDim( );
+
+	if ( updateMatrices == BT_TRUE )
+	{
+		std::vector< uint > nRows( N,0 );
+
+		blockStage.resize( nBlocks );
+		blockOffset.resize( nBlocks );
+
+		for( run1 = 0; run1 < nBlocks; run1++ )
+		{
+			columns.clear( );
+
+			for( run2 = 0; run2 < 5*N; run2++ )
+			{
+				if ( cp.constraintGradient.getNumRows( run1,run2 ) == 0 )
+					continue;
+
+				cp.constraintGradient.getSubBlock( run1,run2,tmp );
+				if ( tmp.isZero( 0.0 ) == false )
+					columns.push_back( run2 );
+			}
+
+			if ( getTermStage( columns,stage ) != SUCCESSFUL_RETURN )
+				return RET_NOT_IMPLEMENTED_YET;
+
+			blockStage[run1]  = stage;
+			blockOffset[run1] = nRows[stage];
+			nRows[stage] += (uint)blockDims( run1 );
+		}
+
+		for( run1 = 0; run1 < N; run1++ )
+			C[run1].init( nRows[run1],getNS( run1 ) + getNV( run1 ) );
+
+		for( run1 = 0; run1 < nBlocks; run1++ )
+		{
+			stage = blockStage[run1];
+
+			for( run2 = 0; run2 < 5*N; run2++ )
+			{
+				if ( cp.constraintGradient.getNumRows( run1,run2 ) == 0 )
+					continue;
+
+				cp.constraintGradient.getSubBlock( run1,run2,tmp );
+				if ( tmp.isZero( 0.0 ) == true )
+					continue;
+
+				getStageOffset( run2,stage,offsetC );
+				C[stage].block( blockOffset[run1],offsetC,tmp.getNumRows(),tmp.getNumCols() ) += tmp;
+			}
+		}
+	}
+
+	for( run1 = 0; run1 < N; run1++ )
+	{
+		lbC[run1].init( C[run1].getNumRows( ) );
+		ubC[run1].init( C[run1].getNumRows( ) );
+	}
+
+	for( run1 = 0; run1 < nBlocks; run1++ )
+	{
+		uint nRows = (uint)blockDims( run1 );
+		stage = blockStage[run1];
+
+		cp.lowerConstraintResiduum.getSubBlock( run1,0,tmp,nRows,1 );
+		for( run3 = 0; run3 < nRows; run3++ )
+			lbC[stage]( blockOffset[run1]+run3 ) = tmp( run3,0 );
+
+		cp.upperConstraintResiduum.getSubBlock( run1,0,tmp,nRows,1 );
+		for( run3 = 0; run3 < nRows; run3++ )
+			ubC[stage]( blockOffset[run1]+run3 ) = tmp( run3,0 );
+	}
+
+	if ( updateMatrices == BT_TRUE )
+	{
+		returnValue returnvalue = regularizeStageHessians( );
+		if ( returnvalue != SUCCESSFUL_RETURN )
+			return returnvalue;
+	}
+
+	isPrepared = BT_TRUE;
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue RiccatiBasedCPsolver::regularizeStageHessians( )
+{
+	uint run1;
+	uint N = getNumPoints( );
+
+	// ensure that Hessian matrices are symmetric
+	BooleanType isSymmetric = BT_TRUE;
+
+	for( run1 = 0; run1 < N; run1++ )
+	{
+		if ( H[run1].isSymmetric( ) == BT_FALSE )
+		{
+			isSymmetric = BT_FALSE;
+			H[run1].symmetrize( );
+		}
+	}
+
+	if ( isSymmetric == BT_FALSE )
+		ACADOINFO( RET_NONSYMMETRIC_HESSIAN_MATRIX );
+
+
+	// PROJECT THE STAGE HESSIANS TO THE POSITIVE DEFINITE CONE IF NECESSARY:
+	// -----------------------------------------------------------------------
+	int hessianMode;
+	get( HESSIAN_APPROXIMATION,hessianMode );
+
+	if ( (HessianApproximationMode)hessianMode == EXACT_HESSIAN )
+	{
+		double dampingFactor;
+		get( HESSIAN_PROJECTION_FACTOR, dampingFactor );
+
+		if ( dampingFactor >= 0.0 )
+		{
+			for( run1 = 0; run1 < N; run1++ )
+			{
+				SelfAdjointEigenSolver< MatrixXd > es( H[run1] );
+				MatrixXd V = es.eigenvectors();
+				VectorXd E = es.eigenvalues();
+
+				for (unsigned el = 0; el < E.size(); el++)
+					if (E( el ) <= 0.1 * dampingFactor)
+					{
+						if (fabs(E( el )) >= dampingFactor)
+							E( el ) = fabs(E( el ));
+						else
+							E( el ) = dampingFactor;
+					}
+
+				H[run1] = V * E.asDiagonal() * V.transpose();
+			}
+		}
+	}
+
+
+	// APPLY LEVENBERG-MARQUARD REGULARISATION (OF THE FREE VARIABLES) IF DESIRED:
+	// ---------------------------------------------------------------------------
+	double levenbergMarquard;
+	get( LEVENBERG_MARQUARDT, levenbergMarquard );
+
+	if( levenbergMarquard > EPS )
+	{
+		for( run1 = 0; run1 < getNX()+getNP(); run1++ )
+			H[0]( run1,run1 ) += levenbergMarquard;
+
+		for( run1 = 0; run1 < N-1; run1++ )
+			H[run1].bottomRightCorner( getNV( run1 ),getNV( run1 ) ).diagonal( ).array( ) += levenbergMarquard;
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue RiccatiBasedCPsolver::setupInequalities( )
+{
+	uint run1, run2;
+	uint N = getNumPoints( );
+
+	for( run1 = 0; run1 < N; run1++ )
+	{
+		DVector lb( lbZ[run1] );
+		DVector ub( ubZ[run1] );
+
+		if ( run1 == 0 )
+		{
+			if ( deltaX.isEmpty( ) == BT_FALSE )
+			{
+				lb.segment( 0,getNX() ) = deltaX;
+				ub.segment( 0,getNX() ) = deltaX;
+			}
+
+			if ( deltaP.isEmpty( ) == BT_FALSE )
+			{
+				lb.segment( getNX(),getNP() ) = deltaP;
+				ub.segment( getNX(),getNP() ) = deltaP;
+			}
+		}
+
+		boundIdx[run1].clear( );
+		for( run2 = 0; run2 < lb.getDim(); run2++ )
+			if ( ( isFiniteBound( lb(run2) ) == true ) || ( isFiniteBound( ub(run2) ) == true ) )
+				boundIdx[run1].push_back( run2 );
+
+		uint nB = boundIdx[run1].size( );
+		uint nC = C[run1].getNumRows( );
+		uint nZ = lb.getDim( );
+
+		D[run1].init( nB+nC,nZ );
+		lo[run1].init( nB+nC );
+		up[run1].init( nB+nC );
+
+		for( run2 = 0; run2 < nB; run2++ )
+		{
+			D[run1]( run2,boundIdx[run1][run2] ) = 1.0;
+			lo[run1]( run2 ) = lb( boundIdx[run1][run2] );
+			up[run1]( run2 ) = ub( boundIdx[run1][run2] );
+		}
+
+		if ( nC > 0 )
+		{
+			D[run1].bottomRows( nC ) = C[run1];
+			lo[run1].tail( nC ) = lbC[run1];
+			up[run1].tail( nC ) = ubC[run1];
+		}
+
+		hasLo[run1].init( nB+nC );
+		hasUp[run1].init( nB+nC );
+		isEq[run1].init( nB+nC );
+
+		// equalities are not split into two inequalities, as the barrier
+		// weights of both would grow without bound
+		for( run2 = 0; run2 < nB+nC; run2++ )
+		{
+			if ( ( isFiniteBound( lo[run1](run2) ) == true ) && ( up[run1](run2) - lo[run1](run2) <= BOUNDTOL ) )
+			{
+				isEq[run1]( run2 ) = 1.0;
+				continue;
+			}
+
+			if ( isFiniteBound( lo[run1](run2) ) == true ) hasLo[run1]( run2 ) = 1.0;
+			if ( isFiniteBound( up[run1](run2) ) == true ) hasUp[run1]( run2 ) = 1.0;
+		}
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+returnValue RiccatiBasedCPsolver::solveQP(	uint maxIter,
+											uint& nIter
+											)
+{
+	uint run1, run2;
+	uint N = getNumPoints( );
+
+	const double tau = 0.995;
+
+
+	// INITIALIZE THE ITERATES:
+	// ------------------------
+	double scale = 1.0;
+	uint nIneq = 0;
+
+	for( run1 = 0; run1 < N; run1++ )
+	{
+		uint nZ = getNS( run1 ) + getNV( run1 );
+		uint nD = D[run1].getNumRows( );
+
+		z[run1].init( nZ );
+		dz[run1].init( nZ );
+
+		tLo[run1].init( nD );  lamLo[run1].init( nD );
+		tUp[run1].init( nD );  lamUp[run1].init( nD );
+		yEq[run1].init( nD );
+
+		for( run2 = 0; run2 < nD; run2++ )
+		{
+			if ( hasLo[run1](run2) > 0.5 )
+			{
+				tLo[run1]( run2 )   = acadoMax( 1.0,-lo[run1](run2) );
+				lamLo[run1]( run2 ) = 1.0;
+				scale = acadoMax( scale,fabs( lo[run1](run2) ) );
+				nIneq++;
+			}
+			if ( hasUp[run1](run2) > 0.5 )
+			{
+				tUp[run1]( run2 )   = acadoMax( 1.0,up[run1](run2) );
+				lamUp[run1]( run2 ) = 1.0;
+				scale = acadoMax( scale,fabs( up[run1](run2) ) );
+				nIneq++;
+			}
+			if ( isEq[run1](run2) > 0.5 )
+				scale = acadoMax( scale,fabs( lo[run1](run2) ) );
+		}
+
+		if ( g[run1].getDim( ) > 0 )
+			scale = acadoMax( scale,g[run1].getNorm( VN_LINF ) );
+
+		if ( run1 < N-1 )
+		{
+			lambdaDyn[run1].init( getNS( run1+1 ) );
+			dlambdaDyn[run1].init( getNS( run1+1 ) );
+			scale = acadoMax( scale,c[run1].getNorm( VN_LINF ) );
+		}
+	}
+
+	const double tol = 1.0e-10 * scale;
+
+	std::vector< DVector > rcLo( N ), rcUp( N );
+
+
+	// INTERIOR POINT ITERATIONS:
+	// --------------------------
+	double resDual, resDyn, resIneq;
+	double mu = computeResiduals( resDual,resDyn,resIneq );
+
+	for( nIter = 0; nIter < maxIter; nIter++ )
+	{
+		if ( acadoIsNaN( resDual + resDyn + resIneq + mu ) == BT_TRUE )
+			return RET_QP_SOLUTION_FAILED;
+
+		if ( ( resDual <= tol ) && ( resDyn <= tol ) && ( resIneq <= tol ) && ( mu <= tol ) )
+			return SUCCESSFUL_RETURN;
+
+		// the barrier weights of active inequalities grow like 1/mu, such that
+		// further iterations would only amplify round-off errors
+		if ( mu < 1.0e-3 * tol )
+			break;
+
+		if ( mu > 1.0e20 * scale )
+			return RET_QP_INFEASIBLE;
+
+		if ( factorizeNewtonSystem( ) != SUCCESSFUL_RETURN )
+			break;
+
+		// predictor (affine scaling) step
+		for( run1 = 0; run1 < N; run1++ )
+		{
+			rcLo[run1] = -tLo[run1].cwiseProduct( lamLo[run1] );
+			rcUp[run1] = -tUp[run1].cwiseProduct( lamUp[run1] );
+		}
+
+		solveNewtonSystem( rcLo,rcUp );
+
+		double alpha = getMaxStepLength( 1.0 );
+		double sigma = 0.0;
+
+		if ( nIneq > 0 )
+		{
+			double muAff = 0.0;
+			for( run1 = 0; run1 < N; run1++ )
+			{
+				muAff += ( tLo[run1] + alpha*dtLo[run1] ).dot( lamLo[run1] + alpha*dlamLo[run1] );
+				muAff += ( tUp[run1] + alpha*dtUp[run1] ).dot( lamUp[run1] + alpha*dlamUp[run1] );
+			}
+			muAff /= (double)nIneq;
+
+			sigma = pow( muAff / mu, 3 );
+			if ( sigma > 1.0 )
+				sigma = 1.0;
+
+			// corrector step
+			for( run1 = 0; run1 < N; run1++ )
+			{
+				rcLo[run1] += hasLo[run1] * sigma*mu - dtLo[run1].cwiseProduct( dlamLo[run1] );
+				rcUp[run1] += hasUp[run1] * sigma*mu - dtUp[run1].cwiseProduct( dlamUp[run1] );
+			}
+
+			solveNewtonSystem( rcLo,rcUp );
+			alpha = getMaxStepLength( tau );
+		}
+
+		for( run1 = 0; run1 < N; run1++ )
+		{
+			z[run1]     += alpha*dz[run1];
+			tLo[run1]   += alpha*dtLo[run1];
+			tUp[run1]   += alpha*dtUp[run1];
+			lamLo[run1] += alpha*dlamLo[run1];
+			lamUp[run1] += alpha*dlamUp[run1];
+			yEq[run1]   += alpha*dyEq[run1];
+
+			if ( run1 < N-1 )
+				lambdaDyn[run1] += alpha*dlambdaDyn[run1];
+		}
+
+		mu = computeResiduals( resDual,resDyn,resIneq );
+	}
+
+	if ( acadoIsNaN( resDual + resDyn + resIneq + mu ) == BT_TRUE )
+		return RET_QP_SOLUTION_FAILED;
+
+	if ( ( resDual <= 1.0e3*tol ) && ( resDyn <= tol ) && ( resIneq <= tol ) && ( mu <= tol ) )
+		return SUCCESSFUL_RETURN;
+
+	if ( ( resDual <= sqrt( tol ) ) && ( resDyn <= sqrt( tol ) ) && ( resIneq <= sqrt( tol ) ) )
+		return RET_QP_SOLUTION_REACHED_LIMIT;
+
+	return RET_QP_INFEASIBLE;
+}
+
+
+double RiccatiBasedCPsolver::computeResiduals( double& resDual, double& resDyn, double& resIneq )
+{
+	uint run1;
+	uint N = getNumPoints( );
+
+	double mu = 0.0;
+	uint nIneq = 0;
+
+	resDual = 0.0;
+	resDyn  = 0.0;
+	resIneq = 0.0;
+
+	for( run1 = 0; run1 < N; run1++ )
+	{
+		uint ns = getNS( run1 );
+		DVector Dz( D[run1] * z[run1] );
+
+		rDual[run1] = H[run1] * z[run1] + g[run1] - D[run1].transpose( ) * ( lamLo[run1] - lamUp[run1] + yEq[run1] );
+
+		if ( run1 > 0 )
+			rDual[run1].segment( 0,ns ) -= lambdaDyn[run1-1];
+
+		if ( run1 < N-1 )
+		{
+			rDual[run1].segment( 0,ns ) += A[run1].transpose( ) * lambdaDyn[run1];
+			rDual[run1].segment( ns,getNV( run1 ) ) += B[run1].transpose( ) * lambdaDyn[run1];
+
+			rDyn[run1] = z[run1+1].segment( 0,getNS( run1+1 ) ) - A[run1] * z[run1].segment( 0,ns )
+					   - B[run1] * z[run1].segment( ns,getNV( run1 ) ) - c[run1];
+
+			if ( rDyn[run1].getDim( ) > 0 )
+				resDyn = acadoMax( resDyn,rDyn[run1].getNorm( VN_LINF ) );
+		}
+
+		rLo[run1] = ( Dz - lo[run1] - tLo[run1] ).cwiseProduct( hasLo[run1] );
+		rUp[run1] = ( up[run1] - Dz - tUp[run1] ).cwiseProduct( hasUp[run1] );
+		rEq[run1] = ( Dz - lo[run1] ).cwiseProduct( isEq[run1] );
+
+		if ( rDual[run1].getDim( ) > 0 )
+			resDual = acadoMax( resDual,rDual[run1].getNorm( VN_LINF ) );
+
+		if ( rLo[run1].getDim( ) > 0 )
+		{
+			resIneq = acadoMax( resIneq,rLo[run1].getNorm( VN_LINF ) );
+			resIneq = acadoMax( resIneq,rUp[run1].getNorm( VN_LINF ) );
+			resIneq = acadoMax( resIneq,rEq[run1].getNorm( VN_LINF ) );
+		}
+
+		mu    += tLo[run1].dot( lamLo[run1] ) + tUp[run1].dot( lamUp[run1] );
+		nIneq += (uint)( hasLo[run1].sum( ) + hasUp[run1].sum( ) + 0.5 );
+	}
+
+	if ( nIneq > 0 )
+		return mu / (double)nIneq;
+	else
+		return 0.0;
+}
+
+
+returnValue RiccatiBasedCPsolver::factorizeNewtonSystem( )
+{
+	int run1;
+	int N = getNumPoints( );
+
+	// the inequalities enter the Hessian via their barrier weights
+	std::vector< DMatrix > Ht( N );
+
+	for( run1 = 0; run1 < N; run1++ )
+	{
+		DVector sigma( D[run1].getNumRows( ) );
+
+		for( uint run2 = 0; run2 < sigma.getDim(); run2++ )
+		{
+			if ( hasLo[run1](run2) > 0.5 ) sigma( run2 ) += lamLo[run1](run2) / tLo[run1](run2);
+			if ( hasUp[run1](run2) > 0.5 ) sigma( run2 ) += lamUp[run1](run2) / tUp[run1](run2);
+			if ( isEq[run1](run2)  > 0.5 ) sigma( run2 ) += 1.0 / equalityRegularisation;
+		}
+
+		Ht[run1] = H[run1] + D[run1].transpose( ) * sigma.asDiagonal( ) * D[run1];
+	}
+
+
+	// BACKWARD RICCATI RECURSION:
+	// ---------------------------
+	P[N-1] = Ht[N-1];
+
+	for( run1 = N-2; run1 >= 0; run1-- )
+	{
+		uint ns = getNS( run1 );
+		uint nv = getNV( run1 );
+
+		DMatrix PA( P[run1+1] * A[run1] );
+		DMatrix PB( P[run1+1] * B[run1] );
+
+		DMatrix Hvv( Ht[run1].bottomRightCorner( nv,nv ) + B[run1].transpose( ) * PB );
+		G[run1] = Ht[run1].bottomLeftCorner( nv,ns ) + B[run1].transpose( ) * PA;
+
+		if ( choleskyFactor( Hvv,LHvv[run1] ) != SUCCESSFUL_RETURN )
+			return RET_QP_SOLUTION_FAILED;
+
+		K[run1] = -G[run1];
+		choleskySolve( LHvv[run1],K[run1] );
+
+		P[run1] = Ht[run1].topLeftCorner( ns,ns ) + A[run1].transpose( ) * PA + G[run1].transpose( ) * K[run1];
+		P[run1].symmetrize( );
+	}
+
+	return choleskyFactor( P[0],LP0 );
+}
+
+
+returnValue RiccatiBasedCPsolver::solveNewtonSystem(	const std::vector< DVector >& rcLo,
+														const std::vector< DVector >& rcUp
+														)
+{
+	int run1;
+	int N = getNumPoints( );
+
+	std::vector< DVector > q( N ), kff( N-1 ), pv( N );
+
+
+	// LINEAR TERMS OF THE NEWTON SYSTEM:
+	// ----------------------------------
+	for( run1 = 0; run1 < N; run1++ )
+	{
+		DVector phi( D[run1].getNumRows( ) );
+
+		for( uint run2 = 0; run2 < phi.getDim(); run2++ )
+		{
+			if ( hasLo[run1](run2) > 0.5 )
+				phi( run2 ) += ( rcLo[run1](run2) - lamLo[run1](run2)*rLo[run1](run2) ) / tLo[run1](run2);
+			if ( hasUp[run1](run2) > 0.5 )
+				phi( run2 ) -= ( rcUp[run1](run2) - lamUp[run1](run2)*rUp[run1](run2) ) / tUp[run1](run2);
+			if ( isEq[run1](run2) > 0.5 )
+				phi( run2 ) -= rEq[run1](run2) / equalityRegularisation;
+		}
+
+		q[run1] = H[run1] * z[run1] + g[run1] - D[run1].transpose( ) * ( lamLo[run1] - lamUp[run1] + yEq[run1] + phi );
+	}
+
+
+	// BACKWARD RECURSION:
+	// -------------------
+	pv[N-1] = q[N-1];
+
+	for( run1 = N-2; run1 >= 0; run1-- )
+	{
+		uint ns = getNS( run1 );
+		uint nv = getNV( run1 );
+
+		DVector w( pv[run1+1] - P[run1+1] * rDyn[run1] );
+
+		kff[run1] = -( q[run1].segment( ns,nv ) + B[run1].transpose( ) * w );
+		choleskySolve( LHvv[run1],kff[run1] );
+
+		pv[run1] = q[run1].segment( 0,ns ) + A[run1].transpose( ) * w + G[run1].transpose( ) * kff[run1];
+	}
+
+
+	// FORWARD RECURSION:
+	// ------------------
+	DVector s( -pv[0] );
+	choleskySolve( LP0,s );
+
+	for( run1 = 0; run1 < N-1; run1++ )
+	{
+		uint ns = getNS( run1 );
+		uint nv = getNV( run1 );
+
+		dz[run1].segment( 0,ns ) = s;
+		dz[run1].segment( ns,nv ) = K[run1] * s + kff[run1];
+
+		s = A[run1] * s + B[run1] * dz[run1].segment( ns,nv ) - rDyn[run1];
+
+		dlambdaDyn[run1] = P[run1+1] * s + pv[run1+1] - lambdaDyn[run1];
+	}
+	dz[N-1] = s;
+
+
+	// SLACK AND DUAL STEPS:
+	// ---------------------
+	for( run1 = 0; run1 < N; run1++ )
+	{
+		DVector Ddz( D[run1] * dz[run1] );
+
+		dtLo[run1] = ( Ddz + rLo[run1] ).cwiseProduct( hasLo[run1] );
+		dtUp[run1] = ( rUp[run1] - Ddz ).cwiseProduct( hasUp[run1] );
+
+		dlamLo[run1].init( Ddz.getDim( ) );
+		dlamUp[run1].init( Ddz.getDim( ) );
+
+		// proximal update of the multipliers of the equalities
+		dyEq[run1] = -( Ddz + rEq[run1] ).cwiseProduct( isEq[run1] ) / equalityRegularisation;
+
+		for( uint run2 = 0; run2 < Ddz.getDim(); run2++ )
+		{
+			if ( hasLo[run1](run2) > 0.5 )
+				dlamLo[run1]( run2 ) = ( rcLo[run1](run2) - lamLo[run1](run2)*dtLo[run1](run2) ) / tLo[run1](run2);
+			if ( hasUp[run1](run2) > 0.5 )
+				dlamUp[run1]( run2 ) = ( rcUp[run1](run2) - lamUp[run1](run2)*dtUp[run1](run2) ) / tUp[run1](run2);
+		}
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+double RiccatiBasedCPsolver::getMaxStepLength( double tau ) const
+{
+	uint run1, run2;
+	uint N = getNumPoints( );
+
+	double alpha = 1.0;
+
+	for( run1 = 0; run1 < N; run1++ )
+	{
+		for( run2 = 0; run2 < tLo[run1].getDim(); run2++ )
+		{
+			if ( dtLo[run1](run2) < 0.0 )
+				alpha = acadoMin( alpha,-tau*tLo[run1](run2)/dtLo[run1](run2) );
+			if ( dtUp[run1](run2) < 0.0 )
+				alpha = acadoMin( alpha,-tau*tUp[run1](run2)/dtUp[run1](run2) );
+			if ( dlamLo[run1](run2) < 0.0 )
+				alpha = acadoMin( alpha,-tau*lamLo[run1](run2)/dlamLo[run1](run2) );
+			if ( dlamUp[run1](run2) < 0.0 )
+				alpha = acadoMin( alpha,-tau*lamUp[run1](run2)/dlamUp[run1](run2) );
+		}
+	}
+
+	return alpha;
+}
+
+
+returnValue RiccatiBasedCPsolver::expand(	BandedCP& cp
+										)
+{
+	uint run1, run2;
+
+	uint N  = getNumPoints( );
+	uint nx = getNX( );
+	uint np = getNP( );
+	uint nu = getNU( );
+	uint nw = getNW( );
+
+	DMatrix tmp;
+
+
+	// PRIMAL SOLUTION:
+	// ----------------
+	cp.deltaX.init( 5*N,1 );
+
+	for( run1 = 0; run1 < N; run1++ )
+	{
+		tmp = z[run1].segment( 0,nx );
+		cp.deltaX.setDense( run1,0,tmp );
+
+		if ( np > 0 )
+		{
+			tmp = z[0].segment( nx,np );
+			cp.deltaX.setDense( 2*N+run1,0,tmp );
+		}
+
+		// the controls of the last node coincide with the ones of the last interval
+		uint stage  = ( run1 < N-1 ) ? run1 : N-2;
+		uint offset = getNS( stage );
+
+		if ( nu > 0 )
+		{
+			tmp = z[stage].segment( offset,nu );
+			cp.deltaX.setDense( 3*N+run1,0,tmp );
+		}
+
+		if ( nw > 0 )
+		{
+			tmp = z[stage].segment( offset+nu,nw );
+			cp.deltaX.setDense( 4*N+run1,0,tmp );
+		}
+	}
+
+
+	// MULTIPLIERS OF THE DYNAMICS:
+	// ----------------------------
+	cp.lambdaDynamic.init( N-1,1 );
+
+	int dynMode;
+	get( DYNAMIC_SENSITIVITY, dynMode );
+
+	for( run1 = 0; run1 < N-1; run1++ )
+	{
+		if ( dynMode == FORWARD_SENSITIVITY_LIFTED )
+		{
+			tmp.init( nx,1 );
+			tmp.setAll( 1.0/((double) nx) );
+		}
+		else
+			tmp = lambdaDyn[run1].segment( 0,nx );
+
+		cp.lambdaDynamic.setDense( run1,0,tmp );
+	}
+
+
+	// MULTIPLIERS OF THE CONSTRAINTS:
+	// -------------------------------
+	cp.lambdaConstraint.init( blockDims.getDim(),1 );
+
+	for( run1 = 0; run1 < blockDims.getDim(); run1++ )
+	{
+		uint stage = blockStage[run1];
+		uint row   = boundIdx[stage].size( ) + blockOffset[run1];
+
+		tmp.init( (uint)blockDims( run1 ),1 );
+		for( run2 = 0; run2 < (uint)blockDims( run1 ); run2++ )
+			tmp( run2,0 ) = lamLo[stage]( row+run2 ) - lamUp[stage]( row+run2 ) + yEq[stage]( row+run2 );
+
+		cp.lambdaConstraint.setDense( run1,0,tmp );
+	}
+
+
+	// MULTIPLIERS OF THE SIMPLE BOUNDS:
+	// ---------------------------------
+	cp.lambdaBound.init( 4*N+1,1 );
+
+	std::vector< DVector > lambdaZ( N );
+
+	for( run1 = 0; run1 < N; run1++ )
+	{
+		lambdaZ[run1].init( getNS( run1 ) + getNV( run1 ) );
+
+		for( run2 = 0; run2 < boundIdx[run1].size(); run2++ )
+			lambdaZ[run1]( boundIdx[run1][run2] ) = lamLo[run1]( run2 ) - lamUp[run1]( run2 ) + yEq[run1]( run2 );
+
+		tmp = lambdaZ[run1].segment( 0,nx );
+		cp.lambdaBound.setDense( run1,0,tmp );
+	}
+
+	if ( np > 0 )
+	{
+		tmp = lambdaZ[0].segment( nx,np );
+		cp.lambdaBound.setDense( 2*N,0,tmp );
+	}
+
+	for( run1 = 0; run1 < N-1; run1++ )
+	{
+		if ( nu > 0 )
+		{
+			tmp = lambdaZ[run1].segment( getNS( run1 ),nu );
+			cp.lambdaBound.setDense( 2*N+1+run1,0,tmp );
+		}
+
+		if ( nw > 0 )
+		{
+			tmp = lambdaZ[run1].segment( getNS( run1 )+nu,nw );
+			cp.lambdaBound.setDense( 3*N+1+run1,0,tmp );
+		}
+	}
+
+	return SUCCESSFUL_RETURN;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -0,0 +1,313 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/conic_solver/riccati_based_cp_solver.hpp
+ *    \date 2014
+ */
+
+
+#ifndef ACADO_TOOLKIT_RICCATI_BASED_CP_SOLVER_HPP
+#define ACADO_TOOLKIT_RICCATI_BASED_CP_SOLVER_HPP
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/matrix_vector/matrix_vector.hpp>
+#include <acado/conic_solver/banded_cp_solver.hpp>
+
+#include <vector>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Solves banded conic programs arising in optimal control without condensing.
+ *
+ *	\ingroup NumericalAlgorithm
+ *
+ *  The class Riccati based CP solver solves band structured quadratic
+ *  programs directly in their sparse, stage-wise form. A primal-dual
+ *  interior point method (Mehrotra predictor-corrector) is used; the
+ *  Newton system of every iteration is solved by a backward Riccati
+ *  recursion over the shooting nodes. Thus, the cost of one iteration is
+ *  linear in the number of nodes, while condensing is cubic.
+ *
+ *  The parameters are treated as additional states with trivial dynamics
+ *  and the controls at the last node (which coincide with the ones of the
+ *  previous interval) are appended to the terminal state. Algebraic
+ *  states, as well as Hessian blocks or constraints that couple
+ *  non-neighbouring nodes, are not supported.
+ *
+ *  The solver is selected by setting the option SPARSE_QP_SOLUTION
+ *  to SPARSE_SOLVER.
+ */
+
+class RiccatiBasedCPsolver: public BandedCPsolver {
+
+
+    //
+    // PUBLIC MEMBER FUNCTIONS:
+    //
+    public:
+
+        /** Default constructor. */
+        RiccatiBasedCPsolver( );
+
+        RiccatiBasedCPsolver(	UserInteraction* _userInteraction,
+								uint nConstraints_,
+								const DVector& blockDims_
+								);
+
+        /** Copy constructor (deep copy). */
+        RiccatiBasedCPsolver( const RiccatiBasedCPsolver& rhs );
+
+        /** Destructor. */
+        virtual ~RiccatiBasedCPsolver( );
+
+        /** Assignment operator (deep copy). */
+        RiccatiBasedCPsolver& operator=( const RiccatiBasedCPsolver& rhs );
+
+
+        /** Assignment operator (deep copy). */
+        virtual BandedCPsolver* clone() const;
+
+
+        /** initializes the banded conic solver */
+        virtual returnValue init( const OCPiterate &iter_ );
+
+
+        /** Extracts the stage-wise data of a given banded conic program. */
+        virtual returnValue prepareSolve(	BandedCP& cp
+											);
+
+        /** Solves a given banded conic program:                                    \n
+         *                                                                          \n
+         *  \param cp     the banded conic program to be solved                     \n
+         *                                                                          \n
+         *  \return SUCCESSFUL_RETURN   (if successful)                             \n
+         *          RET_BANDED_CP_SOLUTION_FAILED                                   \n
+         */
+        virtual returnValue solve(	BandedCP& cp
+									);
+
+        /** Writes the primal and dual solution back to the banded conic program. */
+        virtual returnValue finalizeSolve(	BandedCP& cp
+											);
+
+
+		inline uint getNX( ) const;
+		inline uint getNXA( ) const;
+		inline uint getNP( ) const;
+		inline uint getNU( ) const;
+		inline uint getNW( ) const;
+
+		inline uint getNC( ) const;
+
+		inline uint getNumPoints( ) const;
+
+
+		virtual returnValue getParameters        ( DVector        &p_  ) const;
+		virtual returnValue getFirstControl      ( DVector        &u0_ ) const;
+
+
+		virtual returnValue setRealTimeParameters(	const DVector& DeltaX,
+													const DVector& DeltaP = emptyConstVector
+													);
+
+		inline BooleanType areRealTimeParametersDefined( ) const;
+
+
+		virtual returnValue freezeCondensing( );
+
+		virtual returnValue unfreezeCondensing( );
+
+
+
+    //
+    // PROTECTED MEMBER FUNCTIONS:
+    //
+    protected:
+
+        /** Returns the number of stage states (x, p and, at the last node, u and w). */
+        inline uint getNS( uint stage ) const;
+
+        /** Returns the number of stage inputs (u and w, empty at the last node). */
+        inline uint getNV( uint stage ) const;
+
+
+        /** Determines the stage and the offset of a block column of the      \n
+         *  banded CP within the stage variables [s_k; v_k] of a term that is \n
+         *  assigned to the given stage.                                      \n
+         *                                                                    \n
+         *  \return BT_TRUE  iff the column can be mapped onto the stage       \n
+         */
+        BooleanType getStageOffset( uint column, uint stage, uint& offset ) const;
+
+        /** Returns the natural stage of a block column of the banded CP, \n
+         *  i.e. the stage of terms that only involve this column.        \n
+         */
+        uint getNaturalStage( uint column ) const;
+
+        /** Determines the stage of a term that involves the given block  \n
+         *  columns.                                                      \n
+         *                                                                \n
+         *  \return SUCCESSFUL_RETURN                                     \n
+         *          RET_NOT_IMPLEMENTED_YET (columns couple several stages)\n
+         */
+        returnValue getTermStage( const std::vector< uint >& columns, uint& stage ) const;
+
+
+        /** Extracts the stage-wise QP data from the banded CP. */
+        returnValue setupStageData(	BandedCP& cp
+									);
+
+        /** Projects the stage Hessians (exact Hessian) and applies the   \n
+         *  Levenberg-Marquardt regularisation of the free variables.     \n
+         */
+        returnValue regularizeStageHessians( );
+
+        /** Sets up the inequalities of all stages (including the         \n
+         *  real-time parameters, if defined).                            \n
+         */
+        returnValue setupInequalities( );
+
+
+        /** Runs the interior point iterations.                           \n
+         *                                                                \n
+         *  \return SUCCESSFUL_RETURN                                     \n
+         *          RET_QP_SOLUTION_REACHED_LIMIT                         \n
+         *          RET_QP_INFEASIBLE                                     \n
+         */
+        returnValue solveQP(	uint maxIter,
+								uint& nIter
+								);
+
+        /** Computes the residuals of the KKT conditions and returns the  \n
+         *  duality measure mu.                                           \n
+         */
+        double computeResiduals( double& resDual, double& resDyn, double& resIneq );
+
+        /** Factorizes the Newton system by a backward Riccati recursion. */
+        returnValue factorizeNewtonSystem( );
+
+        /** Solves the Newton system for the given complementarity        \n
+         *  right-hand sides, based on the last factorization.            \n
+         */
+        returnValue solveNewtonSystem(	const std::vector< DVector >& rcLo,
+										const std::vector< DVector >& rcUp
+										);
+
+        /** Returns the largest step length in (0,1] that keeps all slack  \n
+         *  and dual variables nonnegative (scaled by tau).               \n
+         */
+        double getMaxStepLength( double tau ) const;
+
+
+        /** Writes the solution into the banded CP. */
+        returnValue expand(	BandedCP& cp
+							);
+
+
+
+    //
+    // DATA MEMBERS:
+    //
+    protected:
+
+        OCPiterate iter;
+        DVector blockDims;
+        uint nConstraints;
+
+        BooleanType isPrepared;                  /**< Whether stage data is available        */
+        BooleanType isFrozen;                    /**< Whether the stage matrices are kept    */
+
+
+        // STAGE-WISE QP DATA (stage k has the variables z_k = [s_k; v_k]):
+        // ----------------------------------------------------------------
+        std::vector< DMatrix > H;                /**< Stage Hessians                         */
+        std::vector< DVector > g;                /**< Stage gradients                        */
+
+        std::vector< DMatrix > A;                /**< Dynamics w.r.t. s_k                    */
+        std::vector< DMatrix > B;                /**< Dynamics w.r.t. v_k                    */
+        std::vector< DVector > c;                /**< Dynamics offsets                       */
+
+        std::vector< DVector > lbZ;              /**< Simple lower bounds                    */
+        std::vector< DVector > ubZ;              /**< Simple upper bounds                    */
+        std::vector< DMatrix > C;                /**< Stage constraint matrices              */
+        std::vector< DVector > lbC;              /**< Stage constraint lower bounds          */
+        std::vector< DVector > ubC;              /**< Stage constraint upper bounds          */
+
+        std::vector< uint >    blockStage;       /**< Stage of each constraint block         */
+        std::vector< uint >    blockOffset;      /**< Row of each block within C[stage]      */
+
+
+        // INEQUALITIES  lo <= D z_k <= up  OF THE INTERIOR POINT METHOD:
+        // ---------------------------------------------------------------
+        std::vector< DMatrix > D;                /**< Bound rows followed by constraints     */
+        std::vector< DVector > lo;               /**< Lower limits                           */
+        std::vector< DVector > up;               /**< Upper limits                           */
+        std::vector< DVector > hasLo;            /**< 1 if the lower limit is finite         */
+        std::vector< DVector > hasUp;            /**< 1 if the upper limit is finite         */
+        std::vector< DVector > isEq;             /**< 1 if lower and upper limit coincide    */
+        std::vector< std::vector< int > > boundIdx; /**< Variable index of each bound row    */
+
+
+        // ITERATES AND NEWTON STEPS:
+        // ---------------------------------------------------------------
+        std::vector< DVector > z, lambdaDyn;
+        std::vector< DVector > tLo, tUp, lamLo, lamUp, yEq;
+        std::vector< DVector > dz, dlambdaDyn;
+        std::vector< DVector > dtLo, dtUp, dlamLo, dlamUp, dyEq;
+
+        std::vector< DVector > rDual, rDyn, rLo, rUp, rEq;
+
+
+        // RICCATI FACTORIZATION:
+        // ---------------------------------------------------------------
+        std::vector< DMatrix > P;                /**< Cost-to-go Hessians                    */
+        std::vector< DMatrix > K;                /**< Feedback gains                         */
+        std::vector< DMatrix > G;                /**< Cross terms  S + B' P A                */
+        std::vector< DMatrix > LHvv;             /**< Cholesky factors of R + B' P B         */
+        DMatrix LP0;                             /**< Cholesky factor of P_0                 */
+
+
+		DVector deltaX;
+		DVector deltaP;
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#include <acado/conic_solver/riccati_based_cp_solver.ipp>
+
+
+#endif  // ACADO_TOOLKIT_RICCATI_BASED_CP_SOLVER_HPP
+
+/*
+ *  end of file
+ */
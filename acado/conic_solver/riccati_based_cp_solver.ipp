@@ -0,0 +1,113 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file include/acado/conic_solver/riccati_based_cp_solver.ipp
+ *    \date 2014
+ */
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+inline uint RiccatiBasedCPsolver::getNX( ) const
+{
+	return iter.getNX();
+}
+
+
+inline uint RiccatiBasedCPsolver::getNXA( ) const
+{
+	return iter.getNXA();
+}
+
+
+inline uint RiccatiBasedCPsolver::getNP( ) const
+{
+	return iter.getNP();
+}
+
+
+inline uint RiccatiBasedCPsolver::getNU( ) const
+{
+	return iter.getNU();
+}
+
+
+inline uint RiccatiBasedCPsolver::getNW( ) const
+{
+	return iter.getNW();
+}
+
+
+inline uint RiccatiBasedCPsolver::getNC( ) const
+{
+	return nConstraints;
+}
+
+
+inline uint RiccatiBasedCPsolver::getNumPoints( ) const
+{
+	return iter.getNumPoints();
+}
+
+
+inline BooleanType RiccatiBasedCPsolver::areRealTimeParametersDefined( ) const
+{
+	if ( ( deltaX.isEmpty( ) == BT_TRUE ) && ( deltaP.isEmpty( ) == BT_TRUE ) )
+		return BT_FALSE;
+	else
+		return BT_TRUE;
+}
+
+
+inline uint RiccatiBasedCPsolver::getNS( uint stage ) const
+{
+	if ( stage == getNumPoints( )-1 )
+		return getNX() + getNP() + getNU() + getNW();
+	else
+		return getNX() + getNP();
+}
+
+
+inline uint RiccatiBasedCPsolver::getNV( uint stage ) const
+{
+	if ( stage == getNumPoints( )-1 )
+		return 0;
+	else
+		return getNU() + getNW();
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
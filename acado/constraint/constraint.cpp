@@ -1174,6 +1174,15 @@ BooleanType Constraint::isEmpty() const{
 }
 
 
+returnValue Constraint::setNumThreads( int numThreads_ ){
+
+    if( path_constraint != 0 )
+        return path_constraint->setNumThreads( numThreads_ );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 
 //
 // PROTECTED MEMBER FUNCTIONS:
@@ -449,6 +449,15 @@ class Constraint : public BoxConstraint{
          */
         BooleanType isEmpty() const;
 
+
+        /** Sets the number of threads that evaluate the grid points of \n
+         *  the path constraints concurrently.                          \n
+         *                                                              \n
+         *  \return SUCCESSFUL_RETURN                                   \n
+         */
+        returnValue setNumThreads( int numThreads_ );
+
+
         returnValue getPathConstraints(Function& function_, DMatrix& lb_, DMatrix& ub_) const;
 
         returnValue getPointConstraint(const unsigned index, Function& function_, DMatrix& lb_, DMatrix& ub_) const;
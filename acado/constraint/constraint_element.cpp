@@ -76,6 +76,8 @@ ConstraintElement::ConstraintElement( ){
     bSeed2        = 0     ;
 
     condType      = CT_SPARSE;
+
+    numThreads    = 1;
 }
 
 
@@ -127,6 +129,8 @@ ConstraintElement::ConstraintElement( const Grid& grid_, int nFcn_, int nB_ ){
     bSeed2        = 0     ;
 
     condType      = CT_SPARSE;
+
+    numThreads    = 1;
 }
 
 
@@ -242,6 +246,11 @@ ConstraintElement::ConstraintElement( const ConstraintElement& rhs ){
     dBackward = rhs.dBackward;
 
     condType  = rhs.condType;
+
+    numThreads = rhs.numThreads;
+    threadFcn  = rhs.threadFcn ;
+    threadZ    = rhs.threadZ   ;
+    threadJJ   = rhs.threadJJ  ;
 }
 
 
@@ -279,11 +288,11 @@ ConstraintElement::~ConstraintElement( ){
     if( t_index != 0 )
         delete[] t_index;
 
-	if ( z != 0 )
-		delete[] z;
-	
-	if ( JJ != 0 )
-		delete[] JJ;
+    if ( z != 0 )
+        delete[] z;
+
+    if ( JJ != 0 )
+        delete[] JJ;
 
     if( xSeed   != 0 ) delete xSeed  ;
     if( xaSeed  != 0 ) delete xaSeed ;
@@ -470,6 +479,11 @@ ConstraintElement& ConstraintElement::operator=( const ConstraintElement& rhs ){
         dBackward = rhs.dBackward;
 
         condType  = rhs.condType;
+
+        numThreads = rhs.numThreads;
+        threadFcn  = rhs.threadFcn ;
+        threadZ    = rhs.threadZ   ;
+        threadJJ   = rhs.threadJJ  ;
     }
 
     return *this;
@@ -481,7 +495,9 @@ returnValue ConstraintElement::init(  const OCPiterate& iter ){
     int run1, run2;
 	
 	initializeEvaluationPoints( iter );
-	
+
+    // the dimensions of the evaluation points may have changed:
+    resetThreads();
 
     if( iter.x  != NULL ) nx = iter.x ->getNumValues();
     else             nx = 0                 ;
@@ -750,6 +766,49 @@ returnValue ConstraintElement::initializeEvaluationPoints( const OCPiterate& ite
 	return SUCCESSFUL_RETURN;
 }
 
+returnValue ConstraintElement::setNumThreads( int numThreads_ ){
+
+    int nThreads = ( numThreads_ < 1 ) ? 1 : numThreads_;
+
+    if( nThreads != numThreads ){
+        numThreads = nThreads;
+        resetThreads();
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+int ConstraintElement::prepareThreads( int nPoints ){
+
+    int nThreads = numThreads;
+    if( nThreads > nPoints ) nThreads = nPoints;
+
+    // user-defined C functions are not necessarily reentrant:
+    if( nThreads <= 1 || fcn == 0 || z == 0 || JJ == 0 || fcn[0].isSymbolic() == BT_FALSE )
+        return 1;
+
+    // the copies are only made once, the evaluation points are set up
+    // point-wise by the evaluation routines:
+    if( (int)threadFcn.size() < nThreads-1 ){
+
+        threadFcn.assign( nThreads-1, fcn[0] );
+        threadZ  .assign( nThreads-1, z  [0] );
+        threadJJ .assign( nThreads-1, JJ [0] );
+    }
+
+    return nThreads;
+}
+
+
+void ConstraintElement::resetThreads( ){
+
+    threadFcn.clear();
+    threadZ  .clear();
+    threadJJ .clear();
+}
+
+
 returnValue ConstraintElement::get(Function& function_, DMatrix& lb_, DMatrix& ub_)
 {
 	if ( fcn == NULL )
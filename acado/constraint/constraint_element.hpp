@@ -40,6 +40,8 @@
 #include <acado/function/function.hpp>
 #include <acado/variables_grid/variables_grid.hpp>
 
+#include <vector>
+
 
 BEGIN_NAMESPACE_ACADO
 
@@ -221,6 +223,13 @@ class ConstraintElement{
 
         returnValue get(Function& function_, DMatrix& lb_, DMatrix& ub_);
 
+
+        /** Sets the number of threads that evaluate the grid points of \n
+         *  the constraint element concurrently (default: 1).            \n
+         *  \return SUCCESSFUL_RETURN                                    \n
+         */
+        returnValue setNumThreads( int numThreads_ );
+
 // ==========================================================================
 //
 //                          PROTECTED MEMBER FUNCTIONS:
@@ -233,6 +242,36 @@ class ConstraintElement{
 														);
 
 
+        /** Prepares the evaluation of the first function on nPoints grid  \n
+         *  points: every thread but the first one gets its own copy of    \n
+         *  the function and of the evaluation points, since the buffers   \n
+         *  of a function must not be shared between threads.              \n
+         *                                                                 \n
+         *  \return The number of threads to be used.                      \n
+         */
+        int prepareThreads( int nPoints );
+
+        /** Discards the copies made by prepareThreads(); to be called     \n
+         *  whenever the first function or the dimensions change.          \n
+         */
+        void resetThreads( );
+
+        /** Returns the first grid point that is evaluated by the given    \n
+         *  thread. The points of a thread are contiguous and evaluated in \n
+         *  the buffer positions 0, 1, ... of its function.                \n
+         */
+        inline int getFirstPoint( int thread, int nThreads, int nPoints ) const;
+
+        /** Returns the copy of the first function used by the given thread. */
+        inline Function& getThreadFunction( int thread );
+
+        /** Returns the evaluation point used by the given thread. */
+        inline EvaluationPoint& getThreadZ( int thread );
+
+        /** Returns the derivative evaluation point used by the given thread. */
+        inline EvaluationPoint& getThreadJJ( int thread );
+
+
 
     //
     // DATA MEMBERS:
@@ -273,6 +312,16 @@ class ConstraintElement{
         int              nB     ;   /**< number of bounds        */
 
 
+        // PARALLEL EVALUATION OF THE GRID POINTS:
+        // ---------------------------------------
+
+        int                            numThreads;   /**< number of threads              */
+        std::vector< Function >        threadFcn ;   /**< copies of fcn[0] (threads > 0) */
+        std::vector< EvaluationPoint > threadZ   ;   /**< their evaluation points        */
+        std::vector< EvaluationPoint > threadJJ  ;
+        std::vector< returnValue >     pointReturnValues;   /**< return values of the grid points */
+
+
         // INPUT STORAGE:
         // ------------------------
         BlockMatrix      *xSeed   ;   /**< the 1st order forward seed in x-direction */
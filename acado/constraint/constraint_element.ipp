@@ -112,6 +112,33 @@ inline int ConstraintElement::getNW  () const{
 }
 
 
+inline int ConstraintElement::getFirstPoint( int thread, int nThreads, int nPoints ) const{
+
+    return (int)( ( (long)nPoints*thread ) / nThreads );
+}
+
+
+inline Function& ConstraintElement::getThreadFunction( int thread ){
+
+    if( thread == 0 ) return fcn[0];
+    return threadFcn[thread-1];
+}
+
+
+inline EvaluationPoint& ConstraintElement::getThreadZ( int thread ){
+
+    if( thread == 0 ) return z[0];
+    return threadZ[thread-1];
+}
+
+
+inline EvaluationPoint& ConstraintElement::getThreadJJ( int thread ){
+
+    if( thread == 0 ) return JJ[0];
+    return threadJJ[thread-1];
+}
+
+
 inline BooleanType ConstraintElement::isAffine() const{
 
     for( int run1 = 0; run1 < nFcn; run1++ )
@@ -75,7 +75,7 @@ PathConstraint& PathConstraint::operator=( const PathConstraint& rhs ){
 
 returnValue PathConstraint::evaluate( const OCPiterate& iter ){
 
-    int run1, run2;
+    int run1, thread;
 
     if( fcn == 0 ) return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
@@ -84,37 +84,45 @@ returnValue PathConstraint::evaluate( const OCPiterate& iter ){
 
     if( nc == 0 )  return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
-    residuumL.init(T+1,1);
-    residuumU.init(T+1,1);
+    // the residuum blocks are overwritten in place, such that their
+    // storage is reused from the second evaluation on:
+    if( residuumL.getNumRows() != (uint)(T+1) || residuumL.getNumCols() != 1 ){
+        residuumL.init(T+1,1);
+        residuumU.init(T+1,1);
+    }
 
-    for( run1 = 0; run1 <= T; run1++ ){
+    // EVALUATE THE GRID POINTS (IN PARALLEL):
+    // ---------------------------------------
+    const int nThreads = prepareThreads( T+1 );
 
-        DMatrix resL( nc, 1 );
-        DMatrix resU( nc, 1 );
+    pointReturnValues.resize( T+1 );
 
-		z[0].setZ( run1, iter );
-		DVector result = fcn[0].evaluate( z[0],run1 );
+    #pragma omp parallel for private( run1 ) num_threads( nThreads ) schedule( static ) if( nThreads > 1 )
+    for( thread = 0; thread < nThreads; thread++ ){
 
-        for( run2 = 0; run2 < nc; run2++ ){
-             resL( run2, 0 ) = lb[run1][run2] - result(run2);
-             resU( run2, 0 ) = ub[run1][run2] - result(run2);
-        }
+        const int first = getFirstPoint( thread  , nThreads, T+1 );
+        const int last  = getFirstPoint( thread+1, nThreads, T+1 );
 
-        // STORE THE RESULTS:
-        // ------------------
-        residuumL.setDense( run1, 0, resL );
-        residuumU.setDense( run1, 0, resU );
+        for( run1 = first; run1 < last; run1++ )
+            pointReturnValues[run1] = evaluatePoint( run1, run1-first, iter, getThreadFunction( thread ), getThreadZ( thread ) );
     }
 
-    return SUCCESSFUL_RETURN;
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+    for( run1 = 0; run1 <= T; run1++ ){
+        if( pointReturnValues[run1] != SUCCESSFUL_RETURN ){
+            returnvalue = pointReturnValues[run1];
+            break;
+        }
+    }
+
+    return returnvalue;
 }
 
 
 returnValue PathConstraint::evaluateSensitivities(){
 
 
-    int run1, run3;
-    returnValue returnvalue;
+    int run1, thread;
 
     if( fcn == 0 ) return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
@@ -130,55 +138,32 @@ returnValue PathConstraint::evaluateSensitivities(){
             xSeed2 != 0 || pSeed2 != 0 || uSeed2 != 0 || wSeed2 != 0 )
             return ACADOERROR( RET_WRONG_DEFINITION_OF_SEEDS );
 
-		int nBDirs;
-
         dBackward.init( N, 5*N );
 
+        // the grid points are assigned to the threads as in evaluate()
+        const int nThreads = prepareThreads( N );
 
-        for( run3 = 0; run3 < N; run3++ )
-		{
-            DMatrix bseed_;
-            bSeed->getSubBlock( 0, run3, bseed_);
-			
-            nBDirs = bSeed->getNumRows( 0, run3 );
-
-            DMatrix Dx ( nBDirs, nx );
-            DMatrix Dxa( nBDirs, na );
-            DMatrix Dp ( nBDirs, np );
-            DMatrix Du ( nBDirs, nu );
-            DMatrix Dw ( nBDirs, nw );
-
-			for( run1 = 0; run1 < nBDirs; run1++ )
-			{
-				ACADO_TRY( fcn[0].AD_backward( bseed_.getRow(run1),JJ[0],run3 ) );
-		
-				if( nx > 0 ) Dx .setRow( run1, JJ[0].getX () );
-				if( na > 0 ) Dxa.setRow( run1, JJ[0].getXA() );
-				if( np > 0 ) Dp .setRow( run1, JJ[0].getP () );
-				if( nu > 0 ) Du .setRow( run1, JJ[0].getU () );
-				if( nw > 0 ) Dw .setRow( run1, JJ[0].getW () );
-				
-				JJ[0].setZero( );
-
-            }
-
-			if( nx > 0 )
-				dBackward.setDense( run3,     run3, Dx );
+        pointReturnValues.resize( N );
 
-			if( na > 0 )
-				dBackward.setDense( run3,   N+run3, Dxa );
+        #pragma omp parallel for private( run1 ) num_threads( nThreads ) schedule( static ) if( nThreads > 1 )
+        for( thread = 0; thread < nThreads; thread++ ){
 
-			if( np > 0 )
-				dBackward.setDense( run3, 2*N+run3, Dp );
+            const int first = getFirstPoint( thread  , nThreads, N );
+            const int last  = getFirstPoint( thread+1, nThreads, N );
 
-			if( nu > 0 )
-				dBackward.setDense( run3, 3*N+run3, Du );
+            for( run1 = first; run1 < last; run1++ )
+                pointReturnValues[run1] = evaluatePointSensitivities( run1, run1-first, getThreadFunction( thread ), getThreadJJ( thread ) );
+        }
 
-			if( nw > 0 )
-				dBackward.setDense( run3, 4*N+run3, Dw );
+        returnValue returnvalue = SUCCESSFUL_RETURN;
+        for( run1 = 0; run1 < N; run1++ ){
+            if( pointReturnValues[run1] != SUCCESSFUL_RETURN ){
+                returnvalue = pointReturnValues[run1];
+                break;
+            }
         }
 
-		return SUCCESSFUL_RETURN;
+		return returnvalue;
 	}
 	
 	// TODO: implement forward mode
@@ -190,7 +175,7 @@ returnValue PathConstraint::evaluateSensitivities(){
 
 returnValue PathConstraint::evaluateSensitivities( int &count, const BlockMatrix &seed_, BlockMatrix &hessian ){
 
-    int run3;
+    int run1, thread;
     const int N  = grid.getNumPoints();
     if( fcn == 0 ) return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
@@ -198,262 +183,373 @@ returnValue PathConstraint::evaluateSensitivities( int &count, const BlockMatrix
 
     dBackward.init( N, 5*N );
 
-    for( run3 = 0; run3 < N; run3++ ){
+    // every grid point adds to its own blocks of the Hessian only:
+    const int nThreads = prepareThreads( N );
+
+    pointReturnValues.resize( N );
 
-        DMatrix seed;
-        seed_.getSubBlock( count, 0, seed, nc, 1 );
-        count++;
+    #pragma omp parallel for private( run1 ) num_threads( nThreads ) schedule( static ) if( nThreads > 1 )
+    for( thread = 0; thread < nThreads; thread++ ){
 
-        // EVALUATION OF THE SENSITIVITIES:
-        // --------------------------------
+        const int first = getFirstPoint( thread  , nThreads, N );
+        const int last  = getFirstPoint( thread+1, nThreads, N );
 
-        int run1, run2;
+        for( run1 = first; run1 < last; run1++ ){
 
-        double *bseed1 = new double[nc];
-        double *bseed2 = new double[nc];
-        double *R      = new double[nc];
-        double *J      = new double[fcn[0].getNumberOfVariables() +1];
-        double *H      = new double[fcn[0].getNumberOfVariables() +1];
-        double *fseed  = new double[fcn[0].getNumberOfVariables() +1];
+            DMatrix seed;
+            seed_.getSubBlock( count+run1, 0, seed, nc, 1 );
 
-        for( run1 = 0; run1 < nc; run1++ ){
-            bseed1[run1] = seed(run1,0);
-            bseed2[run1] = 0.0;
+            pointReturnValues[run1] = evaluatePointSensitivities( run1, run1-first, getThreadFunction( thread ), seed, hessian );
         }
+    }
+    count += N;
 
-        for( run1 = 0; run1 < fcn[0].getNumberOfVariables()+1; run1++ )
-            fseed[run1] = 0.0;
-
-        DMatrix Dx ( nc, nx );
-        DMatrix Dxa( nc, na );
-        DMatrix Dp ( nc, np );
-        DMatrix Du ( nc, nu );
-        DMatrix Dw ( nc, nw );
-
-        DMatrix Hx ( nx, nx );
-        DMatrix Hxa( nx, na );
-        DMatrix Hp ( nx, np );
-        DMatrix Hu ( nx, nu );
-        DMatrix Hw ( nx, nw );
-
-        for( run2 = 0; run2 < nx; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[0][run2]] = 1.0;
-            fcn[0].AD_forward( run3, fseed, R );
-            for( run1 = 0; run1 < nc; run1++ )
-                Dx( run1, run2 ) = R[run1];
-            fseed[y_index[0][run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[0].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+    for( run1 = 0; run1 < N; run1++ ){
+        if( pointReturnValues[run1] != SUCCESSFUL_RETURN ){
+            returnvalue = pointReturnValues[run1];
+            break;
+        }
+    }
 
-            fcn[0].AD_backward2( run3, bseed1, bseed2, J, H );
+    return returnvalue;
+}
 
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2, run1             ) = -H[y_index[0][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2, run1-nx          ) = -H[y_index[0][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2, run1-nx-na       ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2, run1-nx-na-np    ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
-        }
 
-        if( nx > 0 ){
 
-            dBackward.setDense( run3, run3, Dx );
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
 
-            if( nx > 0 ) hessian.addDense( run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( run3, 4*N + run3, Hw  );
-        }
 
-        Hx.init ( na, nx );
-        Hxa.init( na, na );
-        Hp.init ( na, np );
-        Hu.init ( na, nu );
-        Hw.init ( na, nw );
-
-        for( run2 = nx; run2 < nx+na; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[0][run2]] = 1.0;
-            fcn[0].AD_forward( run3, fseed, R );
-            for( run1 = 0; run1 < nc; run1++ )
-                Dxa( run1, run2-nx ) = R[run1];
-            fseed[y_index[0][run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[0].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
+returnValue PathConstraint::evaluatePoint( int idx, int number, const OCPiterate& iter,
+                                           Function& f, EvaluationPoint& zz ){
 
-            fcn[0].AD_backward2( run3, bseed1, bseed2, J, H );
+    int run2;
 
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx, run1             ) = -H[y_index[0][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx, run1-nx          ) = -H[y_index[0][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx, run1-nx-na       ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx, run1-nx-na-np    ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
-        }
+    const int nc = f.getDim();
+
+    // THE RESULTS ARE STORED DIRECTLY IN THE RESIDUUM:
+    // ------------------------------------------------
+    DMatrix& resL = residuumL.getDense( idx, 0, nc, 1 );
+    DMatrix& resU = residuumU.getDense( idx, 0, nc, 1 );
+
+    // resU temporarily holds the function value
+    zz.setZ( idx, iter );
+    f.evaluate( zz, number, resU.data() );
+
+    for( run2 = 0; run2 < nc; run2++ ){
+         resL( run2, 0 ) = lb[idx][run2] - resU( run2, 0 );
+         resU( run2, 0 ) = ub[idx][run2] - resU( run2, 0 );
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue PathConstraint::evaluatePointSensitivities( int idx, int number,
+                                                        Function& f, EvaluationPoint& jj ){
+
+    int run1;
+    const int N = grid.getNumPoints();
+
+    DMatrix bseed_;
+    bSeed->getSubBlock( 0, idx, bseed_);
+
+    const int nBDirs = bSeed->getNumRows( 0, idx );
+
+    DMatrix Dx ( nBDirs, nx );
+    DMatrix Dxa( nBDirs, na );
+    DMatrix Dp ( nBDirs, np );
+    DMatrix Du ( nBDirs, nu );
+    DMatrix Dw ( nBDirs, nw );
+
+    for( run1 = 0; run1 < nBDirs; run1++ )
+    {
+        ACADO_TRY( f.AD_backward( bseed_.getRow(run1),jj,number ) );
+
+        if( nx > 0 ) Dx .setRow( run1, jj.getX () );
+        if( na > 0 ) Dxa.setRow( run1, jj.getXA() );
+        if( np > 0 ) Dp .setRow( run1, jj.getP () );
+        if( nu > 0 ) Du .setRow( run1, jj.getU () );
+        if( nw > 0 ) Dw .setRow( run1, jj.getW () );
+
+        jj.setZero( );
+    }
+
+    if( nx > 0 )
+        dBackward.setDense( idx,     idx, Dx );
+
+    if( na > 0 )
+        dBackward.setDense( idx,   N+idx, Dxa );
+
+    if( np > 0 )
+        dBackward.setDense( idx, 2*N+idx, Dp );
+
+    if( nu > 0 )
+        dBackward.setDense( idx, 3*N+idx, Du );
+
+    if( nw > 0 )
+        dBackward.setDense( idx, 4*N+idx, Dw );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue PathConstraint::evaluatePointSensitivities( int idx, int number, Function& f,
+                                                        const DMatrix &seed, BlockMatrix &hessian ){
 
-        if( na > 0 ){
+    const int N  = grid.getNumPoints();
+    const int nc = f.getDim();
+
+    // EVALUATION OF THE SENSITIVITIES:
+    // --------------------------------
+
+    int run1, run2;
 
-            dBackward.setDense( run3, N+run3, Dxa );
+    double *bseed1 = new double[nc];
+    double *bseed2 = new double[nc];
+    double *R      = new double[nc];
+    double *J      = new double[f.getNumberOfVariables() +1];
+    double *H      = new double[f.getNumberOfVariables() +1];
+    double *fseed  = new double[f.getNumberOfVariables() +1];
 
-            if( nx > 0 ) hessian.addDense( N+run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( N+run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( N+run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( N+run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( N+run3, 4*N + run3, Hw  );
+    for( run1 = 0; run1 < nc; run1++ ){
+        bseed1[run1] = seed(run1,0);
+        bseed2[run1] = 0.0;
+    }
+
+    for( run1 = 0; run1 < f.getNumberOfVariables()+1; run1++ )
+        fseed[run1] = 0.0;
+
+    DMatrix Dx ( nc, nx );
+    DMatrix Dxa( nc, na );
+    DMatrix Dp ( nc, np );
+    DMatrix Du ( nc, nu );
+    DMatrix Dw ( nc, nw );
+
+    DMatrix Hx ( nx, nx );
+    DMatrix Hxa( nx, na );
+    DMatrix Hp ( nx, np );
+    DMatrix Hu ( nx, nu );
+    DMatrix Hw ( nx, nw );
+
+    for( run2 = 0; run2 < nx; run2++ ){
+
+        // FIRST ORDER DERIVATIVES:
+        // ------------------------
+        fseed[y_index[0][run2]] = 1.0;
+        f.AD_forward( number, fseed, R );
+        for( run1 = 0; run1 < nc; run1++ )
+            Dx( run1, run2 ) = R[run1];
+        fseed[y_index[0][run2]] = 0.0;
+
+        // SECOND ORDER DERIVATIVES:
+        // -------------------------
+        for( run1 = 0; run1 <= f.getNumberOfVariables(); run1++ ){
+            J[run1] = 0.0;
+            H[run1] = 0.0;
         }
 
-        Hx.init ( np, nx );
-        Hxa.init( np, na );
-        Hp.init ( np, np );
-        Hu.init ( np, nu );
-        Hw.init ( np, nw );
-
-        for( run2 = nx+na; run2 < nx+na+np; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[0][run2]] = 1.0;
-            fcn[0].AD_forward( run3, fseed, R );
-            for( run1 = 0; run1 < nc; run1++ )
-                Dp( run1, run2-nx-na ) = R[run1];
-            fseed[y_index[0][run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[0].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
+        f.AD_backward2( number, bseed1, bseed2, J, H );
+
+        for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2, run1             ) = -H[y_index[0][run1]];
+        for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2, run1-nx          ) = -H[y_index[0][run1]];
+        for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2, run1-nx-na       ) = -H[y_index[0][run1]];
+        for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2, run1-nx-na-np    ) = -H[y_index[0][run1]];
+        for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
+    }
 
-            fcn[0].AD_backward2( run3, bseed1, bseed2, J, H );
+    if( nx > 0 ){
 
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx-na, run1             ) = -H[y_index[0][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx-na, run1-nx          ) = -H[y_index[0][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx-na, run1-nx-na       ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx-na, run1-nx-na-np    ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx-na, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
+        dBackward.setDense( idx, idx, Dx );
+
+        if( nx > 0 ) hessian.addDense( idx,       idx, Hx  );
+        if( na > 0 ) hessian.addDense( idx,   N + idx, Hxa );
+        if( np > 0 ) hessian.addDense( idx, 2*N + idx, Hp  );
+        if( nu > 0 ) hessian.addDense( idx, 3*N + idx, Hu  );
+        if( nw > 0 ) hessian.addDense( idx, 4*N + idx, Hw  );
+    }
+
+    Hx.init ( na, nx );
+    Hxa.init( na, na );
+    Hp.init ( na, np );
+    Hu.init ( na, nu );
+    Hw.init ( na, nw );
+
+    for( run2 = nx; run2 < nx+na; run2++ ){
+
+        // FIRST ORDER DERIVATIVES:
+        // ------------------------
+        fseed[y_index[0][run2]] = 1.0;
+        f.AD_forward( number, fseed, R );
+        for( run1 = 0; run1 < nc; run1++ )
+            Dxa( run1, run2-nx ) = R[run1];
+        fseed[y_index[0][run2]] = 0.0;
+
+        // SECOND ORDER DERIVATIVES:
+        // -------------------------
+        for( run1 = 0; run1 <= f.getNumberOfVariables(); run1++ ){
+            J[run1] = 0.0;
+            H[run1] = 0.0;
         }
 
-        if( np > 0 ){
+        f.AD_backward2( number, bseed1, bseed2, J, H );
+
+        for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx, run1             ) = -H[y_index[0][run1]];
+        for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx, run1-nx          ) = -H[y_index[0][run1]];
+        for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx, run1-nx-na       ) = -H[y_index[0][run1]];
+        for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx, run1-nx-na-np    ) = -H[y_index[0][run1]];
+        for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
+    }
+
+    if( na > 0 ){
 
-            dBackward.setDense( run3, 2*N+run3, Dp );
+        dBackward.setDense( idx, N+idx, Dxa );
 
-            if( nx > 0 ) hessian.addDense( 2*N+run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( 2*N+run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( 2*N+run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( 2*N+run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( 2*N+run3, 4*N + run3, Hw  );
+        if( nx > 0 ) hessian.addDense( N+idx,       idx, Hx  );
+        if( na > 0 ) hessian.addDense( N+idx,   N + idx, Hxa );
+        if( np > 0 ) hessian.addDense( N+idx, 2*N + idx, Hp  );
+        if( nu > 0 ) hessian.addDense( N+idx, 3*N + idx, Hu  );
+        if( nw > 0 ) hessian.addDense( N+idx, 4*N + idx, Hw  );
+    }
+
+    Hx.init ( np, nx );
+    Hxa.init( np, na );
+    Hp.init ( np, np );
+    Hu.init ( np, nu );
+    Hw.init ( np, nw );
+
+    for( run2 = nx+na; run2 < nx+na+np; run2++ ){
+
+        // FIRST ORDER DERIVATIVES:
+        // ------------------------
+        fseed[y_index[0][run2]] = 1.0;
+        f.AD_forward( number, fseed, R );
+        for( run1 = 0; run1 < nc; run1++ )
+            Dp( run1, run2-nx-na ) = R[run1];
+        fseed[y_index[0][run2]] = 0.0;
+
+        // SECOND ORDER DERIVATIVES:
+        // -------------------------
+        for( run1 = 0; run1 <= f.getNumberOfVariables(); run1++ ){
+            J[run1] = 0.0;
+            H[run1] = 0.0;
         }
 
+        f.AD_backward2( number, bseed1, bseed2, J, H );
 
-        Hx.init ( nu, nx );
-        Hxa.init( nu, na );
-        Hp.init ( nu, np );
-        Hu.init ( nu, nu );
-        Hw.init ( nu, nw );
+        for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx-na, run1             ) = -H[y_index[0][run1]];
+        for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx-na, run1-nx          ) = -H[y_index[0][run1]];
+        for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx-na, run1-nx-na       ) = -H[y_index[0][run1]];
+        for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx-na, run1-nx-na-np    ) = -H[y_index[0][run1]];
+        for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx-na, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
+    }
 
-        for( run2 = nx+na+np; run2 < nx+na+np+nu; run2++ ){
+    if( np > 0 ){
 
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[0][run2]] = 1.0;
-            fcn[0].AD_forward( run3, fseed, R );
-            for( run1 = 0; run1 < nc; run1++ )
-                Du( run1, run2-nx-na-np ) = R[run1];
-            fseed[y_index[0][run2]] = 0.0;
+        dBackward.setDense( idx, 2*N+idx, Dp );
 
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[0].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
+        if( nx > 0 ) hessian.addDense( 2*N+idx,       idx, Hx  );
+        if( na > 0 ) hessian.addDense( 2*N+idx,   N + idx, Hxa );
+        if( np > 0 ) hessian.addDense( 2*N+idx, 2*N + idx, Hp  );
+        if( nu > 0 ) hessian.addDense( 2*N+idx, 3*N + idx, Hu  );
+        if( nw > 0 ) hessian.addDense( 2*N+idx, 4*N + idx, Hw  );
+    }
 
-            fcn[0].AD_backward2( run3, bseed1, bseed2, J, H );
 
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx-na-np, run1             ) = -H[y_index[0][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx-na-np, run1-nx          ) = -H[y_index[0][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx-na-np, run1-nx-na       ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx-na-np, run1-nx-na-np    ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx-na-np, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
-        }
+    Hx.init ( nu, nx );
+    Hxa.init( nu, na );
+    Hp.init ( nu, np );
+    Hu.init ( nu, nu );
+    Hw.init ( nu, nw );
 
-        if( nu > 0 ){
+    for( run2 = nx+na+np; run2 < nx+na+np+nu; run2++ ){
 
-            dBackward.setDense( run3, 3*N+run3, Du );
+        // FIRST ORDER DERIVATIVES:
+        // ------------------------
+        fseed[y_index[0][run2]] = 1.0;
+        f.AD_forward( number, fseed, R );
+        for( run1 = 0; run1 < nc; run1++ )
+            Du( run1, run2-nx-na-np ) = R[run1];
+        fseed[y_index[0][run2]] = 0.0;
 
-            if( nx > 0 ) hessian.addDense( 3*N+run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( 3*N+run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( 3*N+run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( 3*N+run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( 3*N+run3, 4*N + run3, Hw  );
+        // SECOND ORDER DERIVATIVES:
+        // -------------------------
+        for( run1 = 0; run1 <= f.getNumberOfVariables(); run1++ ){
+            J[run1] = 0.0;
+            H[run1] = 0.0;
         }
 
-        Hx.init ( nw, nx );
-        Hxa.init( nw, na );
-        Hp.init ( nw, np );
-        Hu.init ( nw, nu );
-        Hw.init ( nw, nw );
-
-        for( run2 = nx+na+np+nu; run2 < nx+na+np+nu+nw; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[0][run2]] = 1.0;
-            fcn[0].AD_forward( run3, fseed, R );
-            for( run1 = 0; run1 < nc; run1++ )
-                Dw( run1, run2-nx-na-np-nu ) = R[run1];
-            fseed[y_index[0][run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[0].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
+        f.AD_backward2( number, bseed1, bseed2, J, H );
 
-            fcn[0].AD_backward2( run3, bseed1, bseed2, J, H );
+        for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx-na-np, run1             ) = -H[y_index[0][run1]];
+        for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx-na-np, run1-nx          ) = -H[y_index[0][run1]];
+        for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx-na-np, run1-nx-na       ) = -H[y_index[0][run1]];
+        for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx-na-np, run1-nx-na-np    ) = -H[y_index[0][run1]];
+        for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx-na-np, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
+    }
 
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx-na-np-nu, run1             ) = -H[y_index[0][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx-na-np-nu, run1-nx          ) = -H[y_index[0][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx-na-np-nu, run1-nx-na       ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx-na-np-nu, run1-nx-na-np    ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx-na-np-nu, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
-        }
+    if( nu > 0 ){
 
-        if( nw > 0 ){
+        dBackward.setDense( idx, 3*N+idx, Du );
 
-            dBackward.setDense( run3, 4*N+run3, Dw );
+        if( nx > 0 ) hessian.addDense( 3*N+idx,       idx, Hx  );
+        if( na > 0 ) hessian.addDense( 3*N+idx,   N + idx, Hxa );
+        if( np > 0 ) hessian.addDense( 3*N+idx, 2*N + idx, Hp  );
+        if( nu > 0 ) hessian.addDense( 3*N+idx, 3*N + idx, Hu  );
+        if( nw > 0 ) hessian.addDense( 3*N+idx, 4*N + idx, Hw  );
+    }
 
-            if( nx > 0 ) hessian.addDense( 4*N+run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( 4*N+run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( 4*N+run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( 4*N+run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( 4*N+run3, 4*N + run3, Hw  );
+    Hx.init ( nw, nx );
+    Hxa.init( nw, na );
+    Hp.init ( nw, np );
+    Hu.init ( nw, nu );
+    Hw.init ( nw, nw );
+
+    for( run2 = nx+na+np+nu; run2 < nx+na+np+nu+nw; run2++ ){
+
+        // FIRST ORDER DERIVATIVES:
+        // ------------------------
+        fseed[y_index[0][run2]] = 1.0;
+        f.AD_forward( number, fseed, R );
+        for( run1 = 0; run1 < nc; run1++ )
+            Dw( run1, run2-nx-na-np-nu ) = R[run1];
+        fseed[y_index[0][run2]] = 0.0;
+
+        // SECOND ORDER DERIVATIVES:
+        // -------------------------
+        for( run1 = 0; run1 <= f.getNumberOfVariables(); run1++ ){
+            J[run1] = 0.0;
+            H[run1] = 0.0;
         }
 
-        delete[] bseed1;
-        delete[] bseed2;
-        delete[] R     ;
-        delete[] J     ;
-        delete[] H     ;
-        delete[] fseed ;
+        f.AD_backward2( number, bseed1, bseed2, J, H );
+
+        for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx-na-np-nu, run1             ) = -H[y_index[0][run1]];
+        for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx-na-np-nu, run1-nx          ) = -H[y_index[0][run1]];
+        for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx-na-np-nu, run1-nx-na       ) = -H[y_index[0][run1]];
+        for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx-na-np-nu, run1-nx-na-np    ) = -H[y_index[0][run1]];
+        for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx-na-np-nu, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
+    }
+
+    if( nw > 0 ){
+
+        dBackward.setDense( idx, 4*N+idx, Dw );
+
+        if( nx > 0 ) hessian.addDense( 4*N+idx,       idx, Hx  );
+        if( na > 0 ) hessian.addDense( 4*N+idx,   N + idx, Hxa );
+        if( np > 0 ) hessian.addDense( 4*N+idx, 2*N + idx, Hp  );
+        if( nu > 0 ) hessian.addDense( 4*N+idx, 3*N + idx, Hu  );
+        if( nw > 0 ) hessian.addDense( 4*N+idx, 4*N + idx, Hw  );
     }
 
+    delete[] bseed1;
+    delete[] bseed2;
+    delete[] R     ;
+    delete[] J     ;
+    delete[] H     ;
+    delete[] fseed ;
 
     return SUCCESSFUL_RETURN;
 }
@@ -131,6 +131,31 @@ class PathConstraint : public ConstraintElement{
 
 	protected:
 
+        /** Evaluates the residuum at the grid point idx in the buffer     \n
+          * position number of the given function.                       \n
+          *                                                              \n
+          * \return SUCESSFUL_RETURN                                     \n
+          */
+        returnValue evaluatePoint( int idx, int number, const OCPiterate& iter,
+                                   Function& f, EvaluationPoint& zz );
+
+
+        /** Evaluates the backward sensitivities at the grid point idx.  \n
+          *                                                              \n
+          * \return SUCESSFUL_RETURN                                     \n
+          */
+        returnValue evaluatePointSensitivities( int idx, int number,
+                                                Function& f, EvaluationPoint& jj );
+
+
+        /** Evaluates the sensitivities and the Hessian contribution at  \n
+          * the grid point idx for the given multipliers.                \n
+          *                                                              \n
+          * \return SUCESSFUL_RETURN                                     \n
+          */
+        returnValue evaluatePointSensitivities( int idx, int number, Function& f,
+                                                const DMatrix &seed, BlockMatrix &hessian );
+
 };
 
 
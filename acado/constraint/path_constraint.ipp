@@ -81,6 +81,7 @@ inline returnValue PathConstraint::add( const DVector lb_, const Expression& arg
 
 
     fcn[0] << arg;
+    resetThreads();
 
     for( run1 = 0; run1 < grid.getNumPoints(); run1++ ){
 
@@ -32,12 +32,156 @@
  */
 
 
+
 #include <acado/dynamic_discretization/collocation_method.hpp>
 
 
 BEGIN_NAMESPACE_ACADO
 
 
+/** Evaluates the Legendre polynomial of degree n at x. */
+static double evaluateLegendrePolynomial( int n, double x ){
+
+    double p0 = 1.0;
+    double p1 = x;
+
+    if( n == 0 ) return p0;
+
+    for( int k = 1; k < n; k++ ){
+        double p2 = ( (2.0*k+1.0)*x*p1 - k*p0 )/( k+1.0 );
+        p0 = p1;
+        p1 = p2;
+    }
+    return p1;
+}
+
+
+/** Evaluates the polynomial whose roots are the collocation points of the \n
+ *  given type on [-1,1].                                                   \n
+ */
+static double evaluateCollocationPolynomial( int type, int n, double x ){
+
+    if( type == CT_GAUSS_LEGENDRE )
+        return evaluateLegendrePolynomial( n, x );
+
+    return evaluateLegendrePolynomial( n, x ) - evaluateLegendrePolynomial( n-1, x );
+}
+
+
+/** Evaluation of the dynamics of one interval at the collocation points of \n
+ *  a step: holds the positions of the states and inputs in the argument of \n
+ *  the DifferentialEquation and the buffers for the evaluation and the     \n
+ *  automatic differentiation. The dynamics at the collocation point i are  \n
+ *  evaluated in the buffer i of the DifferentialEquation. The equation k   \n
+ *  defines the derivative of the state component[k]; states, collocation  \n
+ *  variables and Jacobians are ordered like the states of the iterate.     \n
+ */
+class CollocationFunction{
+
+public:
+
+    CollocationFunction( DifferentialEquation &f_, const DVector &p, const DVector &u, const DVector &w ) : f( f_ ){
+
+        int k;
+
+        n     = f.getDim( );
+        mp    = f.getNP ( );
+        mu    = f.getNU ( );
+        mw    = f.getNW ( );
+        mq    = mp + mu + mw;
+        nVars = f.getNumberOfVariables( );
+
+        stateIndex.resize( n  );
+        inputIndex.resize( mq );
+        component.resize( n );
+
+        DVector components = f.getDifferentialStateComponents( );
+
+        for( k = 0; k < n; k++ ){
+            component[k]  = (int) components(k);
+            stateIndex[k] = f.getStateEnumerationIndex( k );
+            if( stateIndex[k] == nVars )
+                stateIndex[k] = nVars + 1 + k;
+        }
+        for( k = 0; k < mp; k++ ) inputIndex[k      ] = f.index( VT_PARAMETER  , k );
+        for( k = 0; k < mu; k++ ) inputIndex[mp+k   ] = f.index( VT_CONTROL    , k );
+        for( k = 0; k < mw; k++ ) inputIndex[mp+mu+k] = f.index( VT_DISTURBANCE, k );
+
+        timeIndex = f.index( VT_TIME, 0 );
+
+        z.assign( nVars + 1 + n, 0.0 );
+
+        for( k = 0; k < mp; k++ ) z[inputIndex[k      ]] = p(k);
+        for( k = 0; k < mu; k++ ) z[inputIndex[mp+k   ]] = u(k);
+        for( k = 0; k < mw; k++ ) z[inputIndex[mp+mu+k]] = w(k);
+
+        fValue.resize( n );
+        seed.assign( n*n, 0.0 );
+        df.resize( (nVars+1)*n );
+
+        for( k = 0; k < n; k++ )
+            seed[k*n+k] = 1.0;
+    }
+
+    /** Evaluates the residuum F of the collocation equations              \n
+     *  K_i = f( t + c_i h, x + h sum_j a_ij K_j ) of the step starting at  \n
+     *  the time t, where K is the segment of the collocation variables of  \n
+     *  the step starting at offset.                                        \n
+     */
+    void evaluate( double t, double h, const DMatrix &cA, const DVector &cC,
+                   const DVector::Base &x, const DVector::Base &K, int offset, DVector::Base &F ){
+
+        int i, j, k;
+        const int s = cC.getDim( );
+
+        for( i = 0; i < s; i++ ){
+
+            z[timeIndex] = t + cC(i)*h;
+            for( k = 0; k < n; k++ ){
+                double y = x(component[k]);
+                for( j = 0; j < s; j++ )
+                    y += h*cA(i,j)*K(offset+j*n+component[k]);
+                z[stateIndex[k]] = y;
+            }
+
+            f.evaluate( i, &z[0], &fValue[0] );
+
+            for( k = 0; k < n; k++ )
+                F(i*n+component[k]) = K(offset+i*n+component[k]) - fValue[k];
+        }
+    }
+
+    /** Computes the Jacobians of the dynamics w.r.t. the states (Jx) and  \n
+     *  the inputs (Jq, if given) at all collocation points of the last    \n
+     *  evaluation, stacked row-wise.                                      \n
+     */
+    void differentiate( int s, DMatrix::Base &Jx, DMatrix::Base *Jq ){
+
+        int i, k, l;
+
+        for( i = 0; i < s; i++ ){
+
+            std::fill( df.begin(), df.end(), 0.0 );
+            f.AD_backward( i, n, &seed[0], &df[0] );
+
+            for( k = 0; k < n; k++ ){
+                for( l = 0; l < n; l++ )
+                    Jx(i*n+component[k],component[l]) = ( stateIndex[l] < nVars ) ? df[stateIndex[l]*n+k] : 0.0;
+                if( Jq != 0 )
+                    for( l = 0; l < mq; l++ )
+                        (*Jq)(i*n+component[k],l) = ( inputIndex[l] < nVars ) ? df[inputIndex[l]*n+k] : 0.0;
+            }
+        }
+    }
+
+    DifferentialEquation  &f;
+    int                    n, mp, mu, mw, mq, nVars, timeIndex;
+    std::vector< int >     stateIndex, inputIndex, component;
+    std::vector< double >  z, fValue, seed, df;
+};
+
+
+
 //
 // PUBLIC MEMBER FUNCTIONS:
 //
@@ -45,33 +189,88 @@ BEGIN_NAMESPACE_ACADO
 
 CollocationMethod::CollocationMethod( ) : DynamicDiscretization( )
 {
+    dynamics        = 0;
+    collocationType = -1;
+    numPoints       = 0;
+    numSteps        = 0;
+    newtonTolerance = defaultCorrectorTolerance;
 }
 
 
 CollocationMethod::CollocationMethod( UserInteraction* _userInteraction ) : DynamicDiscretization( _userInteraction )
 {
+    dynamics        = 0;
+    collocationType = -1;
+    numPoints       = 0;
+    numSteps        = 0;
+    newtonTolerance = defaultCorrectorTolerance;
 }
 
 
 CollocationMethod::CollocationMethod( const CollocationMethod& rhs )
                      :DynamicDiscretization ( rhs ){
 
-
+    CollocationMethod::copy( rhs );
 }
 
 
 CollocationMethod::~CollocationMethod( ){
 
+    CollocationMethod::deleteAll();
 }
 
 
 
 CollocationMethod& CollocationMethod::operator=( const CollocationMethod& rhs ){
 
+    if( this != &rhs ){
+
+        CollocationMethod::deleteAll();
+
+        DynamicDiscretization::operator=( rhs );
+        CollocationMethod::copy( rhs );
+    }
     return *this;
 }
 
 
+void CollocationMethod::copy( const CollocationMethod &arg ){
+
+    int run1;
+
+    if( arg.dynamics != 0 ){
+        dynamics = (DifferentialEquation**)calloc(N,sizeof(DifferentialEquation*));
+        for( run1 = 0; run1 < N; run1++ )
+            dynamics[run1] = new DifferentialEquation( *arg.dynamics[run1] );
+    }
+    else dynamics = 0;
+
+    breakPoints     = arg.breakPoints    ;
+    collocationType = arg.collocationType;
+    numPoints       = arg.numPoints      ;
+    numSteps        = arg.numSteps       ;
+    cA              = arg.cA             ;
+    cB              = arg.cB             ;
+    cC              = arg.cC             ;
+    cL              = arg.cL             ;
+    newtonTolerance = arg.newtonTolerance;
+
+    xStart      = arg.xStart     ;
+    pStart      = arg.pStart     ;
+    uStart      = arg.uStart     ;
+    wStart      = arg.wStart     ;
+    slopes      = arg.slopes     ;
+    corrections = arg.corrections;
+    xSteps      = arg.xSteps     ;
+
+    liftSlopes  = arg.liftSlopes ;
+    liftX       = arg.liftX      ;
+    liftQ       = arg.liftQ      ;
+    liftDx      = arg.liftDx     ;
+    liftDq      = arg.liftDq     ;
+}
+
+
 DynamicDiscretization* CollocationMethod::clone() const{
 
     return new CollocationMethod(*this);
@@ -83,7 +282,57 @@ returnValue CollocationMethod::addStage( const DynamicSystem  &dynamicSystem_,
                                       const Grid           &stageIntervals,
                                       const IntegratorType &integratorType_ ){
 
-    return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+    // LOAD THE DIFFERENTIAL EQUATION FROM THE DYNAMIC SYSTEM:
+    // -------------------------------------------------------
+    DifferentialEquation differentialEquation_ = dynamicSystem_.getDifferentialEquation( );
+
+    if( differentialEquation_.isDiscretized() == BT_TRUE )
+        return ACADOERROR( RET_CANNOT_TREAT_DISCRETE_DE );
+
+    if( differentialEquation_.getNumAlgebraicEquations() != 0 )
+        return ACADOERROR( RET_CANNOT_TREAT_DAE );
+
+    if( differentialEquation_.isImplicit() == BT_TRUE )
+        return ACADOERROR( RET_CANNOT_TREAT_IMPLICIT_DE );
+
+
+    // STORE ONE COPY OF THE DYNAMICS PER INTERVAL OF THE UNION GRID:
+    // ---------------------------------------------------------------
+    int run1 = N;
+    unionGrid = unionGrid & stageIntervals;
+    N         = unionGrid.getNumIntervals();
+
+    dynamics = (DifferentialEquation**)realloc(dynamics,N*sizeof(DifferentialEquation*));
+
+    while( run1 < N ){
+        dynamics[run1] = new DifferentialEquation( differentialEquation_ );
+        run1++;
+    }
+
+    // the collocation variables of the previous union grid are invalid
+    slopes.clear();
+    liftSlopes.clear();
+
+
+    // STORE THE INFORMATION ABOUT STAGE-BREAK POINTS AND START/END TIMES:
+    // -------------------------------------------------------------------
+    int tmp = 0;
+    if( breakPoints.getNumRows() > 0 ){
+        addOptionsList( );
+        tmp = (int) breakPoints( breakPoints.getNumRows()-1, 0 );
+    }
+
+    DMatrix stageIndices(1,5);
+
+    stageIndices(0,0) = stageIntervals.getNumIntervals() + tmp;
+    stageIndices(0,1) = differentialEquation_.getStartTimeIdx();
+    stageIndices(0,2) = differentialEquation_.getEndTimeIdx();
+    stageIndices(0,3) = differentialEquation_.getStartTime();
+    stageIndices(0,4) = differentialEquation_.getEndTime();
+
+    breakPoints.appendRows(stageIndices);
+
+    return SUCCESSFUL_RETURN;
 }
 
 
@@ -96,60 +345,1047 @@ returnValue CollocationMethod::addTransition( const Transition& transition_ ){
 
 returnValue CollocationMethod::clear(){
 
-    return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+    deleteAllSeeds();
+    CollocationMethod::deleteAll();
+    breakPoints.init(0,0);
+
+    return SUCCESSFUL_RETURN;
 }
 
 
 
 returnValue CollocationMethod::evaluate( OCPiterate &iter ){
 
-    return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+    ASSERT( iter.x != 0 );
+
+    int run1;
+    double tStart, tEnd;
+
+    DVector x ;  nx = iter.getNX ();
+    DVector xa;  na = iter.getNXA();
+    DVector p ;  np = iter.getNP ();
+    DVector u ;  nu = iter.getNU ();
+    DVector w ;  nw = iter.getNW ();
+
+    if( na > 0 )
+        return ACADOERROR( RET_CANNOT_TREAT_DAE );
+
+    ACADO_TRY( setupCollocationScheme( ) );
+
+    double tol;
+    get( CORRECTOR_TOLERANCE, tol );
+
+    // the residuum of the collocation equations cannot be made smaller
+    // than the rounding errors of the model evaluation
+    newtonTolerance = acadoMax( tol, 1.0e3*EPS );
+
+    residuum = *(iter.x);
+    residuum.setAll( 0.0 );
+
+    iter.getInitialData( x, xa, p, u, w );
+
+    xStart.resize( N );
+    pStart.resize( N );
+    uStart.resize( N );
+    wStart.resize( N );
+    xSteps.resize( N );
+    slopes.resize( N );
+    corrections.resize( N );
+
+    liftSlopes.resize( N );
+    liftX.resize( N );
+    liftQ.resize( N );
+    liftDx.resize( N );
+    liftDq.resize( N );
+
+    std::vector< DVector > xEnd( N );
+
+    // in simulation mode the collocation equations are solved to convergence,
+    // otherwise the collocation variables are updated by the last linearization
+    const BooleanType useLifting = ( iter.isInSimulationMode( ) == BT_FALSE ) ? BT_TRUE : BT_FALSE;
+
+
+    // SOLVE THE COLLOCATION EQUATIONS OF ALL INTERVALS AT ONCE IF THEY ARE INDEPENDENT:
+    // ---------------------------------------------------------------------------------
+    int numThreads;
+    get( NUM_THREADS, numThreads );
+
+    BooleanType isIntegrated = BT_FALSE;
+
+    if( numThreads > 1 && N > 1 && hasIndependentIntervals( iter ) == BT_TRUE ){
+
+        for( run1 = 0; run1 < N; run1++ ){
+
+            tStart = unionGrid.getTime( run1 );
+
+            xStart[run1] = x;  pStart[run1] = p;
+            uStart[run1] = u;  wStart[run1] = w;
+
+            if( run1 > 0 ){
+                if( iter.x != 0 ) xStart[run1] = iter.x->getVector( iter.x->getFloorIndex( tStart ) );
+                if( iter.u != 0 ) uStart[run1] = iter.u->getVector( iter.u->getFloorIndex( tStart ) );
+                if( iter.w != 0 ) wStart[run1] = iter.w->getVector( iter.w->getFloorIndex( tStart ) );
+            }
+        }
+
+        returnValue *returnvalues = new returnValue[N];
+
+        #pragma omp parallel for num_threads( numThreads ) schedule( dynamic )
+        for( run1 = 0; run1 < N; run1++ )
+            returnvalues[run1] = integrateInterval( run1, xStart[run1], pStart[run1], uStart[run1], wStart[run1], useLifting, xEnd[run1] );
+
+        returnValue returnvalue = SUCCESSFUL_RETURN;
+        for( run1 = 0; run1 < N; run1++ )
+            if( returnvalues[run1] != SUCCESSFUL_RETURN )
+                returnvalue = RET_UNABLE_TO_INTEGRATE_SYSTEM;
+
+        delete[] returnvalues;
+
+        if( returnvalue != SUCCESSFUL_RETURN )
+            return ACADOERROR( returnvalue );
+
+        isIntegrated = BT_TRUE;
+    }
+
+
+    // RUN A LOOP OVER ALL INTERVALS OF THE UNION GRID:
+    // ------------------------------------------------
+    for( run1 = 0; run1 < N; run1++ ){
+
+        tStart = unionGrid.getTime( run1   );
+        tEnd   = unionGrid.getTime( run1+1 );
+
+        Grid evaluationGrid;
+        iter.x->getSubGrid( tStart,tEnd,evaluationGrid );
+
+        if( isIntegrated == BT_FALSE ){
+
+            xStart[run1] = x;  pStart[run1] = p;
+            uStart[run1] = u;  wStart[run1] = w;
+
+            if( integrateInterval( run1, x, p, u, w, useLifting, xEnd[run1] ) != SUCCESSFUL_RETURN )
+                return ACADOERROR( RET_UNABLE_TO_INTEGRATE_SYSTEM );
+        }
+
+        DVector xOld = xEnd[run1];
+        DVector pOld = p;
+
+        // the states at the points of a finer state grid are given by the
+        // collocation polynomial, the last point is the end of the interval
+        for( uint run2 = 1; run2 < evaluationGrid.getNumPoints( ); run2++ ){
+
+            if( run2 < evaluationGrid.getNumPoints( )-1 )
+                x = interpolate( run1, evaluationGrid.getTime( run2 ) );
+            else
+                x = xOld;
+
+            iter.updateData( evaluationGrid.getTime( run2 ), x, xa, p, u, w );
+        }
+
+        if ( iter.isInSimulationMode( ) == BT_FALSE )
+            p = pOld;
+
+        residuum.setVector( run1, xOld - x );
+    }
+
+    // LOG THE RESULTS:
+    // ----------------
+    return logTrajectory( iter );
 }
 
 
 
 returnValue CollocationMethod::evaluateSensitivities( ){
 
-    return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+    int i;
+    int numThreads;
+    get( NUM_THREADS, numThreads );
+
+    if( (int) xStart.size() != N )
+        return ACADOERROR( RET_NOT_FROZEN );
+
+    // the intervals are independent once the collocation equations are solved
+    std::vector< DMatrix > Gx( N ), Gp( N ), Gu( N ), Gw( N );
+    returnValue *returnvalues = new returnValue[N];
+
+    #pragma omp parallel for num_threads( numThreads ) schedule( dynamic ) if( numThreads > 1 )
+    for( i = 0; i < N; i++ )
+        returnvalues[i] = differentiateInterval( i, Gx[i], Gp[i], Gu[i], Gw[i] );
+
+    for( i = 0; i < N; i++ ){
+        if( returnvalues[i] != SUCCESSFUL_RETURN ){
+            returnValue returnvalue = returnvalues[i];
+            delete[] returnvalues;
+            return ACADOERROR( returnvalue );
+        }
+    }
+    delete[] returnvalues;
+
+
+    // COMPUTATION OF BACKWARD SENSITIVITIES:
+    // --------------------------------------
+    if( bSeed.isEmpty() == BT_FALSE ){
+
+        dBackward.init( N, 5 );
+
+        for( i = 0; i < N; i++ ){
+
+            DMatrix seed;
+            bSeed.getSubBlock( 0, i, seed );
+
+            if( nx > 0 ) dBackward.setDense( i, 0, seed*Gx[i] );
+            if( np > 0 ) dBackward.setDense( i, 2, seed*Gp[i] );
+            if( nu > 0 ) dBackward.setDense( i, 3, seed*Gu[i] );
+            if( nw > 0 ) dBackward.setDense( i, 4, seed*Gw[i] );
+        }
+        return SUCCESSFUL_RETURN;
+    }
+
+
+    // COMPUTATION OF FORWARD SENSITIVITIES:
+    // -------------------------------------
+    dForward.init( N, 5 );
+
+    for( i = 0; i < N; i++ ){
+
+        DMatrix X, P, U, W;
+
+        if( xSeed.isEmpty() == BT_FALSE ) xSeed.getSubBlock( i, 0, X );
+        if( pSeed.isEmpty() == BT_FALSE ) pSeed.getSubBlock( i, 0, P );
+        if( uSeed.isEmpty() == BT_FALSE ) uSeed.getSubBlock( i, 0, U );
+        if( wSeed.isEmpty() == BT_FALSE ) wSeed.getSubBlock( i, 0, W );
+
+        if( nx > 0 ) dForward.setDense( i, 0, X.isEmpty() ? DMatrix( nx, 0 ) : DMatrix( Gx[i]*X ) );
+        if( np > 0 ) dForward.setDense( i, 2, P.isEmpty() ? DMatrix( nx, 0 ) : DMatrix( Gp[i]*P ) );
+        if( nu > 0 ) dForward.setDense( i, 3, U.isEmpty() ? DMatrix( nx, 0 ) : DMatrix( Gu[i]*U ) );
+        if( nw > 0 ) dForward.setDense( i, 4, W.isEmpty() ? DMatrix( nx, 0 ) : DMatrix( Gw[i]*W ) );
+    }
+
+    return SUCCESSFUL_RETURN;
 }
 
 
 returnValue CollocationMethod::evaluateSensitivitiesLifted( ){
 
-    return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+    // the collocation variables are always lifted, see integrateInterval()
+    return evaluateSensitivities( );
 }
 
 
 returnValue CollocationMethod::evaluateSensitivities( const BlockMatrix &seed, BlockMatrix &hessian ){
 
-    return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
-}
+    const int NN = N+1;
+    int i, j, k;
+    int numThreads;
+    get( NUM_THREADS, numThreads );
 
+    if( (int) xStart.size() != N )
+        return ACADOERROR( RET_NOT_FROZEN );
 
-returnValue CollocationMethod::deleteAllSeeds(){
+    // THE FIRST AND SECOND ORDER DERIVATIVES OF ALL INTERVALS W.R.T. (x,p,u,w):
+    // --------------------------------------------------------------------------
+    std::vector< DVector > S( N );
+    std::vector< DMatrix > G( N ), H( N );
+    returnValue *returnvalues = new returnValue[N];
+
+    for( i = 0; i < N; i++ ){
+        DMatrix tmp;
+        seed.getSubBlock( i, 0, tmp, nx, 1 );
+        S[i] = tmp.getCol( 0 );
+    }
+
+    #pragma omp parallel for num_threads( numThreads ) schedule( dynamic ) if( numThreads > 1 )
+    for( i = 0; i < N; i++ )
+        returnvalues[i] = differentiateSecondOrder( i, S[i], G[i], H[i] );
+
+    for( i = 0; i < N; i++ ){
+        if( returnvalues[i] != SUCCESSFUL_RETURN ){
+            returnValue returnvalue = returnvalues[i];
+            delete[] returnvalues;
+            return ACADOERROR( returnvalue );
+        }
+    }
+    delete[] returnvalues;
+
+
+    // ASSEMBLY OF THE FORWARD SENSITIVITIES AND THE HESSIAN BLOCKS:
+    // -------------------------------------------------------------
+    const int dims  [4] = { nx, np, nu, nw };
+    const int blocks[4] = { 0, 2, 3, 4 };
+
+    int offsets[4];
+    offsets[0] = 0;
+    for( j = 1; j < 4; j++ )
+        offsets[j] = offsets[j-1] + dims[j-1];
+
+    dForward.init( N, 5 );
+
+    for( i = 0; i < N; i++ ){
+
+        DMatrix seeds[4];
+
+        if( xSeed.isEmpty() == BT_FALSE ) xSeed.getSubBlock( i, 0, seeds[0] );
+        if( pSeed.isEmpty() == BT_FALSE ) pSeed.getSubBlock( i, 0, seeds[1] );
+        if( uSeed.isEmpty() == BT_FALSE ) uSeed.getSubBlock( i, 0, seeds[2] );
+        if( wSeed.isEmpty() == BT_FALSE ) wSeed.getSubBlock( i, 0, seeds[3] );
+
+        // embed the derivatives w.r.t. the inputs of the dynamics of this
+        // interval into the (possibly larger) dimensions of the iterate
+        const int n  = dynamics[i]->getDim( );
+        const int mq = dynamics[i]->getNP( ) + dynamics[i]->getNU( ) + dynamics[i]->getNW( );
+        const int local[4] = { n, dynamics[i]->getNP( ), dynamics[i]->getNU( ), dynamics[i]->getNW( ) };
+
+        DMatrix::Base P = DMatrix::Base::Zero( n + mq, offsets[3] + nw );
+        int row = 0;
+        for( j = 0; j < 4; j++ )
+            for( k = 0; k < local[j]; k++ )
+                P( row++, offsets[j] + k ) = 1.0;
+
+        DMatrix::Base Gi = G[i]*P;
+        DMatrix::Base Hi = P.transpose()*H[i]*P;
 
-//     setForwardSeed(  0, 0, 0, 0, 1 );
-//     setForwardSeed(  0, 0, 0, 0, 2 );
-//     setBackwardSeed( 0, 1 );
-//     setBackwardSeed( 0, 2 );
+        for( j = 0; j < 4; j++ ){
 
-    // delete seeds of member classes ...
+            if( dims[j] == 0 ) continue;
 
+            if( seeds[j].isEmpty() == BT_TRUE ){
+                dForward.setDense( i, blocks[j], DMatrix( n, 0 ) );
+                continue;
+            }
+
+            dForward.setDense( i, blocks[j], DMatrix( Gi.block( 0, offsets[j], n, dims[j] )*seeds[j] ) );
+
+            for( k = 0; k < 4; k++ ){
+
+                if( dims[k] == 0 ) continue;
+
+                DMatrix Hjk = seeds[j].transpose()*Hi.block( offsets[j], offsets[k], dims[j], dims[k] );
+                hessian.addDense( blocks[j]*NN+i, blocks[k]*NN+i, Hjk );
+            }
+        }
+    }
     return SUCCESSFUL_RETURN;
 }
 
 
+returnValue CollocationMethod::deleteAllSeeds(){
+
+    return DynamicDiscretization::deleteAllSeeds();
+}
+
+
 
 returnValue CollocationMethod::unfreeze( ){
 
-    return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+    // the collocation variables are iterates of the NLP and have to be kept
+    return SUCCESSFUL_RETURN;
 }
 
 
 
 BooleanType CollocationMethod::isAffine( ) const
 {
-    return BT_FALSE;
+    for( int run1 = 0; run1 < N; ++run1 )
+        if ( dynamics[run1]->isAffine( ) == BT_FALSE )
+            return BT_FALSE;
+
+    return BT_TRUE;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+
+returnValue CollocationMethod::deleteAll(){
+
+    int run1;
+    if( dynamics != 0 ){
+        for( run1 = 0; run1 < N; run1++ )
+            if( dynamics[run1] != 0 )
+                delete dynamics[run1];
+        free(dynamics);
+        dynamics = 0;
+    }
+
+    xStart.clear();
+    pStart.clear();
+    uStart.clear();
+    wStart.clear();
+    slopes.clear();
+    corrections.clear();
+    xSteps.clear();
+
+    liftSlopes.clear();
+    liftX.clear();
+    liftQ.clear();
+    liftDx.clear();
+    liftDq.clear();
+
+    unionGrid.init();
+    DynamicDiscretization::initializeVariables( );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue CollocationMethod::setupCollocationScheme( ){
+
+    int type, s, m;
+
+    get( COLLOCATION_TYPE      , type );
+    get( COLLOCATION_NUM_POINTS, s    );
+    get( COLLOCATION_NUM_STEPS , m    );
+
+    if( ( type != CT_GAUSS_LEGENDRE && type != CT_RADAU_IIA ) || s < 1 || s > 9 || m < 1 )
+        return ACADOERROR( RET_INVALID_OPTION );
+
+    if( type == collocationType && s == numPoints && m == numSteps )
+        return SUCCESSFUL_RETURN;
+
+    int i, j, k;
+
+    // COLLOCATION POINTS: ROOTS OF THE LEGENDRE POLYNOMIAL (GAUSS) OR OF
+    // P_s - P_{s-1} (RADAU IIA, INCLUDING THE END POINT) MAPPED TO [0,1]:
+    // -------------------------------------------------------------------
+    const int nGrid = 200*s;
+
+    cC.init( s );
+    int nRoots = 0;
+
+    double xl = -1.0;
+    double gl = evaluateCollocationPolynomial( type, s, xl );
+
+    for( k = 1; k < nGrid && nRoots < s; k++ ){
+
+        double xr = -1.0 + 2.0*k/nGrid;
+        double gr = evaluateCollocationPolynomial( type, s, xr );
+
+        // a sign change is detected between a negative and a non-negative
+        // value, such that a root on the grid is bracketed exactly once
+        if( ( gl < 0.0 ) != ( gr < 0.0 ) ){
+
+            double a = xl, b = xr, ga = gl;
+            for( j = 0; j < 100; j++ ){
+                double c  = 0.5*( a + b );
+                double gc = evaluateCollocationPolynomial( type, s, c );
+                if( ga*gc <= 0.0 ){ b = c; }
+                else{ a = c; ga = gc; }
+            }
+            cC(nRoots++) = 0.25*( a + b ) + 0.5;
+        }
+        xl = xr;
+        gl = gr;
+    }
+
+    if( type == CT_RADAU_IIA && nRoots == s-1 )
+        cC(nRoots++) = 1.0;
+
+    if( nRoots != s )
+        return ACADOERROR( RET_UNKNOWN_BUG );
+
+
+    // BUTCHER TABLEAU: INTEGRALS OF THE LAGRANGE POLYNOMIALS, WHOSE
+    // MONOMIAL COEFFICIENTS ARE GIVEN BY THE INVERSE VANDERMONDE MATRIX:
+    // ------------------------------------------------------------------
+    DMatrix V( s, s );
+    for( i = 0; i < s; i++ )
+        for( k = 0; k < s; k++ )
+            V(i,k) = pow( cC(i), k );
+
+    cL = V.inverse();
+
+    cA.init( s, s );
+    cB.init( s );
+    cA.setZero();
+    cB.setZero();
+
+    for( j = 0; j < s; j++ ){
+        for( k = 0; k < s; k++ ){
+            cB(j) += cL(k,j)/( k+1.0 );
+            for( i = 0; i < s; i++ )
+                cA(i,j) += cL(k,j)*pow( cC(i), k+1 )/( k+1.0 );
+        }
+    }
+
+    collocationType = type;
+    numPoints       = s;
+    numSteps        = m;
+
+    // the stored collocation variables do not fit the new scheme
+    slopes.clear();
+    liftSlopes.clear();
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue CollocationMethod::integrateInterval( int            idx       ,
+                                                  const DVector &x0        ,
+                                                  const DVector &p         ,
+                                                  const DVector &u         ,
+                                                  const DVector &w         ,
+                                                  BooleanType    useLifting,
+                                                  DVector       &xEnd        ){
+
+    const int n  = dynamics[idx]->getDim( );
+    const int mp = dynamics[idx]->getNP ( );
+    const int mu = dynamics[idx]->getNU ( );
+    const int mw = dynamics[idx]->getNW ( );
+
+    if( (int) x0.getDim() != n || (int) p.getDim() < mp || (int) u.getDim() < mu || (int) w.getDim() < mw )
+        return RET_INPUT_HAS_WRONG_DIMENSION;
+
+    const BooleanType isLifted = ( useLifting == BT_TRUE &&
+                                   (int) liftSlopes[idx].getDim() == n*numPoints*numSteps ) ? BT_TRUE : BT_FALSE;
+
+    if( isLifted == BT_TRUE ){
+
+        // UPDATE THE COLLOCATION VARIABLES BY THE LAST LINEARIZATION:
+        // -----------------------------------------------------------
+        DVector q( mp+mu+mw );
+        q.segment( 0    , mp ) = p.segment( 0, mp );
+        q.segment( mp   , mu ) = u.segment( 0, mu );
+        q.segment( mp+mu, mw ) = w.segment( 0, mw );
+
+        slopes[idx] = liftSlopes[idx] + liftDx[idx]*( x0 - liftX[idx] ) + liftDq[idx]*( q - liftQ[idx] );
+    }
+    else{
+        if( solveInterval( idx, x0, p, u, w ) != SUCCESSFUL_RETURN )
+            return RET_UNABLE_TO_INTEGRATE_SYSTEM;
+    }
+
+    return linearizeInterval( idx, x0, p, u, w, isLifted, xEnd );
+}
+
+
+returnValue CollocationMethod::solveInterval( int            idx,
+                                              const DVector &x0 ,
+                                              const DVector &p  ,
+                                              const DVector &u  ,
+                                              const DVector &w    ){
+
+    CollocationFunction f( *dynamics[idx], p, u, w );
+
+    const int n  = f.n;
+    const int s  = numPoints;
+    const int ns = n*s;
+
+    const int maxNumIterations = 50;
+
+    const double t0 = unionGrid.getTime( idx );
+    const double h  = ( unionGrid.getTime( idx+1 ) - t0 )/numSteps;
+
+    int i, k, step;
+
+    DMatrix::Base Jx( ns, n ), M( ns, ns );
+    DVector::Base F( ns ), dK;
+    Eigen::PartialPivLU< DMatrix::Base > lu;
+
+    DVector::Base xm = x0;
+
+    DVector &K = slopes[idx];
+    BooleanType isWarmStart = ( (int) K.getDim() == ns*numSteps ) ? BT_TRUE : BT_FALSE;
+    if( isWarmStart == BT_FALSE )
+        K.init( ns*numSteps );
+
+
+    for( step = 0; step < numSteps; step++ ){
+
+        Eigen::VectorBlock< DVector::Base > Km = K.segment( step*ns, ns );
+
+        if( isWarmStart == BT_FALSE ){
+
+            f.z[f.timeIndex] = t0 + step*h;
+            for( k = 0; k < n; k++ )
+                f.z[f.stateIndex[k]] = xm(f.component[k]);
+
+            f.f.evaluate( 0, &f.z[0], &f.fValue[0] );
+
+            for( i = 0; i < s; i++ )
+                for( k = 0; k < n; k++ )
+                    Km(i*n+f.component[k]) = f.fValue[k];
+        }
+
+
+        // NEWTON ITERATIONS FOR THE COLLOCATION EQUATIONS K_i = f( t_i, x_m + h sum_j a_ij K_j ):
+        // --------------------------------------------------------------------------------------
+        BooleanType isConverged = BT_FALSE;
+        int iter = 0;
+
+        while( 1 ){
+
+            f.evaluate( t0 + step*h, h, cA, cC, xm, K, step*ns, F );
+
+            if( F.allFinite() == false )
+                return RET_UNABLE_TO_INTEGRATE_SYSTEM;
+
+            double scale = 1.0 + Km.lpNorm< Eigen::Infinity >();
+
+            if( isConverged == BT_TRUE || F.lpNorm< Eigen::Infinity >() <= newtonTolerance*scale )
+                break;
+
+            if( iter >= maxNumIterations )
+                return RET_UNABLE_TO_INTEGRATE_SYSTEM;
+
+            f.differentiate( s, Jx, 0 );
+
+            for( i = 0; i < s; i++ )
+                for( k = 0; k < s; k++ )
+                    M.block( i*n, k*n, n, n ) = ( -h*cA(i,k) )*Jx.block( i*n, 0, n, n );
+            M.diagonal().array() += 1.0;
+
+            lu.compute( M );
+            dK  = lu.solve( -F );
+            Km += dK;
+
+            if( dK.lpNorm< Eigen::Infinity >() <= newtonTolerance*scale )
+                isConverged = BT_TRUE;
+
+            iter++;
+        }
+
+        for( i = 0; i < s; i++ )
+            xm += ( h*cB(i) )*Km.segment( i*n, n );
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue CollocationMethod::linearizeInterval( int            idx               ,
+                                                  const DVector &x0                ,
+                                                  const DVector &p                 ,
+                                                  const DVector &u                 ,
+                                                  const DVector &w                 ,
+                                                  BooleanType    computeCorrections,
+                                                  DVector       &xEnd              ,
+                                                  DMatrix       *Gx                ,
+                                                  DMatrix       *Gp                ,
+                                                  DMatrix       *Gu                ,
+                                                  DMatrix       *Gw                  ){
+
+    CollocationFunction f( *dynamics[idx], p, u, w );
+
+    const int n  = f.n;
+    const int mp = f.mp;
+    const int mu = f.mu;
+    const int mw = f.mw;
+    const int mq = f.mq;
+    const int s  = numPoints;
+    const int ns = n*s;
+
+    const double t0 = unionGrid.getTime( idx );
+    const double h  = ( unionGrid.getTime( idx+1 ) - t0 )/numSteps;
+
+    int i, j, step;
+
+    const BooleanType computeSensitivities = ( Gx != 0 ) ? BT_TRUE : BT_FALSE;
+
+    DVector &K = slopes[idx];
+    if( (int) K.getDim() != ns*numSteps )
+        return RET_UNABLE_TO_INTEGRATE_SYSTEM;
+
+    DVector &dK0 = corrections[idx];
+    dK0.init( ns*numSteps );
+    dK0.setZero();
+
+    if( computeSensitivities == BT_TRUE ){
+        liftDx[idx].init( ns*numSteps, n  );
+        liftDq[idx].init( ns*numSteps, mq );
+    }
+
+    DMatrix::Base Jx( ns, n ), Jq( ns, mq ), M( ns, ns ), dKx, dKq;
+    DVector::Base F( ns ), dK;
+    Eigen::PartialPivLU< DMatrix::Base > lu;
+
+    DMatrix::Base Sx = DMatrix::Base::Identity( n, n );
+    DMatrix::Base Sq = DMatrix::Base::Zero( n, mq );
+
+    DVector::Base xm = x0;
+    DVector::Base c  = DVector::Base::Zero( n );
+
+    xSteps[idx].init( numSteps+1, n );
+
+
+    for( step = 0; step < numSteps; step++ ){
+
+        xSteps[idx].row( step ) = ( xm + c ).transpose();
+
+        if( computeCorrections == BT_TRUE || computeSensitivities == BT_TRUE ){
+
+            // THE BLOCK OF THE JACOBIAN OF THE COLLOCATION EQUATIONS OF THIS STEP:
+            // --------------------------------------------------------------------
+            f.evaluate( t0 + step*h, h, cA, cC, xm, K, step*ns, F );
+
+            if( F.allFinite() == false )
+                return RET_UNABLE_TO_INTEGRATE_SYSTEM;
+
+            f.differentiate( s, Jx, ( computeSensitivities == BT_TRUE ) ? &Jq : 0 );
+
+            for( i = 0; i < s; i++ )
+                for( j = 0; j < s; j++ )
+                    M.block( i*n, j*n, n, n ) = ( -h*cA(i,j) )*Jx.block( i*n, 0, n, n );
+            M.diagonal().array() += 1.0;
+
+            lu.compute( M );
+
+
+            // SENSITIVITIES BY THE IMPLICIT FUNCTION THEOREM:
+            // -----------------------------------------------
+            if( computeSensitivities == BT_TRUE ){
+
+                dKx = lu.solve( Jx*Sx );
+                dKq = lu.solve( Jx*Sq + Jq );
+
+                liftDx[idx].block( step*ns, 0, ns, n  ) = dKx;
+                liftDq[idx].block( step*ns, 0, ns, mq ) = dKq;
+
+                for( i = 0; i < s; i++ ){
+                    Sx += ( h*cB(i) )*dKx.block( i*n, 0, n, n  );
+                    Sq += ( h*cB(i) )*dKq.block( i*n, 0, n, mq );
+                }
+            }
+
+
+            // NEWTON STEP OF THE COLLOCATION VARIABLES, WHICH ALSO ACCOUNTS
+            // FOR THE NEWTON STEPS OF THE PREVIOUS STEPS OF THE INTERVAL:
+            // -------------------------------------------------------------
+            if( computeCorrections == BT_TRUE ){
+
+                dK = lu.solve( Jx*c - F );
+                dK0.segment( step*ns, ns ) = dK;
+
+                for( i = 0; i < s; i++ )
+                    c += ( h*cB(i) )*dK.segment( i*n, n );
+            }
+        }
+
+        for( i = 0; i < s; i++ )
+            xm += ( h*cB(i) )*K.segment( step*ns + i*n, n );
+    }
+
+    xEnd = xm + c;
+    xSteps[idx].row( numSteps ) = xEnd.transpose();
+
+    if( computeSensitivities == BT_TRUE ){
+
+        Gx->init( n, nx );  Gx->setZero();
+        Gp->init( n, np );  Gp->setZero();
+        Gu->init( n, nu );  Gu->setZero();
+        Gw->init( n, nw );  Gw->setZero();
+
+        Gx->block( 0, 0, n, n  ) = Sx;
+        Gp->block( 0, 0, n, mp ) = Sq.block( 0, 0    , n, mp );
+        Gu->block( 0, 0, n, mu ) = Sq.block( 0, mp   , n, mu );
+        Gw->block( 0, 0, n, mw ) = Sq.block( 0, mp+mu, n, mw );
+
+
+        // STORE THE LINEARIZATION FOR THE UPDATE OF THE COLLOCATION VARIABLES:
+        // --------------------------------------------------------------------
+        liftSlopes[idx] = K + dK0;
+        liftX[idx] = x0;
+
+        liftQ[idx].init( mq );
+        liftQ[idx].segment( 0    , mp ) = p.segment( 0, mp );
+        liftQ[idx].segment( mp   , mu ) = u.segment( 0, mu );
+        liftQ[idx].segment( mp+mu, mw ) = w.segment( 0, mw );
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue CollocationMethod::differentiateInterval( int idx, DMatrix &Gx, DMatrix &Gp, DMatrix &Gu, DMatrix &Gw ){
+
+    DVector xEnd;
+
+    if( linearizeInterval( idx, xStart[idx], pStart[idx], uStart[idx], wStart[idx], BT_TRUE, xEnd, &Gx, &Gp, &Gu, &Gw ) != SUCCESSFUL_RETURN )
+        return RET_UNABLE_TO_INTEGRATE_SYSTEM;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue CollocationMethod::differentiateSecondOrder( int            idx,
+                                                         const DVector &S  ,
+                                                         DMatrix       &G  ,
+                                                         DMatrix       &H    ){
+
+    DMatrix Gx, Gp, Gu, Gw;
+
+    // the first order sensitivities also store the linearization for lifting
+    if( differentiateInterval( idx, Gx, Gp, Gu, Gw ) != SUCCESSFUL_RETURN )
+        return RET_UNABLE_TO_INTEGRATE_SYSTEM;
+
+    CollocationFunction f( *dynamics[idx], pStart[idx], uStart[idx], wStart[idx] );
+
+    const int n  = f.n;
+    const int mq = f.mq;
+    const int nv = n + mq;
+    const int s  = numPoints;
+    const int ns = n*s;
+
+    const double t0 = unionGrid.getTime( idx );
+    const double h  = ( unionGrid.getTime( idx+1 ) - t0 )/numSteps;
+
+    const DVector &K = slopes[idx];
+
+    int i, j, k, l, step;
+
+    if( (int) S.getDim() < n )
+        return RET_INPUT_HAS_WRONG_DIMENSION;
+
+
+    // FORWARD SWEEP: STATES, JACOBIANS AND SENSITIVITIES OF ALL STEPS
+    // W.R.T. v = (x0,p,u,w):
+    // ----------------------------------------------------------------
+    std::vector< DVector::Base > xm( numSteps+1 );
+    std::vector< DMatrix::Base > Jx( numSteps ), M( numSteps ), Sv( numSteps+1 ), dKv( numSteps );
+
+    DMatrix::Base Jq( ns, mq );
+    Eigen::PartialPivLU< DMatrix::Base > lu;
+    DVector::Base F( ns );
+
+    xm[0] = xStart[idx];
+    Sv[0] = DMatrix::Base::Zero( n, nv );
+    Sv[0].block( 0, 0, n, n ).setIdentity();
+
+    for( step = 0; step < numSteps; step++ ){
+
+        Jx[step].resize( ns, n );
+        M [step].resize( ns, ns );
+
+        f.evaluate( t0 + step*h, h, cA, cC, xm[step], K, step*ns, F );
+        f.differentiate( s, Jx[step], &Jq );
+
+        for( i = 0; i < s; i++ )
+            for( j = 0; j < s; j++ )
+                M[step].block( i*n, j*n, n, n ) = ( -h*cA(i,j) )*Jx[step].block( i*n, 0, n, n );
+        M[step].diagonal().array() += 1.0;
+
+        DMatrix::Base rhs = Jx[step]*Sv[step];
+        rhs.block( 0, n, ns, mq ) += Jq;
+
+        lu.compute( M[step] );
+        dKv[step] = lu.solve( rhs );
+
+        xm[step+1] = xm[step];
+        Sv[step+1] = Sv[step];
+        for( i = 0; i < s; i++ ){
+            xm[step+1] += ( h*cB(i) )*K.segment( step*ns + i*n, n );
+            Sv[step+1] += ( h*cB(i) )*dKv[step].block( i*n, 0, n, nv );
+        }
+    }
+
+    G = Sv[numSteps];
+
+
+    // ADJOINT SWEEP: MULTIPLIERS mu OF THE COLLOCATION EQUATIONS SUCH THAT
+    // S^T x_end + sum mu^T F IS STATIONARY W.R.T. THE COLLOCATION VARIABLES:
+    // ----------------------------------------------------------------------
+    std::vector< DVector::Base > mu( numSteps );
+    DVector::Base lambda = S.segment( 0, n );
+
+    for( step = numSteps-1; step >= 0; step-- ){
+
+        DVector::Base rhs( ns );
+        for( i = 0; i < s; i++ )
+            rhs.segment( i*n, n ) = ( -h*cB(i) )*lambda;
+
+        lu.compute( M[step].transpose() );
+        mu[step] = lu.solve( rhs );
+
+        lambda -= Jx[step].transpose()*mu[step];
+    }
+
+
+    // SECOND ORDER TERMS: THE DYNAMICS AT EVERY COLLOCATION POINT DEPEND
+    // ON v THROUGH THE STAGE VALUE z_i = x_m + h sum_j a_ij K_j AND THE INPUTS:
+    // -------------------------------------------------------------------------
+    const int nVars = f.nVars;
+
+    std::vector< double > fseed( nVars+1, 0.0 ), R( n ), J( nVars+1 ), Hd( nVars+1 );
+    std::vector< double > bseed1( n ), bseed2( n, 0.0 );
+
+    DMatrix::Base T( n, nv ), HT( nv, nv );
+    HT.setZero();
+
+    for( step = 0; step < numSteps; step++ ){
+
+        f.evaluate( t0 + step*h, h, cA, cC, xm[step], K, step*ns, F );
+
+        for( i = 0; i < s; i++ ){
+
+            T = Sv[step];
+            for( j = 0; j < s; j++ )
+                T += ( h*cA(i,j) )*dKv[step].block( j*n, 0, n, nv );
+
+            for( k = 0; k < n; k++ )
+                bseed1[k] = mu[step]( i*n+f.component[k] );
+
+            for( l = 0; l < nv; l++ ){
+
+                for( k = 0; k < n; k++ )
+                    if( f.stateIndex[k] < nVars )
+                        fseed[f.stateIndex[k]] = T(f.component[k],l);
+                for( k = 0; k < mq; k++ )
+                    if( f.inputIndex[k] < nVars )
+                        fseed[f.inputIndex[k]] = ( l == n+k ) ? 1.0 : 0.0;
+
+                f.f.AD_forward( i, &fseed[0], &R[0] );
+
+                std::fill( J .begin(), J .end(), 0.0 );
+                std::fill( Hd.begin(), Hd.end(), 0.0 );
+
+                f.f.AD_backward2( i, &bseed1[0], &bseed2[0], &J[0], &Hd[0] );
+
+                // the collocation equations are K - f = 0
+                for( k = 0; k < n; k++ )
+                    if( f.stateIndex[k] < nVars )
+                        HT.col( l ) -= Hd[f.stateIndex[k]]*T.row( f.component[k] ).transpose();
+                for( k = 0; k < mq; k++ )
+                    if( f.inputIndex[k] < nVars )
+                        HT( n+k, l ) -= Hd[f.inputIndex[k]];
+            }
+        }
+    }
+
+    H = HT;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+DVector CollocationMethod::interpolate( int idx, double t ) const{
+
+    const int n  = xSteps[idx].getNumCols( );
+    const int s  = numPoints;
+    const int ns = n*s;
+
+    const double t0 = unionGrid.getTime( idx );
+    const double h  = ( unionGrid.getTime( idx+1 ) - t0 )/numSteps;
+
+    int step = (int) floor( ( t - t0 )/h );
+    step = acadoMax( 0, acadoMin( step, numSteps-1 ) );
+
+    const double tau = ( t - t0 )/h - step;
+
+    // x(t) = x_m + h sum_j ( int_0^tau l_j ) K_j with the Lagrange polynomials l_j
+    DVector x = xSteps[idx].getRow( step );
+
+    for( int j = 0; j < s; j++ ){
+
+        double weight = 0.0;
+        for( int k = 0; k < s; k++ )
+            weight += cL(k,j)*pow( tau, k+1 )/( k+1.0 );
+
+        x += ( h*weight )*( slopes[idx].segment( step*ns + j*n, n ) + corrections[idx].segment( step*ns + j*n, n ) );
+    }
+
+    return x;
+}
+
+
+returnValue CollocationMethod::logTrajectory( const OCPiterate &iter ){
+
+    if( dynamics == 0 || (int) xSteps.size() != N ) return SUCCESSFUL_RETURN;
+
+    int i, j;
+    double T = 0.0;
+    double t1 = 0.0, t2 = 0.0;
+    double h = 0.0;
+    BooleanType needToRescale = BT_FALSE;
+
+    VariablesGrid logX, logP, logU, logW, tmp, tmp2;
+
+    DMatrix intervalPoints(N+1,1);
+    intervalPoints(0,0) = 0.0;
+
+    j = 0;
+    for( i = 0; i < N; i++ ){
+
+        if( (int) breakPoints(j,0) <= i ) j++;
+
+        int i1 = (int) breakPoints(j,1);
+        int i2 = (int) breakPoints(j,2);
+
+        if( i1 >= 0 )  t1 = iter.p->operator()(0,i1);
+        else           t1 = breakPoints(j,3);
+
+        if( i2 >= 0 )  t2 = iter.p->operator()(0,i2);
+        else           t2 = breakPoints(j,4);
+
+        if( i == 0 ) T = t1;
+
+        tmp.init( nx, unionGrid.getTime( i ), unionGrid.getTime( i+1 ), numSteps+1 );
+        for( int run1 = 0; run1 <= numSteps; run1++ )
+            tmp.setVector( run1, xSteps[i].getRow( run1 ) );
+
+        intervalPoints(i+1,0) = intervalPoints(i,0) + tmp.getNumPoints();
+
+        if ( ( i1 >= 0 ) || ( i2 >= 0 ) )
+        {
+            if ( iter.isInSimulationMode() == BT_FALSE )
+            {
+                h = t2-t1;
+                needToRescale = BT_TRUE;
+            }
+        }
+        else
+        {
+            h = 1.0;
+            needToRescale = BT_FALSE;
+        }
+
+        if ( needToRescale == BT_TRUE ) rescale( &tmp, T, h );
+
+        if( nx > 0 ){ logX .appendTimes( tmp );
+                    }
+        if( np > 0 ){ tmp2.init( np, tmp.getFirstTime(),tmp.getLastTime(),2 );
+                      if ( iter.isInSimulationMode( ) == BT_FALSE )
+                        tmp2.setAllVectors( iter.p->getVector(0) );
+                      else
+                        tmp2.setAllVectors( iter.p->getVector(i) );
+                      logP .appendTimes( tmp2 );
+                    }
+        if( nu > 0 ){ tmp2.init( nu, tmp.getFirstTime(),tmp.getLastTime(),2 );
+                      tmp2.setAllVectors(iter.u->getVector(i));
+                      logU .appendTimes( tmp2 );
+                    }
+        if( nw > 0 ){ tmp2.init( nw, tmp );
+                      tmp2.setAllVectors(iter.w->getVector(i));
+                      logW .appendTimes( tmp2 );
+                    }
+        T = tmp.getLastTime();
+    }
+
+
+    // WRITE DATA TO THE LOG COLLECTION:
+    // ---------------------------------
+    if( nx > 0 ) setLast( LOG_DIFFERENTIAL_STATES, logX   );
+    if( np > 0 ) setLast( LOG_PARAMETERS         , logP   );
+    if( nu > 0 ) setLast( LOG_CONTROLS           , logU   );
+    if( nw > 0 ) setLast( LOG_DISTURBANCES       , logW   );
+
+    setLast( LOG_DISCRETIZATION_INTERVALS, intervalPoints );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue CollocationMethod::rescale(	VariablesGrid* trajectory,
+                                        double tEndNew,
+                                        double newIntervalLength
+                                        ) const
+{
+    trajectory->shiftTimes( -trajectory->getTime(0) );
+    trajectory->scaleTimes( newIntervalLength );
+    trajectory->shiftTimes( tEndNew  );
+
+    return SUCCESSFUL_RETURN;
 }
 
 
@@ -48,6 +48,33 @@ BEGIN_NAMESPACE_ACADO
  *  The class CollocationMethod allows to discretize a DifferentialEquation 
  *	for use in optimal control algorithms by means of a collocation scheme.
  *
+ *  Every interval of the union grid is divided into COLLOCATION_NUM_STEPS
+ *  steps, on which the state trajectory is approximated by a polynomial
+ *  through COLLOCATION_NUM_POINTS Gauss-Legendre or Radau IIA points
+ *  (option COLLOCATION_TYPE).
+ *
+ *  The collocation variables are variables of the NLP which are lifted,
+ *  i.e. they are not solved to convergence at every evaluation but updated
+ *  together with the node variables: at each linearization point the
+ *  block-sparse Jacobian of the collocation equations of every step is
+ *  factorized once and yields both the Newton step of the collocation
+ *  variables and their derivatives w.r.t. the node variables. The QP only
+ *  sees the nodes, hence it keeps the structure of a multiple shooting
+ *  discretization, and after the QP step the collocation variables are
+ *  updated by the linearization. Only the first evaluation of an interval
+ *  and evaluations in simulation mode solve the collocation equations by
+ *  Newton's method.
+ *
+ *  Since the intervals only share their nodes, the residuum and the
+ *  sensitivities of all intervals can be evaluated in parallel (option
+ *  NUM_THREADS). Second order derivatives for exact Hessians are computed
+ *  by an adjoint sweep over the collocation equations and second order
+ *  automatic differentiation of the dynamics. If the state grid is finer
+ *  than the union grid, the intermediate states are given by the
+ *  collocation polynomials.
+ *
+ *  The current implementation is restricted to explicit ODEs.
+ *
  *	\author Boris Houska, Hans Joachim Ferreau
  */
 class CollocationMethod : public DynamicDiscretization
@@ -141,9 +168,154 @@ public:
     virtual returnValue deleteAllSeeds();
 
 
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
 protected:
 
+    void copy( const CollocationMethod &arg );
+
+    returnValue deleteAll();
+
+
+    /** Computes the coefficients of the collocation scheme selected by  \n
+     *  the options (if they have changed).                              \n
+     *                                                                   \n
+     *  \return SUCCESSFUL_RETURN                                        \n
+     *          RET_INVALID_OPTION                                       \n
+     */
+    returnValue setupCollocationScheme( );
+
+
+    /** Computes the collocation variables of the interval idx for the  \n
+     *  initial state x0, either by the linearization of the last call   \n
+     *  to differentiateInterval (if useLifting is BT_TRUE) or by        \n
+     *  Newton's method, and returns the state at the end of the         \n
+     *  interval.                                                        \n
+     *                                                                   \n
+     *  \return SUCCESSFUL_RETURN                                        \n
+     *          RET_UNABLE_TO_INTEGRATE_SYSTEM                           \n
+     */
+    returnValue integrateInterval( int            idx       ,
+                                   const DVector &x0        ,
+                                   const DVector &p         ,
+                                   const DVector &u         ,
+                                   const DVector &w         ,
+                                   BooleanType    useLifting,
+                                   DVector       &xEnd        );
+
+
+    /** Solves the collocation equations of the interval idx starting    \n
+     *  at x0 by Newton's method, warm-started from the current          \n
+     *  collocation variables.                                           \n
+     *                                                                   \n
+     *  \return SUCCESSFUL_RETURN                                        \n
+     *          RET_UNABLE_TO_INTEGRATE_SYSTEM                           \n
+     */
+    returnValue solveInterval( int            idx,
+                               const DVector &x0 ,
+                               const DVector &p  ,
+                               const DVector &u  ,
+                               const DVector &w    );
+
+
+    /** Linearizes the collocation equations of the interval idx at the  \n
+     *  current collocation variables and returns the state at the end   \n
+     *  of the interval after the Newton step of the collocation         \n
+     *  variables (if computeCorrections is BT_TRUE). If Gx is given,    \n
+     *  the sensitivities of the end state w.r.t. x0, p, u and w are     \n
+     *  computed as well and the linearization is stored for lifting.    \n
+     *                                                                   \n
+     *  \return SUCCESSFUL_RETURN                                        \n
+     *          RET_UNABLE_TO_INTEGRATE_SYSTEM                           \n
+     */
+    returnValue linearizeInterval( int            idx               ,
+                                   const DVector &x0                ,
+                                   const DVector &p                 ,
+                                   const DVector &u                 ,
+                                   const DVector &w                 ,
+                                   BooleanType    computeCorrections,
+                                   DVector       &xEnd              ,
+                                   DMatrix       *Gx = 0            ,
+                                   DMatrix       *Gp = 0            ,
+                                   DMatrix       *Gu = 0            ,
+                                   DMatrix       *Gw = 0              );
+
+
+    /** Computes the sensitivities of the interval idx at the point of   \n
+     *  the last evaluation.                                             \n
+     *                                                                   \n
+     *  \return SUCCESSFUL_RETURN                                        \n
+     *          RET_UNABLE_TO_INTEGRATE_SYSTEM                           \n
+     */
+    returnValue differentiateInterval( int idx, DMatrix &Gx, DMatrix &Gp, DMatrix &Gu, DMatrix &Gw );
+
+
+    /** Computes the sensitivities G of the end state of the interval    \n
+     *  idx w.r.t. all its inputs (x,p,u,w) and the second derivative H  \n
+     *  of S^T times the end state at the point of the last evaluation.  \n
+     *  The multipliers of the collocation equations are obtained by an  \n
+     *  adjoint sweep, the second derivatives of the dynamics by         \n
+     *  automatic differentiation.                                       \n
+     *                                                                   \n
+     *  \return SUCCESSFUL_RETURN                                        \n
+     *          RET_UNABLE_TO_INTEGRATE_SYSTEM                           \n
+     */
+    returnValue differentiateSecondOrder( int            idx,
+                                          const DVector &S  ,
+                                          DMatrix       &G  ,
+                                          DMatrix       &H    );
+
+
+    /** Evaluates the collocation polynomial of the interval idx at the  \n
+     *  time t.                                                          \n
+     */
+    DVector interpolate( int idx, double t ) const;
+
+
+    returnValue logTrajectory( const OCPiterate &iter );
+    returnValue rescale(	VariablesGrid* trajectory,
+                            double tEndNew,
+                            double newIntervalLength
+                            ) const;
+
+
+//
+// PROTECTED MEMBERS:
+//
+
+protected:
 
+    DifferentialEquation  **dynamics       ;   /**< one copy of the dynamics per interval      */
+    DMatrix                 breakPoints    ;   /**< stage break points and start/end times     */
+
+    int                     collocationType;   /**< the current collocation scheme             */
+    int                     numPoints      ;   /**< the number of collocation points           */
+    int                     numSteps       ;   /**< the number of steps per interval           */
+    DMatrix                 cA             ;   /**< the Butcher tableau of the scheme          */
+    DVector                 cB             ;   /**< the weights of the scheme                  */
+    DVector                 cC             ;   /**< the collocation points in [0,1]            */
+    DMatrix                 cL             ;   /**< monomial coefficients of the Lagrange
+                                                    polynomials of the collocation points     */
+    double                  newtonTolerance;   /**< tolerance of the Newton iterations         */
+
+    std::vector< DVector >  xStart         ;   /**< the initial states of all intervals        */
+    std::vector< DVector >  pStart         ;   /**< the parameters of all intervals            */
+    std::vector< DVector >  uStart         ;   /**< the controls of all intervals              */
+    std::vector< DVector >  wStart         ;   /**< the disturbances of all intervals          */
+    std::vector< DVector >  slopes         ;   /**< the collocation variables                  */
+    std::vector< DVector >  corrections    ;   /**< their Newton steps at the last evaluation  */
+    std::vector< DMatrix >  xSteps         ;   /**< the states at the step boundaries          */
+
+    std::vector< DVector >  liftSlopes     ;   /**< the collocation variables after the
+                                                    Newton step at the last linearization     */
+    std::vector< DVector >  liftX          ;   /**< the initial states at the linearization    */
+    std::vector< DVector >  liftQ          ;   /**< the inputs (p,u,w) at the linearization    */
+    std::vector< DMatrix >  liftDx         ;   /**< derivatives of the collocation variables
+                                                    w.r.t. the initial state                   */
+    std::vector< DMatrix >  liftDq         ;   /**< derivatives of the collocation variables
+                                                    w.r.t. the inputs (p,u,w)                  */
 };
 
 
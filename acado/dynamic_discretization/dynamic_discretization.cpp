@@ -193,6 +193,10 @@ returnValue DynamicDiscretization::setupOptions( ){
 	addOption( FREEZE_INTEGRATOR           , defaultFreezeIntegrator        );
 	addOption( FEASIBILITY_CHECK           , defaultFeasibilityCheck        );
 	addOption( PLOT_RESOLUTION             , defaultPlotResoltion           );
+	addOption( NUM_THREADS                 , defaultNumThreads              );
+	addOption( COLLOCATION_TYPE            , defaultCollocationType         );
+	addOption( COLLOCATION_NUM_POINTS      , defaultCollocationNumPoints    );
+	addOption( COLLOCATION_NUM_STEPS       , defaultCollocationNumSteps     );
 
 	// add integrator options
 	addOption( MAX_NUM_INTEGRATOR_STEPS    , defaultMaxNumSteps             );
@@ -287,6 +291,31 @@ uint DynamicDiscretization::getNumEvaluationPoints() const{
 }
 
 
+BooleanType DynamicDiscretization::hasIndependentIntervals( const OCPiterate &iter ) const{
+
+    if( iter.isInSimulationMode( ) == BT_TRUE )
+        return BT_FALSE;
+
+    // The initial values of interval run1 > 0 are read from the iterate only
+    // if the corresponding nodes exist and are not auto-initialized;
+    // otherwise they depend on the integration of the previous interval.
+    VariablesGrid *grids[4] = { iter.x, iter.xa, iter.u, iter.w };
+
+    uint run1, run2;
+    for( run1 = 1; run1 < unionGrid.getNumIntervals(); run1++ ){
+
+        double t = unionGrid.getTime( run1 );
+
+        for( run2 = 0; run2 < 4; run2++ ){
+            if( grids[run2] == 0 ) continue;
+            if( grids[run2]->hasTime( t ) == BT_FALSE ) return BT_FALSE;
+            if( grids[run2]->getAutoInit( grids[run2]->getFloorIndex( t ) ) == BT_TRUE ) return BT_FALSE;
+        }
+    }
+    return BT_TRUE;
+}
+
+
 
 CLOSE_NAMESPACE_ACADO
 
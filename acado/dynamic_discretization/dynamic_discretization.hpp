@@ -260,6 +260,15 @@ class DynamicDiscretization : public AlgorithmicBase
         uint getNumEvaluationPoints() const;
 
 
+		/**< Checks whether all interior nodes of the iterate are fixed, i.e.  \n
+		*   whether the initial values of all intervals are known before       \n
+		*   integrating and the intervals can be evaluated independently.      \n
+		*                                                                       \n
+		*   \return BT_TRUE  iff the intervals are independent                 \n
+		*/
+		BooleanType hasIndependentIntervals( const OCPiterate &iter ) const;
+
+
 	//
 	// PROTECTED MEMBERS:
 	//
@@ -428,6 +428,7 @@ returnValue IntegrationAlgorithm::setupOptions( )
 	addOption( INTEGRATOR_TYPE             , INT_BDF                        );
 	addOption( FEASIBILITY_CHECK           , defaultFeasibilityCheck        );
 	addOption( PLOT_RESOLUTION             , defaultPlotResoltion           );
+	addOption( NUM_THREADS                 , defaultNumThreads              );
 	
 	// add integrator options
 	addOption( MAX_NUM_INTEGRATOR_STEPS    , defaultMaxNumSteps             );
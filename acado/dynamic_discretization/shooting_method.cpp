@@ -227,6 +227,19 @@ returnValue ShootingMethod::evaluate(	OCPiterate &iter
     residuum.setAll( 0.0 );
 
     iter.getInitialData( x, xa, p, u, w );
+
+
+    // INTEGRATE ALL INTERVALS AT ONCE IF THEY ARE INDEPENDENT:
+    // -------------------------------------------------------
+    int numThreads;
+    get( NUM_THREADS, numThreads );
+
+    BooleanType isIntegrated = BT_FALSE;
+
+    if( numThreads > 1 && N > 1 && hasIndependentIntervals( iter ) == BT_TRUE ){
+        ACADO_TRY( integrateInParallel( iter, numThreads ) );
+        isIntegrated = BT_TRUE;
+    }
 // 	iter.x->print( "x" );
 // 	iter.u->print( "u" );
 
@@ -238,13 +251,16 @@ returnValue ShootingMethod::evaluate(	OCPiterate &iter
 
     for( run1 = 0; run1 < unionGrid.getNumIntervals(); run1++ ){
 
-        integrator[run1]->setOptions( getOptions( 0 ) );  // ??
+		if ( isIntegrated == BT_FALSE )
+		{
+			integrator[run1]->setOptions( getOptions( 0 ) );  // ??
 
-		int freezeIntegrator;
-		get( FREEZE_INTEGRATOR, freezeIntegrator );
+			int freezeIntegrator;
+			get( FREEZE_INTEGRATOR, freezeIntegrator );
 
-		if ( (BooleanType)freezeIntegrator == BT_TRUE )
-			integrator[run1]->freezeAll();
+			if ( (BooleanType)freezeIntegrator == BT_TRUE )
+				integrator[run1]->freezeAll();
+		}
 
         tStart = unionGrid.getTime( run1   );
         tEnd   = unionGrid.getTime( run1+1 );
@@ -275,8 +291,9 @@ returnValue ShootingMethod::evaluate(	OCPiterate &iter
 // 		u.print("u before");
 // 		x.print("x before");
 // 		w.print("w");
-        if ( integrator[run1]->integrate( outputGrid&evaluationGrid, x, xa, p, u, w ) != SUCCESSFUL_RETURN )
-			return ACADOERROR( RET_UNABLE_TO_INTEGRATE_SYSTEM );
+        if ( isIntegrated == BT_FALSE )
+			if ( integrator[run1]->integrate( outputGrid&evaluationGrid, x, xa, p, u, w ) != SUCCESSFUL_RETURN )
+				return ACADOERROR( RET_UNABLE_TO_INTEGRATE_SYSTEM );
 
 		
 		DVector xOld;
@@ -466,50 +483,169 @@ returnValue ShootingMethod::differentiateForwardBackward( const int     &idx ,
 
 returnValue ShootingMethod::evaluateSensitivities(){
 
-    int i;
+    int i, j;
+    int numThreads;
+    get( NUM_THREADS, numThreads );
+
+    // The intervals are independent as soon as the seeds are known. Every
+    // interval writes its derivative blocks and its return value into its
+    // own slots; the block matrix is assembled and errors are reported
+    // sequentially after the parallel loop.
+    DMatrix     *blocks       = new DMatrix    [5*N];
+    returnValue *returnvalues = new returnValue[N];
+
+    BooleanType isBackward = ( bSeed.isEmpty() == BT_FALSE ) ? BT_TRUE : BT_FALSE;
 
     // COMPUTATION OF BACKWARD SENSITIVITIES:
     // --------------------------------------
 
-    if( bSeed.isEmpty() == BT_FALSE ){
+    if( isBackward == BT_TRUE ){
 
-        dBackward.init( N, 5 );
+        #pragma omp parallel for num_threads( numThreads ) schedule( dynamic ) if( numThreads > 1 )
+        for( i = 0; i < N; i++ )
+            returnvalues[i] = evaluateBackwardSensitivities( i, &blocks[5*i] );
+    }
+    else{
 
-        for( i = 0; i < N; i++ ){
+    // COMPUTATION OF FORWARD SENSITIVITIES:
+    // -------------------------------------
 
-             DMatrix seed, X, P, U, W;
-             bSeed.getSubBlock( 0, i, seed );
+        #pragma omp parallel for num_threads( numThreads ) schedule( dynamic ) if( numThreads > 1 )
+        for( i = 0; i < N; i++ )
+            returnvalues[i] = evaluateForwardSensitivities( i, &blocks[5*i] );
+    }
 
-             ACADO_TRY( differentiateBackward( i, seed, X, P, U, W ) );
+    returnValue returnvalue = SUCCESSFUL_RETURN;
 
-             if( nx > 0 ) dBackward.setDense( i, 0, X );
-             if( np > 0 ) dBackward.setDense( i, 2, P );
-             if( nu > 0 ) dBackward.setDense( i, 3, U );
-             if( nw > 0 ) dBackward.setDense( i, 4, W );
+    for( i = 0; i < N; i++ ){
+        if( returnvalues[i] != SUCCESSFUL_RETURN ){
+            returnvalue = returnvalues[i];
+            break;
         }
-        return SUCCESSFUL_RETURN;
     }
 
+    if( returnvalue == SUCCESSFUL_RETURN ){
 
-    // COMPUTATION OF FORWARD SENSITIVITIES:
-    // -------------------------------------
+        const int dims[5] = { nx, 0, np, nu, nw };
 
-    dForward.init( N, 5 );
+        BlockMatrix &d = ( isBackward == BT_TRUE ) ? dBackward : dForward;
+        d.init( N, 5 );
 
-    for( i = 0; i < N; i++ ){
+        for( i = 0; i < N; i++ )
+            for( j = 0; j < 5; j++ )
+                if( dims[j] > 0 )
+                    d.setDense( i, j, blocks[5*i+j] );
+    }
 
-        DMatrix X, P, U, W, D, E;
+    delete[] returnvalues;
+    delete[] blocks;
+
+    return returnvalue;
+}
+
+
+returnValue ShootingMethod::evaluateBackwardSensitivities( int idx, DMatrix *D ){
+
+    DMatrix seed;
+    bSeed.getSubBlock( 0, idx, seed );
+
+    return differentiateBackward( idx, seed, D[0], D[2], D[3], D[4] );
+}
 
-        if( xSeed.isEmpty() == BT_FALSE ) xSeed.getSubBlock( i, 0, X );
-        if( pSeed.isEmpty() == BT_FALSE ) pSeed.getSubBlock( i, 0, P );
-        if( uSeed.isEmpty() == BT_FALSE ) uSeed.getSubBlock( i, 0, U );
-        if( wSeed.isEmpty() == BT_FALSE ) wSeed.getSubBlock( i, 0, W );
 
-        if( nx > 0 ){ ACADO_TRY( differentiateForward( i, X, E, E, E, D )); dForward.setDense( i, 0, D ); }
-        if( np > 0 ){ ACADO_TRY( differentiateForward( i, E, P, E, E, D )); dForward.setDense( i, 2, D ); }
-        if( nu > 0 ){ ACADO_TRY( differentiateForward( i, E, E, U, E, D )); dForward.setDense( i, 3, D ); }
-        if( nw > 0 ){ ACADO_TRY( differentiateForward( i, E, E, E, W, D )); dForward.setDense( i, 4, D ); }
+returnValue ShootingMethod::evaluateForwardSensitivities( int idx, DMatrix *D ){
+
+    DMatrix X, P, U, W, E;
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+
+    if( xSeed.isEmpty() == BT_FALSE ) xSeed.getSubBlock( idx, 0, X );
+    if( pSeed.isEmpty() == BT_FALSE ) pSeed.getSubBlock( idx, 0, P );
+    if( uSeed.isEmpty() == BT_FALSE ) uSeed.getSubBlock( idx, 0, U );
+    if( wSeed.isEmpty() == BT_FALSE ) wSeed.getSubBlock( idx, 0, W );
+
+    if( nx > 0 && returnvalue == SUCCESSFUL_RETURN ) returnvalue = differentiateForward( idx, X, E, E, E, D[0] );
+    if( np > 0 && returnvalue == SUCCESSFUL_RETURN ) returnvalue = differentiateForward( idx, E, P, E, E, D[2] );
+    if( nu > 0 && returnvalue == SUCCESSFUL_RETURN ) returnvalue = differentiateForward( idx, E, E, U, E, D[3] );
+    if( nw > 0 && returnvalue == SUCCESSFUL_RETURN ) returnvalue = differentiateForward( idx, E, E, E, W, D[4] );
+
+    return returnvalue;
+}
+
+
+returnValue ShootingMethod::integrateInParallel( const OCPiterate &iter, int numThreads ){
+
+    int run1;
+    double tStart, tEnd;
+
+    int freezeIntegrator;
+    get( FREEZE_INTEGRATOR, freezeIntegrator );
+
+    Grid    *grids = new Grid   [N];
+    DVector *x     = new DVector[N];
+    DVector *xa    = new DVector[N];
+    DVector *u     = new DVector[N];
+    DVector *w     = new DVector[N];
+    DVector  p;
+
+    returnValue *returnvalues = new returnValue[N];
+
+    iter.getInitialData( x[0], xa[0], p, u[0], w[0] );
+
+    // SET UP ALL INTERVALS (SEQUENTIALLY):
+    // ------------------------------------
+    for( run1 = 0; run1 < N; run1++ ){
+
+        integrator[run1]->setOptions( getOptions( 0 ) );
+
+        if ( (BooleanType)freezeIntegrator == BT_TRUE )
+            integrator[run1]->freezeAll();
+
+        tStart = unionGrid.getTime( run1   );
+        tEnd   = unionGrid.getTime( run1+1 );
+
+        Grid evaluationGrid;
+        iter.x->getSubGrid( tStart,tEnd,evaluationGrid );
+
+        Grid outputGrid;
+        if ( acadoIsNegative( integrator[run1]->getDifferentialEquationSampleTime( ) ) == BT_TRUE )
+            outputGrid.init( tStart,tEnd,getNumEvaluationPoints() );
+        else
+            outputGrid.init( tStart,tEnd, 1+acadoRound( (tEnd-tStart)/integrator[run1]->getDifferentialEquationSampleTime() ) );
+
+        grids[run1] = outputGrid & evaluationGrid;
+
+        if( run1 > 0 ){
+            x [run1] = x [0]; xa[run1] = xa[0];
+            u [run1] = u [0]; w [run1] = w [0];
+
+            if( iter.x  != 0 ) x [run1] = iter.x ->getVector( iter.x ->getFloorIndex( tStart ) );
+            if( iter.xa != 0 ) xa[run1] = iter.xa->getVector( iter.xa->getFloorIndex( tStart ) );
+            if( iter.u  != 0 ) u [run1] = iter.u ->getVector( iter.u ->getFloorIndex( tStart ) );
+            if( iter.w  != 0 ) w [run1] = iter.w ->getVector( iter.w ->getFloorIndex( tStart ) );
+        }
     }
+
+    // INTEGRATE ALL INTERVALS (IN PARALLEL):
+    // --------------------------------------
+    #pragma omp parallel for num_threads( numThreads ) schedule( dynamic )
+    for( run1 = 0; run1 < N; run1++ )
+        returnvalues[run1] = integrator[run1]->integrate( grids[run1], x[run1], xa[run1], p, u[run1], w[run1] );
+
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+    for( run1 = 0; run1 < N; run1++ )
+        if( returnvalues[run1] != SUCCESSFUL_RETURN )
+            returnvalue = RET_UNABLE_TO_INTEGRATE_SYSTEM;
+
+    delete[] returnvalues;
+    delete[] grids;
+    delete[] x ;
+    delete[] xa;
+    delete[] u ;
+    delete[] w ;
+
+    if( returnvalue != SUCCESSFUL_RETURN )
+        return ACADOERROR( returnvalue );
+
     return SUCCESSFUL_RETURN;
 }
 
@@ -191,6 +191,34 @@ class ShootingMethod : public DynamicDiscretization
             returnValue update( DMatrix &G, const DMatrix &A, const DMatrix &B );
 
 
+			/**< Integrates all shooting intervals simultaneously on the given number  \n
+			*   of threads. The results are stored in the integrators and collected   \n
+			*   by evaluate() afterwards.                                              \n
+			*                                                                          \n
+			*   \return SUCCESSFUL_RETURN                                              \n
+			*           RET_UNABLE_TO_INTEGRATE_SYSTEM                                 \n
+			*/
+			returnValue integrateInParallel( const OCPiterate &iter, int numThreads );
+
+
+			/**< Evaluates the forward sensitivities of the shooting interval idx      \n
+			*   and stores the derivative blocks of this interval in D[0..4]. Only    \n
+			*   the integrator of the interval is modified, hence the routine may be  \n
+			*   called concurrently for different intervals.                          \n
+			*                                                                          \n
+			*   \return SUCCESSFUL_RETURN or the error of the integrator               \n
+			*/
+			returnValue evaluateForwardSensitivities( int idx, DMatrix *D );
+
+
+			/**< Evaluates the backward sensitivities of the shooting interval idx     \n
+			*   and stores the derivative blocks of this interval in D[0..4].         \n
+			*                                                                          \n
+			*   \return SUCCESSFUL_RETURN or the error of the integrator               \n
+			*/
+			returnValue evaluateBackwardSensitivities( int idx, DMatrix *D );
+
+
 			/**< Writes the continous integrator output to the logging object, if this     \n
 			*   is requested. Please note, that this routine converts the VariablesGrids  \n
 			*   from the integration routine into a large matrix. Consequently, the break \n
@@ -163,6 +163,8 @@ protected:
 
     inline returnValue copy( const int *order, const DVector &rhs );
 
+    inline returnValue copy( const int *order, const VariablesGrid *rhs, const uint &pointIdx );
+
     void copy( const EvaluationPoint &rhs );
     void deleteAll();
 
@@ -50,6 +50,17 @@ inline returnValue EvaluationPoint::copy( const int *order, const DVector &rhs )
 }
 
 
+inline returnValue EvaluationPoint::copy( const int *order, const VariablesGrid *rhs, const uint &pointIdx ){
+
+    if( rhs == 0 ) return SUCCESSFUL_RETURN;
+
+    uint i;
+    for( i = 0; i < rhs->getNumValues(); i++ )
+        z[order[i]] = rhs->operator()( pointIdx,i );
+    return SUCCESSFUL_RETURN;
+}
+
+
 inline DVector EvaluationPoint::backCopy( const int *order, const uint &dim ) const{
 
     DVector tmp(dim);
@@ -59,7 +70,7 @@ inline DVector EvaluationPoint::backCopy( const int *order, const uint &dim ) co
     return tmp;
 }
 
-inline returnValue EvaluationPoint::setT ( const double &t  ){ return copy( idx[0], DVector(1,&t) ); }
+inline returnValue EvaluationPoint::setT ( const double &t  ){ z[idx[0][0]] = t; return SUCCESSFUL_RETURN; }
 inline returnValue EvaluationPoint::setX ( const DVector &x  ){ return copy( idx[1], x            ); }
 inline returnValue EvaluationPoint::setXA( const DVector &xa ){ return copy( idx[2], xa           ); }
 inline returnValue EvaluationPoint::setP ( const DVector &p  ){ return copy( idx[3], p            ); }
@@ -71,12 +82,13 @@ inline returnValue EvaluationPoint::setDX( const DVector &dx ){ return copy( idx
 inline returnValue EvaluationPoint::setZ ( const uint       &idx_,
                                            const OCPiterate &iter  ){
 
+    // the values are copied from the grids directly, without temporaries:
     setT ( iter.getTime (idx_) );
-    setX ( iter.getX    (idx_) );
-    setXA( iter.getXA   (idx_) );
-    setP ( iter.getP    (idx_) );
-    setU ( iter.getU    (idx_) );
-    setW ( iter.getW    (idx_) );
+    copy ( idx[1], iter.x , idx_ );
+    copy ( idx[2], iter.xa, idx_ );
+    copy ( idx[3], iter.p , idx_ );
+    copy ( idx[4], iter.u , idx_ );
+    copy ( idx[5], iter.w , idx_ );
 
     return SUCCESSFUL_RETURN;
 }
@@ -36,6 +36,7 @@
 #include <acado/symbolic_expression/symbolic_expression.hpp>
 #include <acado/function/evaluation_point.hpp>
 #include <acado/function/function_.hpp>
+#include <acado/clock/runtime_profiler.hpp>
 
 
 
@@ -278,8 +279,14 @@ returnValue Function::evaluate( int number, double *x, double *_result ){
 
 //     return evaluationTree.evaluate( number+memoryOffset, x, _result );
 
+    RuntimeProfiler& profiler = RuntimeProfiler::instance();
+    double profilerStart = profiler.tic();
+
     evaluationTree.evaluate( number+memoryOffset, x, _result );
 
+    // one operation per intermediate and per output component
+    if( profiler.isEnabled() == BT_TRUE )
+        profiler.toc( PP_FUNCTION_EVALUATION, profilerStart, evaluationTree.getN() + getDim() );
 
 
     return SUCCESSFUL_RETURN;
@@ -316,6 +323,19 @@ BooleanType Function::isDependingOn( const Expression     &variable ){
     return evaluationTree.isDependingOn( variable );
 }
 
+returnValue Function::getDependencyPattern( int           nVars    ,
+                                           VariableType *varType  ,
+                                           int          *component,
+                                           BooleanType  *pattern    ){
+
+    if( isSymbolic() == BT_FALSE ){
+        for( int run1 = 0; run1 < getDim(); run1++ )
+            pattern[run1] = BT_TRUE;
+        return SUCCESSFUL_RETURN;
+    }
+    return evaluationTree.getDependencyPattern( nVars, varType, component, pattern );
+}
+
 BooleanType Function::isLinearIn( const Expression     &variable ){
 
     return evaluationTree.isLinearIn( variable );
@@ -402,26 +422,21 @@ BooleanType Function::isConcave(){
 
 returnValue Function::jacobian(DMatrix &x) {
     int n=getDim();
-    int N=getNumberOfVariables();
+    int N=getNumberOfVariables()+1;
     returnValue ret;
 
     x=DMatrix(getNX(),n);x.setAll(0);
     //u=DMatrix(getNU(),n);u.setAll(0);
     //p=DMatrix(getNP(),n);p.setAll(0);
     //w=DMatrix(getNW(),n);w.setAll(0);
-    double *Jr=new double[N];
-    double *seed=new double[n];
-    for (int i=0;i<n;i++) seed[i]=0;
-    for (int i=0;i<n;i++) {
-	if (i>0) seed[i-1]=0;
-	seed[i]=1;
-	for (int j=0;j<N;j++) Jr[j]=0;
-    	ret=AD_backward(0,seed,Jr);
-	if (ret != SUCCESSFUL_RETURN) return ret;
-	for (int j=0;j<getNX();j++) x(j,i)=Jr[index(VT_DIFFERENTIAL_STATE,j)];
-    }
-    delete[] Jr;
-    delete[] seed;
+
+    // all n backward directions are propagated in one sweep:
+    DMatrix seed = eye<double>(n);
+    DMatrix Jr(N,n); Jr.setAll(0);
+
+    ret=AD_backward(0,n,seed.data(),Jr.data());
+    if (ret != SUCCESSFUL_RETURN) return ret;
+    for (int j=0;j<getNX();j++) x.row(j)=Jr.row(index(VT_DIFFERENTIAL_STATE,j));
     return SUCCESSFUL_RETURN;
 }
 
@@ -438,6 +453,18 @@ returnValue Function::AD_backward( int number, double *seed, double  *df ){
 }
 
 
+returnValue Function::AD_forward( int number, int nDir, double *seed, double *df ){
+
+    return evaluationTree.AD_forward( number+memoryOffset, nDir, seed, df );
+}
+
+
+returnValue Function::AD_backward( int number, int nDir, double *seed, double *df ){
+
+    return evaluationTree.AD_backward( number+memoryOffset, nDir, seed, df );
+}
+
+
 returnValue Function::AD_forward2( int number, double *seed, double *dseed,
                                    double *df, double *ddf ){
 
@@ -473,11 +500,12 @@ returnValue Function::print(	std::ostream& stream,
 
 returnValue Function::exportForwardDeclarations(	std::ostream& stream,
 													const char *fcnName  ,
-													const char *realString
+													const char *realString,
+													const char *contextParameter
 													) const
 {
 	if (getDim() > 0)
-		return evaluationTree.exportForwardDeclarations(stream, fcnName, realString);
+		return evaluationTree.exportForwardDeclarations(stream, fcnName, realString, contextParameter);
 
 	return SUCCESSFUL_RETURN;
 }
@@ -493,12 +521,13 @@ returnValue Function::exportCode(	std::ostream& stream,
 									uint		_numDX,
 									uint		_numOD,
 									bool       allocateMemory,
-									bool       staticMemory
+									bool       staticMemory,
+									const char *contextParameter
 									) const
 {
 	if (getDim() > 0)
 		return evaluationTree.exportCode(stream, fcnName, realString,
-				_numX, _numXA, _numU, _numP, _numDX, _numOD, allocateMemory, staticMemory);
+				_numX, _numXA, _numU, _numP, _numDX, _numOD, allocateMemory, staticMemory, contextParameter);
 
 	return SUCCESSFUL_RETURN;
 }
@@ -530,6 +559,14 @@ DVector Function::evaluate( const EvaluationPoint &x,
 }
 
 
+returnValue Function::evaluate( const EvaluationPoint &x,
+                                const int             &number,
+                                double                *res    ){
+
+    return evaluate( number, x.getEvaluationPointer(), res );
+}
+
+
 DVector Function::AD_forward( const EvaluationPoint &x,
                              const int        &number  ){
 
@@ -602,6 +639,11 @@ unsigned Function::getGlobalExportVariableSize( ) const
 	return evaluationTree.getGlobalExportVariableSize( );
 }
 
+returnValue Function::setJITCompilation( BooleanType useJIT, const std::string& cacheDirectory )
+{
+	return evaluationTree.setJITCompilation( useJIT, cacheDirectory );
+}
+
 
 CLOSE_NAMESPACE_ACADO
 
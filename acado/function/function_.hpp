@@ -203,6 +203,20 @@ public:
                      const int             &number = 0  );
 
 
+    /** Evaluates the function without allocating memory for  \n
+     *  the result.                                            \n
+     *                                                         \n
+     *  \param x       the evaluation point                    \n
+     *  \param number  the storage position                    \n
+     *  \param res     the result (of dimension getDim())      \n
+     *                                                         \n
+     *  \return SUCCESSFUL_RETURN                              \n
+     */
+    returnValue evaluate( const EvaluationPoint &x     ,
+                          const int             &number,
+                          double                *res    );
+
+
     /** Redundant evaluation routine which is equivalent to \n
      *  to the evaluate routine above.                      \n
      *                                                      \n
@@ -269,6 +283,20 @@ public:
 
 
 
+    /** Determines for each component of the function whether it \n
+     *  structurally depends on (any of) the given variables.     \n
+     *  Non-symbolic functions are assumed to depend on all       \n
+     *  variables.                                                \n
+     *  \return SUCCESSFUL_RETURN                                 \n
+     *
+     */
+     returnValue getDependencyPattern( int           nVars    , /**< number of variables   */
+                                       VariableType *varType  , /**< the variable types    */
+                                       int          *component, /**< and their components  */
+                                       BooleanType  *pattern    /**< the result (getDim()) */ );
+
+
+
     /** Checks whether the function is linear in                  \n
      *  (or not depending on)  var(index)                         \n
      *  \return BT_FALSE if no linearity is                       \n
@@ -395,6 +423,38 @@ public:
 
 
 
+    /** Automatic Differentiation in forward mode for a block of  \n
+     *  nDir directions (vector mode). Seeds and derivatives are  \n
+     *  stored contiguously per variable, i.e. seed is a          \n
+     *  row-major (getNumberOfVariables()+1) x nDir matrix and    \n
+     *  df a row-major getDim() x nDir matrix.                    \n
+     *  This function uses the intermediate                       \n
+     *  results from a buffer.                                    \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NAN                                           \n
+     */
+     returnValue AD_forward(  int     number  /**< storage position     */,
+                              int     nDir    /**< number of directions */,
+                              double *seed    /**< the seed block       */,
+                              double *df      /**< the derivative block */  );
+
+
+
+    /** Automatic Differentiation in backward mode for a block of \n
+     *  nDir directions (vector mode) based on buffered values.   \n
+     *  The seed is a row-major getDim() x nDir matrix, the       \n
+     *  derivatives are added to the row-major                    \n
+     *  (getNumberOfVariables()+1) x nDir matrix df.              \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NAN                                           \n
+     */
+     returnValue AD_backward( int     number  /**< the buffer position  */,
+                              int     nDir    /**< number of directions */,
+                              double *seed    /**< the seed block       */,
+                              double *df      /**< the derivative block */  );
+
+
+
     /** Automatic Differentiation in forward mode for             \n
      *  2nd derivatives.                                          \n
      *  This function uses intermediate                           \n
@@ -460,7 +520,8 @@ public:
 
      returnValue exportForwardDeclarations(	std::ostream& stream,
 											const char *fcnName = "ACADOfcn",
-											const char *realString = "double"
+											const char *realString = "double",
+											const char *contextParameter = ""
 											) const;
 
      returnValue exportCode(	std::ostream& stream,
@@ -473,7 +534,8 @@ public:
 								uint		_numDX = 0,
 								uint		_numOD = 0,
 								bool       allocateMemory = true,
-								bool       staticMemory   = false
+								bool       staticMemory   = false,
+								const char *contextParameter = ""
 								) const;
 
      /** Clears the buffer and resets the buffer size \n
@@ -511,6 +573,19 @@ public:
      /** Get size of the variable that holds intermediate values. */
      unsigned getGlobalExportVariableSize( ) const;
 
+     /** Enables or disables the run-time compilation of the function:  \n
+      *  its C code is compiled by the system compiler into a cached     \n
+      *  shared object, which is then used for the numeric evaluation    \n
+      *  and first order derivatives (see FunctionEvaluationJIT).        \n
+      *                                                                  \n
+      *  \param useJIT          whether the function shall be compiled   \n
+      *  \param cacheDirectory  directory of the compiled objects        \n
+      *                                                                  \n
+      *  \return SUCCESSFUL_RETURN                                       \n
+      */
+     returnValue setJITCompilation( BooleanType useJIT,
+                                    const std::string& cacheDirectory = std::string() );
+
 // PROTECTED MEMBERS:
 // ------------------
 
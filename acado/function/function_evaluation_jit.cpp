@@ -0,0 +1,318 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+
+/**
+ *    \file   src/function/function_evaluation_jit.cpp
+ *    \date   2014
+ */
+
+
+#include <acado/function/function_evaluation_jit.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#ifdef ACADO_WITH_JIT
+#include <cerrno>
+#include <dlfcn.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+#ifdef ACADO_WITH_JIT
+
+/** Returns whether path is a directory (or a regular file, respectively)
+ *  that is not a symbolic link, is owned by the current user and is
+ *  writable neither by the group nor by others. Only such objects are
+ *  used for loading code into the process. */
+static BooleanType isTrustedPath( const std::string& path, BooleanType isDirectory ){
+
+    struct stat info;
+
+    if( lstat( path.c_str(), &info ) != 0 )
+        return BT_FALSE;
+
+    if( isDirectory == BT_TRUE && S_ISDIR( info.st_mode ) == 0 )
+        return BT_FALSE;
+
+    if( isDirectory == BT_FALSE && S_ISREG( info.st_mode ) == 0 )
+        return BT_FALSE;
+
+    if( info.st_uid != getuid() )
+        return BT_FALSE;
+
+    if( ( info.st_mode & ( S_IWGRP | S_IWOTH ) ) != 0 )
+        return BT_FALSE;
+
+    return BT_TRUE;
+}
+
+
+/** Creates the directory with mode 0700 unless it exists already. */
+static returnValue createPrivateDirectory( const std::string& path ){
+
+    if( mkdir( path.c_str(), 0700 ) != 0 && errno != EEXIST ){
+        LOG( LVL_WARNING ) << "Unable to create the JIT cache directory " << path << std::endl;
+        return RET_JIT_COMPILATION_FAILED;
+    }
+
+    if( isTrustedPath( path, BT_TRUE ) == BT_FALSE ){
+        LOG( LVL_WARNING ) << "The JIT cache directory " << path << " is not private to the current user" << std::endl;
+        return RET_JIT_COMPILATION_FAILED;
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+#endif
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+FunctionEvaluationJIT::FunctionEvaluationJIT( ){
+
+    evaluate      = 0;
+    forward       = 0;
+    backward      = 0;
+    forwardBlock  = 0;
+    backwardBlock = 0;
+    handle        = 0;
+}
+
+
+FunctionEvaluationJIT::FunctionEvaluationJIT( const FunctionEvaluationJIT& arg ){
+
+    evaluate      = 0;
+    forward       = 0;
+    backward      = 0;
+    forwardBlock  = 0;
+    backwardBlock = 0;
+    handle        = 0;
+
+    if( arg.isLoaded() == BT_TRUE )
+        open( arg.path );
+}
+
+
+FunctionEvaluationJIT::~FunctionEvaluationJIT( ){
+
+    unload();
+}
+
+
+FunctionEvaluationJIT& FunctionEvaluationJIT::operator=( const FunctionEvaluationJIT& arg ){
+
+    if( this != &arg ){
+
+        unload();
+
+        if( arg.isLoaded() == BT_TRUE )
+            open( arg.path );
+    }
+    return *this;
+}
+
+
+returnValue FunctionEvaluationJIT::load( const std::string& code, const std::string& cacheDirectory ){
+
+#ifdef ACADO_WITH_JIT
+
+    unload();
+
+    // DETERMINE THE COMPILER AND THE CACHE DIRECTORY:
+    // -----------------------------------------------
+    std::string compiler = "cc -O2 -fPIC -shared";
+    if( getenv( "ACADO_JIT_COMPILER" ) != 0 )
+        compiler = getenv( "ACADO_JIT_COMPILER" );
+
+    std::string directory = cacheDirectory;
+    if( directory.empty() == true && getenv( "ACADO_JIT_CACHE_DIR" ) != 0 )
+        directory = getenv( "ACADO_JIT_CACHE_DIR" );
+    if( directory.empty() == true ){
+
+        // per-user cache, following the XDG base directory specification
+        if( getenv( "XDG_CACHE_HOME" ) != 0 && getenv( "XDG_CACHE_HOME" )[0] == '/' ){
+            directory = getenv( "XDG_CACHE_HOME" );
+        }
+        else{
+            if( getenv( "HOME" ) == 0 ){
+                LOG( LVL_WARNING ) << "Neither XDG_CACHE_HOME nor HOME is set, no JIT cache directory" << std::endl;
+                return RET_JIT_COMPILATION_FAILED;
+            }
+
+            directory = std::string( getenv( "HOME" ) ) + "/.cache";
+
+            if( mkdir( directory.c_str(), 0700 ) != 0 && errno != EEXIST ){
+                LOG( LVL_WARNING ) << "Unable to create the directory " << directory << std::endl;
+                return RET_JIT_COMPILATION_FAILED;
+            }
+        }
+        directory += "/acado_jit";
+    }
+
+    returnValue returnvalue = createPrivateDirectory( directory );
+    if( returnvalue != SUCCESSFUL_RETURN )
+        return returnvalue;
+
+    // THE FILE NAME IS A HASH (FNV-1A) OF THE CODE AND THE COMPILER:
+    // --------------------------------------------------------------
+    unsigned long long hash = 14695981039346656037ULL;
+    std::string key = compiler + "\n" + code;
+
+    for( unsigned int run1 = 0; run1 < key.size(); run1++ ){
+        hash ^= (unsigned char)key[run1];
+        hash *= 1099511628211ULL;
+    }
+
+    char name[32];
+    snprintf( name, sizeof(name), "acado_jit_%016llx", hash );
+
+    std::string base = directory + "/" + name;
+
+    // COMPILE, UNLESS THE OBJECT IS ALREADY CACHED:
+    // ---------------------------------------------
+    struct stat info;
+
+    if( lstat( (base + ".so").c_str(), &info ) != 0 ){
+
+        // unique names of the temporary files, such that concurrent
+        // processes and threads do not interfere:
+        std::stringstream tmp;
+        tmp << base << "." << getpid() << "." << (void*)this;
+
+        std::ofstream source( (tmp.str() + ".c").c_str() );
+        if( !source )
+            return RET_FILE_CAN_NOT_BE_OPENED;
+
+        source << code;
+        source.close();
+
+        std::string command = compiler + " -o \"" + tmp.str() + ".so\" \"" + tmp.str() + ".c\" -lm";
+
+        int status = system( command.c_str() );
+        remove( (tmp.str() + ".c").c_str() );
+
+        if( status == -1 || WIFEXITED( status ) == 0 || WEXITSTATUS( status ) != 0 ){
+            remove( (tmp.str() + ".so").c_str() );
+            LOG( LVL_WARNING ) << "The JIT compiler failed: " << command << std::endl;
+            return RET_JIT_COMPILATION_FAILED;
+        }
+
+        // publish the object atomically and only with owner permissions
+        if( chmod( (tmp.str() + ".so").c_str(), 0700 ) != 0 ||
+            rename( (tmp.str() + ".so").c_str(), (base + ".so").c_str() ) != 0 ){
+            remove( (tmp.str() + ".so").c_str() );
+            LOG( LVL_WARNING ) << "Unable to store " << base << ".so" << std::endl;
+            return RET_JIT_COMPILATION_FAILED;
+        }
+    }
+
+    if( isTrustedPath( base + ".so", BT_FALSE ) == BT_FALSE ){
+        LOG( LVL_WARNING ) << "The cached object " << base << ".so is not private to the current user" << std::endl;
+        return RET_JIT_COMPILATION_FAILED;
+    }
+
+    return open( base + ".so" );
+
+#else
+
+    return RET_NOT_IMPLEMENTED_YET;
+
+#endif
+}
+
+
+returnValue FunctionEvaluationJIT::unload( ){
+
+#ifdef ACADO_WITH_JIT
+    if( handle != 0 )
+        dlclose( handle );
+#endif
+
+    evaluate      = 0;
+    forward       = 0;
+    backward      = 0;
+    forwardBlock  = 0;
+    backwardBlock = 0;
+    handle        = 0;
+
+    path.clear();
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue FunctionEvaluationJIT::open( const std::string& path_ ){
+
+#ifdef ACADO_WITH_JIT
+
+    handle = dlopen( path_.c_str(), RTLD_NOW | RTLD_LOCAL );
+
+    if( handle == 0 )
+        return RET_JIT_COMPILATION_FAILED;
+
+    evaluate      = (EvaluateFcn     )dlsym( handle, "acado_jit_evaluate"       );
+    forward       = (ForwardFcn      )dlsym( handle, "acado_jit_forward"        );
+    backward      = (BackwardFcn     )dlsym( handle, "acado_jit_backward"       );
+    forwardBlock  = (ForwardBlockFcn )dlsym( handle, "acado_jit_forward_block"  );
+    backwardBlock = (BackwardBlockFcn)dlsym( handle, "acado_jit_backward_block" );
+
+    if( evaluate == 0 || forward == 0 || backward == 0 || forwardBlock == 0 || backwardBlock == 0 ){
+        unload();
+        return RET_JIT_COMPILATION_FAILED;
+    }
+
+    path = path_;
+
+    return SUCCESSFUL_RETURN;
+
+#else
+
+    return RET_NOT_IMPLEMENTED_YET;
+
+#endif
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -0,0 +1,150 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+
+/**
+ *    \file include/acado/function/function_evaluation_jit.hpp
+ *    \date 2014
+ */
+
+#ifndef ACADO_TOOLKIT_FUNCTION_EVALUATION_JIT_HPP
+#define ACADO_TOOLKIT_FUNCTION_EVALUATION_JIT_HPP
+
+#include <acado/utils/acado_utils.hpp>
+#include <string>
+
+BEGIN_NAMESPACE_ACADO
+
+/**
+ *	\brief Compiles the C code of a function at run-time and loads it.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class FunctionEvaluationJIT compiles the C code exported by a
+ *  FunctionEvaluationTape with the system compiler into a shared object
+ *  and loads it. The shared objects are cached on disk, using a hash of
+ *  the code and of the compiler command as file name, such that every
+ *  function is compiled only once.
+ *
+ *  The compiler command can be changed with the environment variable
+ *  ACADO_JIT_COMPILER (default: "cc -O2 -fPIC -shared"). Run-time
+ *  compilation is only available on POSIX systems.
+ *
+ *  The cache is private to the user: the directory is created with mode
+ *  0700, and a cached object is only loaded if it and its directory are
+ *  owned by the current user and are not writable by group or others.
+ */
+class FunctionEvaluationJIT
+{
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+public:
+
+    /** Default constructor. */
+    FunctionEvaluationJIT( );
+
+    /** Copy constructor (loads the same shared object). */
+    FunctionEvaluationJIT( const FunctionEvaluationJIT& arg );
+
+    /** Destructor. */
+    virtual ~FunctionEvaluationJIT( );
+
+    /** Assignment operator (loads the same shared object). */
+    FunctionEvaluationJIT& operator=( const FunctionEvaluationJIT& arg );
+
+
+    /** Compiles the given code (unless it is found in the cache         \n
+     *  directory) and loads it.                                         \n
+     *                                                                   \n
+     *  \param code            the C code of the functions               \n
+     *  \param cacheDirectory  directory of the compiled objects; if     \n
+     *                         empty, ACADO_JIT_CACHE_DIR or             \n
+     *                         $XDG_CACHE_HOME/acado_jit (default:       \n
+     *                         ~/.cache/acado_jit) is used               \n
+     *                                                                   \n
+     *  \return SUCCESSFUL_RETURN                                        \n
+     *          RET_JIT_COMPILATION_FAILED                               \n
+     *          RET_NOT_IMPLEMENTED_YET (no run-time compilation)        \n
+     */
+    returnValue load( const std::string& code, const std::string& cacheDirectory );
+
+    /** Unloads the shared object. */
+    returnValue unload( );
+
+    /** Returns whether a shared object is loaded. */
+    inline BooleanType isLoaded( ) const;
+
+    /** Returns the path of the loaded shared object. */
+    inline const std::string& getPath( ) const;
+
+
+    /** The signatures of the compiled functions. */
+    typedef void (*EvaluateFcn      )( double *x, double *v, double *f );
+    typedef void (*ForwardFcn       )( const double *v, double *seed, double *df, double *d );
+    typedef void (*BackwardFcn      )( const double *v, const double *seed, double *df, double *d );
+    typedef void (*ForwardBlockFcn  )( const double *v, int nDir, double *seed, double *df, double *d );
+    typedef void (*BackwardBlockFcn )( const double *v, int nDir, const double *seed, double *df, double *d );
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+protected:
+
+    /** Opens the shared object at the given path and looks up the functions. */
+    returnValue open( const std::string& path_ );
+
+
+//
+// DATA MEMBERS:
+//
+public:
+
+    EvaluateFcn         evaluate      ;   /**< Evaluation of the tape                 */
+    ForwardFcn          forward       ;   /**< Forward AD (one direction)             */
+    BackwardFcn         backward      ;   /**< Backward AD (one direction)            */
+    ForwardBlockFcn     forwardBlock  ;   /**< Forward AD (block of directions)       */
+    BackwardBlockFcn    backwardBlock ;   /**< Backward AD (block of directions)      */
+
+protected:
+
+    void               *handle        ;   /**< Handle of the shared object            */
+    std::string         path          ;   /**< Path of the shared object              */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#include <acado/function/function_evaluation_jit.ipp>
+
+
+#endif  // ACADO_TOOLKIT_FUNCTION_EVALUATION_JIT_HPP
+
+// end of file.
@@ -0,0 +1,829 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+
+/**
+ *    \file   src/function/function_evaluation_tape.cpp
+ *    \date   2014
+ */
+
+
+#include <acado/function/function_evaluation_tape.hpp>
+#include <acado/symbolic_operator/symbolic_operator.hpp>
+
+#include <map>
+#include <sstream>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+// status flags of the buffer positions
+static const int TAPE_EVALUATED    = 1;
+static const int TAPE_SEEDED       = 2;
+static const int TAPE_SYNCHRONIZED = 4;
+
+
+
+/**
+ *	\brief Records operator trees on a FunctionEvaluationTape.
+ *
+ *	The recorder walks the trees using the generic operator evaluation
+ *	interface. Every node is appended as an instruction unless an identical
+ *	instruction already exists, in which case its register is reused.
+ */
+class FunctionEvaluationTapeRecorder : public EvaluationBase{
+
+public:
+
+	typedef FunctionEvaluationTape::TapeInstruction TapeInstruction;
+
+	FunctionEvaluationTapeRecorder( std::vector< TapeInstruction > &code_, std::vector< int > &projections_ )
+		: code( code_ ), projections( projections_ ), result( -1 ), failed( BT_FALSE ){ }
+
+	virtual ~FunctionEvaluationTapeRecorder(){ }
+
+	/** Records the tree and returns its register (-1 if unsupported). */
+	int record( Operator &arg ){
+
+		result = -1;
+		arg.evaluate( this );
+
+		if( result < 0 )
+			failed = BT_TRUE;
+
+		return result;
+	}
+
+	/** Records an intermediate state, which is accessed via its variable index. */
+	int recordIntermediate( Operator &arg, int index ){
+
+		int r = record( arg );
+		if( r < 0 ) return -1;
+
+		r = append( FunctionEvaluationTape::TO_COPY, r, index, 0.0 );
+		intermediates[ index ] = r;
+		return r;
+	}
+
+	BooleanType hasFailed() const{ return failed; }
+
+	virtual void addition   ( Operator &arg1, Operator &arg2 ){ binary( FunctionEvaluationTape::TO_ADD     , arg1, arg2 ); }
+	virtual void subtraction( Operator &arg1, Operator &arg2 ){ binary( FunctionEvaluationTape::TO_SUBTRACT, arg1, arg2 ); }
+	virtual void product    ( Operator &arg1, Operator &arg2 ){ binary( FunctionEvaluationTape::TO_MULTIPLY, arg1, arg2 ); }
+	virtual void quotient   ( Operator &arg1, Operator &arg2 ){ binary( FunctionEvaluationTape::TO_DIVIDE  , arg1, arg2 ); }
+	virtual void power      ( Operator &arg1, Operator &arg2 ){ binary( FunctionEvaluationTape::TO_POWER   , arg1, arg2 ); }
+
+	virtual void powerInt( Operator &arg1, int &arg2 ){
+
+		int a = record( arg1 );
+		result = ( a < 0 ) ? -1 : append( FunctionEvaluationTape::TO_POWER_INT, a, -1, (double)arg2 );
+	}
+
+	virtual void project( int &idx ){
+
+		std::map< int,int >::const_iterator it = intermediates.find( idx );
+
+		if( it != intermediates.end() )
+			result = it->second;
+		else
+			result = append( FunctionEvaluationTape::TO_PROJECT, idx, -1, 0.0 );
+	}
+
+	virtual void set( double &arg ){ result = append( FunctionEvaluationTape::TO_CONSTANT, -1, -1, arg ); }
+
+	virtual void Acos( Operator &arg ){ unary( FunctionEvaluationTape::TO_ACOS, arg ); }
+	virtual void Asin( Operator &arg ){ unary( FunctionEvaluationTape::TO_ASIN, arg ); }
+	virtual void Atan( Operator &arg ){ unary( FunctionEvaluationTape::TO_ATAN, arg ); }
+	virtual void Cos ( Operator &arg ){ unary( FunctionEvaluationTape::TO_COS , arg ); }
+	virtual void Exp ( Operator &arg ){ unary( FunctionEvaluationTape::TO_EXP , arg ); }
+	virtual void Log ( Operator &arg ){ unary( FunctionEvaluationTape::TO_LOG , arg ); }
+	virtual void Sin ( Operator &arg ){ unary( FunctionEvaluationTape::TO_SIN , arg ); }
+	virtual void Tan ( Operator &arg ){ unary( FunctionEvaluationTape::TO_TAN , arg ); }
+
+protected:
+
+	struct Key{
+
+		int op, a, b; double c;
+
+		bool operator<( const Key &arg ) const{
+
+			if( op != arg.op ) return op < arg.op;
+			if( a  != arg.a  ) return a  < arg.a ;
+			if( b  != arg.b  ) return b  < arg.b ;
+			return c < arg.c;
+		}
+	};
+
+	void unary( int op, Operator &arg ){
+
+		int a = record( arg );
+		result = ( a < 0 ) ? -1 : append( op, a, -1, 0.0 );
+	}
+
+	void binary( int op, Operator &arg1, Operator &arg2 ){
+
+		int a = record( arg1 );
+		int b = record( arg2 );
+		result = ( a < 0 || b < 0 ) ? -1 : append( op, a, b, 0.0 );
+	}
+
+	/** Appends an instruction, or returns the register of an identical one. */
+	int append( int op, int a, int b, double c ){
+
+		Key key = { op, a, b, c };
+
+		std::map< Key,int >::const_iterator it = table.find( key );
+		if( it != table.end() )
+			return it->second;
+
+		TapeInstruction instruction = { op, a, b, c };
+		code.push_back( instruction );
+
+		int r = (int)code.size() - 1;
+		table[ key ] = r;
+
+		if( op == FunctionEvaluationTape::TO_PROJECT )
+			projections.push_back( r );
+
+		return r;
+	}
+
+	std::vector< TapeInstruction > &code;
+	std::vector< int >             &projections;
+
+	std::map< Key,int > table        ;
+	std::map< int,int > intermediates;
+
+	int         result;
+	BooleanType failed;
+};
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+FunctionEvaluationTape::FunctionEvaluationTape( ){
+
+    bufferSize = 0;
+    useJIT     = BT_FALSE;
+}
+
+
+FunctionEvaluationTape::~FunctionEvaluationTape( ){ }
+
+
+returnValue FunctionEvaluationTape::init( int dim, Operator **f, int n, Operator **sub, const int *subIndex ){
+
+    int run1;
+
+    code.clear();
+    output.clear();
+    projections.clear();
+    clearBuffer();
+    jit.unload();
+
+    FunctionEvaluationTapeRecorder recorder( code, projections );
+
+    for( run1 = 0; run1 < n && recorder.hasFailed() == BT_FALSE; run1++ )
+        recorder.recordIntermediate( *sub[run1], subIndex[run1] );
+
+    for( run1 = 0; run1 < dim && recorder.hasFailed() == BT_FALSE; run1++ )
+        output.push_back( recorder.record( *f[run1] ) );
+
+    if( recorder.hasFailed() == BT_TRUE ){
+        code.clear();
+        output.clear();
+        projections.clear();
+        return RET_NOT_IMPLEMENTED_YET;
+    }
+
+    // the interpreter is used if the compilation fails:
+    if( useJIT == BT_TRUE ){
+
+        std::stringstream source;
+        exportCode( source );
+
+        if( jit.load( source.str(), jitDirectory ) != SUCCESSFUL_RETURN )
+            ACADOWARNING( RET_JIT_COMPILATION_FAILED );
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTape::setJITCompilation( BooleanType useJIT_, const std::string& cacheDirectory ){
+
+    useJIT       = useJIT_;
+    jitDirectory = cacheDirectory;
+
+    if( useJIT == BT_FALSE )
+        jit.unload();
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTape::evaluate( int number, double *x, double *result ){
+
+    int run1;
+    const int nI = (int)code.size();
+
+    allocateBuffer( number );
+
+    double                *v = &values[number*nI];
+    const TapeInstruction *I = &code[0];
+
+    bufferStatus[number] = TAPE_EVALUATED;
+
+    if( jit.isLoaded() == BT_TRUE ){
+        jit.evaluate( x, v, result );
+        return SUCCESSFUL_RETURN;
+    }
+
+    for( run1 = 0; run1 < nI; run1++ ){
+
+        switch( I[run1].op ){
+
+            case TO_PROJECT  : v[run1] = x[I[run1].a];                  break;
+            case TO_CONSTANT : v[run1] = I[run1].c;                     break;
+            case TO_COPY     : v[run1] = v[I[run1].a];
+                               x[I[run1].b] = v[run1];                  break;
+            case TO_ADD      : v[run1] = v[I[run1].a] + v[I[run1].b];   break;
+            case TO_SUBTRACT : v[run1] = v[I[run1].a] - v[I[run1].b];   break;
+            case TO_MULTIPLY : v[run1] = v[I[run1].a] * v[I[run1].b];   break;
+            case TO_DIVIDE   : v[run1] = v[I[run1].a] / v[I[run1].b];   break;
+            case TO_POWER    : v[run1] = pow( v[I[run1].a],v[I[run1].b] );       break;
+            case TO_POWER_INT: v[run1] = pow( v[I[run1].a],(int)I[run1].c );     break;
+            case TO_ACOS     : v[run1] = acos( v[I[run1].a] );          break;
+            case TO_ASIN     : v[run1] = asin( v[I[run1].a] );          break;
+            case TO_ATAN     : v[run1] = atan( v[I[run1].a] );          break;
+            case TO_COS      : v[run1] = cos ( v[I[run1].a] );          break;
+            case TO_EXP      : v[run1] = exp ( v[I[run1].a] );          break;
+            case TO_LOG      : v[run1] = log ( v[I[run1].a] );          break;
+            case TO_SIN      : v[run1] = sin ( v[I[run1].a] );          break;
+            case TO_TAN      : v[run1] = tan ( v[I[run1].a] );          break;
+        }
+    }
+
+    for( run1 = 0; run1 < (int)output.size(); run1++ )
+        result[run1] = v[output[run1]];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTape::AD_forward( int number, double *seed, double *df ){
+
+    int run1;
+    double p1, p2;
+    const int nI = (int)code.size();
+    const int nP = (int)projections.size();
+
+    allocateBuffer( number );
+
+    const double          *v = &values[number*nI];
+    double                *d = &derivatives[0];
+    const TapeInstruction *I = &code[0];
+
+    if( jit.isLoaded() == BT_TRUE ){
+        jit.forward( v, seed, df, d );
+    }
+    else{
+
+        for( run1 = 0; run1 < nI; run1++ ){
+
+            switch( I[run1].op ){
+
+                case TO_PROJECT  : d[run1] = seed[I[run1].a];               break;
+                case TO_CONSTANT : d[run1] = 0.0;                           break;
+                case TO_COPY     : d[run1] = d[I[run1].a];
+                                   seed[I[run1].b] = d[run1];               break;
+                case TO_ADD      : d[run1] = d[I[run1].a] + d[I[run1].b];   break;
+                case TO_SUBTRACT : d[run1] = d[I[run1].a] - d[I[run1].b];   break;
+
+                default:
+                    getPartials( run1, v, p1, p2 );
+                    if( I[run1].b < 0 ) d[run1] = p1*d[I[run1].a];
+                    else                d[run1] = p1*d[I[run1].a] + p2*d[I[run1].b];
+                    break;
+            }
+        }
+
+        for( run1 = 0; run1 < (int)output.size(); run1++ )
+            df[run1] = d[output[run1]];
+    }
+
+    // remember the seed for restoring the buffers of the tree:
+    for( run1 = 0; run1 < nP; run1++ )
+        seeds[number*nP+run1] = d[projections[run1]];
+
+    bufferStatus[number] = TAPE_EVALUATED | TAPE_SEEDED;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTape::AD_backward( int number, double *seed, double *df ){
+
+    int run1;
+    double p1, p2, r;
+    const int nI = (int)code.size();
+
+    allocateBuffer( number );
+
+    const double          *v = &values[number*nI];
+    double                *d = &derivatives[0];
+    const TapeInstruction *I = &code[0];
+
+    if( jit.isLoaded() == BT_TRUE ){
+        jit.backward( v, seed, df, d );
+        return SUCCESSFUL_RETURN;
+    }
+
+    for( run1 = 0; run1 < nI; run1++ )
+        d[run1] = 0.0;
+
+    for( run1 = 0; run1 < (int)output.size(); run1++ )
+        d[output[run1]] += seed[run1];
+
+    for( run1 = nI-1; run1 >= 0; run1-- ){
+
+        r = d[run1];
+
+        switch( I[run1].op ){
+
+            case TO_PROJECT  : df[I[run1].a] += r;                      break;
+            case TO_CONSTANT :                                          break;
+            case TO_COPY     : r += df[I[run1].b];
+                               df[I[run1].b] = r;
+                               d[I[run1].a] += r;                       break;
+            case TO_ADD      : d[I[run1].a] += r;
+                               d[I[run1].b] += r;                       break;
+            case TO_SUBTRACT : d[I[run1].a] += r;
+                               d[I[run1].b] -= r;                       break;
+
+            default:
+                getPartials( run1, v, p1, p2 );
+                d[I[run1].a] += p1*r;
+                if( I[run1].b >= 0 ) d[I[run1].b] += p2*r;
+                break;
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTape::AD_forward( int number, int nDir, double *seed, double *df ){
+
+    int run1, run2;
+    double p1, p2;
+    const int nI = (int)code.size();
+
+    allocateBuffer( number );
+
+    if( (int)derivatives.size() < nI*nDir )
+        derivatives.resize( nI*nDir );
+
+    const double          *v = &values[number*nI];
+    const TapeInstruction *I = &code[0];
+
+    if( jit.isLoaded() == BT_TRUE ){
+        jit.forwardBlock( v, nDir, seed, df, &derivatives[0] );
+        return SUCCESSFUL_RETURN;
+    }
+
+    for( run1 = 0; run1 < nI; run1++ ){
+
+        double       *d  = &derivatives[run1*nDir];
+        const double *da = ( I[run1].a >= 0 && I[run1].op != TO_PROJECT ) ? &derivatives[I[run1].a*nDir] : 0;
+        const double *db = ( I[run1].b >= 0 && I[run1].op != TO_COPY    ) ? &derivatives[I[run1].b*nDir] : 0;
+
+        switch( I[run1].op ){
+
+            case TO_PROJECT:
+                for( run2 = 0; run2 < nDir; run2++ ) d[run2] = seed[I[run1].a*nDir+run2];
+                break;
+
+            case TO_CONSTANT:
+                for( run2 = 0; run2 < nDir; run2++ ) d[run2] = 0.0;
+                break;
+
+            case TO_COPY:
+                for( run2 = 0; run2 < nDir; run2++ ) d[run2] = da[run2];
+                for( run2 = 0; run2 < nDir; run2++ ) seed[I[run1].b*nDir+run2] = d[run2];
+                break;
+
+            case TO_ADD:
+                for( run2 = 0; run2 < nDir; run2++ ) d[run2] = da[run2] + db[run2];
+                break;
+
+            case TO_SUBTRACT:
+                for( run2 = 0; run2 < nDir; run2++ ) d[run2] = da[run2] - db[run2];
+                break;
+
+            default:
+                getPartials( run1, v, p1, p2 );
+                if( db == 0 ) for( run2 = 0; run2 < nDir; run2++ ) d[run2] = p1*da[run2];
+                else          for( run2 = 0; run2 < nDir; run2++ ) d[run2] = p1*da[run2] + p2*db[run2];
+                break;
+        }
+    }
+
+    for( run1 = 0; run1 < (int)output.size(); run1++ )
+        for( run2 = 0; run2 < nDir; run2++ )
+            df[run1*nDir+run2] = derivatives[output[run1]*nDir+run2];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTape::AD_backward( int number, int nDir, double *seed, double *df ){
+
+    int run1, run2;
+    double p1, p2;
+    const int nI = (int)code.size();
+
+    allocateBuffer( number );
+
+    if( (int)derivatives.size() < nI*nDir )
+        derivatives.resize( nI*nDir );
+
+    const double          *v = &values[number*nI];
+    const TapeInstruction *I = &code[0];
+
+    if( jit.isLoaded() == BT_TRUE ){
+        jit.backwardBlock( v, nDir, seed, df, &derivatives[0] );
+        return SUCCESSFUL_RETURN;
+    }
+
+    for( run1 = 0; run1 < nI*nDir; run1++ )
+        derivatives[run1] = 0.0;
+
+    for( run1 = 0; run1 < (int)output.size(); run1++ )
+        for( run2 = 0; run2 < nDir; run2++ )
+            derivatives[output[run1]*nDir+run2] += seed[run1*nDir+run2];
+
+    for( run1 = nI-1; run1 >= 0; run1-- ){
+
+        double *r  = &derivatives[run1*nDir];
+        double *da = ( I[run1].a >= 0 && I[run1].op != TO_PROJECT ) ? &derivatives[I[run1].a*nDir] : 0;
+        double *db = ( I[run1].b >= 0 && I[run1].op != TO_COPY    ) ? &derivatives[I[run1].b*nDir] : 0;
+
+        switch( I[run1].op ){
+
+            case TO_PROJECT:
+                for( run2 = 0; run2 < nDir; run2++ ) df[I[run1].a*nDir+run2] += r[run2];
+                break;
+
+            case TO_CONSTANT:
+                break;
+
+            case TO_COPY:
+                for( run2 = 0; run2 < nDir; run2++ ){
+                    r[run2] += df[I[run1].b*nDir+run2];
+                    df[I[run1].b*nDir+run2] = r[run2];
+                    da[run2] += r[run2];
+                }
+                break;
+
+            case TO_ADD:
+                for( run2 = 0; run2 < nDir; run2++ ){ da[run2] += r[run2]; db[run2] += r[run2]; }
+                break;
+
+            case TO_SUBTRACT:
+                for( run2 = 0; run2 < nDir; run2++ ){ da[run2] += r[run2]; db[run2] -= r[run2]; }
+                break;
+
+            default:
+                getPartials( run1, v, p1, p2 );
+                for( run2 = 0; run2 < nDir; run2++ ) da[run2] += p1*r[run2];
+                if( db != 0 ) for( run2 = 0; run2 < nDir; run2++ ) db[run2] += p2*r[run2];
+                break;
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+BooleanType FunctionEvaluationTape::isSynchronized( int number ) const{
+
+    // the tape has never been evaluated at this position:
+    if( number >= bufferSize || bufferStatus[number] == 0 )
+        return BT_TRUE;
+
+    if( ( bufferStatus[number] & TAPE_SYNCHRONIZED ) != 0 )
+        return BT_TRUE;
+
+    return BT_FALSE;
+}
+
+
+void FunctionEvaluationTape::setSynchronized( int number ){
+
+    if( number < bufferSize )
+        bufferStatus[number] |= TAPE_SYNCHRONIZED;
+}
+
+
+BooleanType FunctionEvaluationTape::getPoint( int number, double *x, double *seed ) const{
+
+    int run1;
+    const int nI = (int)code.size();
+    const int nP = (int)projections.size();
+
+    if( number >= bufferSize )
+        return BT_FALSE;
+
+    for( run1 = 0; run1 < nP; run1++ )
+        x[code[projections[run1]].a] = values[number*nI+projections[run1]];
+
+    if( ( bufferStatus[number] & TAPE_SEEDED ) == 0 )
+        return BT_FALSE;
+
+    for( run1 = 0; run1 < nP; run1++ )
+        seed[code[projections[run1]].a] = seeds[number*nP+run1];
+
+    return BT_TRUE;
+}
+
+
+returnValue FunctionEvaluationTape::clearBuffer( ){
+
+    bufferSize = 0;
+
+    values.clear();
+    seeds.clear();
+    bufferStatus.clear();
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue FunctionEvaluationTape::exportCode( std::ostream& stream ) const{
+
+    int run1;
+    const int nI = (int)code.size();
+    const int nO = (int)output.size();
+
+    const char *symbol[] = { 0, 0, 0, "+", "-", "*", "/" };
+
+    stream << "/* This file was auto-generated by ACADO Toolkit. */" << std::endl << std::endl;
+    stream << "#include <math.h>" << std::endl << std::endl;
+    stream.precision( 17 );
+    stream << std::scientific;
+
+    // EVALUATION:
+    // -----------
+    stream << "void acado_jit_evaluate( double *x, double *v, double *f )\n{\n";
+
+    for( run1 = 0; run1 < nI; run1++ ){
+
+        const TapeInstruction &I = code[run1];
+        stream << "v[" << run1 << "] = ";
+
+        switch( I.op ){
+
+            case TO_PROJECT  : stream << "x[" << I.a << "];\n";                                          break;
+            case TO_CONSTANT : stream << I.c << ";\n";                                                    break;
+            case TO_COPY     : stream << "v[" << I.a << "]; x[" << I.b << "] = v[" << run1 << "];\n";     break;
+            case TO_ADD      :
+            case TO_SUBTRACT :
+            case TO_MULTIPLY :
+            case TO_DIVIDE   : stream << "v[" << I.a << "] " << symbol[I.op] << " v[" << I.b << "];\n";    break;
+            case TO_POWER    : stream << "pow( v[" << I.a << "], v[" << I.b << "] );\n";                  break;
+            case TO_POWER_INT: stream << "pow( v[" << I.a << "], " << I.c << " );\n";                     break;
+            case TO_ACOS     : stream << "acos( v[" << I.a << "] );\n";                                   break;
+            case TO_ASIN     : stream << "asin( v[" << I.a << "] );\n";                                   break;
+            case TO_ATAN     : stream << "atan( v[" << I.a << "] );\n";                                   break;
+            case TO_COS      : stream << "cos( v[" << I.a << "] );\n";                                    break;
+            case TO_EXP      : stream << "exp( v[" << I.a << "] );\n";                                    break;
+            case TO_LOG      : stream << "log( v[" << I.a << "] );\n";                                    break;
+            case TO_SIN      : stream << "sin( v[" << I.a << "] );\n";                                    break;
+            case TO_TAN      : stream << "tan( v[" << I.a << "] );\n";                                    break;
+        }
+    }
+    for( run1 = 0; run1 < nO; run1++ )
+        stream << "f[" << run1 << "] = v[" << output[run1] << "];\n";
+
+    stream << "}\n\n";
+
+    // FORWARD AD:
+    // -----------
+    stream << "void acado_jit_forward( const double *v, double *seed, double *df, double *d )\n{\n";
+    stream << "double p1, p2;\n";
+
+    for( run1 = 0; run1 < nI; run1++ ){
+
+        const TapeInstruction &I = code[run1];
+
+        switch( I.op ){
+
+            case TO_PROJECT  : stream << "d[" << run1 << "] = seed[" << I.a << "];\n";                   break;
+            case TO_CONSTANT : stream << "d[" << run1 << "] = 0.0;\n";                                  break;
+            case TO_COPY     : stream << "d[" << run1 << "] = d[" << I.a << "]; seed[" << I.b << "] = d[" << run1 << "];\n"; break;
+            case TO_ADD      :
+            case TO_SUBTRACT : stream << "d[" << run1 << "] = d[" << I.a << "] " << symbol[I.op] << " d[" << I.b << "];\n"; break;
+
+            default:
+                exportPartials( stream, run1 );
+                stream << "d[" << run1 << "] = p1*d[" << I.a << "]";
+                if( I.b >= 0 ) stream << " + p2*d[" << I.b << "]";
+                stream << ";\n";
+                break;
+        }
+    }
+    for( run1 = 0; run1 < nO; run1++ )
+        stream << "df[" << run1 << "] = d[" << output[run1] << "];\n";
+
+    stream << "}\n\n";
+
+    // BACKWARD AD:
+    // ------------
+    stream << "void acado_jit_backward( const double *v, const double *seed, double *df, double *d )\n{\n";
+    stream << "double p1, p2;\n";
+    stream << "int i;\n";
+    stream << "for (i = 0; i < " << nI << "; ++i) d[i] = 0.0;\n";
+
+    for( run1 = 0; run1 < nO; run1++ )
+        stream << "d[" << output[run1] << "] += seed[" << run1 << "];\n";
+
+    for( run1 = nI-1; run1 >= 0; run1-- ){
+
+        const TapeInstruction &I = code[run1];
+
+        switch( I.op ){
+
+            case TO_PROJECT  : stream << "df[" << I.a << "] += d[" << run1 << "];\n";                    break;
+            case TO_CONSTANT :                                                                          break;
+            case TO_COPY     : stream << "d[" << run1 << "] += df[" << I.b << "]; df[" << I.b << "] = d[" << run1
+                                      << "]; d[" << I.a << "] += d[" << run1 << "];\n";                  break;
+            case TO_ADD      : stream << "d[" << I.a << "] += d[" << run1 << "]; d[" << I.b << "] += d[" << run1 << "];\n"; break;
+            case TO_SUBTRACT : stream << "d[" << I.a << "] += d[" << run1 << "]; d[" << I.b << "] -= d[" << run1 << "];\n"; break;
+
+            default:
+                exportPartials( stream, run1 );
+                stream << "d[" << I.a << "] += p1*d[" << run1 << "];";
+                if( I.b >= 0 ) stream << " d[" << I.b << "] += p2*d[" << run1 << "];";
+                stream << "\n";
+                break;
+        }
+    }
+    stream << "}\n\n";
+
+    // FORWARD AD (BLOCK OF DIRECTIONS):
+    // ---------------------------------
+    stream << "void acado_jit_forward_block( const double *v, int n, double *seed, double *df, double *d )\n{\n";
+    stream << "double p1, p2;\n";
+    stream << "int j;\n";
+
+    for( run1 = 0; run1 < nI; run1++ ){
+
+        const TapeInstruction &I = code[run1];
+        const char *loop = "for (j = 0; j < n; ++j) ";
+
+        switch( I.op ){
+
+            case TO_PROJECT  : stream << loop << "d[" << run1 << "*n+j] = seed[" << I.a << "*n+j];\n";  break;
+            case TO_CONSTANT : stream << loop << "d[" << run1 << "*n+j] = 0.0;\n";                     break;
+            case TO_COPY     : stream << loop << "{ d[" << run1 << "*n+j] = d[" << I.a << "*n+j]; seed[" << I.b
+                                      << "*n+j] = d[" << run1 << "*n+j]; }\n";                          break;
+            case TO_ADD      :
+            case TO_SUBTRACT : stream << loop << "d[" << run1 << "*n+j] = d[" << I.a << "*n+j] " << symbol[I.op]
+                                      << " d[" << I.b << "*n+j];\n";                                    break;
+
+            default:
+                exportPartials( stream, run1 );
+                stream << loop << "d[" << run1 << "*n+j] = p1*d[" << I.a << "*n+j]";
+                if( I.b >= 0 ) stream << " + p2*d[" << I.b << "*n+j]";
+                stream << ";\n";
+                break;
+        }
+    }
+    for( run1 = 0; run1 < nO; run1++ )
+        stream << "for (j = 0; j < n; ++j) df[" << run1 << "*n+j] = d[" << output[run1] << "*n+j];\n";
+
+    stream << "}\n\n";
+
+    // BACKWARD AD (BLOCK OF DIRECTIONS):
+    // ----------------------------------
+    stream << "void acado_jit_backward_block( const double *v, int n, const double *seed, double *df, double *d )\n{\n";
+    stream << "double p1, p2;\n";
+    stream << "int i, j;\n";
+    stream << "for (i = 0; i < " << nI << "*n; ++i) d[i] = 0.0;\n";
+
+    for( run1 = 0; run1 < nO; run1++ )
+        stream << "for (j = 0; j < n; ++j) d[" << output[run1] << "*n+j] += seed[" << run1 << "*n+j];\n";
+
+    for( run1 = nI-1; run1 >= 0; run1-- ){
+
+        const TapeInstruction &I = code[run1];
+        const char *loop = "for (j = 0; j < n; ++j) ";
+
+        switch( I.op ){
+
+            case TO_PROJECT  : stream << loop << "df[" << I.a << "*n+j] += d[" << run1 << "*n+j];\n";   break;
+            case TO_CONSTANT :                                                                          break;
+            case TO_COPY     : stream << loop << "{ d[" << run1 << "*n+j] += df[" << I.b << "*n+j]; df[" << I.b
+                                      << "*n+j] = d[" << run1 << "*n+j]; d[" << I.a << "*n+j] += d[" << run1 << "*n+j]; }\n"; break;
+            case TO_ADD      : stream << loop << "{ d[" << I.a << "*n+j] += d[" << run1 << "*n+j]; d[" << I.b
+                                      << "*n+j] += d[" << run1 << "*n+j]; }\n";                         break;
+            case TO_SUBTRACT : stream << loop << "{ d[" << I.a << "*n+j] += d[" << run1 << "*n+j]; d[" << I.b
+                                      << "*n+j] -= d[" << run1 << "*n+j]; }\n";                         break;
+
+            default:
+                exportPartials( stream, run1 );
+                stream << loop << "d[" << I.a << "*n+j] += p1*d[" << run1 << "*n+j];\n";
+                if( I.b >= 0 ) stream << loop << "d[" << I.b << "*n+j] += p2*d[" << run1 << "*n+j];\n";
+                break;
+        }
+    }
+    stream << "}\n\n";
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+void FunctionEvaluationTape::allocateBuffer( int number ){
+
+    if( number >= bufferSize ){
+
+        bufferSize = number+1;
+
+        values.resize( bufferSize*code.size() );
+        seeds.resize( bufferSize*projections.size() );
+        bufferStatus.resize( bufferSize,0 );
+    }
+
+    if( derivatives.size() < code.size() )
+        derivatives.resize( code.size() );
+}
+
+
+void FunctionEvaluationTape::exportPartials( std::ostream& stream, int idx ) const{
+
+    // the formulas are the same as in getPartials()
+    std::stringstream a, b, r;
+
+    a << "v[" << code[idx].a << "]";
+    b << "v[" << code[idx].b << "]";
+    r << "v[" << idx << "]";
+
+    const std::string va = a.str(), vb = b.str(), vr = r.str();
+
+    switch( code[idx].op ){
+
+        case TO_MULTIPLY : stream << "p1 = " << vb << "; p2 = " << va << ";\n";                                  break;
+        case TO_DIVIDE   : stream << "p1 = 1.0/" << vb << "; p2 = -" << va << "/(" << vb << "*" << vb << ");\n";  break;
+        case TO_POWER    : stream << "p1 = " << vb << "*pow(" << va << "," << vb << "-1.0); p2 = " << vr
+                                  << "*log(" << va << ");\n";                                                   break;
+        case TO_POWER_INT: stream << "p1 = " << code[idx].c << "*pow(" << va << "," << code[idx].c - 1.0 << ");\n"; break;
+        case TO_ACOS     : stream << "p1 = -1/sqrt(1-" << va << "*" << va << ");\n";                           break;
+        case TO_ASIN     : stream << "p1 = 1/sqrt(1-" << va << "*" << va << ");\n";                            break;
+        case TO_ATAN     : stream << "p1 = 1/(1+" << va << "*" << va << ");\n";                                break;
+        case TO_COS      : stream << "p1 = -sin(" << va << ");\n";                                              break;
+        case TO_EXP      : stream << "p1 = " << vr << ";\n";                                                    break;
+        case TO_LOG      : stream << "p1 = 1/" << va << ";\n";                                                  break;
+        case TO_SIN      : stream << "p1 = cos(" << va << ");\n";                                               break;
+        case TO_TAN      : stream << "p1 = 1+" << vr << "*" << vr << ";\n";                                     break;
+    }
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
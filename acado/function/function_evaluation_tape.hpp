@@ -0,0 +1,272 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/function/function_evaluation_tape.hpp
+ *    \date 2014
+ */
+
+#ifndef ACADO_TOOLKIT_FUNCTION_EVALUATION_TAPE_HPP
+#define ACADO_TOOLKIT_FUNCTION_EVALUATION_TAPE_HPP
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/function/function_evaluation_jit.hpp>
+#include <vector>
+
+BEGIN_NAMESPACE_ACADO
+
+class Operator;
+
+/**
+ *	\brief Flat instruction tape for the numeric evaluation of a function tree.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class FunctionEvaluationTape stores the expressions of a
+ *  FunctionEvaluationTree as a linear list of instructions. Every
+ *  instruction writes exactly one register; common subexpressions are
+ *  detected while the tape is built and share their register.
+ *
+ *  The tape offers the same numeric interface as the tree (evaluation and
+ *  first order automatic differentiation in forward, backward and vector
+ *  mode, based on buffered values), but runs it in a single loop without
+ *  virtual function calls. Trees containing operators that cannot be
+ *  recorded (e.g. C-functions or nonsmooth operators) are not supported;
+ *  in this case init() fails and the tree has to be used instead.
+ *
+ *  Optionally, the tape is exported as C code and compiled at run-time
+ *  (see FunctionEvaluationJIT); the numeric interface then calls the
+ *  compiled functions instead of interpreting the instructions.
+ *
+ *  Since second order derivatives are still computed by the tree, the tape
+ *  keeps track of the evaluation point and the last forward seed of every
+ *  buffer position, such that the buffers of the tree can be restored on
+ *  demand.
+ */
+class FunctionEvaluationTape
+{
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+public:
+
+    /** Default constructor. */
+    FunctionEvaluationTape( );
+
+    /** Destructor. */
+    virtual ~FunctionEvaluationTape( );
+
+
+    /** Records the given expressions.                                  \n
+     *                                                                  \n
+     *  \param dim       number of components                           \n
+     *  \param f         the components                                 \n
+     *  \param n         number of intermediate expressions             \n
+     *  \param sub       the intermediate expressions                   \n
+     *  \param subIndex  the variable indices of the intermediate states\n
+     *                                                                  \n
+     *  \return SUCCESSFUL_RETURN                                       \n
+     *          RET_NOT_IMPLEMENTED_YET (unsupported operator)          \n
+     */
+    returnValue init( int dim, Operator **f, int n, Operator **sub, const int *subIndex );
+
+
+    /** Enables or disables the run-time compilation of the tape. If    \n
+     *  enabled, the tape is compiled by init().                        \n
+     *                                                                  \n
+     *  \param useJIT_          whether the tape shall be compiled       \n
+     *  \param cacheDirectory   directory of the compiled objects (see   \n
+     *                          FunctionEvaluationJIT::load)            \n
+     *                                                                  \n
+     *  \return SUCCESSFUL_RETURN                                       \n
+     */
+    returnValue setJITCompilation( BooleanType useJIT_, const std::string& cacheDirectory );
+
+
+    /** Returns whether the compiled code of the tape is used. */
+    inline BooleanType isCompiled( ) const;
+
+
+    /** Exports the C code of the tape, i.e. the functions used by      \n
+     *  FunctionEvaluationJIT.                                          \n
+     *  \return SUCCESSFUL_RETURN                                       \n
+     */
+    returnValue exportCode( std::ostream& stream ) const;
+
+
+    /** Returns whether the tape has been recorded successfully. */
+    inline BooleanType isEmpty( ) const;
+
+
+    /** Returns the number of instructions (registers) of the tape. */
+    inline int getNumInstructions( ) const;
+
+
+    /** Evaluates the tape and stores the registers in the buffer       \n
+     *  position number. The intermediate states are written to x.      \n
+     *  \return SUCCESSFUL_RETURN                                       \n
+     */
+    returnValue evaluate( int number, double *x, double *result );
+
+
+    /** Automatic Differentiation in forward mode based on the values   \n
+     *  in the buffer position number. The derivatives of the           \n
+     *  intermediate states are written to seed.                        \n
+     *  \return SUCCESSFUL_RETURN                                       \n
+     */
+    returnValue AD_forward( int number, double *seed, double *df );
+
+
+    /** Automatic Differentiation in backward mode based on the values  \n
+     *  in the buffer position number. The derivatives are added to df. \n
+     *  \return SUCCESSFUL_RETURN                                       \n
+     */
+    returnValue AD_backward( int number, double *seed, double *df );
+
+
+    /** Automatic Differentiation in forward mode for a block of nDir   \n
+     *  directions, stored contiguously per variable (see               \n
+     *  FunctionEvaluationTree::AD_forward).                            \n
+     *  \return SUCCESSFUL_RETURN                                       \n
+     */
+    returnValue AD_forward( int number, int nDir, double *seed, double *df );
+
+
+    /** Automatic Differentiation in backward mode for a block of nDir  \n
+     *  directions, stored contiguously per variable (see               \n
+     *  FunctionEvaluationTree::AD_backward).                           \n
+     *  \return SUCCESSFUL_RETURN                                       \n
+     */
+    returnValue AD_backward( int number, int nDir, double *seed, double *df );
+
+
+    /** Returns whether the buffers of the tree at the given position   \n
+     *  are consistent with the last evaluation of the tape.            \n
+     */
+    BooleanType isSynchronized( int number ) const;
+
+
+    /** Marks the buffers of the tree at the given position as          \n
+     *  consistent with the last evaluation of the tape.                \n
+     */
+    void setSynchronized( int number );
+
+
+    /** Restores the evaluation point x and the last forward seed of    \n
+     *  the given buffer position. Both arrays have to be initialized   \n
+     *  (usually with zeros) by the caller.                             \n
+     *                                                                  \n
+     *  \return BT_TRUE  iff a forward seed has been recorded           \n
+     */
+    BooleanType getPoint( int number, double *x, double *seed ) const;
+
+
+    /** Frees the buffers. */
+    returnValue clearBuffer( );
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+protected:
+
+    /** Makes sure that the buffer position number exists. */
+    void allocateBuffer( int number );
+
+    /** Computes the partial derivatives of the instruction idx. */
+    inline void getPartials( int idx, const double *v, double &p1, double &p2 ) const;
+
+    /** Exports the partial derivatives of the instruction idx. */
+    void exportPartials( std::ostream& stream, int idx ) const;
+
+
+//
+// DATA MEMBERS:
+//
+public:
+
+    /** Instruction codes of the tape. */
+    enum TapeOperation{
+
+        TO_PROJECT,     /**< load variable a                          */
+        TO_CONSTANT,    /**< load the constant c                      */
+        TO_COPY,        /**< assign register a to an intermediate     */
+        TO_ADD,         /**< a + b                                    */
+        TO_SUBTRACT,    /**< a - b                                    */
+        TO_MULTIPLY,    /**< a * b                                    */
+        TO_DIVIDE,      /**< a / b                                    */
+        TO_POWER,       /**< pow( a, b )                              */
+        TO_POWER_INT,   /**< pow( a, (int)c )                         */
+        TO_ACOS,
+        TO_ASIN,
+        TO_ATAN,
+        TO_COS,
+        TO_EXP,
+        TO_LOG,
+        TO_SIN,
+        TO_TAN
+    };
+
+    /** A single instruction writing the register with the same index. */
+    struct TapeInstruction{
+
+        int    op;  /**< the operation                                          */
+        int    a ;  /**< first argument register (or variable index)            */
+        int    b ;  /**< second argument register (or intermediate index)       */
+        double c ;  /**< constant or integer exponent                           */
+    };
+
+protected:
+
+    std::vector< TapeInstruction > code   ;   /**< The instructions                       */
+    std::vector< int >      output        ;   /**< The registers of the components        */
+    std::vector< int >      projections   ;   /**< The registers of the variables         */
+
+    std::vector< double >   values        ;   /**< The registers of all buffer positions  */
+    std::vector< double >   seeds         ;   /**< The last forward seeds (per buffer)    */
+    std::vector< int >      bufferStatus  ;   /**< Status of the buffer positions         */
+
+    std::vector< double >   derivatives   ;   /**< Workspace for the derivatives          */
+
+    int                     bufferSize    ;   /**< The number of buffer positions         */
+
+    BooleanType             useJIT        ;   /**< Whether the tape shall be compiled     */
+    std::string             jitDirectory  ;   /**< Directory of the compiled objects      */
+    FunctionEvaluationJIT   jit           ;   /**< The compiled code                      */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#include <acado/function/function_evaluation_tape.ipp>
+
+
+#endif  // ACADO_TOOLKIT_FUNCTION_EVALUATION_TAPE_HPP
+
+// end of file.
@@ -0,0 +1,98 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+
+/**
+*    \file include/acado/function/function_evaluation_tape.ipp
+*    \date 2014
+*/
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+inline BooleanType FunctionEvaluationTape::isEmpty( ) const{
+
+    if( code.empty() == true ) return BT_TRUE;
+    return BT_FALSE;
+}
+
+
+inline BooleanType FunctionEvaluationTape::isCompiled( ) const{
+
+    return jit.isLoaded();
+}
+
+
+inline int FunctionEvaluationTape::getNumInstructions( ) const{
+
+    return (int)code.size();
+}
+
+
+inline void FunctionEvaluationTape::getPartials( int idx, const double *v, double &p1, double &p2 ) const{
+
+    const double va = v[code[idx].a];
+
+    // the formulas are the same as in the corresponding operators
+    switch( code[idx].op ){
+
+        case TO_MULTIPLY : p1 = v[code[idx].b];
+                           p2 = va;
+                           break;
+
+        case TO_DIVIDE   : p1 = 1.0/v[code[idx].b];
+                           p2 = -va/( v[code[idx].b]*v[code[idx].b] );
+                           break;
+
+        case TO_POWER    : p1 = v[code[idx].b]*pow( va,v[code[idx].b]-1.0 );
+                           p2 = v[idx]*log( va );
+                           break;
+
+        case TO_POWER_INT: p1 = code[idx].c*pow( va,(int)code[idx].c-1 );
+                           p2 = 0.0;
+                           break;
+
+        case TO_ACOS     : p1 = -1/sqrt(1-va*va);        p2 = 0.0; break;
+        case TO_ASIN     : p1 =  1/sqrt(1-va*va);        p2 = 0.0; break;
+        case TO_ATAN     : p1 =  1/(1+va*va);            p2 = 0.0; break;
+        case TO_COS      : p1 = -sin(va);                p2 = 0.0; break;
+        case TO_EXP      : p1 =  v[idx];                 p2 = 0.0; break;
+        case TO_LOG      : p1 =  1/va;                   p2 = 0.0; break;
+        case TO_SIN      : p1 =  cos(va);                p2 = 0.0; break;
+        case TO_TAN      : p1 =  1+v[idx]*v[idx];        p2 = 0.0; break;
+
+        default          : p1 = 0.0;                     p2 = 0.0; break;
+    }
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -35,11 +35,82 @@
 #include <acado/function/function_evaluation_tree.hpp>
 #include <acado/symbolic_expression/symbolic_expression.hpp>
 
+#include <map>
+
 using namespace std;
 
 BEGIN_NAMESPACE_ACADO
 
 
+// intermediates that are used at most this many statements after their
+// computation (and not by the outputs) are exported as local variables
+static const int AUX_LOCAL_RANGE = 8;
+
+
+
+/**
+ *	\brief Collects the variables that an operator tree depends on.
+ *
+ *	The collector walks the tree using the generic operator evaluation
+ *	interface and stores the global index of every projection. Trees
+ *	containing operators that do not support this interface are flagged.
+ */
+class FunctionEvaluationTreeDependencies : public EvaluationBase{
+
+public:
+
+	FunctionEvaluationTreeDependencies( std::vector< int > &indices_ )
+		: indices( indices_ ), visited( false ), failed( BT_FALSE ){ }
+
+	virtual ~FunctionEvaluationTreeDependencies(){ }
+
+	/** Appends the indices of all variables the tree depends on. */
+	void collect( Operator &arg ){
+
+		visited = false;
+		arg.evaluate( this );
+
+		if( visited == false )
+			failed = BT_TRUE;
+	}
+
+	BooleanType hasFailed() const{ return failed; }
+
+	virtual void addition   ( Operator &arg1, Operator &arg2 ){ binary( arg1, arg2 ); }
+	virtual void subtraction( Operator &arg1, Operator &arg2 ){ binary( arg1, arg2 ); }
+	virtual void product    ( Operator &arg1, Operator &arg2 ){ binary( arg1, arg2 ); }
+	virtual void quotient   ( Operator &arg1, Operator &arg2 ){ binary( arg1, arg2 ); }
+	virtual void power      ( Operator &arg1, Operator &arg2 ){ binary( arg1, arg2 ); }
+	virtual void powerInt   ( Operator &arg1, int      &arg2 ){ collect( arg1 ); visited = true; }
+
+	virtual void project( int &idx ){ indices.push_back( idx ); visited = true; }
+	virtual void set    ( double &arg ){ visited = true; }
+
+	virtual void Acos( Operator &arg ){ collect( arg ); visited = true; }
+	virtual void Asin( Operator &arg ){ collect( arg ); visited = true; }
+	virtual void Atan( Operator &arg ){ collect( arg ); visited = true; }
+	virtual void Cos ( Operator &arg ){ collect( arg ); visited = true; }
+	virtual void Exp ( Operator &arg ){ collect( arg ); visited = true; }
+	virtual void Log ( Operator &arg ){ collect( arg ); visited = true; }
+	virtual void Sin ( Operator &arg ){ collect( arg ); visited = true; }
+	virtual void Tan ( Operator &arg ){ collect( arg ); visited = true; }
+
+protected:
+
+	void binary( Operator &arg1, Operator &arg2 ){
+
+		collect( arg1 );
+		collect( arg2 );
+		visited = true;
+	}
+
+	std::vector< int > &indices;
+
+	bool        visited;
+	BooleanType failed;
+};
+
+
 
 //
 // PUBLIC MEMBER FUNCTIONS:
@@ -54,6 +125,8 @@ FunctionEvaluationTree::FunctionEvaluationTree( ){
     dim       =  0;
     n         =  0;
 
+    tapeStatus = 0;
+
     globalExportVariableName = "acado_aux";
 }
 
@@ -94,6 +167,9 @@ FunctionEvaluationTree::FunctionEvaluationTree( const FunctionEvaluationTree& ar
     }
 
     safeCopy = arg.safeCopy;
+
+    tape       = arg.tape      ;
+    tapeStatus = arg.tapeStatus;
 }
 
 
@@ -183,6 +259,9 @@ FunctionEvaluationTree& FunctionEvaluationTree::operator=( const FunctionEvaluat
             }
         }
         safeCopy = arg.safeCopy;
+
+        tape       = arg.tape      ;
+        tapeStatus = arg.tapeStatus;
     }
 
     return *this;
@@ -202,6 +281,8 @@ returnValue FunctionEvaluationTree::operator<<( const Expression& arg ){
 
     uint run1;
 
+    tapeStatus = 0;
+
     for( run1 = 0; run1 < arg.getDim(); run1++ ){
 
         int nn;
@@ -239,6 +320,9 @@ returnValue FunctionEvaluationTree::evaluate( double *x, double *result ){
 
     int run1;
 
+    if( useTape() == BT_TRUE )
+        return tape.evaluate( 0, x, result );
+
     for( run1 = 0; run1 < n; run1++ ){
 
         sub[run1]->evaluate( 0, x, &x[ indexList->index(VT_INTERMEDIATE_STATE,
@@ -259,22 +343,21 @@ returnValue FunctionEvaluationTree::evaluate( double *x, double *result, PrintLe
 	if (printL == MEDIUM || printL == HIGH)
 		cout << "Symbolic expression evaluation:" << endl;
 
-    for( run1 = 0; run1 < n; run1++ ){
+    returnValue returnvalue = evaluate( 0, x, result );
 
-        sub[run1]->evaluate( 0, x, &x[ indexList->index(VT_INTERMEDIATE_STATE,
-                                                     lhs_comp[run1]         ) ] );
-        if( printL == HIGH )
+    if( returnvalue != SUCCESSFUL_RETURN )
+        return returnvalue;
+
+    if( printL == HIGH ){
+        for( run1 = 0; run1 < n; run1++ )
         	cout 	<< "sub[" << lhs_comp[ run1 ] << "] = "
         			<< scientific << x[ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1]) ]
         			<< endl;
     }
 
-	for (run1 = 0; run1 < dim; run1++) {
-		f[run1]->evaluate(0, x, &result[run1]);
-
-		if (printL == HIGH || printL == MEDIUM)
+	if (printL == HIGH || printL == MEDIUM)
+		for (run1 = 0; run1 < dim; run1++)
 			cout << "f[" << run1 << "] = " << scientific << result[run1] << endl;
-	}
 
     return SUCCESSFUL_RETURN;
 }
@@ -285,6 +368,9 @@ returnValue FunctionEvaluationTree::evaluate( int number, double *x, double *res
 
     int run1;
 
+    if( useTape() == BT_TRUE )
+        return tape.evaluate( number, x, result );
+
     for( run1 = 0; run1 < n; run1++ ){
         sub[run1]->evaluate( number, x, &x[ indexList->index(VT_INTERMEDIATE_STATE,
                                                              lhs_comp[run1]         ) ] );
@@ -486,6 +572,27 @@ BooleanType FunctionEvaluationTree::isDependingOn( const Expression &variable ){
 }
 
 
+returnValue FunctionEvaluationTree::getDependencyPattern( int           nVars    ,
+                                                          VariableType *varType  ,
+                                                          int          *component,
+                                                          BooleanType  *pattern    ){
+
+    int          run1;
+    BooleanType *implicit_dep = new BooleanType[n];
+
+    for( run1 = 0; run1 < n; run1++ ){
+        implicit_dep[run1] = sub[run1]->isDependingOn( nVars, varType, component, implicit_dep );
+    }
+    for( run1 = 0; run1 < dim; run1++ ){
+        pattern[run1] = f[run1]->isDependingOn( nVars, varType, component, implicit_dep );
+    }
+
+    delete[] implicit_dep;
+    return SUCCESSFUL_RETURN;
+}
+
+
+
 BooleanType FunctionEvaluationTree::isLinearIn( const Expression &variable ){
 
     int nn = variable.getDim();
@@ -721,6 +828,11 @@ returnValue FunctionEvaluationTree::AD_forward( double *x, double *seed, double
 
     int run1;
 
+    if( useTape() == BT_TRUE ){
+        tape.evaluate( 0, x, ff );
+        return tape.AD_forward( 0, seed, df );
+    }
+
     for( run1 = 0; run1 < n; run1++ ){
         sub[run1]->AD_forward( 0, x, seed,
                          &x   [ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])],
@@ -740,6 +852,11 @@ returnValue FunctionEvaluationTree::AD_forward( int number, double *x, double *s
 
     int run1;
 
+    if( useTape() == BT_TRUE ){
+        tape.evaluate( number, x, ff );
+        return tape.AD_forward( number, seed, df );
+    }
+
     for( run1 = 0; run1 < n; run1++ ){
         sub[run1]->AD_forward( number, x, seed,
                          &x   [ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])],
@@ -757,6 +874,9 @@ returnValue FunctionEvaluationTree::AD_forward( int number, double *seed, double
 
     int run1;
 
+    if( useTape() == BT_TRUE )
+        return tape.AD_forward( number, seed, df );
+
     for( run1 = 0; run1 < n; run1++ ){
         sub[run1]->AD_forward( number, seed,
                          &seed[ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])] );
@@ -773,6 +893,9 @@ returnValue FunctionEvaluationTree::AD_backward( double *seed, double  *df ){
 
     int run1;
 
+    if( useTape() == BT_TRUE )
+        return tape.AD_backward( 0, seed, df );
+
     for( run1 = dim-1; run1 >= 0; run1-- ){
         f[run1]->AD_backward( 0, seed[run1], df );
     }
@@ -794,6 +917,9 @@ returnValue FunctionEvaluationTree::AD_backward( int number, double *seed, doubl
 
     int run1;
 
+    if( useTape() == BT_TRUE )
+        return tape.AD_backward( number, seed, df );
+
     for( run1 = dim-1; run1 >= 0; run1-- ){
         f[run1]->AD_backward( number, seed[run1], df );
     }
@@ -808,12 +934,113 @@ returnValue FunctionEvaluationTree::AD_backward( int number, double *seed, doubl
 }
 
 
+returnValue FunctionEvaluationTree::AD_forward( int number, int nDir, double *seed, double *df ){
+
+    int run1, run2;
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+
+    if( useTape() == BT_TRUE )
+        return tape.AD_forward( number, nDir, seed, df );
+
+    for( run1 = 0; run1 < n && returnvalue == SUCCESSFUL_RETURN; run1++ ){
+        returnvalue = sub[run1]->AD_forward( number, nDir, seed,
+                         &seed[ nDir*indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])] );
+    }
+    for( run1 = 0; run1 < dim && returnvalue == SUCCESSFUL_RETURN; run1++ ){
+        returnvalue = f[run1]->AD_forward( number, nDir, seed, &df[nDir*run1] );
+    }
+
+    if( returnvalue != RET_NOT_IMPLEMENTED_YET )
+        return returnvalue;
+
+    // NOT ALL OPERATORS SUPPORT THE VECTOR MODE (E.G. C-FUNCTIONS):
+    // PROPAGATE THE DIRECTIONS ONE AFTER ANOTHER.
+    // -------------------------------------------------------------
+    const int nVars = getNumberOfVariables()+1;
+
+    double *seed_ = new double[nVars];
+    double *df_   = new double[dim  ];
+
+    for( run2 = 0; run2 < nDir; run2++ ){
+
+        for( run1 = 0; run1 < nVars; run1++ )
+            seed_[run1] = seed[run1*nDir+run2];
+
+        returnvalue = AD_forward( number, seed_, df_ );
+        if( returnvalue != SUCCESSFUL_RETURN ) break;
+
+        for( run1 = 0; run1 < nVars; run1++ )
+            seed[run1*nDir+run2] = seed_[run1];
+        for( run1 = 0; run1 < dim; run1++ )
+            df[run1*nDir+run2] = df_[run1];
+    }
+
+    delete[] seed_;
+    delete[] df_  ;
+
+    return returnvalue;
+}
+
+
+returnValue FunctionEvaluationTree::AD_backward( int number, int nDir, double *seed, double *df ){
+
+    int run1, run2;
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+
+    if( useTape() == BT_TRUE )
+        return tape.AD_backward( number, nDir, seed, df );
+
+    for( run1 = dim-1; run1 >= 0 && returnvalue == SUCCESSFUL_RETURN; run1-- ){
+        returnvalue = f[run1]->AD_backward( number, nDir, &seed[nDir*run1], df );
+    }
+
+    for( run1 = n-1; run1 >= 0 && returnvalue == SUCCESSFUL_RETURN; run1-- ){
+        returnvalue = sub[run1]->AD_backward( number, nDir,
+                              &df[ nDir*indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])],
+                              df );
+    }
+
+    if( returnvalue != RET_NOT_IMPLEMENTED_YET )
+        return returnvalue;
+
+    // NOT ALL OPERATORS SUPPORT THE VECTOR MODE (E.G. C-FUNCTIONS):
+    // PROPAGATE THE DIRECTIONS ONE AFTER ANOTHER.
+    // -------------------------------------------------------------
+    const int nVars = getNumberOfVariables()+1;
+
+    double *seed_ = new double[dim  ];
+    double *df_   = new double[nVars];
+
+    for( run2 = 0; run2 < nDir; run2++ ){
+
+        for( run1 = 0; run1 < dim; run1++ )
+            seed_[run1] = seed[run1*nDir+run2];
+        for( run1 = 0; run1 < nVars; run1++ )
+            df_[run1] = df[run1*nDir+run2];
+
+        returnvalue = AD_backward( number, seed_, df_ );
+        if( returnvalue != SUCCESSFUL_RETURN ) break;
+
+        for( run1 = 0; run1 < nVars; run1++ )
+            df[run1*nDir+run2] = df_[run1];
+    }
+
+    delete[] seed_;
+    delete[] df_  ;
+
+    return returnvalue;
+}
+
+
 returnValue FunctionEvaluationTree::AD_forward2( int number, double *seed,
                                              double *dseed, double *df,
                                              double *ddf ){
 
     int run1;
 
+    if( synchronizeBuffer( number ) != SUCCESSFUL_RETURN )
+        return ACADOERROR( RET_UNKNOWN_BUG );
+
     for( run1 = 0; run1 < n; run1++ ){
         sub[run1]->AD_forward2( number, seed, dseed,
                          &seed [ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])],
@@ -832,6 +1059,9 @@ returnValue FunctionEvaluationTree::AD_backward2( int number, double *seed1, dou
 
     int run1;
 
+    if( synchronizeBuffer( number ) != SUCCESSFUL_RETURN )
+        return ACADOERROR( RET_UNKNOWN_BUG );
+
     for( run1 = dim-1; run1 >= 0; run1-- ){
         f[run1]->AD_backward2( number, seed1[run1], seed2[run1], df, ddf );
     }
@@ -867,7 +1097,8 @@ returnValue FunctionEvaluationTree::C_print( 	std::ostream& stream,
 
 returnValue FunctionEvaluationTree::exportForwardDeclarations(	std::ostream& stream,
 																const char *fcnName,
-																const char *realString
+																const char *realString,
+																const char *contextParameter
 																) const
 {
 	stream	<<
@@ -877,7 +1108,7 @@ returnValue FunctionEvaluationTree::exportForwardDeclarations(	std::ostream& str
 			" *  \\param in Input to the exported function.\n"
 			" *  \\param out Output of the exported function.\n"
 			" */\n"
-			<< "void " << fcnName << "(const " << realString << "* in, "
+			<< "void " << fcnName << "(" << contextParameter << "const " << realString << "* in, "
 			<< realString << "* out);" << endl;
 
     return SUCCESSFUL_RETURN;
@@ -894,7 +1125,8 @@ returnValue FunctionEvaluationTree::exportCode(	std::ostream& stream,
 												uint		_numDX,
 												uint		_numOD,
 												bool       allocateMemory,
-												bool       staticMemory
+												bool       staticMemory,
+												const char *contextParameter
 												) const{
 
     int run1;
@@ -913,7 +1145,7 @@ returnValue FunctionEvaluationTree::exportCode(	std::ostream& stream,
 
 	unsigned offset = 0;
 
-	stream << "void " << fcnName << "(const " << realString << "* in, " << realString << "* out)\n{\n";
+	stream << "void " << fcnName << "(" << contextParameter << "const " << realString << "* in, " << realString << "* out)\n{\n";
 
 	if (numX > 0)
 		stream << "const " << realString << "* xd = in;" << endl;
@@ -955,9 +1187,15 @@ returnValue FunctionEvaluationTree::exportCode(	std::ostream& stream,
 		stream << "const " << realString << "* t = in + " << offset << ";" << endl;
 	offset += getNT();
 
-    if (n > 0)
+	// Assign the intermediates to reusable storage positions
+	vector< int > slot;
+	vector< bool > local;
+	int nLocals;
+	int nAux = allocateAuxiliaryVariables( slot, local, nLocals );
+
+    if (nAux > 0)
     {
-    	stream << "/* Vector of auxiliary variables; number of elements: " << n << ". */" << endl;
+    	stream << "/* Vector of auxiliary variables; number of elements: " << nAux << ". */" << endl;
 
     	if ( allocateMemory )
     	{
@@ -965,34 +1203,46 @@ returnValue FunctionEvaluationTree::exportCode(	std::ostream& stream,
     		{
     			stream << "static ";
     		}
-    		stream << realString << " a[" << n << "];";
+    		stream << realString << " a[" << nAux << "];";
     	}
     	else
     		stream << realString << "* a = " << globalExportVariableName << ";";
     	stream << endl << endl;
+    }
 
-    	stream << "/* Compute intermediate quantities: */" << endl;
+    if (nLocals > 0)
+    {
+    	stream << "/* Short-lived auxiliary variables. */" << endl << realString;
+    	for (run1 = 0; run1 < nLocals; run1++)
+    		stream << (run1 == 0 ? " " : ", ") << "t" << run1;
+    	stream << ";" << endl << endl;
     }
 
+    if (n > 0)
+    	stream << "/* Compute intermediate quantities: */" << endl;
+
     vector< string > auxVarIndividualNames;
     auxVarIndividualNames.resize( nni );
 	for (run1 = 0; run1 < n; run1++)
 	{
 		stringstream ss;
-		ss << "a" << "[" << run1 << "]";
+		if (local[ run1 ] == true)
+			ss << "t" << slot[ run1 ];
+		else
+			ss << "a" << "[" << slot[ run1 ] << "]";
 		auxVarIndividualNames[ lhs_comp[ run1 ] ] = ss.str();
 	}
 
 	IoFormatter iof( stream );
 	iof.set(16, iof.width, ios::scientific);
 
-	// Export intermediate quantities
+	// Export intermediate quantities (without flushing the stream after every line)
 	for (run1 = 0; run1 < n; run1++)
 	{
 		// Convert the name for intermediate variables for subexpressions
 		sub[run1]->setVariableExportName(VT_INTERMEDIATE_STATE, auxVarIndividualNames);
 
-		stream << "a[" << run1 << "] = " << *sub[ run1 ] << ";" << endl;
+		stream << auxVarIndividualNames[ lhs_comp[ run1 ] ] << " = " << *sub[ run1 ] << ";\n";
 	}
 
 	// Export output quantities
@@ -1002,7 +1252,7 @@ returnValue FunctionEvaluationTree::exportCode(	std::ostream& stream,
 		// Convert names for interm. quantities for output expressions
 		f[run1]->setVariableExportName(VT_INTERMEDIATE_STATE, auxVarIndividualNames);
 
-		stream << "out[" << run1 << "] = " << *f[ run1 ] << ";" << endl;
+		stream << "out[" << run1 << "] = " << *f[ run1 ] << ";\n";
 	}
 
 	iof.reset();
@@ -1018,6 +1268,8 @@ returnValue FunctionEvaluationTree::clearBuffer(){
     int run1;
     returnValue returnvalue;
 
+    tape.clearBuffer();
+
     for( run1 = 0; run1 < n; run1++ ){
         returnvalue = sub[run1]->clearBuffer();
         if( returnvalue != SUCCESSFUL_RETURN ){
@@ -1046,6 +1298,8 @@ returnValue FunctionEvaluationTree::makeImplicit( int dim_ ){
     int run1;
     int var_counter = indexList->makeImplicit(dim_);
 
+    tapeStatus = 0;
+
     for( run1 = 0; run1 < dim_; run1++ ){
 
         Operator *tmp = f[run1]->clone();
@@ -1173,11 +1427,192 @@ std::string FunctionEvaluationTree::getGlobalExportVariableName() const
 	return globalExportVariableName;
 }
 
+returnValue FunctionEvaluationTree::setJITCompilation( BooleanType useJIT, const std::string& cacheDirectory )
+{
+	// the tape is compiled when it is recorded next time
+	tapeStatus = 0;
+
+	return tape.setJITCompilation( useJIT, cacheDirectory );
+}
+
 unsigned FunctionEvaluationTree::getGlobalExportVariableSize() const
 {
-	return n;
+	vector< int > slot;
+	vector< bool > local;
+	int nLocals;
+
+	return allocateAuxiliaryVariables( slot, local, nLocals );
 }
 
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+int FunctionEvaluationTree::allocateAuxiliaryVariables(	vector< int >&  slot,
+														vector< bool >& local,
+														int&            nLocals
+														) const
+{
+	int run1, run2;
+
+	slot.resize( n );
+	local.assign( n, false );
+	nLocals = 0;
+
+	if (n == 0)
+		return 0;
+
+	// Map the global indices of the intermediates onto their positions
+	map< int,int > position;
+	for (run1 = 0; run1 < n; run1++)
+		position[ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[ run1 ]) ] = run1;
+
+	// Determine the last expression that uses each intermediate; the
+	// outputs count as expression n
+	vector< int > lastUse( n, -1 );
+	vector< int > indices;
+	FunctionEvaluationTreeDependencies dependencies( indices );
+
+	for (run1 = 0; run1 < n + dim; run1++)
+	{
+		indices.clear();
+		dependencies.collect( run1 < n ? *sub[ run1 ] : *f[ run1 - n ] );
+
+		for (run2 = 0; run2 < (int)indices.size(); run2++)
+		{
+			map< int,int >::const_iterator it = position.find( indices[ run2 ] );
+
+			if (it != position.end())
+				lastUse[ it->second ] = run1 < n ? run1 : n;
+		}
+	}
+
+	// Without complete dependency information every intermediate keeps
+	// its own element of the auxiliary array
+	if (dependencies.hasFailed() == BT_TRUE)
+	{
+		for (run1 = 0; run1 < n; run1++)
+			slot[ run1 ] = run1;
+
+		return n;
+	}
+
+	// Linear scan over the intermediates: positions are released after the
+	// last use of their value and handed out again in LIFO order, such that
+	// recently used (and thus cached) positions are preferred
+	vector< vector< int > > expiring( n );
+	for (run1 = 0; run1 < n; run1++)
+		if (lastUse[ run1 ] > run1 && lastUse[ run1 ] < n)
+			expiring[ lastUse[ run1 ] ].push_back( run1 );
+
+	vector< int > freeAux, freeLocals;
+	int nAux = 0;
+
+	for (run1 = 0; run1 < n; run1++)
+	{
+		for (run2 = 0; run2 < (int)expiring[ run1 ].size(); run2++)
+		{
+			int idx = expiring[ run1 ][ run2 ];
+
+			if (local[ idx ] == true)
+				freeLocals.push_back( slot[ idx ] );
+			else
+				freeAux.push_back( slot[ idx ] );
+		}
+
+		local[ run1 ] = lastUse[ run1 ] < n && lastUse[ run1 ] - run1 <= AUX_LOCAL_RANGE;
+
+		vector< int >& freeSlots = local[ run1 ] == true ? freeLocals : freeAux;
+		int&           nSlots    = local[ run1 ] == true ? nLocals : nAux;
+
+		if (freeSlots.empty() == true)
+		{
+			slot[ run1 ] = nSlots++;
+		}
+		else
+		{
+			slot[ run1 ] = freeSlots.back();
+			freeSlots.pop_back();
+		}
+
+		// Unused intermediates are still computed, but only need their
+		// position for the current statement
+		if (lastUse[ run1 ] <= run1)
+			freeSlots.push_back( slot[ run1 ] );
+	}
+
+	return nAux;
+}
+
+
+BooleanType FunctionEvaluationTree::useTape( ){
+
+    if( tapeStatus == 0 ){
+
+        int run1;
+        int *subIndex = new int[n+1];
+
+        for( run1 = 0; run1 < n; run1++ )
+            subIndex[run1] = indexList->index( VT_INTERMEDIATE_STATE, lhs_comp[run1] );
+
+        tapeStatus = -1;
+
+        if( dim > 0 && isSymbolic() == BT_TRUE )
+            if( tape.init( dim, f, n, sub, subIndex ) == SUCCESSFUL_RETURN )
+                tapeStatus = 1;
+
+        delete[] subIndex;
+    }
+
+    if( tapeStatus == 1 ) return BT_TRUE;
+    return BT_FALSE;
+}
+
+
+returnValue FunctionEvaluationTree::synchronizeBuffer( int number ){
+
+    int run1;
+
+    if( tapeStatus != 1 || tape.isSynchronized( number ) == BT_TRUE )
+        return SUCCESSFUL_RETURN;
+
+    const int nVars = getNumberOfVariables()+1;
+
+    double *x    = new double[nVars];
+    double *seed = new double[nVars];
+    double *res  = new double[dim+1];
+
+    for( run1 = 0; run1 < nVars; run1++ ){
+        x   [run1] = 0.0;
+        seed[run1] = 0.0;
+    }
+
+    BooleanType hasSeed = tape.getPoint( number, x, seed );
+
+    for( run1 = 0; run1 < n; run1++ )
+        sub[run1]->evaluate( number, x, &x[ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1]) ] );
+    for( run1 = 0; run1 < dim; run1++ )
+        f[run1]->evaluate( number, x, &res[run1] );
+
+    if( hasSeed == BT_TRUE ){
+        for( run1 = 0; run1 < n; run1++ )
+            sub[run1]->AD_forward( number, seed, &seed[ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1]) ] );
+        for( run1 = 0; run1 < dim; run1++ )
+            f[run1]->AD_forward( number, seed, &res[run1] );
+    }
+
+    tape.setSynchronized( number );
+
+    delete[] x   ;
+    delete[] seed;
+    delete[] res ;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
@@ -37,6 +37,7 @@
 #include <acado/symbolic_expression/expression.hpp>
 #include <acado/symbolic_operator/evaluation_template.hpp>
 #include <acado/symbolic_operator/symbolic_index_list.hpp>
+#include <acado/function/function_evaluation_tape.hpp>
 
 BEGIN_NAMESPACE_ACADO
 
@@ -48,6 +49,10 @@ BEGIN_NAMESPACE_ACADO
  *  The class FunctionEvaluationTree is designed to organize the evaluation of
  *  tree structured expressions.
  *
+ *  For the numeric evaluation and first order derivatives, the expressions
+ *  are recorded once on a FunctionEvaluationTape, which is used whenever all
+ *  operators can be recorded. Otherwise the operator trees are evaluated.
+ *
  *	\author Boris Houska, Hans Joachim Ferreau, Milan Vukov
  */
 class FunctionEvaluationTree
@@ -241,6 +246,17 @@ public:
      virtual BooleanType isDependingOn( const Expression     &variable );
 
 
+    /** Determines for each component of the function whether it \n
+     *  structurally depends on (any of) the given variables.     \n
+     *  \return SUCCESSFUL_RETURN                                 \n
+     *
+     */
+     virtual returnValue getDependencyPattern( int           nVars    , /**< number of variables   */
+                                               VariableType *varType  , /**< the variable types    */
+                                               int          *component, /**< and their components  */
+                                               BooleanType  *pattern    /**< the result (dim)      */ );
+
+
     /** Checks whether the symbolic expression is linear in       \n
      *  a specified variable.                                     \n
      *  \return BT_FALSE if no linearity is                       \n
@@ -363,6 +379,41 @@ public:
 
 
 
+    /** Automatic Differentiation in forward mode for a block of  \n
+     *  nDir directions (vector mode), which are propagated in a  \n
+     *  single sweep through the tree. Seeds and derivatives are  \n
+     *  stored contiguously per variable, i.e. the seed of        \n
+     *  variable i in direction j is seed[i*nDir+j] and the       \n
+     *  derivative of component i is df[i*nDir+j].                \n
+     *  This function uses the intermediate                       \n
+     *  results from a buffer.                                    \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NAN                                           \n
+     */
+     virtual returnValue AD_forward( int     number  /**< storage position     */,
+                                     int     nDir    /**< number of directions */,
+                                     double *seed    /**< the seed block       */,
+                                     double *df      /**< the derivative block */  );
+
+
+
+    // IMPORTANT REMARK FOR AD_BACKWARD: run evaluate first to define
+    //                                   the point x and to compute f.
+
+    /** Automatic Differentiation in backward mode for a block of \n
+     *  nDir directions (vector mode) based on buffered values.   \n
+     *  The layout of seed and df is the same as in AD_forward,   \n
+     *  df has to be initialized (usually with zeros).            \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NAN                                           \n
+     */
+     virtual returnValue AD_backward( int     number /**< the buffer position  */,
+                                      int     nDir   /**< number of directions */,
+                                      double *seed   /**< the seed block       */,
+                                      double *df     /**< the derivative block */ );
+
+
+
 
     /** Automatic Differentiation in forward mode for             \n
      *  2nd derivatives.                                          \n
@@ -416,7 +467,8 @@ public:
 
      returnValue exportForwardDeclarations(	std::ostream& stream = std::cout,
 											const char *fcnName = "ACADOfcn",
-											const char *realString = "double"
+											const char *realString = "double",
+											const char *contextParameter = ""
 											) const;
 
      returnValue exportCode(	std::ostream& stream = std::cout,
@@ -429,7 +481,8 @@ public:
 								uint       _numDX = 0,
 								uint       _numOD = 0,
 								bool       allocateMemory = true,
-								bool       staticMemory   = false
+								bool       staticMemory   = false,
+								const char *contextParameter = ""
 								) const;
 
      /** Clears the buffer and resets the buffer size \n
@@ -464,8 +517,51 @@ public:
 
      std::string getGlobalExportVariableName() const;
 
+     /** Returns the number of elements of the auxiliary array of the    \n
+      *  exported code, i.e. the peak number of simultaneously live      \n
+      *  intermediates that are not kept in local variables.             \n
+      */
      unsigned getGlobalExportVariableSize() const;
 
+     /** Enables or disables the run-time compilation of the tape (see  \n
+      *  Function::setJITCompilation).                                  \n
+      */
+     returnValue setJITCompilation( BooleanType useJIT, const std::string& cacheDirectory );
+
+     //
+     // PROTECTED MEMBER FUNCTIONS:
+     //
+protected:
+
+     /** Records the expressions on the tape (if not done yet) and     \n
+      *  returns whether the tape can be used for the evaluation.      \n
+      */
+     BooleanType useTape( );
+
+     /** Restores the buffers of the operators at the given position   \n
+      *  from the tape, as needed for second order derivatives.        \n
+      */
+     returnValue synchronizeBuffer( int number );
+
+     /** Assigns storage to the intermediate expressions for the code     \n
+      *  export, based on a liveness analysis of the intermediate         \n
+      *  sequence: a storage position is reused as soon as the last       \n
+      *  expression that depends on its previous value has been computed. \n
+      *  Short-lived intermediates are kept in local variables, all other \n
+      *  ones in the auxiliary array.                                     \n
+      *                                                                   \n
+      *  \param slot    The storage position of each intermediate.        \n
+      *  \param local   Whether an intermediate is a local variable.      \n
+      *  \param nLocals The number of local variables.                    \n
+      *                                                                   \n
+      *  \return The number of elements of the auxiliary array.           \n
+      */
+     int allocateAuxiliaryVariables(	std::vector< int >&  slot,
+										std::vector< bool >& local,
+										int&                 nLocals
+										) const;
+
+
      //
      // DATA MEMBERS:
      //
@@ -480,6 +576,9 @@ protected:
 
      Expression           safeCopy ;
 
+     FunctionEvaluationTape tape    ;   /**< The instruction tape of the expressions */
+     int                  tapeStatus;   /**< 0: not recorded, 1: recorded, -1: not supported */
+
      /** Name of the variable that holds intermediate expressions. */
      std::string		globalExportVariableName;
 };
@@ -42,6 +42,7 @@
 #include <acado/integrator/integrator_runge_kutta45.hpp>
 #include <acado/integrator/integrator_runge_kutta78.hpp>
 #include <acado/integrator/integrator_bdf.hpp>
+#include <acado/clock/runtime_profiler.hpp>
 
 using namespace std;
 
@@ -279,8 +280,12 @@ returnValue Integrator::integrate(	const Grid   &t_  ,
 // 	tmpX.print( "integrator x0" );
 // 	u.print( "integrator u0" );
 // 	p.print( "integrator p0" );
+    double profilerStart = RuntimeProfiler::instance().tic();
+
     returnvalue = evaluate( tmpX, xa, p, u, w, t_ );
 
+    RuntimeProfiler::instance().toc( PP_INTEGRATION, profilerStart );
+
     if( returnvalue != SUCCESSFUL_RETURN )
         return returnvalue;
 
@@ -373,8 +378,12 @@ returnValue Integrator::integrateSensitivities( ){
         if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR(returnvalue);
     }
 
+    double profilerStart = RuntimeProfiler::instance().tic();
+
     returnvalue = evaluateSensitivities();
 
+    RuntimeProfiler::instance().toc( PP_INTEGRATION, profilerStart );
+
     if( returnvalue != SUCCESSFUL_RETURN ) return ACADOERROR(returnvalue);
 
 
@@ -36,6 +36,7 @@
 #include <acado/symbolic_expression/symbolic_expression.hpp>
 #include <acado/function/function_.hpp>
 #include <acado/integrator/integrator.hpp>
+#include <acado/bindings/acado_csparse/acado_csparse.hpp>
 
 using namespace std;
 
@@ -197,6 +198,7 @@ void IntegratorBDF::allocateMemory( ){
 
 
     iseed = new double[ndir];
+    jseed = new double[ndir*m];
 
     x     = new double [ndir];
 
@@ -204,6 +206,8 @@ void IntegratorBDF::allocateMemory( ){
         x[run1]     = 0.0;
         iseed[run1] = 0.0;
     }
+    for( run1 = 0; run1 < ndir*m; run1++ )
+        jseed[run1] = 0.0;
 
     t = 0.0;
 
@@ -248,7 +252,7 @@ void IntegratorBDF::allocateMemory( ){
 
     maxNM = 1;
     M     = (DMatrix**)calloc(maxNM,sizeof(DMatrix*));
-//    qr.resize( maxNM );
+    clearDecompositions();
     M_index   = (int*)calloc(maxNM,sizeof(int));
 
     M_index[0] = 0;
@@ -418,7 +422,7 @@ void IntegratorBDF::initializeVariables(){
 
     k = 0; k2 = 0; l = 0; l2 = 0;
 
-    iseed = 0; nstep = 0; psi   = 0;
+    iseed = 0; jseed = 0; nstep = 0; psi   = 0;
     psi_  = 0; gamma = 0; eta   = 0;
     eta2  = 0; x     = 0; t     = 0;
 
@@ -529,6 +533,7 @@ void IntegratorBDF::constructAll( const IntegratorBDF& arg ){
     }
 
     iseed = new double[ndir];
+    jseed = new double[ndir*m];
 
     x     = new double [ndir];
 
@@ -536,6 +541,8 @@ void IntegratorBDF::constructAll( const IntegratorBDF& arg ){
         x[run1]     = 0.0;
         iseed[run1] = 0.0;
     }
+    for( run1 = 0; run1 < ndir*m; run1++ )
+        jseed[run1] = 0.0;
 
     t     = 0.0;
 
@@ -581,6 +588,7 @@ void IntegratorBDF::constructAll( const IntegratorBDF& arg ){
 
     maxNM = 1;
     M     = (DMatrix**)calloc(maxNM,sizeof(DMatrix*));
+    clearDecompositions();
     M_index   = (int*)calloc(maxNM,sizeof(int));
 
     M_index[0] = 0;
@@ -589,6 +597,10 @@ void IntegratorBDF::constructAll( const IntegratorBDF& arg ){
 
     las = arg.las;
 
+    jacRowIdx = arg.jacRowIdx;
+    jacColIdx = arg.jacColIdx;
+    jacValues = arg.jacValues;
+
     for( run1 = 0; run1 < 4; run1++ ){
         eta [run1] = new double[m];
         eta2[run1] = new double[m];
@@ -876,6 +888,10 @@ void IntegratorBDF::deleteAll(){
         delete[] iseed;
     }
 
+    if( jseed != NULL ){
+        delete[] jseed;
+    }
+
     if( x != NULL )
         delete[] x;
 
@@ -925,6 +941,11 @@ void IntegratorBDF::deleteAll(){
         free(M);
         free(M_index);
     }
+    clearDecompositions();
+
+    jacRowIdx.clear();
+    jacColIdx.clear();
+    jacValues.clear();
 
     if( F != NULL )
         delete[] F;
@@ -1099,6 +1120,7 @@ returnValue IntegratorBDF::unfreeze(){
     maxNM = 1;
     nOfM  = 0;
     M       = (DMatrix**)realloc(M,maxNM*sizeof(DMatrix*));
+    clearDecompositions();
     M_index = (int*)realloc(M_index,maxAlloc*sizeof(int));
 
     h = (double*)realloc(h,maxAlloc*sizeof(double));
@@ -2416,31 +2438,25 @@ returnValue IntegratorBDF::determineCorrector( int stepnumber, BooleanType ini )
                M[0]->init(m,m);
            }
 
+           // all m columns are computed in one vector-mode AD sweep:
            for( run1 = 0; run1 < md; run1++ ){
-               iseed[ddiff_index[run1]] = gamma[stepnumber][4];
-               iseed[ diff_index[run1]] = 1.0;
-               if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, iseed,
-                                      k2[0][0] ) != SUCCESSFUL_RETURN ){
-                  return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-               }
-               for( run2 = 0; run2 < m; run2++ )
-                   M[M_index[stepnumber]]->operator()(run2,run1) = k2[0][0][run2];
-
-               iseed[ddiff_index[run1]] = 0.0;
-               iseed[ diff_index[run1]] = 0.0;
+               jseed[ddiff_index[run1]*m+run1] = gamma[stepnumber][4];
+               jseed[ diff_index[run1]*m+run1] = 1.0;
            }
+           for( run1 = 0; run1 < ma; run1++ )
+               jseed[diff_index[md+run1]*m+md+run1] = 1.0;
 
-           for( run1 = 0; run1 < ma; run1++ ){
-               iseed[ diff_index[md+run1]] = 1.0;
-               if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, iseed,
-                                        k2[0][0] ) != SUCCESSFUL_RETURN ){
-                  return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-               }
-               for( run2 = 0; run2 < m; run2++ )
-                   M[M_index[stepnumber]]->operator()(run2,md+run1) = k2[0][0][run2];
+           if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, m, jseed,
+                                  M[M_index[stepnumber]]->data() ) != SUCCESSFUL_RETURN ){
+              return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
+           }
 
-               iseed[diff_index[md+run1]] = 0.0;
+           for( run1 = 0; run1 < md; run1++ ){
+               jseed[ddiff_index[run1]*m+run1] = 0.0;
+               jseed[ diff_index[run1]*m+run1] = 0.0;
            }
+           for( run1 = 0; run1 < ma; run1++ )
+               jseed[diff_index[md+run1]*m+md+run1] = 0.0;
 
            nJacEvaluations++;
            jacComputation.stop();
@@ -2461,6 +2477,9 @@ returnValue IntegratorBDF::determineCorrector( int stepnumber, BooleanType ini )
                                *M[M_index[stepnumber]],
                                 F );
 
+       if( norm1 < 0.0 )
+           return ACADOERROR(RET_THE_DAE_INDEX_IS_TOO_LARGE);
+
        if( soa == SOA_MESH_FROZEN || soa == SOA_EVERYTHING_FROZEN ){
            if( newtonsteps == nOfNewtonSteps[stepnumber] ){
                return SUCCESSFUL_RETURN;
@@ -2924,32 +2943,25 @@ returnValue IntegratorBDF::rk_start_solve( int stepnumber ){
                M[0]->init(m,m);
            }
 
+           // all m columns are computed in one vector-mode AD sweep:
            for( run1 = 0; run1 < md; run1++ ){
-               iseed[ddiff_index[run1]] = 1.0;
-               iseed[ diff_index[run1]] = ise;
-               if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, iseed,
-                                      k2[0][0] ) != SUCCESSFUL_RETURN ){
-                  return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-               }
-
-               for( run2 = 0; run2 < m; run2++ )
-                   M[M_index[stepnumber]]->operator()(run2,run1) = k2[0][0][run2];
-
-               iseed[ddiff_index[run1]] = 0.0;
-               iseed[ diff_index[run1]] = 0.0;
+               jseed[ddiff_index[run1]*m+run1] = 1.0;
+               jseed[ diff_index[run1]*m+run1] = ise;
            }
-           for( run1 = 0; run1 < ma; run1++ ){
-               iseed[ diff_index[md+run1]] = 1.0;
-               if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, iseed,
-                                      k2[0][0] ) != SUCCESSFUL_RETURN ){
-                  return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-               }
+           for( run1 = 0; run1 < ma; run1++ )
+               jseed[diff_index[md+run1]*m+md+run1] = 1.0;
 
-               for( run2 = 0; run2 < m; run2++ )
-                   M[M_index[stepnumber]]->operator()(run2,md+run1) = k2[0][0][run2];
+           if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, m, jseed,
+                                  M[M_index[stepnumber]]->data() ) != SUCCESSFUL_RETURN ){
+              return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
+           }
 
-               iseed[diff_index[md+run1]] = 0.0;
+           for( run1 = 0; run1 < md; run1++ ){
+               jseed[ddiff_index[run1]*m+run1] = 0.0;
+               jseed[ diff_index[run1]*m+run1] = 0.0;
            }
+           for( run1 = 0; run1 < ma; run1++ )
+               jseed[diff_index[md+run1]*m+md+run1] = 0.0;
 
            nJacEvaluations++;
            jacComputation.stop();
@@ -2970,6 +2982,9 @@ returnValue IntegratorBDF::rk_start_solve( int stepnumber ){
                                *M[M_index[stepnumber]],
                                 F );
 
+       if( norm1 < 0.0 )
+           return ACADOERROR(RET_THE_DAE_INDEX_IS_TOO_LARGE);
+
        if( soa == SOA_MESH_FROZEN || soa == SOA_EVERYTHING_FROZEN ){
            if( newtonsteps == nOfNewtonSteps[stepnumber] ){
                return SUCCESSFUL_RETURN;
@@ -5111,23 +5126,55 @@ void IntegratorBDF::printRKIntermediateResults(){
 }
 
 
-returnValue IntegratorBDF::decomposeJacobian(int index, DMatrix &J){
+returnValue IntegratorBDF::decomposeJacobian(int index, const DMatrix &J){
 
-//	ACADOFATAL(  RET_NOT_IMPLEMENTED_YET );
+    int run1;
+
+    ASSERT( index >= 0 );
 
     switch( las ){
 
         case HOUSEHOLDER_METHOD:
-//        	ACADOFATAL(  RET_NOT_IMPLEMENTED_YET );
+        	if( index >= (int)qr.size() )
+        		qr.resize( index+1 );
+        	qr[ index ].compute( J );
+        	break;
+
+        case GAUSS_LU:
+        	if( index >= (int)lu.size() )
+        		lu.resize( index+1 );
+        	lu[ index ].compute( J );
         	break;
-//        	ASSERT( index < qr.size() );
-//        	qr[ index ] = Eigen::HouseholderQR< DMatrix::Base >( J );
-//        	return SUCCESSFUL_RETURN;
 
         case SPARSE_LU:
-        		ACADOFATAL(  RET_NOT_IMPLEMENTED_YET );
-        		break;
-//             return J.computeSparseLUdecomposition();
+        	if( jacRowIdx.empty() == true )
+        		setupSparsityPattern();
+
+        	if( index >= (int)sparseLU.size() )
+        		sparseLU.resize( index+1, 0 );
+
+        	if( sparseLU[ index ] == 0 ){
+        		// all Jacobians share the same sparsity pattern, hence
+        		// the symbolic analysis of the first one is reused
+        		if( sparseLU[ 0 ] != 0 ){
+        			sparseLU[ index ] = sparseLU[ 0 ]->clone();
+        		}
+        		else{
+        			sparseLU[ index ] = new ACADOcsparse();
+        			sparseLU[ index ]->setDimension( m );
+        			sparseLU[ index ]->setNumberOfEntries( (int)jacRowIdx.size() );
+        			sparseLU[ index ]->setIndices( &jacRowIdx[0], &jacColIdx[0] );
+        			sparseLU[ index ]->setTolerance( 1.0 );
+        			sparseLU[ index ]->setPrintLevel( NONE );
+        		}
+        	}
+
+        	for( run1 = 0; run1 < (int)jacRowIdx.size(); run1++ )
+        		jacValues[run1] = J( jacRowIdx[run1], jacColIdx[run1] );
+
+        	if( sparseLU[ index ]->setMatrix( &jacValues[0] ) != SUCCESSFUL_RETURN )
+        		return RET_THE_DAE_INDEX_IS_TOO_LARGE;
+        	break;
 
         default:
              return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
@@ -5137,21 +5184,109 @@ returnValue IntegratorBDF::decomposeJacobian(int index, DMatrix &J){
 }
 
 
+BooleanType IntegratorBDF::isDecomposed( int index ) const{
+
+    switch( las ){
+
+        case HOUSEHOLDER_METHOD:
+             return ( index < (int)qr.size() && qr[ index ].rows() == m ) ? BT_TRUE : BT_FALSE;
+
+        case GAUSS_LU:
+             return ( index < (int)lu.size() && lu[ index ].rows() == m ) ? BT_TRUE : BT_FALSE;
+
+        case SPARSE_LU:
+             return ( index < (int)sparseLU.size() && sparseLU[ index ] != 0 ) ? BT_TRUE : BT_FALSE;
+
+        default:
+             return BT_FALSE;
+    }
+}
+
+
+void IntegratorBDF::clearDecompositions(){
+
+    unsigned run1;
+
+    for( run1 = 0; run1 < sparseLU.size(); run1++ )
+        if( sparseLU[run1] != 0 )
+            delete sparseLU[run1];
+
+    qr.clear();
+    lu.clear();
+    sparseLU.clear();
+}
+
+
+returnValue IntegratorBDF::setupSparsityPattern(){
+
+    int run1, run2;
+
+    VariableType varType  [2];
+    int          component[2];
+    BooleanType *dep = new BooleanType[m];
+
+    DVector stateComponents = rhs->getDifferentialStateComponents();
+
+    jacRowIdx.clear();
+    jacColIdx.clear();
+
+    // the column run1 of the iteration matrix collects the derivatives
+    // w.r.t. the differential state and its time derivative (or w.r.t.
+    // the algebraic state, respectively):
+    for( run1 = 0; run1 < m; run1++ ){
+
+        if( run1 < md ){
+            varType  [0] = VT_DIFFERENTIAL_STATE ;
+            component[0] = (int)stateComponents(run1);
+            varType  [1] = VT_DDIFFERENTIAL_STATE;
+            component[1] = run1;
+            rhs->getDependencyPattern( 2, varType, component, dep );
+        }
+        else{
+            varType  [0] = VT_ALGEBRAIC_STATE;
+            component[0] = run1-md;
+            rhs->getDependencyPattern( 1, varType, component, dep );
+        }
+
+        for( run2 = 0; run2 < m; run2++ ){
+            if( dep[run2] == BT_TRUE ){
+                jacRowIdx.push_back( run2 );
+                jacColIdx.push_back( run1 );
+            }
+        }
+    }
+    jacValues.resize( jacRowIdx.size() );
+
+    delete[] dep;
+    return SUCCESSFUL_RETURN;
+}
+
+
 double IntegratorBDF::applyNewtonStep( int index, double *etakplus1, const double *etak, const DMatrix &J, const double *FFF ){
 
     int run1;
     DVector bb(m,FFF);
     DVector deltaX;
 
+    // The factorization is computed once per Jacobian evaluation in
+    // decomposeJacobian; only refactorize if the cache has been invalidated.
+    if( isDecomposed( index ) == BT_FALSE && ( las == HOUSEHOLDER_METHOD || las == GAUSS_LU || las == SPARSE_LU ) )
+        decomposeJacobian( index, J );
+
 	switch (las)
 	{
 	case HOUSEHOLDER_METHOD:
-		deltaX = J.householderQr().solve( bb );
-//		deltaX = qr[ index ].solve(bb);
+		deltaX = qr[ index ].solve( bb );
+		break;
+	case GAUSS_LU:
+		deltaX = lu[ index ].solve( bb );
 		break;
 	case SPARSE_LU:
-		ACADOFATAL(  RET_NOT_IMPLEMENTED_YET );
-//		deltaX = J.solveSparseLU(bb);
+		deltaX = bb;
+		if( sparseLU[ index ]->solve( deltaX.data() ) != SUCCESSFUL_RETURN ){
+			ACADOERROR( RET_THE_DAE_INDEX_IS_TOO_LARGE );
+			return -1.0;
+		}
 		break;
 	default:
 		deltaX.setZero();
@@ -5175,18 +5310,28 @@ void IntegratorBDF::applyMTranspose( int index, double *seed1, DMatrix &J, doubl
 
     DVector deltaX;
 
+    if( isDecomposed( index ) == BT_FALSE && ( las == HOUSEHOLDER_METHOD || las == GAUSS_LU || las == SPARSE_LU ) )
+        decomposeJacobian( index, J );
+
 	switch (las)
 	{
 	case HOUSEHOLDER_METHOD:
-		// Dodgy
-		deltaX = J.transpose().householderQr().solve( bb );
-//		deltaX = J.solveTransposeQR(bb);
-//		deltaX = qr[ index ].matrixQR().block(0, 0, J.cols(), J.cols()).
-//			triangularView<Eigen::Upper>().transpose().solve( bb );
+		// J^T = R^T Q^T  =>  x = Q R^{-T} b
+		deltaX = qr[ index ].householderQ() *
+			( qr[ index ].matrixQR().triangularView<Eigen::Upper>().transpose().solve( bb ) );
+		break;
+	case GAUSS_LU:
+		// J^T = U^T L^T P  =>  x = P^T L^{-T} U^{-T} b
+		deltaX = lu[ index ].permutationP().transpose() *
+			( lu[ index ].matrixLU().triangularView<Eigen::UnitLower>().transpose().solve(
+				lu[ index ].matrixLU().triangularView<Eigen::Upper>().transpose().solve( bb ) ) );
 		break;
 	case SPARSE_LU:
-		ACADOFATAL(  RET_NOT_IMPLEMENTED_YET );
-//		deltaX = J.solveTransposeSparseLU(bb);
+		deltaX = bb;
+		if( sparseLU[ index ]->solveTranspose( deltaX.data() ) != SUCCESSFUL_RETURN ){
+			ACADOERROR( RET_THE_DAE_INDEX_IS_TOO_LARGE );
+			deltaX.setZero();
+		}
 		break;
 	default:
 		ACADOFATAL(  RET_NOT_IMPLEMENTED_YET );
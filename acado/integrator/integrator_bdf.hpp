@@ -376,15 +376,36 @@ protected:
     void printRKIntermediateResults();
 
 
-    /** Decomposes the Jacobian J.               \n
+    /** Decomposes the Jacobian J and stores the factorization in the   \n
+     *  cache slot "index" (QR or LU, depending on the linear algebra    \n
+     *  solver option).                                                  \n
      *  \return SUCCESSFUL_RETURN                \n
      *          RET_THE_DAE_INDEX_IS_TOO_LARGE   \n
      */
-    returnValue decomposeJacobian(int index, DMatrix &J );
+    returnValue decomposeJacobian(int index, const DMatrix &J );
+
+
+    /** Returns whether a factorization is cached for the given index.   \n
+     *  \return BT_TRUE iff the cache slot holds a valid factorization   \n
+     */
+    BooleanType isDecomposed( int index ) const;
+
+
+    /** Frees all cached factorizations of the Jacobians.                \n
+     */
+    void clearDecompositions();
+
+
+    /** Determines the structural sparsity pattern of the iteration      \n
+     *  matrix from the symbolic right-hand side (needed for SPARSE_LU). \n
+     *  \return SUCCESSFUL_RETURN                                        \n
+     */
+    returnValue setupSparsityPattern();
 
 
     /** applies a newton step                                              \n
-     *  \return the norm of the increment                                  \n
+     *  \return the norm of the increment, or a negative value if the     \n
+     *          linear solve failed                                       \n
      */
     double applyNewtonStep( int index, double *etakplus1, const double *etak, const DMatrix &J, const double *FFF );
 
@@ -531,6 +552,7 @@ protected:
     double ***l                ;  /**< the intermediate results                           */
     double ***l2               ;  /**< the intermediate results                           */
     double   *iseed            ;  /**< the intermediate seeds                             */
+    double   *jseed            ;  /**< the seed block for the Jacobian (vector-mode AD)   */
 
 
     // BDF-METHOD:
@@ -547,7 +569,12 @@ protected:
                                   *   polynom.                                            */
 
     DMatrix **M                 ; /**< the Jacobians for Newton's method                   */
-//    std::vector< Eigen::HouseholderQR< DMatrix::Base > > qr;
+    std::vector< Eigen::HouseholderQR< DMatrix::Base > > qr; /**< cached QR factorizations of M (keyed by M_index) */
+    std::vector< Eigen::PartialPivLU< DMatrix::Base > > lu; /**< cached LU factorizations of M (keyed by M_index) */
+    std::vector< SparseSolver* > sparseLU; /**< cached sparse LU factorizations of M (keyed by M_index) */
+    std::vector< int >    jacRowIdx  ; /**< row indices of the structural non-zeros of M       */
+    std::vector< int >    jacColIdx  ; /**< column indices of the structural non-zeros of M    */
+    std::vector< double > jacValues  ; /**< the values of the structural non-zeros of M        */
     int     *M_index           ; /**< the index of the inverse approximation              */
     int      nOfM              ; /**< number of distinct inverse Jacobian approximations  */
     int      maxNM             ; /**< number of allocated Jacobian storage positions      */
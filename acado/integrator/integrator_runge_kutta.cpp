@@ -135,6 +135,7 @@ void IntegratorRK::initializeVariables(){
 
     dim = 0; A = 0; b4 = 0; b5 = 0; c = 0;
     eta4 = 0; eta5 = 0; eta4_ = 0; eta5_ = 0;
+    etaG_ = 0; etaG3_ = 0;
     k = 0; k2 = 0; l = 0; l2 = 0; x = 0;
 
     G = 0; etaG = 0;
@@ -174,6 +175,8 @@ void IntegratorRK::allocateMemory( ){
     eta5  = new double [m];
     eta4_ = new double [m];
     eta5_ = new double [m];
+    etaG_ = new double [m];
+    etaG3_= new double [m];
 
     for( run1 = 0; run1 < m; run1++ ){
 
@@ -320,6 +323,12 @@ void IntegratorRK::deleteAll(){
     if( eta5_ != NULL ){
         delete[] eta5_;
     }
+    if( etaG_ != NULL ){
+        delete[] etaG_;
+    }
+    if( etaG3_ != NULL ){
+        delete[] etaG3_;
+    }
 
     for( run1 = 0; run1 < dim; run1++ ){
       if( k[run1]  != NULL )
@@ -450,6 +459,8 @@ void IntegratorRK::constructAll( const IntegratorRK& arg ){
     eta5  = new double [m];
     eta4_ = new double [m];
     eta5_ = new double [m];
+    etaG_ = new double [m];
+    etaG3_= new double [m];
 
     for( run1 = 0; run1 < m; run1++ ){
 
@@ -1272,10 +1283,6 @@ returnValue IntegratorRK::step(int number_){
     // PROCEED IF THE STEP IS ACCEPTED:
     // --------------------------------
 
-       double *etaG_  = new double[m];
-       double *etaG3_ = new double[m];
-
-
      // compute forward derivatives if requested:
      // ------------------------------------------
 
@@ -1379,9 +1386,6 @@ returnValue IntegratorRK::step(int number_){
              iStore( jj, run1 ) = x[rhs->index( VT_INTERMEDIATE_STATE, run1 )];
      }
 
-     delete[] etaG_ ;
-     delete[] etaG3_;
-
 
      if( nBDirs == 0 || nBDirs2 == 0 ){
 
@@ -445,6 +445,8 @@ protected:
     double  *eta5              ;  /**< the result of order 5                              */
     double  *eta4_             ;  /**< the result of order 4                              */
     double  *eta5_             ;  /**< the result of order 5                              */
+    double  *etaG_             ;  /**< the forward sensitivities of the last step         */
+    double  *etaG3_            ;  /**< the 2nd order sensitivities of the last step       */
     double **k                 ;  /**< the intermediate results                           */
     double **k2                ;  /**< the intermediate results                           */
     double **l                 ;  /**< the intermediate results                           */
@@ -67,18 +67,32 @@ returnValue BlockMatrix::init( uint _nRows, uint _nCols )
 	nRows = _nRows;
 	nCols = _nCols;
 
-	vector< DMatrix > foo(nCols, DMatrix());
-	for (unsigned row = 0; row < nRows; ++row)
-		elements.push_back( foo );
-
-	vector< SubBlockMatrixType > bar(nCols, SBMT_ZERO);
-	for (unsigned row = 0; row < nRows; ++row)
-		types.push_back( bar );
+	// re-initialization must not keep the rows of the previous dimension
+	elements.assign(nRows, vector< DMatrix >(nCols, DMatrix()));
+	types.assign(nRows, vector< SubBlockMatrixType >(nCols, SBMT_ZERO));
 
 	return SUCCESSFUL_RETURN;
 }
 
 
+returnValue BlockMatrix::reset( uint _nRows, uint _nCols )
+{
+	if ( ( nRows != _nRows ) || ( nCols != _nCols ) )
+		return init( _nRows,_nCols );
+
+	return setZero( );
+}
+
+
+void BlockMatrix::releaseZeroBlocks( )
+{
+	for( uint i = 0; i < nRows; i++ )
+		for( uint j = 0; j < nCols; j++ )
+			if( types[i][j] == SBMT_ZERO )
+				elements[i][j].resize( 0,0 );
+}
+
+
 BlockMatrix BlockMatrix::operator+( const BlockMatrix& arg ) const{
 
 	ASSERT( ( getNumRows( ) == arg.getNumRows( ) ) && ( getNumCols( ) == arg.getNumCols( ) ) );
@@ -138,39 +152,50 @@ BlockMatrix& BlockMatrix::operator+=( const BlockMatrix& arg ){
 
 BlockMatrix BlockMatrix::operator-( const BlockMatrix& arg ) const{
 
+    BlockMatrix tmp;
+    subtract( arg,tmp );
+
+    return tmp;
+}
+
+
+returnValue BlockMatrix::subtract( const BlockMatrix& arg, BlockMatrix& result ) const{
+
     ASSERT( ( getNumRows( ) == arg.getNumRows( ) ) && ( getNumCols( ) == arg.getNumCols( ) ) );
+    ASSERT( ( &result != this ) && ( &result != &arg ) );
 
     uint i,j;
 
-    BlockMatrix tmp( getNumRows(), getNumCols() );
+    result.reset( getNumRows(), getNumCols() );
 
     for( i=0; i < getNumRows(); i++ ){
         for( j=0; j < getNumCols(); j++ ){
 
             if( arg.types[i][j] == SBMT_ZERO ){
 
-                tmp.types    [i][j] = types    [i][j];
-                tmp.elements [i][j] = elements [i][j];
+                result.types    [i][j] = types    [i][j];
+                result.elements [i][j] = elements [i][j];
             }
             else{
                 if( types[i][j] != SBMT_ZERO ){
 
-                   tmp.types    [i][j]  = SBMT_DENSE;
-                   tmp.elements [i][j]  = elements [i][j] - arg.elements[i][j];
+                   result.types    [i][j]  = SBMT_DENSE;
+                   result.elements [i][j]  = elements [i][j];
+                   result.elements [i][j] -= arg.elements[i][j];
                 }
                 else{
 
-                   DMatrix nn(arg.elements[i][j].getNumRows(),arg.elements[i][j].getNumCols());
-                   nn.setZero();
+                   result.elements [i][j].resize( arg.elements[i][j].getNumRows(),arg.elements[i][j].getNumCols() );
+                   result.elements [i][j].setZero();
 
-                   tmp.types    [i][j]  = SBMT_DENSE;
-                   tmp.elements [i][j]  = nn - arg.elements[i][j];
+                   result.types    [i][j]  = SBMT_DENSE;
+                   result.elements [i][j] -= arg.elements[i][j];
                 }
             }
         }
     }
 
-    return tmp;
+    return SUCCESSFUL_RETURN;
 }
 
 BlockMatrix BlockMatrix::operator*=( double scalar ){
@@ -191,13 +216,32 @@ BlockMatrix BlockMatrix::operator*=( double scalar ){
 
 BlockMatrix BlockMatrix::operator*( const BlockMatrix& arg ) const{
 
+    BlockMatrix result;
+    multiply( arg,result );
+
+    return result;
+}
+
+
+BlockMatrix BlockMatrix::operator^( const BlockMatrix& arg ) const{
+
+    BlockMatrix result;
+    multiplyTransposed( arg,result );
+
+    return result;
+}
+
+
+returnValue BlockMatrix::multiply( const BlockMatrix& arg, BlockMatrix& result ) const{
+
     ASSERT( getNumCols( ) == arg.getNumRows( ) );
+    ASSERT( ( &result != this ) && ( &result != &arg ) );
 
     uint i,j,k;
 
     uint newNumRows = getNumRows( );
     uint newNumCols = arg.getNumCols( );
-    BlockMatrix result( newNumRows,newNumCols );
+    result.reset( newNumRows,newNumCols );
 
     for( i=0; i<newNumRows; ++i ){
         for( k=0; k<getNumCols( ); ++k ){
@@ -211,8 +255,8 @@ BlockMatrix BlockMatrix::operator*( const BlockMatrix& arg ) const{
                         if( arg.types[k][j] == SBMT_DENSE ){
 
                             if( result.types[i][j] != SBMT_ZERO )
-                                  result.elements[i][j] += elements[i][k] * arg.elements[k][j];
-                            else  result.elements[i][j]  = elements[i][k] * arg.elements[k][j];
+                                  result.elements[i][j].noalias() += elements[i][k] * arg.elements[k][j];
+                            else  result.elements[i][j].noalias()  = elements[i][k] * arg.elements[k][j];
                         }
 
                         if( arg.types[k][j] == SBMT_ONE ){
@@ -265,19 +309,23 @@ BlockMatrix BlockMatrix::operator*( const BlockMatrix& arg ) const{
         }
     }
 
-    return result;
+    // zero blocks of the result do not keep the storage of earlier products
+    result.releaseZeroBlocks( );
+
+    return SUCCESSFUL_RETURN;
 }
 
 
-BlockMatrix BlockMatrix::operator^( const BlockMatrix& arg ) const{
+returnValue BlockMatrix::multiplyTransposed( const BlockMatrix& arg, BlockMatrix& result ) const{
 
 	ASSERT( getNumRows( ) == arg.getNumRows( ) );
+	ASSERT( ( &result != this ) && ( &result != &arg ) );
 
 	uint i,j,k;
 
 	uint newNumRows = getNumCols( );
 	uint newNumCols = arg.getNumCols( );
-	BlockMatrix result( newNumRows,newNumCols );
+	result.reset( newNumRows,newNumCols );
 
     for( i=0; i<newNumRows; ++i ){
         for( k=0; k<getNumRows( ); ++k ){
@@ -290,8 +338,8 @@ BlockMatrix BlockMatrix::operator^( const BlockMatrix& arg ) const{
 
                         if( arg.types[k][j] == SBMT_DENSE ){
                             if( result.types[i][j] != SBMT_ZERO )
-                                  result.elements[i][j] += elements[k][i].transpose() * arg.elements[k][j];
-                            else  result.elements[i][j]  = elements[k][i].transpose() * arg.elements[k][j];
+                                  result.elements[i][j].noalias() += elements[k][i].transpose() * arg.elements[k][j];
+                            else  result.elements[i][j].noalias()  = elements[k][i].transpose() * arg.elements[k][j];
                         }
 
                         if( arg.types[k][j] == SBMT_ONE ){
@@ -339,7 +387,10 @@ BlockMatrix BlockMatrix::operator^( const BlockMatrix& arg ) const{
             }
         }
     }
-	return result;
+	// zero blocks of the result do not keep the storage of earlier products
+	result.releaseZeroBlocks( );
+
+	return SUCCESSFUL_RETURN;
 }
 
 
@@ -455,6 +506,19 @@ returnValue BlockMatrix::setDense( uint rowIdx, uint colIdx, const DMatrix& valu
 }
 
 
+returnValue BlockMatrix::setDense( uint rowIdx, uint colIdx, const DVector& value, uint offset, uint n ){
+
+	ASSERT( offset+n <= value.getDim( ) );
+
+    DMatrix& block = getDense( rowIdx,colIdx,n,1 );
+
+    for( uint i = 0; i < n; i++ )
+        block(i,0) = value(offset+i);
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue BlockMatrix::addDense( uint rowIdx, uint colIdx, const DMatrix& value ){
 
 	ASSERT( rowIdx < getNumRows( ) );
@@ -493,6 +557,48 @@ returnValue BlockMatrix::getSubBlock( uint rowIdx, uint colIdx,
     return SUCCESSFUL_RETURN;
 }
 
+
+returnValue BlockMatrix::copySubBlock( uint rowIdx, uint colIdx, uint nR, uint nC,
+                                       DMatrix &value, uint rowOffset, uint colOffset )  const{
+
+    ASSERT( rowIdx < getNumRows( ) );
+    ASSERT( colIdx < getNumCols( ) );
+    ASSERT( ( rowOffset+nR <= value.getNumRows( ) ) && ( colOffset+nC <= value.getNumCols( ) ) );
+
+    if( types[rowIdx][colIdx] != SBMT_ZERO ){
+
+        ASSERT( nR == elements[rowIdx][colIdx].getNumRows( ) );
+        ASSERT( nC == elements[rowIdx][colIdx].getNumCols( ) );
+
+        value.block( rowOffset,colOffset,nR,nC ) = elements[rowIdx][colIdx];
+    }
+    else
+        value.block( rowOffset,colOffset,nR,nC ).setZero();
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue BlockMatrix::copySubBlock( uint rowIdx, uint colIdx, uint n,
+                                       DVector &value, uint offset )  const{
+
+    ASSERT( rowIdx < getNumRows( ) );
+    ASSERT( colIdx < getNumCols( ) );
+    ASSERT( offset+n <= value.getDim( ) );
+
+    if( types[rowIdx][colIdx] != SBMT_ZERO ){
+
+        ASSERT( n == elements[rowIdx][colIdx].getDim( ) );
+
+        // a single row or column is stored contiguously
+        value.segment( offset,n ) = Eigen::Map< const Eigen::Matrix< double,Eigen::Dynamic,1 > >( elements[rowIdx][colIdx].data( ),n );
+    }
+    else
+        value.segment( offset,n ).setZero();
+
+    return SUCCESSFUL_RETURN;
+}
+
 CLOSE_NAMESPACE_ACADO
 
 /*
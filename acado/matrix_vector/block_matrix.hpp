@@ -70,21 +70,47 @@ class BlockMatrix
         /** Destructor. */
         virtual ~BlockMatrix( );
 
-        /** Initializer */
+        /** Initializer, all components are set to zero blocks of size 0 x 0. */
 		returnValue init( uint _nRows, uint _nCols );
 
+        /** Initializer, all components are set to zero blocks. Unlike init(), the
+		 *  storage of the components is kept if the dimensions do not change.
+		 *  \return SUCCESSFUL_RETURN */
+		returnValue reset( uint _nRows, uint _nCols );
+
 		/** Set method that defines the value of a certain component.
 		 *  \return SUCCESSFUL_RETURN */
 		returnValue setDense( uint           rowIdx, /**< Row index of the component.    */
                               uint           colIdx, /**< Column index of the component. */
                               const DMatrix&  value );
 
+		/** Set method that defines a certain component as the column given by a
+		 *  segment of a vector; the storage of the component is reused if it has
+		 *  this size already.
+		 *  \return SUCCESSFUL_RETURN */
+		returnValue setDense( uint           rowIdx, /**< Row index of the component.    */
+                              uint           colIdx, /**< Column index of the component. */
+                              const DVector& value,  /**< Vector.                        */
+                              uint           offset, /**< First entry of the segment.    */
+                              uint           n       /**< Length of the segment.         */ );
+
 		/** Add method that adds a matrix to a certain component.
 		 *  \return SUCCESSFUL_RETURN */
 		returnValue addDense( uint           rowIdx, /**< Row index of the component.    */
                               uint           colIdx, /**< Column index of the component. */
                               const DMatrix&  value );
 
+		/** Access method that returns a reference to a certain component, which is
+		 *  marked as dense and resized to nR x nC. The storage of the component is
+		 *  reused if it has this size already, i.e. writing through the reference
+		 *  does not allocate memory once the component has been set up.
+		 *  \return Reference to the component
+		 */
+		inline DMatrix& getDense( uint    rowIdx,  /**< Row index of the component.    */
+                                  uint    colIdx,  /**< Column index of the component. */
+                                  uint    nR,      /**< Number of rows.                */
+                                  uint    nC       /**< Number of columns.             */ );
+
 		/** Access method that returns the value of a certain component.
 		 *  \return SUCCESSFUL_RETURN
          */
@@ -92,6 +118,37 @@ class BlockMatrix
                                         uint    colIdx,  /**< Column index of the component. */
                                         DMatrix &value   )  const;
 
+		/** Access method that returns a constant reference to a certain component,
+		 *  i.e. without copying it.
+		 *  \return Reference to the component
+         */
+		inline const DMatrix& getSubBlock(	uint    rowIdx,  /**< Row index of the component.    */
+											uint    colIdx   /**< Column index of the component. */ )  const;
+
+		/** Access method that writes a certain component of a given dimension into
+		 *  the block of a dense matrix starting at (rowOffset, colOffset); zero blocks
+		 *  are written as zeros. Unlike getSubBlock(), it does not allocate memory.
+		 *  \return SUCCESSFUL_RETURN
+         */
+		returnValue copySubBlock(	uint     rowIdx,     /**< Row index of the component.    */
+									uint     colIdx,     /**< Column index of the component. */
+									uint     nR,         /**< Number of rows.                */
+									uint     nC,         /**< Number of columns.             */
+									DMatrix &value,      /**< Dense matrix.                  */
+									uint     rowOffset,  /**< First row of the block.        */
+									uint     colOffset   /**< First column of the block.     */ )  const;
+
+		/** Access method that writes a certain component, which has a single row or
+		 *  column of the given length, into the segment of a vector starting at offset;
+		 *  zero blocks are written as zeros. It does not allocate memory.
+		 *  \return SUCCESSFUL_RETURN
+         */
+		returnValue copySubBlock(	uint     rowIdx,     /**< Row index of the component.    */
+									uint     colIdx,     /**< Column index of the component. */
+									uint     n,          /**< Length of the component.       */
+									DVector &value,      /**< Vector.                        */
+									uint     offset      /**< First entry of the segment.    */ )  const;
+
 		/** Access method that returns the value of a certain component and requiring
          *  a given dimension.
 		 *  \return SUCCESSFUL_RETURN
@@ -129,6 +186,30 @@ class BlockMatrix
 		 *  \return Temporary object containing result of multiplication. */
 		BlockMatrix operator^( const BlockMatrix& arg	/**< Block DMatrix Factor. */ ) const;
 
+		/** Subtracts (element-wise) a matrix from the object and stores the
+		 *  result to a given block matrix, whose storage is reused if its
+		 *  dimensions do not change.
+		 *  \return SUCCESSFUL_RETURN */
+		returnValue subtract(	const BlockMatrix& arg,	/**< Subtrahend. */
+								BlockMatrix& result		/**< Difference. */
+								) const;
+
+		/** Multiplies a matrix from the right to the matrix object and stores
+		 *  the result to a given block matrix, whose storage is reused if its
+		 *  block structure does not change.
+		 *  \return SUCCESSFUL_RETURN */
+		returnValue multiply(	const BlockMatrix& arg,	/**< Block DMatrix Factor. */
+								BlockMatrix& result		/**< Product.             */
+								) const;
+
+		/** Multiplies a matrix from the right to the transposed matrix object and
+		 *  stores the result to a given block matrix, whose storage is reused if its
+		 *  block structure does not change.
+		 *  \return SUCCESSFUL_RETURN */
+		returnValue multiplyTransposed(	const BlockMatrix& arg,	/**< Block DMatrix Factor. */
+										BlockMatrix& result		/**< Product.             */
+										) const;
+
 		/** Returns number of block rows of the block matrix object.
 		 *  \return Number of rows. */
 		inline uint getNumRows( ) const;
@@ -203,6 +284,15 @@ class BlockMatrix
 		returnValue print(	std::ostream& stream = std::cout
 							) const;
 
+    //
+    // PROTECTED MEMBER FUNCTIONS:
+    //
+    protected:
+
+        /** Releases the storage of all components that are zero blocks. */
+        void releaseZeroBlocks( );
+
+
     //
     // DATA MEMBERS:
     //
@@ -40,6 +40,20 @@ BEGIN_NAMESPACE_ACADO
 
 
 
+inline DMatrix& BlockMatrix::getDense( uint rowIdx, uint colIdx, uint nR, uint nC ){
+
+	ASSERT( rowIdx < getNumRows( ) );
+	ASSERT( colIdx < getNumCols( ) );
+
+    if( elements[rowIdx][colIdx].getNumRows() != nR || elements[rowIdx][colIdx].getNumCols() != nC )
+        elements[rowIdx][colIdx].resize( nR, nC );
+
+    types[rowIdx][colIdx] = SBMT_DENSE;
+
+    return elements[rowIdx][colIdx];
+}
+
+
 inline returnValue BlockMatrix::getSubBlock( uint rowIdx, uint colIdx, DMatrix &value )  const{
 
 	ASSERT( rowIdx < getNumRows( ) );
@@ -50,6 +64,15 @@ inline returnValue BlockMatrix::getSubBlock( uint rowIdx, uint colIdx, DMatrix &
 }
 
 
+inline const DMatrix& BlockMatrix::getSubBlock( uint rowIdx, uint colIdx )  const{
+
+	ASSERT( rowIdx < getNumRows( ) );
+	ASSERT( colIdx < getNumCols( ) );
+
+    return elements[rowIdx][colIdx];
+}
+
+
 inline uint BlockMatrix::getNumRows( ) const{
 
 	return nRows;
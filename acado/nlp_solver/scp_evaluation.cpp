@@ -160,6 +160,16 @@ returnValue SCPevaluation::init(	const OCPiterate& iter
 
 returnValue SCPevaluation::evaluate( OCPiterate& iter, BandedCP& cp ){
 
+    // the grid points of the objective and of the path constraints are
+    // evaluated by the same number of threads as the shooting intervals:
+    int numThreads = 1;
+    get( NUM_THREADS, numThreads );
+
+    ACADO_TRY( objective->setNumThreads( numThreads ) );
+    if( constraint != 0 )
+        ACADO_TRY( constraint->setNumThreads( numThreads ) );
+
+
     // EVALUATE THE OBJECTIVE AND CONSTRAINTS:
     // ---------------------------------------
     if( dynamicDiscretization != 0 )
@@ -32,6 +32,7 @@
 
 
 #include <acado/nlp_solver/scp_method.hpp>
+#include <acado/clock/runtime_profiler.hpp>
 #include <iomanip>
 #include <iostream>
 
@@ -126,8 +127,8 @@ SCPmethod::~SCPmethod( )
     if( eval != 0 )
     	delete eval;
 
-	if( scpStep != 0 )
-		delete scpStep;
+    if( scpStep != 0 )
+        delete scpStep;
 
     if( derivativeApproximation != 0 )
 		delete derivativeApproximation;
@@ -209,7 +210,7 @@ returnValue SCPmethod::init(	VariablesGrid* x_init ,
     if( printC == BT_TRUE )
         acadoPrintCopyrightNotice( "SCPmethod -- A Sequential Quadratic Programming Algorithm." );
 
-	iter.init( x_init, xa_init, p_init, u_init, w_init );
+    iter.init( x_init, xa_init, p_init, u_init, w_init );
 
 // 	iter.print(); // already here different!!
 
@@ -333,6 +334,9 @@ returnValue SCPmethod::feedbackStep(	const DVector& x0_,
 
 	clockTotalTime.reset( );
 	clockTotalTime.start( );
+
+	// all measurements until the next feedback step belong to this iteration
+	RuntimeProfiler::instance().setIteration( numberOfSteps );
 	
 	status = BS_RUNNING;
 	hasPerformedStep = BT_FALSE;
@@ -419,10 +423,14 @@ returnValue SCPmethod::performCurrentStep( )
 	(iter.u->getVector(1)).print("iter.u(1)");*/
 	#endif
 
+	double profilerStart = RuntimeProfiler::instance().tic( );
+
 	returnvalue = scpStep->performStep( iter,bandedCP,eval );
 	if( returnvalue != SUCCESSFUL_RETURN )
 		ACADOERROR( RET_NLP_STEP_FAILED );
 
+	RuntimeProfiler::instance().toc( PP_LINE_SEARCH,profilerStart );
+
 	hasPerformedStep = BT_TRUE;
 
 	clock.stop( );
@@ -497,6 +505,7 @@ returnValue SCPmethod::prepareNextStep( )
 
 	clock.reset( );
 	clock.start( );
+	double profilerStart = RuntimeProfiler::instance().tic( );
 
 	if ( needToReevaluate == BT_TRUE )
 	{
@@ -511,6 +520,7 @@ returnValue SCPmethod::prepareNextStep( )
 	if( returnvalue != SUCCESSFUL_RETURN )
 		ACADOERROR( RET_NLP_STEP_FAILED );
 
+	RuntimeProfiler::instance().toc( PP_SENSITIVITIES,profilerStart );
 	clock.stop( );
 	setLast( LOG_TIME_SENSITIVITIES,clock.getTime() );
 
@@ -538,11 +548,13 @@ returnValue SCPmethod::prepareNextStep( )
 	
 	clock.reset( );
 	clock.start( );
+	profilerStart = RuntimeProfiler::instance().tic( );
 
 	returnvalue = computeHessianMatrix( oldLagrangeGradient,newLagrangeGradient );
 	if( returnvalue != SUCCESSFUL_RETURN )
 		ACADOERROR( RET_NLP_STEP_FAILED );
 
+	RuntimeProfiler::instance().toc( PP_HESSIAN_UPDATE,profilerStart );
 	clock.stop( );
 	setLast( LOG_TIME_HESSIAN_COMPUTATION,clock.getTime() );
 
@@ -685,8 +697,8 @@ returnValue SCPmethod::setup( )
     if ( eval == 0 )
     	return ACADOERROR( RET_UNKNOWN_BUG );
 
-	if ( eval->init( iter ) != SUCCESSFUL_RETURN )
-		return ACADOERROR( RET_NLP_INIT_FAILED );
+    if ( eval->init( iter ) != SUCCESSFUL_RETURN )
+        return ACADOERROR( RET_NLP_INIT_FAILED );
 
 
     // PREPARE THE DATA FOR THE SQP ALGORITHM:
@@ -712,6 +724,15 @@ returnValue SCPmethod::setup( )
 		bandedCPsolver = new CondensingBasedCPsolver( userInteraction,eval->getNumConstraints(),eval->getConstraintBlockDims() );
 		bandedCPsolver->init( iter );
 	}
+	else if ( (SparseQPsolutionMethods)sparseQPsolution == SPARSE_SOLVER )
+	{
+		bandedCP.lambdaConstraint.init( eval->getNumConstraintBlocks(), 1 );
+		bandedCP.lambdaDynamic.init( getNumPoints()-1, 1 );
+
+		bandedCPsolver = new RiccatiBasedCPsolver( userInteraction,eval->getNumConstraints(),eval->getConstraintBlockDims() );
+		if ( bandedCPsolver->init( iter ) != SUCCESSFUL_RETURN )
+			return ACADOERROR( RET_NLP_INIT_FAILED );
+	}
 	else
 	{
 		return ACADOERROR( RET_NOT_YET_IMPLEMENTED );
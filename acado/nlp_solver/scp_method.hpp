@@ -43,6 +43,7 @@
 #include <acado/conic_solver/dense_qp_solver.hpp>
 #include <acado/conic_solver/banded_cp_solver.hpp>
 #include <acado/conic_solver/condensing_based_cp_solver.hpp>
+#include <acado/conic_solver/riccati_based_cp_solver.hpp>
 
 #include <acado/nlp_solver/scp_evaluation.hpp>
 #include <acado/nlp_solver/scp_step_linesearch.hpp>
@@ -200,80 +200,50 @@ LSQTerm& LSQTerm::operator=( const LSQTerm& rhs ){
 
 returnValue LSQTerm::evaluate( const OCPiterate &x ){
 
-    uint run1, run2, run3;
+    int run1, thread;
 
-    DVector h_res;
-
-    const uint nh = fcn.getDim();
-    const uint N  = grid.getNumPoints();
+    const int N = grid.getNumPoints();
 
     ObjectiveElement::init( x );
 
     obj = 0.0;
 
-	double currentValue;
-	VariablesGrid allValues( 1,grid );
-
-    for( run1 = 0; run1 < N; run1++ ){
-
-		currentValue = 0.0;
-
-        // EVALUATE THE LSQ-FUCNTION:
-        // --------------------------
-        z.setZ( run1, x );
-        h_res = fcn.evaluate( z, (int) run1 );
-
-	
-	#ifdef SIM_DEBUG
-	if( run1 == 0 || run1 == 1 ){
-	  
-	    h_res.print("hres"); 
-	    r[run1].print("reference");
-	  
-	}
-	#endif
-	
-	
+    // EVALUATE THE GRID POINTS (IN PARALLEL):
+    // ---------------------------------------
+    const int nThreads = prepareThreads( N );
 
-        // EVALUATE THE OBJECTIVE:
-        // -----------------------
+    pointValues.resize( N );
+    pointReturnValues.resize( N );
+    pointResiduals.resize( N );
 
-        if( r != NULL )
-            h_res -= r[run1];
-
-        if( S != NULL ){
+    for( run1 = 0; run1 < N; run1++ ){
+        if( pointResiduals[run1].getDim() != (uint)fcn.getDim() )
+            pointResiduals[run1].init( fcn.getDim() );
+    }
 
-        	if ( !(S[run1].getNumCols() == nh && S[run1].getNumRows() == nh) )
-        		return ACADOERRORTEXT(RET_ASSERTION,
-        				The weighting matrix in the LSQ objective has a wrong dimension.);
+    #pragma omp parallel for private( run1 ) num_threads( nThreads ) schedule( static ) if( nThreads > 1 )
+    for( thread = 0; thread < nThreads; thread++ ){
 
-            for( run2 = 0; run2 < nh; run2++ ){
-                S_h_res[run1][run2] = 0.0;
-                for( run3 = 0; run3 < nh; run3++ )
-                    S_h_res[run1][run2] += S[run1].operator()(run2,run3)*h_res(run3);
-            }
+        const int first = getFirstPoint( thread  , nThreads, N );
+        const int last  = getFirstPoint( thread+1, nThreads, N );
 
-            for( run2 = 0; run2 < nh; run2++ ){
-                 currentValue += 0.5*h_res(run2)*S_h_res[run1][run2];
-            }
-        }
-        else{
-            for( run2 = 0; run2 < nh; run2++ ){
-                S_h_res[run1][run2] = h_res(run2);
-                currentValue += 0.5*h_res(run2)*h_res(run2);
-            }
-        }
+        for( run1 = first; run1 < last; run1++ )
+            pointReturnValues[run1] = evaluatePoint( run1, run1-first, x, getThreadFunction( thread ), getThreadZ( thread ), pointValues[run1] );
+    }
 
-		allValues( run1,0 ) = currentValue;
+    for( run1 = 0; run1 < N; run1++ ){
+        if( pointReturnValues[run1] != SUCCESSFUL_RETURN )
+            return pointReturnValues[run1];
     }
 
-	if (N > 1) {
-		DVector tmp(1);
-		allValues.getIntegral(IM_CONSTANT, tmp);
-		obj = tmp(0);
-	} else {
-		obj = allValues(0, 0);
-	}
+    // integrate the values as piecewise constant functions, which
+    // VariablesGrid::getIntegral( IM_CONSTANT, ... ) would do as well:
+    if (N > 1) {
+        for( run1 = 0; run1 < N-1; run1++ )
+            obj += grid.getIntervalLength( run1 ) * pointValues[run1];
+    } else {
+        obj = pointValues[0];
+    }
 
     return SUCCESSFUL_RETURN;
 }
@@ -282,148 +252,16 @@ returnValue LSQTerm::evaluate( const OCPiterate &x ){
 
 returnValue LSQTerm::evaluateSensitivities( BlockMatrix *hessian ){
 
-    if( hessian == 0 ) return evaluateSensitivitiesGN(0);
-
-    int run1, run2, run3, run4;
-    const int N = grid.getNumPoints();
-    const int nh = fcn.getDim();
-
-    if( bSeed != 0 ){
-
-        if( xSeed  != 0 || pSeed  != 0 || uSeed  != 0 || wSeed  != 0 ||
-            xSeed2 != 0 || pSeed2 != 0 || uSeed2 != 0 || wSeed2 != 0 )
-            return ACADOERROR( RET_WRONG_DEFINITION_OF_SEEDS );
-
-        double *bseed   = new double [nh];
-        double **J      = new double*[nh];
-
-        for( run2 = 0; run2 < nh; run2++ )
-             J[run2] = new double[fcn.getNumberOfVariables() +1];
-
-        if( bSeed->getNumRows( 0, 0 ) != 1 ) return ACADOWARNING( RET_WRONG_DEFINITION_OF_SEEDS );
-
-        DMatrix bseed_;
-        bSeed->getSubBlock( 0, 0, bseed_);
-
-        dBackward.init( 1, 5*N );
-
-        DMatrix Dx ( 1, nx );
-        DMatrix Dxa( 1, na );
-        DMatrix Dp ( 1, np );
-        DMatrix Du ( 1, nu );
-        DMatrix Dw ( 1, nw );
-
-        for( run1 = 0; run1 < N; run1++ ){
-
-            Dx .setZero();
-            Dxa.setZero();
-            Dp .setZero();
-            Du .setZero();
-            Dw .setZero();
-
-            for( run2 = 0; run2 < nh; run2++ ) bseed[run2] = 0;
-
-            for( run2 = 0; run2 < nh; run2++ ){
-                 for(run3 = 0; (int) run3 < fcn.getNumberOfVariables() +1; run3++ )
-                     J[run2][run3] = 0.0;
-
-                 bseed[run2] = 1.0;
-                 fcn.AD_backward( run1, bseed, J[run2] );
-                 bseed[run2] = 0.0;
-
-                 for( run3 = 0; run3 < nx; run3++ ){
-                      Dx( 0, run3 ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
-                 for( run3 = nx; run3 < nx+na; run3++ ){
-                      Dxa( 0, run3-nx ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
-                 for( run3 = nx+na; run3 < nx+na+np; run3++ ){
-                      Dp( 0, run3-nx-na ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
-                 for( run3 = nx+na+np; run3 < nx+na+np+nu; run3++ ){
-                      Du( 0, run3-nx-na-np ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
-                 for( run3 = nx+na+np+nu; run3 < nx+na+np+nu+nw; run3++ ){
-                      Dw( 0, run3-nx-na-np-nu ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
-            }
-            if( nx > 0 ) dBackward.setDense( 0,     run1, Dx  );
-            if( na > 0 ) dBackward.setDense( 0,   N+run1, Dxa );
-            if( np > 0 ) dBackward.setDense( 0, 2*N+run1, Dp  );
-            if( nu > 0 ) dBackward.setDense( 0, 3*N+run1, Du  );
-            if( nw > 0 ) dBackward.setDense( 0, 4*N+run1, Dw  );
-
-
-            // COMPUTATION OF THE EXACT HESSIAN:
-            // ---------------------------------
-
-            const int nnn = nx+na+np+nu+nw;
-            DMatrix tmp( nh, nnn );
-
-            for( run3 = 0; run3 < nnn; run3++ ){
-                for( run2 = 0; run2 < nh; run2++ ){
-                    if( S != 0 ){
-                        tmp( run2, run3 ) = 0.0;
-                        for( run4 = 0; run4 < nh; run4++ ){
-                            tmp( run2, run3 ) += S[run1].operator()(run2,run4)*J[run4][y_index[run3]];
-                        }
-                    }
-                    else{
-                        tmp( run2, run3 ) = J[run2][y_index[run3]];
-                    }
-                }
-            }
-            DMatrix tmp2;
-            int i,j;
-            int *Sidx = new int[6];
-            int *Hidx = new int[5];
-
-            Sidx[0] = 0;
-            Sidx[1] = nx;
-            Sidx[2] = nx+na;
-            Sidx[3] = nx+na+np;
-            Sidx[4] = nx+na+np+nu;
-            Sidx[5] = nx+na+np+nu+nw;
-
-            Hidx[0] =     run1;
-            Hidx[1] =   N+run1;
-            Hidx[2] = 2*N+run1;
-            Hidx[3] = 3*N+run1;
-            Hidx[4] = 4*N+run1;
-
-            for( i = 0; i < 5; i++ ){
-                for( j = 0; j < 5; j++ ){
-
-                    tmp2.init(Sidx[i+1]-Sidx[i],Sidx[j+1]-Sidx[j]);
-                    tmp2.setZero();
-
-                    for( run3 = Sidx[i]; run3 < Sidx[i+1]; run3++ )
-                        for( run4 = Sidx[j]; run4 < Sidx[j+1]; run4++ )
-                            for( run2 = 0; run2 < nh; run2++ )
-                                tmp2(run3-Sidx[i],run4-Sidx[j]) += J[run2][y_index[run3]]*tmp(run2,run4);
-
-                    if( tmp2.getDim() != 0 ) hessian->addDense(Hidx[i],Hidx[j],tmp2);
-                }
-            }
-            delete[] Sidx;
-            delete[] Hidx;
-        }
-
-        for( run2 = 0; run2 < nh; run2++ )
-            delete[] J[run2];
-        delete[] J;
-        delete[] bseed;
-        return SUCCESSFUL_RETURN;
-    }
-    return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+    // the exact Hessian is approximated by its Gauss-Newton part,
+    // i.e. the second derivatives of the LSQ function are neglected:
+    return evaluateSensitivitiesGN( hessian );
 }
 
 
 returnValue LSQTerm::evaluateSensitivitiesGN( BlockMatrix *GNhessian ){
 
-    int run1, run2, run3, run4;
+    int run1, thread;
     const int N = grid.getNumPoints();
-    const int nh = fcn.getDim();
 
     if( bSeed != 0 ){
 
@@ -431,12 +269,6 @@ returnValue LSQTerm::evaluateSensitivitiesGN( BlockMatrix *GNhessian ){
             xSeed2 != 0 || pSeed2 != 0 || uSeed2 != 0 || wSeed2 != 0 )
             return ACADOERROR( RET_WRONG_DEFINITION_OF_SEEDS );
 
-        double *bseed   = new double [nh];
-        double **J      = new double*[nh];
-
-        for( run2 = 0; run2 < nh; run2++ )
-             J[run2] = new double[fcn.getNumberOfVariables() +1];
-
         if( bSeed->getNumRows( 0, 0 ) != 1 ) return ACADOWARNING( RET_WRONG_DEFINITION_OF_SEEDS );
 
         DMatrix bseed_;
@@ -444,138 +276,37 @@ returnValue LSQTerm::evaluateSensitivitiesGN( BlockMatrix *GNhessian ){
 
         dBackward.init( 1, 5*N );
 
-        DMatrix Dx ( 1, nx );
-        DMatrix Dxa( 1, na );
-        DMatrix Dp ( 1, np );
-        DMatrix Du ( 1, nu );
-        DMatrix Dw ( 1, nw );
-
-        for( run1 = 0; run1 < N; run1++ ){
-
-            Dx .setZero();
-            Dxa.setZero();
-            Dp .setZero();
-            Du .setZero();
-            Dw .setZero();
-
-            for( run2 = 0; run2 < nh; run2++ ) bseed[run2] = 0;
+        // the grid points are assigned to the threads as in evaluate(),
+        // every point adds to its own blocks of the Hessian only:
+        const int nThreads = prepareThreads( N );
 
-            if( fcn.ADisSupported() == BT_FALSE ){
+        pointReturnValues.resize( N );
 
-                double *fseed = new double[fcn.getNumberOfVariables()+1];
-                for( run3 = 0; (int) run3 < fcn.getNumberOfVariables()+1; run3++ )
-                     fseed[run3] = 0.0;
+        #pragma omp parallel for private( run1 ) num_threads( nThreads ) schedule( static ) if( nThreads > 1 )
+        for( thread = 0; thread < nThreads; thread++ ){
 
-                for( run3 = 0; (int) run3 < fcn.getNumberOfVariables()+1; run3++ ){
-                     fseed[run3] = 1.0;
-                     fcn.AD_forward( run1, fseed, bseed );
-                     fseed[run3] = 0.0;
-                     for( run2 = 0; run2 < nh; run2++ )
-                         J[run2][run3] = bseed[run2];
-                }
-                delete[] fseed;
-            }
+            const int first = getFirstPoint( thread  , nThreads, N );
+            const int last  = getFirstPoint( thread+1, nThreads, N );
 
-            for( run2 = 0; run2 < nh; run2++ ){
+            for( run1 = first; run1 < last; run1++ )
+                pointReturnValues[run1] = evaluatePointSensitivities( run1, run1-first, getThreadFunction( thread ), bseed_(0,0), GNhessian );
+        }
 
-                 if( fcn.ADisSupported() == BT_TRUE ){
-                     for(run3 = 0; (int) run3 < fcn.getNumberOfVariables() +1; run3++ )
-                         J[run2][run3] = 0.0;
-                     bseed[run2] = 1.0;
-                     fcn.AD_backward( run1, bseed, J[run2] );
-                     bseed[run2] = 0.0;
-                 }
-
-                 for( run3 = 0; run3 < nx; run3++ ){
-                      Dx( 0, run3 ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
-                 for( run3 = nx; run3 < nx+na; run3++ ){
-                      Dxa( 0, run3-nx ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
-                 for( run3 = nx+na; run3 < nx+na+np; run3++ ){
-                      Dp( 0, run3-nx-na ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
-                 for( run3 = nx+na+np; run3 < nx+na+np+nu; run3++ ){
-                      Du( 0, run3-nx-na-np ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
-                 for( run3 = nx+na+np+nu; run3 < nx+na+np+nu+nw; run3++ ){
-                      Dw( 0, run3-nx-na-np-nu ) += bseed_(0,0)*J[run2][y_index[run3]]*S_h_res[run1][run2];
-                 }
-            }
-            if( nx > 0 ) dBackward.setDense( 0,     run1, Dx  );
-            if( na > 0 ) dBackward.setDense( 0,   N+run1, Dxa );
-            if( np > 0 ) dBackward.setDense( 0, 2*N+run1, Dp  );
-            if( nu > 0 ) dBackward.setDense( 0, 3*N+run1, Du  );
-            if( nw > 0 ) dBackward.setDense( 0, 4*N+run1, Dw  );
-
-            // COMPUTE GAUSS-NEWTON HESSIAN APPROXIMATION IF REQUESTED:
-            // --------------------------------------------------------
-
-            if( GNhessian != 0 ){
-
-                const int nnn = nx+na+np+nu+nw;
-                DMatrix tmp( nh, nnn );
-
-                for( run3 = 0; run3 < nnn; run3++ ){
-                    for( run2 = 0; run2 < nh; run2++ ){
-                        if( S != 0 ){
-                            tmp( run2, run3 ) = 0.0;
-                            for( run4 = 0; run4 < nh; run4++ ){
-                                tmp( run2, run3 ) += S[run1].operator()(run2,run4)*J[run4][y_index[run3]];
-                            }
-                        }
-                        else{
-                            tmp( run2, run3 ) = J[run2][y_index[run3]];
-                        }
-                    }
-                }
-                DMatrix tmp2;
-                int i,j;
-                int *Sidx = new int[6];
-                int *Hidx = new int[5];
-
-                Sidx[0] = 0;
-                Sidx[1] = nx;
-                Sidx[2] = nx+na;
-                Sidx[3] = nx+na+np;
-                Sidx[4] = nx+na+np+nu;
-                Sidx[5] = nx+na+np+nu+nw;
-
-                Hidx[0] =     run1;
-                Hidx[1] =   N+run1;
-                Hidx[2] = 2*N+run1;
-                Hidx[3] = 3*N+run1;
-                Hidx[4] = 4*N+run1;
-
-                for( i = 0; i < 5; i++ ){
-                    for( j = 0; j < 5; j++ ){
-
-                        tmp2.init(Sidx[i+1]-Sidx[i],Sidx[j+1]-Sidx[j]);
-                        tmp2.setZero();
-
-                        for( run3 = Sidx[i]; run3 < Sidx[i+1]; run3++ )
-                            for( run4 = Sidx[j]; run4 < Sidx[j+1]; run4++ )
-                                for( run2 = 0; run2 < nh; run2++ )
-                                    tmp2(run3-Sidx[i],run4-Sidx[j]) += J[run2][y_index[run3]]*tmp(run2,run4);
-
-                        if( tmp2.getDim() != 0 ) GNhessian->addDense(Hidx[i],Hidx[j],tmp2);
-                    }
-                }
-                delete[] Sidx;
-                delete[] Hidx;
+        returnValue returnvalue = SUCCESSFUL_RETURN;
+        for( run1 = 0; run1 < N; run1++ ){
+            if( pointReturnValues[run1] != SUCCESSFUL_RETURN ){
+                returnvalue = pointReturnValues[run1];
+                break;
             }
         }
 
-        for( run2 = 0; run2 < nh; run2++ )
-            delete[] J[run2];
-        delete[] J;
-        delete[] bseed;
-        return SUCCESSFUL_RETURN;
+        return returnvalue;
     }
 
     return ACADOERROR(RET_NOT_IMPLEMENTED_YET);
 }
 
+
 returnValue LSQTerm::getWeigthingtMatrix(const unsigned _index, DMatrix& _matrix) const
 {
 	if ( S_temp )
@@ -610,6 +341,203 @@ returnValue LSQTerm::setReference( const VariablesGrid &ref ){
 }
 
 
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+
+returnValue LSQTerm::evaluatePoint( int idx, int number, const OCPiterate &x,
+                                    Function& f, EvaluationPoint& zz, double& value ){
+
+    int run2, run3;
+
+    DVector& h_res = pointResiduals[idx];
+
+    const int nh = f.getDim();
+
+    value = 0.0;
+
+    // EVALUATE THE LSQ-FUCNTION:
+    // --------------------------
+    zz.setZ( idx, x );
+    f.evaluate( zz, number, h_res.data() );
+
+
+    // EVALUATE THE OBJECTIVE:
+    // -----------------------
+
+    if( r != NULL )
+        h_res -= r[idx];
+
+    if( S != NULL ){
+
+    	if ( !(S[idx].getNumCols() == (unsigned)nh && S[idx].getNumRows() == (unsigned)nh) )
+    		return ACADOERRORTEXT(RET_ASSERTION,
+    				The weighting matrix in the LSQ objective has a wrong dimension.);
+
+        for( run2 = 0; run2 < nh; run2++ ){
+            S_h_res[idx][run2] = 0.0;
+            for( run3 = 0; run3 < nh; run3++ )
+                S_h_res[idx][run2] += S[idx].operator()(run2,run3)*h_res(run3);
+        }
+
+        for( run2 = 0; run2 < nh; run2++ ){
+             value += 0.5*h_res(run2)*S_h_res[idx][run2];
+        }
+    }
+    else{
+        for( run2 = 0; run2 < nh; run2++ ){
+            S_h_res[idx][run2] = h_res(run2);
+            value += 0.5*h_res(run2)*h_res(run2);
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue LSQTerm::evaluatePointSensitivities( int idx, int number, Function& f,
+                                                 double weight, BlockMatrix *GNhessian ){
+
+    int run2, run3, run4;
+    const int N  = grid.getNumPoints();
+    const int nh = f.getDim();
+
+    double *bseed   = new double [nh];
+    double **J      = new double*[nh];
+
+    for( run2 = 0; run2 < nh; run2++ )
+         J[run2] = new double[f.getNumberOfVariables() +1];
+
+    DMatrix Dx ( 1, nx );
+    DMatrix Dxa( 1, na );
+    DMatrix Dp ( 1, np );
+    DMatrix Du ( 1, nu );
+    DMatrix Dw ( 1, nw );
+
+    Dx .setZero();
+    Dxa.setZero();
+    Dp .setZero();
+    Du .setZero();
+    Dw .setZero();
+
+    for( run2 = 0; run2 < nh; run2++ ) bseed[run2] = 0;
+
+    if( f.ADisSupported() == BT_FALSE ){
+
+        double *fseed = new double[f.getNumberOfVariables()+1];
+        for( run3 = 0; (int) run3 < f.getNumberOfVariables()+1; run3++ )
+             fseed[run3] = 0.0;
+
+        for( run3 = 0; (int) run3 < f.getNumberOfVariables()+1; run3++ ){
+             fseed[run3] = 1.0;
+             f.AD_forward( number, fseed, bseed );
+             fseed[run3] = 0.0;
+             for( run2 = 0; run2 < nh; run2++ )
+                 J[run2][run3] = bseed[run2];
+        }
+        delete[] fseed;
+    }
+
+    for( run2 = 0; run2 < nh; run2++ ){
+
+         if( f.ADisSupported() == BT_TRUE ){
+             for(run3 = 0; (int) run3 < f.getNumberOfVariables() +1; run3++ )
+                 J[run2][run3] = 0.0;
+             bseed[run2] = 1.0;
+             f.AD_backward( number, bseed, J[run2] );
+             bseed[run2] = 0.0;
+         }
+
+         for( run3 = 0; run3 < nx; run3++ ){
+              Dx( 0, run3 ) += weight*J[run2][y_index[run3]]*S_h_res[idx][run2];
+         }
+         for( run3 = nx; run3 < nx+na; run3++ ){
+              Dxa( 0, run3-nx ) += weight*J[run2][y_index[run3]]*S_h_res[idx][run2];
+         }
+         for( run3 = nx+na; run3 < nx+na+np; run3++ ){
+              Dp( 0, run3-nx-na ) += weight*J[run2][y_index[run3]]*S_h_res[idx][run2];
+         }
+         for( run3 = nx+na+np; run3 < nx+na+np+nu; run3++ ){
+              Du( 0, run3-nx-na-np ) += weight*J[run2][y_index[run3]]*S_h_res[idx][run2];
+         }
+         for( run3 = nx+na+np+nu; run3 < nx+na+np+nu+nw; run3++ ){
+              Dw( 0, run3-nx-na-np-nu ) += weight*J[run2][y_index[run3]]*S_h_res[idx][run2];
+         }
+    }
+    if( nx > 0 ) dBackward.setDense( 0,     idx, Dx  );
+    if( na > 0 ) dBackward.setDense( 0,   N+idx, Dxa );
+    if( np > 0 ) dBackward.setDense( 0, 2*N+idx, Dp  );
+    if( nu > 0 ) dBackward.setDense( 0, 3*N+idx, Du  );
+    if( nw > 0 ) dBackward.setDense( 0, 4*N+idx, Dw  );
+
+    // COMPUTE GAUSS-NEWTON HESSIAN APPROXIMATION IF REQUESTED:
+    // --------------------------------------------------------
+
+    if( GNhessian != 0 ){
+
+        const int nnn = nx+na+np+nu+nw;
+        DMatrix tmp( nh, nnn );
+
+        for( run3 = 0; run3 < nnn; run3++ ){
+            for( run2 = 0; run2 < nh; run2++ ){
+                if( S != 0 ){
+                    tmp( run2, run3 ) = 0.0;
+                    for( run4 = 0; run4 < nh; run4++ ){
+                        tmp( run2, run3 ) += S[idx].operator()(run2,run4)*J[run4][y_index[run3]];
+                    }
+                }
+                else{
+                    tmp( run2, run3 ) = J[run2][y_index[run3]];
+                }
+            }
+        }
+        DMatrix tmp2;
+        int i,j;
+        int *Sidx = new int[6];
+        int *Hidx = new int[5];
+
+        Sidx[0] = 0;
+        Sidx[1] = nx;
+        Sidx[2] = nx+na;
+        Sidx[3] = nx+na+np;
+        Sidx[4] = nx+na+np+nu;
+        Sidx[5] = nx+na+np+nu+nw;
+
+        Hidx[0] =     idx;
+        Hidx[1] =   N+idx;
+        Hidx[2] = 2*N+idx;
+        Hidx[3] = 3*N+idx;
+        Hidx[4] = 4*N+idx;
+
+        for( i = 0; i < 5; i++ ){
+            for( j = 0; j < 5; j++ ){
+
+                tmp2.init(Sidx[i+1]-Sidx[i],Sidx[j+1]-Sidx[j]);
+                tmp2.setZero();
+
+                for( run3 = Sidx[i]; run3 < Sidx[i+1]; run3++ )
+                    for( run4 = Sidx[j]; run4 < Sidx[j+1]; run4++ )
+                        for( run2 = 0; run2 < nh; run2++ )
+                            tmp2(run3-Sidx[i],run4-Sidx[j]) += J[run2][y_index[run3]]*tmp(run2,run4);
+
+                if( tmp2.getDim() != 0 ) GNhessian->addDense(Hidx[i],Hidx[j],tmp2);
+            }
+        }
+        delete[] Sidx;
+        delete[] Hidx;
+    }
+
+    for( run2 = 0; run2 < nh; run2++ )
+        delete[] J[run2];
+    delete[] J;
+    delete[] bseed;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
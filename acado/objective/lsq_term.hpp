@@ -157,6 +157,24 @@ class LSQTerm : public ObjectiveElement{
     //
     protected:
 
+        /** Evaluates the LSQ function at the grid point idx in the buffer \n
+         *  position number of the given function and returns the        \n
+         *  weighted objective value of the point.                        \n
+         *                                                                \n
+         *  \return SUCCESSFUL_RETURN                                     \n
+         */
+        returnValue evaluatePoint( int idx, int number, const OCPiterate &x,
+                                   Function& f, EvaluationPoint& zz, double& value );
+
+
+        /** Evaluates the gradient contribution of the grid point idx and  \n
+         *  adds its Gauss-Newton Hessian block if GNhessian != 0.        \n
+         *                                                                \n
+         *  \return SUCCESSFUL_RETURN                                     \n
+         */
+        returnValue evaluatePointSensitivities( int idx, int number, Function& f,
+                                                double weight, BlockMatrix *GNhessian );
+
 
     //
     // DATA MEMBERS:
@@ -173,6 +191,9 @@ class LSQTerm : public ObjectiveElement{
                                               *  to be stored for backward     \n
                                               *  differentiation               \n
                                               */
+
+    std::vector< double > pointValues  ;    /**< values at the grid points    */
+    std::vector< DVector > pointResiduals;  /**< residuals at the grid points */
 };
 
 
@@ -576,6 +576,17 @@ BooleanType Objective::isEmpty() const{
     return BT_FALSE;
 }
 
+
+returnValue Objective::setNumThreads( int numThreads_ ){
+
+    uint run1;
+
+    for( run1 = 0; run1 < nLSQ; run1++ )
+        ACADO_TRY( lsqTerm[run1]->setNumThreads( numThreads_ ) );
+
+    return SUCCESSFUL_RETURN;
+}
+
 returnValue Objective::getLSQTerms( LsqElements& _elements ) const
 {
 	_elements = cgLsqElements;
@@ -445,6 +445,14 @@ class Objective : public LagrangeTerm
          */
         BooleanType isEmpty() const;
 
+
+        /** Sets the number of threads that evaluate the grid points of \n
+         *  the LSQ terms concurrently.                                 \n
+         *                                                              \n
+         *  \return SUCCESSFUL_RETURN                                   \n
+         */
+        returnValue setNumThreads( int numThreads_ );
+
         /** \name Code generation related functions.
          *  @{ */
         returnValue getLSQTerms( LsqElements& _elements ) const;
@@ -65,6 +65,8 @@ ObjectiveElement::ObjectiveElement( ){
     bSeed2        = 0     ;
 
     obj = 0.0;
+
+    numThreads = 1;
 }
 
 
@@ -94,6 +96,8 @@ ObjectiveElement::ObjectiveElement( const Grid &grid_ ){
     bSeed2        = 0     ;
 
     obj = 0.0;
+
+    numThreads = 1;
 }
 
 
@@ -152,6 +156,13 @@ ObjectiveElement::ObjectiveElement( const ObjectiveElement& rhs ){
     obj       = rhs.obj      ;
     dForward  = rhs.dForward ;
     dBackward = rhs.dBackward;
+
+    z  = rhs.z ;
+    JJ = rhs.JJ;
+
+    numThreads = rhs.numThreads;
+    threadFcn  = rhs.threadFcn ;
+    threadZ    = rhs.threadZ   ;
 }
 
 
@@ -207,8 +218,8 @@ ObjectiveElement& ObjectiveElement::operator=( const ObjectiveElement& rhs ){
         fcn  = rhs.fcn ;
 
         if( rhs.y_index != 0 ){
-            y_index = new int[ny];
-            for( run1 = 0; run1 < ny; run1++ )
+            y_index = new int[rhs.ny];
+            for( run1 = 0; run1 < rhs.ny; run1++ )
                 y_index[run1] = rhs.y_index[run1];
         }
         else  y_index = 0;
@@ -253,6 +264,13 @@ ObjectiveElement& ObjectiveElement::operator=( const ObjectiveElement& rhs ){
         obj       = rhs.obj      ;
         dForward  = rhs.dForward ;
         dBackward = rhs.dBackward;
+
+        z  = rhs.z ;
+        JJ = rhs.JJ;
+
+        numThreads = rhs.numThreads;
+        threadFcn  = rhs.threadFcn ;
+        threadZ    = rhs.threadZ   ;
     }
     return *this;
 }
@@ -264,24 +282,32 @@ returnValue ObjectiveElement::init( const OCPiterate &x ){
 
     int run1;
 
-    z.init( fcn, x );
-    JJ.init( fcn, x );
-	//HH.init( fcn, x );
+    int nx_ = ( x.x  != NULL ) ? (int)x.x ->getNumValues() : 0;
+    int na_ = ( x.xa != NULL ) ? (int)x.xa->getNumValues() : 0;
+    int np_ = ( x.p  != NULL ) ? (int)x.p ->getNumValues() : 0;
+    int nu_ = ( x.u  != NULL ) ? (int)x.u ->getNumValues() : 0;
+    int nw_ = ( x.w  != NULL ) ? (int)x.w ->getNumValues() : 0;
 
-    if( x.x != NULL ) nx = x.x->getNumValues();
-    else             nx = 0                 ;
+    // the terms call init() on every evaluation, the evaluation points and
+    // the copies of the threads are only set up again if the dimensions change:
+    if( y_index != 0 && nx == nx_ && na == na_ && np == np_ && nu == nu_ && nw == nw_ ){
 
-    if( x.xa != NULL ) na = x.xa->getNumValues();
-    else             na = 0                 ;
+        z .setZero();
+        JJ.setZero();
+        return SUCCESSFUL_RETURN;
+    }
 
-    if( x.p  != NULL ) np = x.p ->getNumValues();
-    else             np = 0                 ;
+    z.init( fcn, x );
+    JJ.init( fcn, x );
+	//HH.init( fcn, x );
 
-    if( x.u  != NULL ) nu = x.u ->getNumValues();
-    else             nu = 0                 ;
+    resetThreads();
 
-    if( x.w  != NULL ) nw = x.w ->getNumValues();
-    else             nw = 0                 ;
+    nx = nx_;
+    na = na_;
+    np = np_;
+    nu = nu_;
+    nw = nw_;
 
     ny = nx+na+nu+np+nw;
 
@@ -483,6 +509,53 @@ returnValue ObjectiveElement::getBackwardSensitivities( BlockMatrix *D, int orde
 }
 
 
+returnValue ObjectiveElement::setNumThreads( int numThreads_ ){
+
+    int nThreads = ( numThreads_ < 1 ) ? 1 : numThreads_;
+
+    if( nThreads != numThreads ){
+        numThreads = nThreads;
+        resetThreads();
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+
+int ObjectiveElement::prepareThreads( int nPoints ){
+
+    int nThreads = numThreads;
+    if( nThreads > nPoints ) nThreads = nPoints;
+
+    // user-defined C functions are not necessarily reentrant:
+    if( nThreads <= 1 || fcn.isSymbolic() == BT_FALSE )
+        return 1;
+
+    // the copies are only made once, the evaluation points are set up
+    // point-wise by the evaluation routines:
+    if( (int)threadFcn.size() < nThreads-1 ){
+
+        threadFcn.assign( nThreads-1, fcn );
+        threadZ  .assign( nThreads-1, z   );
+    }
+
+    return nThreads;
+}
+
+
+void ObjectiveElement::resetThreads( ){
+
+    threadFcn.clear();
+    threadZ  .clear();
+}
+
+
 
 CLOSE_NAMESPACE_ACADO
 
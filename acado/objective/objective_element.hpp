@@ -39,6 +39,8 @@
 #include <acado/variables_grid/variables_grid.hpp>
 #include <acado/function/function.hpp>
 
+#include <vector>
+
 BEGIN_NAMESPACE_ACADO
 
 
@@ -213,6 +215,13 @@ class ObjectiveElement{
         returnValue getFunction( Function& _function );
 
 
+        /** Sets the number of threads that evaluate the grid points of \n
+         *  the objective element concurrently (default: 1).             \n
+         *  \return SUCCESSFUL_RETURN                                    \n
+         */
+        returnValue setNumThreads( int numThreads_ );
+
+
 
 // ==========================================================================
 //
@@ -227,6 +236,33 @@ class ObjectiveElement{
         inline Grid getGrid() const;
 
 
+        /** Prepares the evaluation of the function on nPoints grid points:\n
+         *  every thread but the first one gets its own copy of the        \n
+         *  function and of the evaluation points, since the buffers of a  \n
+         *  function must not be shared between threads.                   \n
+         *                                                                 \n
+         *  \return The number of threads to be used.                      \n
+         */
+        int prepareThreads( int nPoints );
+
+        /** Discards the copies made by prepareThreads(); to be called     \n
+         *  whenever the function or the dimensions change.                \n
+         */
+        void resetThreads( );
+
+        /** Returns the first grid point that is evaluated by the given    \n
+         *  thread. The points of a thread are contiguous and evaluated in \n
+         *  the buffer positions 0, 1, ... of its function.                \n
+         */
+        inline int getFirstPoint( int thread, int nThreads, int nPoints ) const;
+
+        /** Returns the copy of the function used by the given thread. */
+        inline Function& getThreadFunction( int thread );
+
+        /** Returns the evaluation point used by the given thread. */
+        inline EvaluationPoint& getThreadZ( int thread );
+
+
     //
     // DATA MEMBERS:
     //
@@ -249,6 +285,15 @@ class ObjectiveElement{
         int              ny     ;   /**< := nx+na+nu+np+nw       */
 
 
+        // PARALLEL EVALUATION OF THE GRID POINTS:
+        // ---------------------------------------
+
+        int                            numThreads;   /**< number of threads              */
+        std::vector< Function >        threadFcn ;   /**< copies of fcn (threads > 0)    */
+        std::vector< EvaluationPoint > threadZ   ;   /**< their evaluation points        */
+        std::vector< returnValue >     pointReturnValues;   /**< return values of the grid points */
+
+
         // INPUT STORAGE:
         // ------------------------
         BlockMatrix      *xSeed   ;   /**< the 1st order forward seed in x-direction */
@@ -53,6 +53,26 @@ inline Grid ObjectiveElement::getGrid() const{
 }
 
 
+inline int ObjectiveElement::getFirstPoint( int thread, int nThreads, int nPoints ) const{
+
+    return (int)( ( (long)nPoints*thread ) / nThreads );
+}
+
+
+inline Function& ObjectiveElement::getThreadFunction( int thread ){
+
+    if( thread == 0 ) return fcn;
+    return threadFcn[thread-1];
+}
+
+
+inline EvaluationPoint& ObjectiveElement::getThreadZ( int thread ){
+
+    if( thread == 0 ) return z;
+    return threadZ[thread-1];
+}
+
+
 inline int ObjectiveElement::getNX() const{
 
     return fcn.getNX();
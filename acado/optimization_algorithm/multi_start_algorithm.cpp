@@ -0,0 +1,290 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file src/optimization_algorithm/multi_start_algorithm.cpp
+ */
+
+
+#include <acado/optimization_algorithm/multi_start_algorithm.hpp>
+#include <acado/ocp/ocp.hpp>
+
+BEGIN_NAMESPACE_ACADO
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+
+MultiStartAlgorithm::MultiStartAlgorithm()
+                    :OptimizationAlgorithm(){
+
+}
+
+
+MultiStartAlgorithm::MultiStartAlgorithm( const OCP& ocp_ )
+                    :OptimizationAlgorithm( ocp_ ){
+
+}
+
+
+MultiStartAlgorithm::MultiStartAlgorithm( const MultiStartAlgorithm& arg )
+                    :OptimizationAlgorithm( arg ),
+                     scenarios       ( arg.scenarios        ),
+                     status          ( arg.status           ),
+                     objective       ( arg.objective        ),
+                     numSQPiterations( arg.numSQPiterations ),
+                     cpuTime         ( arg.cpuTime          ),
+                     xResults        ( arg.xResults         ),
+                     xaResults       ( arg.xaResults        ),
+                     pResults        ( arg.pResults         ),
+                     uResults        ( arg.uResults         ),
+                     wResults        ( arg.wResults         )
+{
+}
+
+
+MultiStartAlgorithm::~MultiStartAlgorithm( ){
+
+}
+
+
+MultiStartAlgorithm& MultiStartAlgorithm::operator=( const MultiStartAlgorithm& arg ){
+
+    if( this != &arg ){
+
+        OptimizationAlgorithm::operator=(arg);
+
+        scenarios        = arg.scenarios       ;
+        status           = arg.status          ;
+        objective        = arg.objective       ;
+        numSQPiterations = arg.numSQPiterations;
+        cpuTime          = arg.cpuTime         ;
+
+        xResults  = arg.xResults ;
+        xaResults = arg.xaResults;
+        pResults  = arg.pResults ;
+        uResults  = arg.uResults ;
+        wResults  = arg.wResults ;
+    }
+    return *this;
+}
+
+
+returnValue MultiStartAlgorithm::addScenario( const VariablesGrid &xd_init_,
+                                              const VariablesGrid &xa_init_,
+                                              const VariablesGrid &p_init_ ,
+                                              const VariablesGrid &u_init_ ,
+                                              const VariablesGrid &w_init_  ){
+
+    scenarios.push_back( OCPiterate( xd_init_.isEmpty() == BT_FALSE ? &xd_init_ : 0,
+                                     xa_init_.isEmpty() == BT_FALSE ? &xa_init_ : 0,
+                                     p_init_ .isEmpty() == BT_FALSE ? &p_init_  : 0,
+                                     u_init_ .isEmpty() == BT_FALSE ? &u_init_  : 0,
+                                     w_init_ .isEmpty() == BT_FALSE ? &w_init_  : 0 ) );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue MultiStartAlgorithm::clearScenarios( ){
+
+    scenarios.clear();
+
+    status.clear();
+    objective.clear();
+    numSQPiterations.clear();
+    cpuTime.clear();
+
+    xResults.clear();
+    xaResults.clear();
+    pResults.clear();
+    uResults.clear();
+    wResults.clear();
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue MultiStartAlgorithm::solve( ){
+
+    int run1;
+
+    ASSERT( ocp != 0 );
+
+    const int nS = (int) getNumScenarios();
+
+    if( nS == 0 )
+        return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+
+    int numThreads;
+    get( NUM_THREADS, numThreads );
+    if( numThreads < 1 ) numThreads = 1;
+
+    status.assign( nS, RET_OPTALG_INIT_FAILED );
+    objective.assign( nS, INFTY );
+    numSQPiterations.assign( nS, 0 );
+    cpuTime.assign( nS, 0.0 );
+
+    xResults .assign( nS, VariablesGrid() );
+    xaResults.assign( nS, VariablesGrid() );
+    pResults .assign( nS, VariablesGrid() );
+    uResults .assign( nS, VariablesGrid() );
+    wResults .assign( nS, VariablesGrid() );
+
+
+    // SET-UP ALL SCENARIOS (ONE AFTER THE OTHER):
+    // -------------------------------------------
+    std::vector< OptimizationAlgorithm* > worker( nS, (OptimizationAlgorithm*) 0 );
+
+    for( run1 = 0; run1 < nS; run1++ )
+        worker[run1] = setupScenario( run1 );
+
+
+    // SOLVE ALL SCENARIOS (IN PARALLEL):
+    // ----------------------------------
+    #pragma omp parallel for num_threads( numThreads ) schedule( dynamic )
+    for( run1 = 0; run1 < nS; run1++ ){
+
+        if( worker[run1] == 0 ) continue;
+
+        cpuTime[run1] = -acadoGetTime();
+        status [run1] = worker[run1]->solve( );
+        cpuTime[run1] += acadoGetTime();
+    }
+
+
+    // COLLECT THE RESULTS:
+    // --------------------
+    int numSolved = 0;
+
+    for( run1 = 0; run1 < nS; run1++ ){
+
+        if( worker[run1] == 0 ) continue;
+
+        numSQPiterations[run1] = worker[run1]->getNumberOfSteps();
+
+        if( status[run1] == SUCCESSFUL_RETURN ){
+
+            objective[run1] = worker[run1]->getObjectiveValue();
+
+            if( worker[run1]->getNX ( ) > 0 ) worker[run1]->getDifferentialStates( xResults [run1] );
+            if( worker[run1]->getNXA( ) > 0 ) worker[run1]->getAlgebraicStates   ( xaResults[run1] );
+            if( worker[run1]->getNP ( ) > 0 ) worker[run1]->getParameters        ( pResults [run1] );
+            if( worker[run1]->getNU ( ) > 0 ) worker[run1]->getControls          ( uResults [run1] );
+            if( worker[run1]->getNW ( ) > 0 ) worker[run1]->getDisturbances      ( wResults [run1] );
+
+            numSolved++;
+        }
+
+        delete worker[run1];
+    }
+
+    if( numSolved == 0 )
+        return ACADOERROR(RET_OPTALG_SOLVE_FAILED);
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+int MultiStartAlgorithm::getBestScenario( ) const{
+
+    int best = -1;
+
+    for( uint run1 = 0; run1 < status.size(); run1++ ){
+
+        if( status[run1] != SUCCESSFUL_RETURN )
+            continue;
+
+        if( best < 0 || objective[run1] < objective[best] )
+            best = run1;
+    }
+
+    return best;
+}
+
+
+returnValue MultiStartAlgorithm::printInfo( ) const{
+
+    printf("\n Scenario   status   objective value   SQP iterations   CPU time [s] \n");
+
+    for( uint run1 = 0; run1 < status.size(); run1++ ){
+
+        printf("  %5d    %6s    % .6e      %5d          %.3e \n",
+               (int) run1+1,
+               status[run1] == SUCCESSFUL_RETURN ? "solved" : "failed",
+               objective[run1], numSQPiterations[run1], cpuTime[run1] );
+    }
+
+    int best = getBestScenario();
+    if( best >= 0 )
+        printf("\n Best scenario: %d \n\n", best+1 );
+    else
+        printf("\n No scenario could be solved. \n\n" );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+
+OptimizationAlgorithm* MultiStartAlgorithm::setupScenario( uint idx ){
+
+    OptimizationAlgorithm* worker = new OptimizationAlgorithm( *this );
+
+    const OCPiterate& scenario = scenarios[idx];
+
+    if( scenario.x  != 0 ) worker->initializeDifferentialStates( *scenario.x  );
+    if( scenario.xa != 0 ) worker->initializeAlgebraicStates   ( *scenario.xa );
+    if( scenario.p  != 0 ) worker->initializeParameters        ( *scenario.p  );
+    if( scenario.u  != 0 ) worker->initializeControls          ( *scenario.u  );
+    if( scenario.w  != 0 ) worker->initializeDisturbances      ( *scenario.w  );
+
+    // the threads are spent on the scenarios, not on the shooting intervals;
+    // setting an option also makes sure that the copy is set-up from scratch:
+    worker->set( NUM_THREADS, 1 );
+
+    if( idx > 0 )
+        worker->set( PRINT_COPYRIGHT, BT_FALSE );
+
+    if( worker->init( ) != SUCCESSFUL_RETURN ){
+        delete worker;
+        return 0;
+    }
+
+    return worker;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -0,0 +1,204 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file include/acado/optimization_algorithm/multi_start_algorithm.hpp
+ */
+
+
+#ifndef ACADO_TOOLKIT_MULTI_START_ALGORITHM_HPP
+#define ACADO_TOOLKIT_MULTI_START_ALGORITHM_HPP
+
+
+#include <acado/optimization_algorithm/optimization_algorithm.hpp>
+
+#include <vector>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/** 
+ *	\brief User-interface to solve an optimal control problem from several initializations at once.
+ *
+ *	\ingroup UserInterfaces
+ *
+ *	The class MultiStartAlgorithm solves the same optimal control problem
+ *	for a batch of scenarios, where each scenario provides its own initial
+ *	guess for (some of) the optimization variables, e.g. a different start
+ *	point or different values of uncertain parameters. Grids that are not
+ *	provided by a scenario are taken from the initialization of the
+ *	algorithm itself.
+ *
+ *	Each scenario is solved by a separate copy of the algorithm, i.e. with
+ *	its own OCP and NLP solver. The copies are set-up one after the other
+ *	and solved concurrently on NUM_THREADS OpenMP threads afterwards. The
+ *	shooting intervals within one scenario are then integrated serially.
+ *	The solutions and statistics of all scenarios are kept and can be
+ *	obtained once solve() has returned.
+ *
+ *	\note Parameters given by a scenario are initial guesses only; they can
+ *	be fixed by adding corresponding constraints to the OCP.
+ */
+class MultiStartAlgorithm : public OptimizationAlgorithm
+{
+    //
+    // PUBLIC MEMBER FUNCTIONS:
+    //
+    public:
+
+        /** Default constructor. */
+        MultiStartAlgorithm();
+
+        /** Default constructor. */
+        MultiStartAlgorithm( const OCP& ocp_ );
+
+        /** Copy constructor (deep copy). */
+        MultiStartAlgorithm( const MultiStartAlgorithm& arg );
+
+        /** Destructor. */
+        virtual ~MultiStartAlgorithm( );
+
+        /** Assignment operator (deep copy). */
+        MultiStartAlgorithm& operator=( const MultiStartAlgorithm& arg );
+
+
+
+        /** Adds a scenario to the batch. Empty grids are replaced by the    \n
+         *  corresponding initialization of the algorithm itself.           \n
+         *                                                                  \n
+         *  \param xd_init_  initialization of the differential states      \n
+         *  \param xa_init_  initialization of the algebraic states         \n
+         *  \param p_init_   initialization of the parameters               \n
+         *  \param u_init_   initialization of the controls                 \n
+         *  \param w_init_   initialization of the disturbances             \n
+         *                                                                  \n
+         *  \return SUCCESSFUL_RETURN                                       \n
+         */
+        returnValue addScenario( const VariablesGrid &xd_init_,
+                                 const VariablesGrid &xa_init_ = emptyConstVariablesGrid,
+                                 const VariablesGrid &p_init_  = emptyConstVariablesGrid,
+                                 const VariablesGrid &u_init_  = emptyConstVariablesGrid,
+                                 const VariablesGrid &w_init_  = emptyConstVariablesGrid );
+
+        /** Removes all scenarios and their results.  \n
+         *                                            \n
+         *  \return SUCCESSFUL_RETURN                 \n
+         */
+        returnValue clearScenarios( );
+
+
+        /** Solves all scenarios.                                    \n
+         *                                                           \n
+         *  \return SUCCESSFUL_RETURN if at least one scenario could \n
+         *          be solved, RET_OPTALG_SOLVE_FAILED otherwise     \n
+         */
+        virtual returnValue solve( );
+
+
+
+        /** Returns the number of scenarios. */
+        inline uint getNumScenarios( ) const;
+
+        /** Returns the value returned by the solver of a scenario. */
+        inline returnValue getScenarioStatus( uint idx ) const;
+
+        /** Returns the optimal objective value of a scenario. */
+        inline double getScenarioObjectiveValue( uint idx ) const;
+
+        /** Returns the number of SQP iterations of a scenario. */
+        inline int getScenarioNumberOfSQPiterations( uint idx ) const;
+
+        /** Returns the CPU time (in seconds) needed to solve a scenario. */
+        inline double getScenarioCPUtime( uint idx ) const;
+
+        /** Returns the index of the solved scenario with the lowest     \n
+         *  objective value, or -1 if no scenario could be solved.      \n
+         */
+        int getBestScenario( ) const;
+
+
+        inline returnValue getScenarioDifferentialStates( uint idx, VariablesGrid &xd_ ) const;
+        inline returnValue getScenarioAlgebraicStates   ( uint idx, VariablesGrid &xa_ ) const;
+        inline returnValue getScenarioParameters        ( uint idx, VariablesGrid &p_  ) const;
+        inline returnValue getScenarioControls          ( uint idx, VariablesGrid &u_  ) const;
+        inline returnValue getScenarioDisturbances      ( uint idx, VariablesGrid &w_  ) const;
+
+
+        /** Prints the statistics of all scenarios.  \n
+         *                                           \n
+         *  \return SUCCESSFUL_RETURN                \n
+         */
+        returnValue printInfo( ) const;
+
+
+
+    //
+    // PROTECTED MEMBER FUNCTIONS:
+    //
+    protected:
+
+        /** Returns a copy of the algorithm that is initialized with the \n
+         *  given scenario and ready to be solved.                       \n
+         *                                                               \n
+         *  \return the initialized copy, or 0 if the set-up failed      \n
+         */
+        OptimizationAlgorithm* setupScenario( uint idx );
+
+
+    //
+    // DATA MEMBERS:
+    //
+    protected:
+
+        std::vector< OCPiterate >    scenarios ;   // the initializations of the scenarios
+
+        std::vector< returnValue >   status    ;   // results of the scenarios
+        std::vector< double >        objective ;
+        std::vector< int >           numSQPiterations;
+        std::vector< double >        cpuTime   ;
+
+        std::vector< VariablesGrid > xResults  ;
+        std::vector< VariablesGrid > xaResults ;
+        std::vector< VariablesGrid > pResults  ;
+        std::vector< VariablesGrid > uResults  ;
+        std::vector< VariablesGrid > wResults  ;
+};
+
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#include <acado/optimization_algorithm/multi_start_algorithm.ipp>
+
+
+#endif  // ACADO_TOOLKIT_MULTI_START_ALGORITHM_HPP
+
+/*
+ *   end of file
+ */
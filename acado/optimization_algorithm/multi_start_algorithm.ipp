@@ -0,0 +1,132 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file include/acado/optimization_algorithm/multi_start_algorithm.ipp
+ */
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+inline uint MultiStartAlgorithm::getNumScenarios( ) const{
+
+    return (uint) scenarios.size();
+}
+
+
+inline returnValue MultiStartAlgorithm::getScenarioStatus( uint idx ) const{
+
+    if( idx >= status.size() )
+        return ACADOERROR(RET_INDEX_OUT_OF_BOUNDS);
+
+    return status[idx];
+}
+
+
+inline double MultiStartAlgorithm::getScenarioObjectiveValue( uint idx ) const{
+
+    if( idx >= objective.size() )
+        return INFTY;
+
+    return objective[idx];
+}
+
+
+inline int MultiStartAlgorithm::getScenarioNumberOfSQPiterations( uint idx ) const{
+
+    if( idx >= numSQPiterations.size() )
+        return 0;
+
+    return numSQPiterations[idx];
+}
+
+
+inline double MultiStartAlgorithm::getScenarioCPUtime( uint idx ) const{
+
+    if( idx >= cpuTime.size() )
+        return 0.0;
+
+    return cpuTime[idx];
+}
+
+
+inline returnValue MultiStartAlgorithm::getScenarioDifferentialStates( uint idx, VariablesGrid &xd_ ) const{
+
+    if( idx >= xResults.size() )
+        return ACADOERROR(RET_INDEX_OUT_OF_BOUNDS);
+
+    xd_ = xResults[idx];
+    return SUCCESSFUL_RETURN;
+}
+
+
+inline returnValue MultiStartAlgorithm::getScenarioAlgebraicStates( uint idx, VariablesGrid &xa_ ) const{
+
+    if( idx >= xaResults.size() )
+        return ACADOERROR(RET_INDEX_OUT_OF_BOUNDS);
+
+    xa_ = xaResults[idx];
+    return SUCCESSFUL_RETURN;
+}
+
+
+inline returnValue MultiStartAlgorithm::getScenarioParameters( uint idx, VariablesGrid &p_ ) const{
+
+    if( idx >= pResults.size() )
+        return ACADOERROR(RET_INDEX_OUT_OF_BOUNDS);
+
+    p_ = pResults[idx];
+    return SUCCESSFUL_RETURN;
+}
+
+
+inline returnValue MultiStartAlgorithm::getScenarioControls( uint idx, VariablesGrid &u_ ) const{
+
+    if( idx >= uResults.size() )
+        return ACADOERROR(RET_INDEX_OUT_OF_BOUNDS);
+
+    u_ = uResults[idx];
+    return SUCCESSFUL_RETURN;
+}
+
+
+inline returnValue MultiStartAlgorithm::getScenarioDisturbances( uint idx, VariablesGrid &w_ ) const{
+
+    if( idx >= wResults.size() )
+        return ACADOERROR(RET_INDEX_OUT_OF_BOUNDS);
+
+    w_ = wResults[idx];
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -168,6 +168,10 @@ returnValue OptimizationAlgorithm::setupOptions( )
 	addOption( INTEGRATOR_TYPE             , defaultIntegratorType          );
 	addOption( FEASIBILITY_CHECK           , defaultFeasibilityCheck        );
 	addOption( PLOT_RESOLUTION             , defaultPlotResoltion           );
+	addOption( NUM_THREADS                 , defaultNumThreads              );
+	addOption( COLLOCATION_TYPE            , defaultCollocationType         );
+	addOption( COLLOCATION_NUM_POINTS      , defaultCollocationNumPoints    );
+	addOption( COLLOCATION_NUM_STEPS       , defaultCollocationNumSteps     );
 	
 	// add integrator options
 	addOption( MAX_NUM_INTEGRATOR_STEPS    , defaultMaxNumSteps             );
@@ -365,6 +365,13 @@ double OptimizationAlgorithmBase::getObjectiveValue() const{
 }
 
 
+int OptimizationAlgorithmBase::getNumberOfSteps() const{
+
+    if( nlpSolver == 0 ) return 0;
+    return nlpSolver->getNumberOfSteps();
+}
+
+
 
 returnValue OptimizationAlgorithmBase::getSensitivitiesX(	BlockMatrix& _sens
 															) const
@@ -576,8 +583,6 @@ returnValue OptimizationAlgorithmBase::init(	UserInteraction* _userIteraction
        if( iter.w  != 0 ) iter.w ->disableAutoInit();
 
 
-    // (COLLOCATION NOT IMPLEMENTED YET)
-
 // 	printf("before!!!\n");
 // 	iter.print();
 
@@ -716,6 +721,19 @@ returnValue OptimizationAlgorithmBase::setupDynamicDiscretization(	UserInteracti
 
     if( differentialEquation != 0 ){
 
+        int discretizationType;
+        _userIteraction->get( DISCRETIZATION_TYPE, discretizationType );
+
+        if( (StateDiscretizationType)discretizationType == COLLOCATION ){
+
+            *dynamicDiscretization = new CollocationMethod( _userIteraction );
+
+            if( (*dynamicDiscretization)->addStage( *differentialEquation[0], unionGrid ) != SUCCESSFUL_RETURN )
+                return ACADOERROR( RET_OPTALG_INIT_FAILED );
+
+            return SUCCESSFUL_RETURN;
+        }
+
         *dynamicDiscretization = new ShootingMethod( _userIteraction );
 
         int intType;
@@ -120,6 +120,9 @@ class OptimizationAlgorithmBase
         double getObjectiveValue         ( const char* fileName ) const;
         double getObjectiveValue         () const;
 
+        /** Returns the number of SQP iterations of the last solve. */
+        int getNumberOfSteps             () const;
+
 		
 		returnValue getSensitivitiesX(	BlockMatrix& _sens
 										) const;
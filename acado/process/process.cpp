@@ -722,6 +722,7 @@ returnValue Process::setupOptions( )
 	addOption( INTEGRATOR_TYPE             , INT_BDF                        );
 	addOption( FEASIBILITY_CHECK           , defaultFeasibilityCheck        );
 	addOption( PLOT_RESOLUTION             , defaultPlotResoltion           );
+	addOption( NUM_THREADS                 , defaultNumThreads              );
 	
 	// add integrator options
 	addOption( MAX_NUM_INTEGRATOR_STEPS    , defaultMaxNumSteps             );
@@ -422,10 +422,7 @@ Expression Expression::mul( const Expression& arg ) const{
         for( i = 0; i< arg.getDim(); i++ ){
 
              delete tmp.element[i];
-             Operator *prod = product( element[0], arg.element[i] );
-             tmp.element[i] = prod->clone();
-
-             delete prod;
+             tmp.element[i] = product( element[0], arg.element[i] );
         }
         return tmp;
     }
@@ -438,10 +435,7 @@ Expression Expression::mul( const Expression& arg ) const{
         for( i = 0; i< getDim(); i++ ){
 
              delete tmp.element[i];
-             Operator *prod = product( arg.element[0], element[i] );
-             tmp.element[i] = prod->clone();
-
-             delete prod;
+             tmp.element[i] = product( arg.element[0], element[i] );
         }
         return tmp;
     }
@@ -1234,13 +1228,9 @@ Expression Expression::ADbackward( const Expression &arg, const Expression &seed
         element[run1]->initDerivative();
         element[run1]->AD_backward( Dim, varType, Component, seed1, iresult, nIS, &IS );
 
-        for( run2 = 0; run2 < Dim; run2++ ){
-            Operator *sum = result.element[run2]->clone();
-            delete result.element[run2];
-            result.element[run2] = new Addition( sum->clone(), iresult[run2]->clone() );
-            delete sum;
-            delete iresult[run2];
-        }
+        // the new terms are added without copying the sums built so far:
+        for( run2 = 0; run2 < Dim; run2++ )
+            result.element[run2] = new Addition( result.element[run2], iresult[run2] );
     }
 
 
@@ -1360,15 +1350,13 @@ Expression Expression::ADsymmetric( 	const Expression &arg, /** argument      */
 
 		for( run2 = 0; run2 < nS; run2++ ){
 			for( run3 = 0; run3 < run2; run3++ ){
-				Operator *sum = result.element[run2*nS+run3]->clone();
-				delete result.element[run2*nS+run3];
+				Operator *sum = result.element[run2*nS+run3];
 				delete result.element[run3*nS+run2];
 				result.element[run2*nS+run3] = sum->myAdd( sum, H[run2*nS+run3] );
 				result.element[run3*nS+run2] = sum->myAdd( sum, H[run2*nS+run3] );
 				delete sum;
 			}
-			Operator *sum = result.element[run2*nS+run2]->clone();
-			delete result.element[run2*nS+run2];
+			Operator *sum = result.element[run2*nS+run2];
 			result.element[run2*nS+run2] = sum->myAdd( sum, H[run2*nS+run2] );
 			delete sum;
 		}
@@ -1382,8 +1370,7 @@ Expression Expression::ADsymmetric( 	const Expression &arg, /** argument      */
 
 		if( ldf != 0 ){
 		   for( run2 = 0; run2 < nS; run2++ ){
-			Operator *sum = tmp2.element[run2]->clone();
-			delete tmp2.element[run2];
+			Operator *sum = tmp2.element[run2];
 			tmp2.element[run2] = sum->myAdd( sum, ld[run2] );
 			delete sum;
 		  }
@@ -361,6 +361,40 @@ returnValue Addition::AD_backward( int number, double seed, double *df ){
 }
 
 
+returnValue Addition::AD_forward( int number, int nDir, double *seed, double *df ){
+
+    int run1;
+    returnValue returnvalue;
+
+    if( nDir > dirBufferSize ){
+        dirBufferSize = nDir;
+        dirBuffer     = (double*)realloc(dirBuffer,dirBufferSize*sizeof(double));
+    }
+
+    returnvalue = argument1->AD_forward( number, nDir, seed, df );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    returnvalue = argument2->AD_forward( number, nDir, seed, dirBuffer );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    for( run1 = 0; run1 < nDir; run1++ )
+        df[run1] = df[run1] + dirBuffer[run1];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue Addition::AD_backward( int number, int nDir, double *seed, double *df ){
+
+    returnValue returnvalue;
+
+    returnvalue = argument1->AD_backward( number, nDir, seed, df );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    return argument2->AD_backward( number, nDir, seed, df );
+}
+
+
 returnValue Addition::AD_forward2( int number, double *seed, double *dseed,
                                    double *df, double *ddf ){
 
@@ -41,6 +41,9 @@ BEGIN_NAMESPACE_ACADO
 
 BinaryOperator::BinaryOperator( ) : SmoothOperator( )
 {
+    dirBuffer     = 0;
+    dirBufferSize = 0;
+
     nCount = 0;
 }
 
@@ -55,6 +58,8 @@ BinaryOperator::BinaryOperator( Operator *_argument1, Operator *_argument2 ) : S
     dargument1_result = (double*)calloc(1,sizeof(double));
     dargument2_result = (double*)calloc(1,sizeof(double));
     bufferSize        = 1                                ;
+    dirBuffer         = 0                                ;
+    dirBufferSize     = 0                                ;
     curvature         = CT_UNKNOWN                       ;
     monotonicity      = MT_UNKNOWN                       ;
 
@@ -221,6 +226,9 @@ void BinaryOperator::copy( const BinaryOperator &arg ){
        dargument2_result[run1] = arg.dargument2_result[run1];
 
     }
+    dirBuffer         = 0;
+    dirBufferSize     = 0;
+
     curvature         = arg.curvature   ;
     monotonicity      = arg.monotonicity;
 
@@ -244,6 +252,7 @@ void BinaryOperator::deleteAll(){
     free(  argument2_result );
     free( dargument1_result );
     free( dargument2_result );
+    free( dirBuffer         );
 }
 
 returnValue BinaryOperator::setVariableExportName(	const VariableType &_type,
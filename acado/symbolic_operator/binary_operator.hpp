@@ -480,6 +480,10 @@ protected:
 
     int     bufferSize       ;    /**< The size of the buffer.    */
 
+    double *dirBuffer        ;    /**< Workspace for vector-mode
+                                   *   AD.                        */
+    int     dirBufferSize    ;    /**< The size of the workspace. */
+
     CurvatureType     curvature   ;
     MonotonicityType  monotonicity;
 };
@@ -264,6 +264,23 @@ returnValue DoubleConstant::AD_backward( int number, double seed, double *df ){
 }
 
 
+returnValue DoubleConstant::AD_forward( int number, int nDir, double *seed, double *df ){
+
+    int run1;
+
+    for( run1 = 0; run1 < nDir; run1++ )
+        df[run1] = 0.0;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue DoubleConstant::AD_backward( int number, int nDir, double *seed, double *df ){
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue DoubleConstant::AD_forward2( int number, double *seed, double *dseed,
                                          double *df, double *ddf ){
 
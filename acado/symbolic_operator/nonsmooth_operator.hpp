@@ -379,6 +379,37 @@ public:
 
 
 
+    /** Automatic Differentiation in forward mode for a block of  \n
+     *  nDir directions (vector mode). Seeds and derivatives are  \n
+     *  stored contiguously per variable, i.e. the seed of        \n
+     *  variable i in direction j is seed[i*nDir+j].              \n
+     *  This function uses the intermediate                       \n
+     *  results from a buffer.                                    \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NAN                                           \n
+     */
+     virtual returnValue AD_forward( int     number  /**< storage position     */,
+                                     int     nDir    /**< number of directions */,
+                                     double *seed    /**< the seed block       */,
+                                     double *df      /**< the nDir derivatives
+                                                          of the expression    */  );
+
+
+
+    /** Automatic Differentiation in backward mode for a block of \n
+     *  nDir directions (vector mode) based on buffered values.   \n
+     *  The derivatives are added to df, which is stored          \n
+     *  contiguously per variable (see AD_forward).               \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NAN                                           \n
+     */
+     virtual returnValue AD_backward( int     number /**< the buffer position  */,
+                                      int     nDir   /**< number of directions */,
+                                      double *seed   /**< the nDir seeds       */,
+                                      double *df     /**< the derivative block */ );
+
+
+
     /** Automatic Differentiation in forward mode for             \n
      *  2nd derivatives.                                          \n
      *  This function uses intermediate                           \n
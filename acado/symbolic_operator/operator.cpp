@@ -53,6 +53,17 @@ Operator::Operator(){
 Operator::~Operator(){ }
 
 
+void* Operator::operator new( std::size_t size ){
+
+    return OperatorPool::allocate( size );
+}
+
+void Operator::operator delete( void* ptr, std::size_t size ){
+
+    OperatorPool::release( ptr, size );
+}
+
+
 Operator& Operator::operator=( const double &arg ){
 
     ACADOERROR( RET_UNKNOWN_BUG );
@@ -107,6 +118,18 @@ int Operator::getGlobalIndex( ) const{
 }
 
 
+returnValue Operator::AD_forward( int number, int nDir, double *seed, double *df ){
+
+    return RET_NOT_IMPLEMENTED_YET;
+}
+
+
+returnValue Operator::AD_backward( int number, int nDir, double *seed, double *df ){
+
+    return RET_NOT_IMPLEMENTED_YET;
+}
+
+
 
 Operator& Operator::operator+=( const double    & arg ){ return operator=( this->operator+(arg) ); }
 Operator& Operator::operator+=( const DVector    & arg ){ return operator=( this->operator+(arg) ); }
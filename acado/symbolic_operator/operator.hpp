@@ -36,6 +36,7 @@
 
 
 #include <acado/symbolic_operator/symbolic_operator_fwd.hpp>
+#include <acado/symbolic_operator/operator_pool.hpp>
 
 
 BEGIN_NAMESPACE_ACADO
@@ -68,6 +69,13 @@ public:
     virtual ~Operator();
 
 
+    /** Allocates all operators from the OperatorPool. */
+    static void* operator new( std::size_t size );
+
+    /** Returns an operator to the OperatorPool. */
+    static void operator delete( void* ptr, std::size_t size );
+
+
     /** Sets the argument (note that arg should have dimension 1). */
 
     virtual Operator& operator=( const double      & arg );
@@ -412,6 +420,43 @@ public:
 
 
 
+    /** Automatic Differentiation in forward mode for a block of  \n
+     *  nDir directions (vector mode). Seeds and derivatives are  \n
+     *  stored contiguously per variable, i.e. the seed of        \n
+     *  variable i in direction j is seed[i*nDir+j].              \n
+     *  This function uses the intermediate                       \n
+     *  results from a buffer.                                    \n
+     *  The default implementation returns                        \n
+     *  RET_NOT_IMPLEMENTED_YET, in which case the caller has to  \n
+     *  propagate the directions one by one.                      \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NOT_IMPLEMENTED_YET                           \n
+     */
+     virtual returnValue AD_forward( int     number  /**< storage position     */,
+                                     int     nDir    /**< number of directions */,
+                                     double *seed    /**< the seed block       */,
+                                     double *df      /**< the nDir derivatives
+                                                          of the expression    */  );
+
+
+
+    /** Automatic Differentiation in backward mode for a block of \n
+     *  nDir directions (vector mode) based on buffered values.   \n
+     *  The derivatives are added to df, which is stored          \n
+     *  contiguously per variable (see AD_forward).               \n
+     *  The default implementation returns                        \n
+     *  RET_NOT_IMPLEMENTED_YET, in which case the caller has to  \n
+     *  propagate the directions one by one.                      \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NOT_IMPLEMENTED_YET                           \n
+     */
+     virtual returnValue AD_backward( int     number /**< the buffer position  */,
+                                      int     nDir   /**< number of directions */,
+                                      double *seed   /**< the nDir seeds       */,
+                                      double *df     /**< the derivative block */ );
+
+
+
     /** Automatic Differentiation in forward mode for             \n
      *  2nd derivatives.                                          \n
      *  This function uses intermediate                           \n
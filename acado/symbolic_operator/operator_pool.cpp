@@ -0,0 +1,175 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file src/symbolic_operator/operator_pool.cpp
+ */
+
+
+#include <acado/symbolic_operator/operator_pool.hpp>
+
+#include <cstdlib>
+#include <new>
+
+
+// The state of the pool consists of plain pointers and counters only. It is
+// therefore valid before any constructor has run and after all destructors
+// have run, i.e. operators in static objects can be created and deleted
+// at any time.
+
+static const std::size_t poolGranularity  = 16;
+static const std::size_t poolMaxNodeSize  = 512;
+static const std::size_t poolChunkSize    = 64 * 1024;
+static const std::size_t poolNumSizes     = poolMaxNodeSize / poolGranularity;
+
+struct PoolNode
+{
+	PoolNode* next;
+};
+
+static PoolNode*     poolFreeLists[ poolNumSizes ];  /**< free nodes, one list per size    */
+static PoolNode*     poolChunks = 0;                 /**< all chunks, kept reachable       */
+static char*         poolChunkPos = 0;               /**< unused part of the current chunk */
+static std::size_t   poolChunkLeft = 0;
+static unsigned long poolNumNodes = 0;
+static unsigned long poolNumReservedBytes = 0;
+
+
+static void* poolCarve( std::size_t bytes )
+{
+	if ( poolChunkLeft < bytes )
+	{
+		// the rest of the current chunk is lost; the first granule of a
+		// chunk links it to the previous ones
+		char* chunk = (char*)std::malloc( poolChunkSize );
+		if ( chunk == 0 )
+			return 0;
+
+		( (PoolNode*)chunk )->next = poolChunks;
+		poolChunks = (PoolNode*)chunk;
+		poolNumReservedBytes += poolChunkSize;
+
+		poolChunkPos  = chunk + poolGranularity;
+		poolChunkLeft = poolChunkSize - poolGranularity;
+	}
+
+	void* ptr = poolChunkPos;
+	poolChunkPos  += bytes;
+	poolChunkLeft -= bytes;
+
+	return ptr;
+}
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+void* OperatorPool::allocate( std::size_t size )
+{
+	if ( size > poolMaxNodeSize )
+		return ::operator new( size );
+
+	const std::size_t idx = ( size + poolGranularity - 1 ) / poolGranularity - 1;
+	void* ptr;
+
+	#pragma omp critical (acado_operator_pool)
+	{
+		if ( poolFreeLists[ idx ] != 0 )
+		{
+			ptr = poolFreeLists[ idx ];
+			poolFreeLists[ idx ] = poolFreeLists[ idx ]->next;
+		}
+		else
+			ptr = poolCarve( ( idx + 1 ) * poolGranularity );
+
+		if ( ptr != 0 )
+			++poolNumNodes;
+	}
+
+	if ( ptr == 0 )
+		throw std::bad_alloc( );
+
+	return ptr;
+}
+
+
+void OperatorPool::release( void* ptr, std::size_t size )
+{
+	if ( ptr == 0 )
+		return;
+
+	if ( size > poolMaxNodeSize )
+	{
+		::operator delete( ptr );
+		return;
+	}
+
+	const std::size_t idx = ( size + poolGranularity - 1 ) / poolGranularity - 1;
+
+	#pragma omp critical (acado_operator_pool)
+	{
+		( (PoolNode*)ptr )->next = poolFreeLists[ idx ];
+		poolFreeLists[ idx ] = (PoolNode*)ptr;
+
+		--poolNumNodes;
+	}
+}
+
+
+unsigned long OperatorPool::getNumNodes( )
+{
+	unsigned long n;
+
+	#pragma omp critical (acado_operator_pool)
+	n = poolNumNodes;
+
+	return n;
+}
+
+
+unsigned long OperatorPool::getNumReservedBytes( )
+{
+	unsigned long n;
+
+	#pragma omp critical (acado_operator_pool)
+	n = poolNumReservedBytes;
+
+	return n;
+}
+
+
+std::size_t OperatorPool::getMaxNodeSize( )
+{
+	return poolMaxNodeSize;
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+/*
+ *	end of file
+ */
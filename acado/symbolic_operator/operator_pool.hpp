@@ -0,0 +1,98 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+ *    \file include/acado/symbolic_operator/operator_pool.hpp
+ */
+
+
+#ifndef ACADO_TOOLKIT_OPERATOR_POOL_HPP
+#define ACADO_TOOLKIT_OPERATOR_POOL_HPP
+
+
+#include <acado/utils/acado_types.hpp>
+
+#include <cstddef>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Arena from which the nodes of symbolic operator trees are allocated.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *	Symbolic expressions consist of many small Operator objects which are
+ *	created and deleted over and over while expressions are built and
+ *	differentiated. The class OperatorPool serves them from large chunks of
+ *	memory instead of allocating every node separately: nodes are rounded up
+ *	to a multiple of 16 bytes, and deleted nodes are kept in one free list
+ *	per size, from where they are reused by the next node of the same size.
+ *	Nodes larger than getMaxNodeSize() bytes are allocated as usual.
+ *
+ *	Chunks are never returned to the system, i.e. the memory of the pool
+ *	is bounded by the largest number of nodes that existed at the same time.
+ *
+ *	The pool is used by Operator::operator new and Operator::operator delete
+ *	and is safe to use from several OpenMP threads.
+ */
+class OperatorPool
+{
+	//
+	//  PUBLIC MEMBER FUNCTIONS:
+	//
+	public:
+
+		/** Returns memory for a node of the given size. */
+		static void* allocate(	std::size_t size	/**< Size of the node in bytes. */
+								);
+
+		/** Returns the memory of a node to the pool. */
+		static void release(	void* ptr,			/**< Memory obtained by allocate(). */
+								std::size_t size	/**< Size passed to allocate().     */
+								);
+
+		/** Returns the number of nodes that are currently allocated from the pool. */
+		static unsigned long getNumNodes( );
+
+		/** Returns the number of bytes that the pool has reserved for its chunks. */
+		static unsigned long getNumReservedBytes( );
+
+		/** Returns the largest node size (in bytes) served by the pool. */
+		static std::size_t getMaxNodeSize( );
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#endif	// ACADO_TOOLKIT_OPERATOR_POOL_HPP
+
+
+/*
+ *	end of file
+ */
@@ -507,6 +507,58 @@ returnValue Power::AD_backward( int number, double seed, double *df ){
 }
 
 
+returnValue Power::AD_forward( int number, int nDir, double *seed, double *df ){
+
+    int run1;
+    returnValue returnvalue;
+
+    if( nDir > dirBufferSize ){
+        dirBufferSize = nDir;
+        dirBuffer     = (double*)realloc(dirBuffer,dirBufferSize*sizeof(double));
+    }
+
+    returnvalue = argument1->AD_forward( number, nDir, seed, df );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    returnvalue = argument2->AD_forward( number, nDir, seed, dirBuffer );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    const double c1 = argument2_result[number]*pow(argument1_result[number],argument2_result[number]-1.0);
+    const double c2 = pow(argument1_result[number],argument2_result[number])*log(argument1_result[number]);
+
+    for( run1 = 0; run1 < nDir; run1++ )
+        df[run1] = c1*df[run1] + c2*dirBuffer[run1];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue Power::AD_backward( int number, int nDir, double *seed, double *df ){
+
+    int run1;
+    returnValue returnvalue;
+
+    if( nDir > dirBufferSize ){
+        dirBufferSize = nDir;
+        dirBuffer     = (double*)realloc(dirBuffer,dirBufferSize*sizeof(double));
+    }
+
+    const double c1 = argument2_result[number]*pow(argument1_result[number],argument2_result[number]-1.0);
+    const double c2 = pow(argument1_result[number],argument2_result[number])*log(argument1_result[number]);
+
+    for( run1 = 0; run1 < nDir; run1++ )
+        dirBuffer[run1] = c1*seed[run1];
+
+    returnvalue = argument1->AD_backward( number, nDir, dirBuffer, df );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    for( run1 = 0; run1 < nDir; run1++ )
+        dirBuffer[run1] = c2*seed[run1];
+
+    return argument2->AD_backward( number, nDir, dirBuffer, df );
+}
+
+
 
 returnValue Power::AD_forward2( int number, double *seed, double *dseed,
                                 double *df, double *ddf ){
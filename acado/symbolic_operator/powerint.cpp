@@ -57,6 +57,8 @@ Power_Int::Power_Int( Operator *_argument, int _exponent ) : SmoothOperator( )
     argument_result   = (double*)calloc(1,sizeof(double));
     dargument_result  = (double*)calloc(1,sizeof(double));
     bufferSize        = 1                                ;
+    dirBuffer         = 0                                ;
+    dirBufferSize     = 0                                ;
     curvature         = CT_UNKNOWN                       ;
     monotonicity      = MT_UNKNOWN                       ;
 
@@ -94,6 +96,9 @@ Power_Int::Power_Int( const Power_Int &arg ){
        dargument_result[run1] = arg.dargument_result[run1];
 
     }
+    dirBuffer         = 0;
+    dirBufferSize     = 0;
+
     curvature         = arg.curvature   ;
     monotonicity      = arg.monotonicity;
 
@@ -127,6 +132,7 @@ Power_Int::~Power_Int(){
 
     free(  argument_result );
     free( dargument_result );
+    free( dirBuffer        );
 
     if( derivative != 0 ) {
     	delete derivative;
@@ -482,6 +488,38 @@ returnValue Power_Int::AD_backward( int number, double seed, double *df ){
 }
 
 
+returnValue Power_Int::AD_forward( int number, int nDir, double *seed, double *df ){
+
+    int run1;
+
+    returnValue returnvalue = argument->AD_forward( number, nDir, seed, df );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    const double nn = exponent*pow( argument_result[number],exponent-1 );
+    for( run1 = 0; run1 < nDir; run1++ )
+        df[run1] *= nn;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue Power_Int::AD_backward( int number, int nDir, double *seed, double *df ){
+
+    int run1;
+
+    if( nDir > dirBufferSize ){
+        dirBufferSize = nDir;
+        dirBuffer     = (double*)realloc(dirBuffer,dirBufferSize*sizeof(double));
+    }
+
+    const double nn = exponent*pow( argument_result[number],exponent-1 );
+    for( run1 = 0; run1 < nDir; run1++ )
+        dirBuffer[run1] = nn*seed[run1];
+
+    return argument->AD_backward( number, nDir, dirBuffer, df );
+}
+
+
 returnValue Power_Int::AD_forward2( int number, double *seed, double *dseed,
                                     double *df, double *ddf ){
 
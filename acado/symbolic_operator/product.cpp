@@ -406,6 +406,52 @@ returnValue Product::AD_backward( int number, double seed, double *df ){
 }
 
 
+returnValue Product::AD_forward( int number, int nDir, double *seed, double *df ){
+
+    int run1;
+    returnValue returnvalue;
+
+    if( nDir > dirBufferSize ){
+        dirBufferSize = nDir;
+        dirBuffer     = (double*)realloc(dirBuffer,dirBufferSize*sizeof(double));
+    }
+
+    returnvalue = argument1->AD_forward( number, nDir, seed, df );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    returnvalue = argument2->AD_forward( number, nDir, seed, dirBuffer );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    for( run1 = 0; run1 < nDir; run1++ )
+        df[run1] = argument2_result[number]*df[run1] + argument1_result[number]*dirBuffer[run1];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue Product::AD_backward( int number, int nDir, double *seed, double *df ){
+
+    int run1;
+    returnValue returnvalue;
+
+    if( nDir > dirBufferSize ){
+        dirBufferSize = nDir;
+        dirBuffer     = (double*)realloc(dirBuffer,dirBufferSize*sizeof(double));
+    }
+
+    for( run1 = 0; run1 < nDir; run1++ )
+        dirBuffer[run1] = argument2_result[number]*seed[run1];
+
+    returnvalue = argument1->AD_backward( number, nDir, dirBuffer, df );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    for( run1 = 0; run1 < nDir; run1++ )
+        dirBuffer[run1] = argument1_result[number]*seed[run1];
+
+    return argument2->AD_backward( number, nDir, dirBuffer, df );
+}
+
+
 returnValue Product::AD_forward2( int number, double *seed, double *dseed,
                                   double *df, double *ddf ){
 
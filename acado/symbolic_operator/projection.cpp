@@ -357,6 +357,30 @@ returnValue Projection::AD_backward( int number, double seed, double *df ){
 }
 
 
+returnValue Projection::AD_forward( int number, int nDir, double *seed, double *df ){
+
+    int run1;
+    const double *s = &seed[variableIndex*nDir];
+
+    for( run1 = 0; run1 < nDir; run1++ )
+        df[run1] = s[run1];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue Projection::AD_backward( int number, int nDir, double *seed, double *df ){
+
+    int run1;
+    double *d = &df[variableIndex*nDir];
+
+    for( run1 = 0; run1 < nDir; run1++ )
+        d[run1] += seed[run1];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue Projection::AD_forward2( int number, double *seed, double *dseed,
                                            double *df, double *ddf ){
 
@@ -423,6 +423,58 @@ returnValue Quotient::AD_backward( int number, double seed, double *df ){
 }
 
 
+returnValue Quotient::AD_forward( int number, int nDir, double *seed, double *df ){
+
+    int run1;
+    returnValue returnvalue;
+
+    if( nDir > dirBufferSize ){
+        dirBufferSize = nDir;
+        dirBuffer     = (double*)realloc(dirBuffer,dirBufferSize*sizeof(double));
+    }
+
+    returnvalue = argument1->AD_forward( number, nDir, seed, df );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    returnvalue = argument2->AD_forward( number, nDir, seed, dirBuffer );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    const double c1 =  1.0/argument2_result[number];
+    const double c2 = -argument1_result[number]/(argument2_result[number]*argument2_result[number]);
+
+    for( run1 = 0; run1 < nDir; run1++ )
+        df[run1] = c1*df[run1] + c2*dirBuffer[run1];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue Quotient::AD_backward( int number, int nDir, double *seed, double *df ){
+
+    int run1;
+    returnValue returnvalue;
+
+    if( nDir > dirBufferSize ){
+        dirBufferSize = nDir;
+        dirBuffer     = (double*)realloc(dirBuffer,dirBufferSize*sizeof(double));
+    }
+
+    const double c1 =  1.0/argument2_result[number];
+    const double c2 = -argument1_result[number]/(argument2_result[number]*argument2_result[number]);
+
+    for( run1 = 0; run1 < nDir; run1++ )
+        dirBuffer[run1] = c1*seed[run1];
+
+    returnvalue = argument1->AD_backward( number, nDir, dirBuffer, df );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    for( run1 = 0; run1 < nDir; run1++ )
+        dirBuffer[run1] = c2*seed[run1];
+
+    return argument2->AD_backward( number, nDir, dirBuffer, df );
+}
+
+
 returnValue Quotient::AD_forward2( int number, double *seed, double *dseed,
                                    double *df, double *ddf ){
 
@@ -363,6 +363,49 @@ returnValue Subtraction::AD_backward( int number, double seed, double *df ){
 }
 
 
+returnValue Subtraction::AD_forward( int number, int nDir, double *seed, double *df ){
+
+    int run1;
+    returnValue returnvalue;
+
+    if( nDir > dirBufferSize ){
+        dirBufferSize = nDir;
+        dirBuffer     = (double*)realloc(dirBuffer,dirBufferSize*sizeof(double));
+    }
+
+    returnvalue = argument1->AD_forward( number, nDir, seed, df );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    returnvalue = argument2->AD_forward( number, nDir, seed, dirBuffer );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    for( run1 = 0; run1 < nDir; run1++ )
+        df[run1] = df[run1] - dirBuffer[run1];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue Subtraction::AD_backward( int number, int nDir, double *seed, double *df ){
+
+    int run1;
+    returnValue returnvalue;
+
+    if( nDir > dirBufferSize ){
+        dirBufferSize = nDir;
+        dirBuffer     = (double*)realloc(dirBuffer,dirBufferSize*sizeof(double));
+    }
+
+    returnvalue = argument1->AD_backward( number, nDir, seed, df );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    for( run1 = 0; run1 < nDir; run1++ )
+        dirBuffer[run1] = -seed[run1];
+
+    return argument2->AD_backward( number, nDir, dirBuffer, df );
+}
+
+
 returnValue Subtraction::AD_forward2( int number, double *seed, double *dseed,
                                       double *df, double *ddf ){
 
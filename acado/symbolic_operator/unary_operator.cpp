@@ -46,6 +46,9 @@ UnaryOperator::UnaryOperator() : SmoothOperator( )
     ddfcn = 0;
     nCount = 0;
 
+    dirBuffer     = 0;
+    dirBufferSize = 0;
+
     derivative = 0;
     derivative2 = 0;
 }
@@ -61,6 +64,8 @@ UnaryOperator::UnaryOperator( Operator *_argument ) : SmoothOperator( )
     argument_result   = (double*)calloc(1,sizeof(double));
     dargument_result  = (double*)calloc(1,sizeof(double));
     bufferSize        = 1                                ;
+    dirBuffer         = 0                                ;
+    dirBufferSize     = 0                                ;
     curvature         = CT_UNKNOWN                       ;
     monotonicity      = MT_UNKNOWN                       ;
 
@@ -102,6 +107,9 @@ UnaryOperator::UnaryOperator( const UnaryOperator &arg ){
         dargument_result[run1] = arg.dargument_result[run1];
     }
 
+    dirBuffer     = 0;
+    dirBufferSize = 0;
+
     curvature    = arg.curvature   ;
     monotonicity = arg.monotonicity;
     cName        = arg.cName       ;
@@ -139,6 +147,7 @@ UnaryOperator::~UnaryOperator(){
 
     free(  argument_result );
     free( dargument_result );
+    free( dirBuffer        );
 }
 
 
@@ -383,6 +392,38 @@ returnValue UnaryOperator::AD_backward( int number, double seed, double *df ){
 }
 
 
+returnValue UnaryOperator::AD_forward( int number, int nDir, double *seed, double *df ){
+
+    int run1;
+
+    returnValue returnvalue = argument->AD_forward( number, nDir, seed, df );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    const double nn = (*dfcn)(argument_result[number]);
+    for( run1 = 0; run1 < nDir; run1++ )
+        df[run1] *= nn;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue UnaryOperator::AD_backward( int number, int nDir, double *seed, double *df ){
+
+    int run1;
+
+    if( nDir > dirBufferSize ){
+        dirBufferSize = nDir;
+        dirBuffer     = (double*)realloc(dirBuffer,dirBufferSize*sizeof(double));
+    }
+
+    const double nn = (*dfcn)(argument_result[number]);
+    for( run1 = 0; run1 < nDir; run1++ )
+        dirBuffer[run1] = nn*seed[run1];
+
+    return argument->AD_backward( number, nDir, dirBuffer, df );
+}
+
+
 returnValue UnaryOperator::AD_forward2( int number, double *seed, double *dseed,
                               double *df, double *ddf ){
 
@@ -73,6 +73,10 @@ const int 		defaultFreezeIntegrator = BT_TRUE;							/**< Default value for spec
 const int 		defaultIntegratorType = INT_RK45;							/**< Default value for integrator type (possible values: INT_RK12, INT_RK23, INT_RK45, INT_RK78, INT_BDF). */
 const int 		defaultFeasibilityCheck = BT_FALSE;							/**< Default value for specifying whether infeasibilty shall be checked (possible values: BT_TRUE, BT_FALSE). */
 const int 		defaultPlotResoltion = LOW;									/**< Default value for specifying the plot resolution (possible values: HIGH, MEDIUM, LOW). */
+const int 		defaultNumThreads = 1;										/**< Default value for the number of threads used to evaluate the shooting intervals (possible values: any positive integer). */
+const int 		defaultCollocationType = CT_RADAU_IIA;						/**< Default value for the collocation scheme (possible values: CT_GAUSS_LEGENDRE, CT_RADAU_IIA). */
+const int 		defaultCollocationNumPoints = 3;							/**< Default value for the number of collocation points per step (possible values: any integer between 1 and 9). */
+const int 		defaultCollocationNumSteps = 1;								/**< Default value for the number of collocation steps per interval (possible values: any positive integer). */
 
 // Integrator
 const int 		defaultMaxNumSteps = 1000;									/**< Default value for maximum number of integrator steps (possible values: any positive integer). */
@@ -84,7 +88,7 @@ const double 	defaultMaxStepsize = 1.0e+8;								/**< Default value for the max
 const double 	defaultStepsizeTuning = 0.5;								/**< Default value for the factor adapting the integrator stepsize (possible values: any positive real smaller than one). */
 const double 	defaultCorrectorTolerance = 1.0e-14;						/**< Default value for the corrector tolerance of implicit integrators (possible values: any positive real number). */
 const int 		defaultIntegratorPrintlevel = LOW;							/**< Default value for for the printlevel determining the quatity of output given by the integrator (possible values: HIGH, MEDIUM, LOW, NONE). */
-const int 		defaultLinearAlgebraSolver = HOUSEHOLDER_METHOD;			/**< Default value for specifying how the linear systems are solved within the integrator (possible values: HOUSEHOLDER_METHOD, SPARSE_LU). */
+const int 		defaultLinearAlgebraSolver = HOUSEHOLDER_METHOD;			/**< Default value for specifying how the linear systems are solved within the integrator (possible values: HOUSEHOLDER_METHOD, GAUSS_LU, SPARSE_LU). */
 const int 		defaultAlgebraicRelaxation = ART_ADAPTIVE_POLYNOMIAL;		/**< Default value for specifying how algebraic equations are relaxed within the integrator (possible values: ART_EXPONENTIAL, ART_ADAPTIVE_POLYNOMIAL). */
 const double	defaultRelaxationParameter = 0.5;							/**< Default value for the amount algebraic equations are relaxed within the integrator (possible values: any positive real number). */
 const int       defaultprintIntegratorProfile = BT_FALSE;					/**< Default value for specifying whether a runtime profile of the integrator shall be printed (possible values: BT_TRUE, BT_FALSE). */
@@ -344,6 +344,7 @@ ReturnValueList returnValueList[] =
 { RET_QPOASES_EMBEDDED_NOT_FOUND,				"Embedded qpOASES code not found", VS_VISIBLE },
 { RET_UNABLE_TO_EXPORT_STATEMENT,				"Unable to export statement due to incomplete definition", VS_VISIBLE },
 { RET_INVALID_CALL_TO_EXPORTED_FUNCTION,		"Invalid call to export functions (check number of calling arguments)", VS_VISIBLE },
+{ RET_JIT_COMPILATION_FAILED,					"Run-time compilation of a function failed", VS_VISIBLE },
 
 /* IMPORTANT: Terminal list element! */
 { TERMINAL_LIST_ELEMENT,						" ", VS_HIDDEN }
@@ -580,6 +581,11 @@ returnValue& returnValue::changeType(returnValueType _type) {
  */	
 void returnValue::print() {
 
+	// unhandled return values may be destroyed on concurrent threads (e.g.
+	// inside the integrators of parallel shooting intervals); keep their
+	// messages in one piece
+	#pragma omp critical (acado_logger)
+	{
 	cout 	<< COL_INFO"[ACADO] " << returnValueLevelToString( level )
 			<< ": " << returnValueTypeToString( type ) << COL_INFO << endl;
 
@@ -587,6 +593,7 @@ void returnValue::print() {
 		for (vector<const char*>::iterator it = data->messages.begin(); it != data->messages.end(); it++)
 			cout << "  " << (*it) << endl;
 	cout << endl;
+	}
 
 	status = STATUS_HANDLED;
 }
@@ -160,7 +160,8 @@ enum ImplicitIntegratorMode{
 	IFTR,			/**< With the reuse of the matrix evaluation and factorization from the previous step (1 evaluation and factorization per integration step). */
 	IFT,				/**< Without the reuse of the matrix from the previous step (2 evaluations and factorizations per integration step). */
 	LIFTED,
-	LIFTED_FEEDBACK
+	LIFTED_FEEDBACK,
+	INEXACT_NEWTON	/**< With the reuse of the factorization across integration steps, shooting intervals and calls, until the Newton iterations contract too slowly (see IMPLICIT_INTEGRATOR_MAX_CONTRACTION). */
 };
 
 
@@ -206,6 +207,14 @@ enum StateDiscretizationType{
 };
 
 
+/** Summarises all possible collocation schemes. */
+enum CollocationType{
+
+    CT_GAUSS_LEGENDRE,      /**< Gauss-Legendre collocation points. */
+    CT_RADAU_IIA            /**< Radau IIA collocation points.      */
+};
+
+
 /** Summarises all possible ways of discretising the system's states. */
 enum ControlParameterizationType{
 
@@ -336,16 +345,21 @@ enum OptionsName
     CG_MODULE_PREFIX,                           /**< Prefix used for all global variables (shall be all uppercase). */
 	CG_EXPORT_FOLDER_NAME,						/**< Export folder name. */
 	CG_USE_ARRIVAL_COST,						/**< Enable interface for arival cost calculation. */
-	CG_USE_OPENMP,								/**< Use OpenMP for parallelization in multiple shooting. */
+	CG_USE_OPENMP,								/**< Use OpenMP for parallelization of the integration, objective evaluation and condensing over the shooting intervals. */
+	CG_REENTRANT_CODE,							/**< Store all data in a context struct which is passed to every exported function, instead of global variables. */
+	CG_BATCH_SIZE,								/**< Number of trajectories for which SIMexport measures the throughput of the integrator in its test program (0 disables it). */
 	CG_USE_VARIABLE_WEIGHTING_MATRIX,			/**< Use variable weighting matrix S on first N shooting nodes. */
 	CG_USE_C99,									/**< Code generation is allowed (or not) to export C-code that conforms C99 standard. */
 	CG_COMPUTE_COVARIANCE_MATRIX,				/**< Enable computation of the variance-covariance matrix for the last estimate. */
 	CG_HARDCODE_CONSTRAINT_VALUES,				/**< Enable/disable hard-coding of the constraint values. */
+	CG_MULTIPLY_BLOCK_SIZE,						/**< Size of the register blocks of exported matrix multiplications which are not unrolled (0 or 1 disables blocking). */
+	CG_SPARSE_SENSITIVITIES,					/**< Exploit the structural sparsity of the model Jacobian in the sensitivity propagation of the exported integrators. */
 	IMPLICIT_INTEGRATOR_MODE,					/**< This determines the mode of the implicit integrator (see enum ImplicitIntegratorMode). */
 //	LIFTED_INTEGRATOR_MODE,						/**< This determines the mode of lifting of the implicit integrator. */
 	LIFTED_GRADIENT_UPDATE,						/**< This determines whether the gradient will be updated, based on the lifted implicit integrator. */
 	IMPLICIT_INTEGRATOR_NUM_ITS,				/**< This is the performed number of Newton iterations in the implicit integrator. */
 	IMPLICIT_INTEGRATOR_NUM_ITS_INIT,			/**< This is the performed number of Newton iterations in the implicit integrator for the initialization of the first step. */
+	IMPLICIT_INTEGRATOR_MAX_CONTRACTION,		/**< Contraction rate of the Newton iterations above which the INEXACT_NEWTON mode of the implicit integrator renews the factorization. */
 	UNROLL_LINEAR_SOLVER,						/**< This option of the boolean type determines the unrolling of the linear solver (no unrolling recommended for larger systems). */
 	CONDENSING_BLOCK_SIZE,						/**< Defines the block size used in a block based condensing approach for code generated RTI. */
 	INTEGRATOR_DEBUG_MODE,
@@ -423,7 +437,11 @@ enum OptionsName
 	GENERATE_SIMULINK_INTERFACE,
 	GENERATE_MATLAB_INTERFACE,
 	OPERATING_SYSTEM,
-	USE_SINGLE_PRECISION
+	USE_SINGLE_PRECISION,
+	NUM_THREADS,								/**< Number of threads used to evaluate independent shooting intervals (requires OpenMP). */
+	COLLOCATION_TYPE,							/**< Collocation scheme used by the COLLOCATION discretization (see CollocationType). */
+	COLLOCATION_NUM_POINTS,						/**< Number of collocation points per step of the COLLOCATION discretization. */
+	COLLOCATION_NUM_STEPS						/**< Number of collocation steps per interval of the COLLOCATION discretization. */
 };
 
 
@@ -495,6 +513,26 @@ enum LogName
 };
 
 
+/** Phases distinguished by the RuntimeProfiler. Phases may be nested, e.g.
+ *  function evaluations are also recorded within an integration.
+ */
+enum ProfilingPhase
+{
+	PP_FUNCTION_EVALUATION,		/**< Evaluation of a symbolic function. */
+	PP_INTEGRATION,				/**< Integration of the dynamics, including sensitivity sweeps. */
+	PP_SENSITIVITIES,			/**< Generation of all sensitivities of the NLP. */
+	PP_CONDENSING,				/**< Condensing or factorization of the structured QP. */
+	PP_QP,						/**< Solution of the (condensed) QP. */
+	PP_EXPANSION,				/**< Expansion of the QP solution. */
+	PP_LINE_SEARCH,				/**< Globalization of the SQP step. */
+	PP_HESSIAN_UPDATE,			/**< Computation or update of the Hessian approximation. */
+	PP_EXPORT_INTEGRATOR,		/**< Code export of the integrator module (setup and file). */
+	PP_EXPORT_SOLVER,			/**< Code export of the NLP solver module (setup and file). */
+	PP_EXPORT_FILES,			/**< Code export of the common header, auxiliary functions and templates. */
+	PP_NUM_PHASES				/**< Number of phases (no phase). */
+};
+
+
 enum PlotFrequency
 {
 	PLOT_AT_START,
@@ -1109,6 +1147,7 @@ RET_ONLY_BOUNDS_FOR_CODE_EXPORT,				/**< Only state and control bounds supported
 RET_QPOASES_EMBEDDED_NOT_FOUND,					/**< Embedded qpOASES code not found. */
 RET_UNABLE_TO_EXPORT_STATEMENT,					/**< Unable to export statement due to incomplete definition. */
 RET_INVALID_CALL_TO_EXPORTED_FUNCTION,			/**< Invalid call to export functions (check number of calling arguments). */
+RET_JIT_COMPILATION_FAILED,						/**< Run-time compilation of a function failed. */
 
 
 /* EXPORTED INTEGRATORS */
@@ -44,6 +44,7 @@
 #include <acado/utils/acado_message_handling.hpp>
 #include <acado/utils/acado_debugging.hpp>
 #include <acado/utils/acado_io_utils.hpp>
+#include <acado/utils/allocation_counter.hpp>
 
 // A very ugly hack
 #if (defined __MINGW32__ || defined __MINGW64__)
@@ -0,0 +1,140 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+*    \file src/utils/allocation_counter.cpp
+*/
+
+
+#include <acado/utils/allocation_counter.hpp>
+
+#ifdef ACADO_WITH_ALLOCATION_COUNTER
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+
+#ifndef __GLIBC__
+	#error "Counting of heap allocations is only supported for glibc."
+#endif
+
+
+static std::atomic< unsigned long > numAllocations( 0 );
+
+
+//
+// REPLACEMENTS OF THE ALLOCATION FUNCTIONS OF THE C LIBRARY:
+//
+// All heap allocations (operator new, Eigen, std::vector, strdup, ...) end
+// up in one of these functions, which count the call and forward it to the
+// implementation of glibc.
+//
+
+extern "C"
+{
+	void* __libc_malloc( std::size_t size );
+	void* __libc_calloc( std::size_t num, std::size_t size );
+	void* __libc_realloc( void* ptr, std::size_t size );
+	void* __libc_memalign( std::size_t alignment, std::size_t size );
+	void  __libc_free( void* ptr );
+
+
+	void* malloc( std::size_t size )
+	{
+		++numAllocations;
+		return __libc_malloc( size );
+	}
+
+	void* calloc( std::size_t num, std::size_t size )
+	{
+		++numAllocations;
+		return __libc_calloc( num,size );
+	}
+
+	void* realloc( void* ptr, std::size_t size )
+	{
+		++numAllocations;
+		return __libc_realloc( ptr,size );
+	}
+
+	void* memalign( std::size_t alignment, std::size_t size )
+	{
+		++numAllocations;
+		return __libc_memalign( alignment,size );
+	}
+
+	void* aligned_alloc( std::size_t alignment, std::size_t size )
+	{
+		++numAllocations;
+		return __libc_memalign( alignment,size );
+	}
+
+	int posix_memalign( void** ptr, std::size_t alignment, std::size_t size )
+	{
+		++numAllocations;
+		*ptr = __libc_memalign( alignment,size );
+
+		return ( *ptr != 0 || size == 0 ) ? 0 : ENOMEM;
+	}
+
+	void free( void* ptr )
+	{
+		__libc_free( ptr );
+	}
+}
+
+#endif	// ACADO_WITH_ALLOCATION_COUNTER
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+BooleanType AllocationCounter::isAvailable( )
+{
+#ifdef ACADO_WITH_ALLOCATION_COUNTER
+	return BT_TRUE;
+#else
+	return BT_FALSE;
+#endif
+}
+
+
+unsigned long AllocationCounter::getNumAllocations( )
+{
+#ifdef ACADO_WITH_ALLOCATION_COUNTER
+	return numAllocations.load( );
+#else
+	return 0;
+#endif
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+/*
+ *	end of file
+ */
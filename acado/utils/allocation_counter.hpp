@@ -0,0 +1,95 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+/**
+*    \file include/acado/utils/allocation_counter.hpp
+*/
+
+
+#ifndef ACADO_TOOLKIT_ALLOCATION_COUNTER_HPP
+#define ACADO_TOOLKIT_ALLOCATION_COUNTER_HPP
+
+
+#include <acado/utils/acado_types.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Counts the heap allocations of the process.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *	The class AllocationCounter allows to check that the steady state of a
+ *	real-time loop does not allocate heap memory: after some warm-up
+ *	iterations, the number of allocations must not change any more.
+ *
+ *	Counting replaces the allocation functions of the C library (malloc,
+ *	calloc, realloc and the aligned variants), through which all heap
+ *	allocations go, including those of operator new and Eigen. This is only
+ *	done if the counter has been compiled with ACADO_WITH_ALLOCATION_COUNTER,
+ *	which is supported for glibc; otherwise, the counter is not available
+ *	and always zero. Besides building ACADO with this option, a program may
+ *	compile allocation_counter.cpp itself with the definition, as the unit
+ *	tests do.
+ *
+ *	Example:
+ *	\code
+ *	unsigned long allocations = AllocationCounter::getNumAllocations( );
+ *	algorithm.feedbackStep( t,x );
+ *	ASSERT( AllocationCounter::getNumAllocations( ) == allocations );
+ *	\endcode
+ */
+class AllocationCounter
+{
+	//
+	//  PUBLIC MEMBER FUNCTIONS:
+	//
+	public:
+
+		/** Returns whether heap allocations are counted.
+		 *
+		 *  \return BT_TRUE iff ACADO has been built with ACADO_WITH_ALLOCATION_COUNTER
+		 */
+		static BooleanType isAvailable( );
+
+		/** Returns the number of heap allocations (including reallocations)
+		 *  of all threads since the start of the process.
+		 */
+		static unsigned long getNumAllocations( );
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#endif	// ACADO_TOOLKIT_ALLOCATION_COUNTER_HPP
+
+
+/*
+ *	end of file
+ */
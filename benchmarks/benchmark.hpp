@@ -0,0 +1,256 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file benchmarks/benchmark.hpp
+ *    \date 2014
+ *
+ *    Minimal timing harness shared by all benchmark applications.
+ *
+ *    Every benchmark application accepts the following arguments:
+ *
+ *    --output FILE       write the results to FILE (default: stdout only)
+ *    --baseline FILE     compare the results against the ones stored in FILE
+ *    --tolerance T       relative slowdown that is reported as regression (default: 0.10)
+ *    --min-time S        minimum measurement time per benchmark in seconds (default: 0.2)
+ *
+ *    Results are stored as one line per benchmark with tab-separated
+ *    fields: name, median time per call [s], minimum time per call [s]
+ *    and number of samples. Lines starting with '#' are comments. The
+ *    application returns a nonzero exit code if the minimum time of any
+ *    benchmark exceeds its baseline by more than the tolerance; the
+ *    minimum is far less sensitive to other load on the machine than
+ *    the median.
+ */
+
+
+#ifndef ACADO_BENCHMARKS_BENCHMARK_HPP
+#define ACADO_BENCHMARKS_BENCHMARK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+class BenchmarkSuite
+{
+public:
+
+	BenchmarkSuite(	const std::string& _suiteName,
+					int argc,
+					char** argv
+					)
+		: suiteName( _suiteName ), tolerance( 0.10 ), minTime( 0.2 )
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			if (strcmp(argv[ i ], "--output") == 0 && i + 1 < argc)
+				outputFile = argv[ ++i ];
+			else if (strcmp(argv[ i ], "--baseline") == 0 && i + 1 < argc)
+				baselineFile = argv[ ++i ];
+			else if (strcmp(argv[ i ], "--tolerance") == 0 && i + 1 < argc)
+				tolerance = atof( argv[ ++i ] );
+			else if (strcmp(argv[ i ], "--min-time") == 0 && i + 1 < argc)
+				minTime = atof( argv[ ++i ] );
+		}
+	}
+
+	/** Returns the current wall-clock time in seconds. */
+	static double now( )
+	{
+		return std::chrono::duration< double >(
+				std::chrono::steady_clock::now().time_since_epoch() ).count();
+	}
+
+	/** Times a callable: calls are batched such that one sample takes  \n
+	 *  at least about a millisecond, and samples are taken until the   \n
+	 *  minimum measurement time is reached (at least five samples).    \n
+	 */
+	template< typename F >
+	void run(	const std::string& name,
+				F f
+				)
+	{
+		// warm-up and calibration of the batch size
+		f();
+
+		unsigned batch = 1;
+		for (;;)
+		{
+			double t0 = now();
+			for (unsigned k = 0; k < batch; ++k)
+				f();
+			double t = now() - t0;
+
+			if (t >= 1.0e-3 || batch >= (1u << 20))
+				break;
+			batch *= 2;
+		}
+
+		std::vector< double > samples;
+		double start = now();
+
+		while (samples.size() < 5 || now() - start < minTime)
+		{
+			double t0 = now();
+			for (unsigned k = 0; k < batch; ++k)
+				f();
+			samples.push_back( (now() - t0) / batch );
+		}
+
+		add(name, samples);
+	}
+
+	/** Adds externally measured samples (times per call in seconds). */
+	void add(	const std::string& name,
+				std::vector< double > samples
+				)
+	{
+		if (samples.size() == 0)
+			return;
+
+		std::sort(samples.begin(), samples.end());
+
+		Result r;
+		r.name = suiteName + "/" + name;
+		r.median = samples[ samples.size() / 2 ];
+		r.min = samples.front();
+		r.samples = samples.size();
+
+		results.push_back( r );
+
+		std::cout << std::left << std::setw( 48 ) << r.name << std::right
+				<< std::scientific << std::setprecision( 3 )
+				<< "  median " << r.median << " s  min " << r.min << " s  ("
+				<< r.samples << " samples)" << std::endl;
+	}
+
+	/** Returns the minimum measurement time per benchmark. */
+	double getMinTime( ) const
+	{
+		return minTime;
+	}
+
+	/** Writes the results and compares them against the baseline.  \n
+	 *                                                               \n
+	 *  \return EXIT_SUCCESS, or EXIT_FAILURE if a regression occurred \n
+	 */
+	int finish( )
+	{
+		if (outputFile.empty() == false)
+		{
+			std::ofstream out( outputFile.c_str() );
+			if (out.is_open() == false)
+			{
+				std::cerr << "Cannot write benchmark results to " << outputFile << std::endl;
+				return EXIT_FAILURE;
+			}
+
+			out << "# name\tmedian [s]\tmin [s]\tsamples" << std::endl;
+			out << std::scientific << std::setprecision( 6 );
+			for (unsigned i = 0; i < results.size(); ++i)
+				out << results[ i ].name << "\t" << results[ i ].median << "\t"
+					<< results[ i ].min << "\t" << results[ i ].samples << std::endl;
+		}
+
+		if (baselineFile.empty() == true)
+			return EXIT_SUCCESS;
+
+		std::ifstream in( baselineFile.c_str() );
+		if (in.is_open() == false)
+		{
+			std::cout << "No baseline found at " << baselineFile << ", skipping comparison." << std::endl;
+			return EXIT_SUCCESS;
+		}
+
+		std::map< std::string, double > baseline;
+		std::string line;
+		while (std::getline(in, line))
+		{
+			if (line.empty() == true || line[ 0 ] == '#')
+				continue;
+
+			std::istringstream ss( line );
+			std::string name;
+			double median, min;
+			if (ss >> name >> median >> min)
+				baseline[ name ] = min;
+		}
+
+		int status = EXIT_SUCCESS;
+		for (unsigned i = 0; i < results.size(); ++i)
+		{
+			std::map< std::string, double >::const_iterator it = baseline.find( results[ i ].name );
+			if (it == baseline.end() || it->second <= 0.0)
+				continue;
+
+			double ratio = results[ i ].min / it->second;
+			if (ratio > 1.0 + tolerance)
+			{
+				std::cout << "REGRESSION " << results[ i ].name << ": " << std::fixed
+						<< std::setprecision( 2 ) << ratio << "x of baseline" << std::endl;
+				status = EXIT_FAILURE;
+			}
+		}
+
+		return status;
+	}
+
+private:
+
+	struct Result
+	{
+		std::string name;
+		double median;
+		double min;
+		unsigned long samples;
+	};
+
+	std::string suiteName;
+	std::string outputFile;
+	std::string baselineFile;
+	double tolerance;
+	double minTime;
+
+	std::vector< Result > results;
+};
+
+
+#endif  // ACADO_BENCHMARKS_BENCHMARK_HPP
+
+/*
+ *  end of file
+ */
@@ -0,0 +1,286 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file benchmarks/benchmark_models.hpp
+ *    \date 2014
+ *
+ *    Reference models of the benchmark suite, taken from the code
+ *    generation examples: the overhead crane (crane_kul_mhe), the
+ *    continuous stirred tank reactor (cstr) and the kite carousel
+ *    (kite_carousel).
+ */
+
+
+#ifndef ACADO_BENCHMARKS_BENCHMARK_MODELS_HPP
+#define ACADO_BENCHMARKS_BENCHMARK_MODELS_HPP
+
+#include <acado_toolkit.hpp>
+
+#include <string>
+#include <vector>
+
+
+/** A reference model together with a nominal operating point. */
+struct BenchmarkModel
+{
+	std::string name;
+
+	ACADO::DifferentialEquation f;		/**< The model equations.                  */
+	ACADO::Expression x;				/**< The differential states.              */
+	ACADO::Expression u;				/**< The controls.                         */
+
+	ACADO::DVector x0;					/**< Nominal state.                        */
+	ACADO::DVector u0;					/**< Nominal control.                      */
+	ACADO::DVector uMin;				/**< Lower control bounds.                 */
+	ACADO::DVector uMax;				/**< Upper control bounds.                 */
+
+	double T;							/**< Length of one shooting interval.      */
+	unsigned N;							/**< Number of shooting intervals.         */
+};
+
+
+/** Resets the variable counters, such that every model starts at index zero. */
+inline void clearBenchmarkCounters( )
+{
+	ACADO::DifferentialState x;
+	x.clearStaticCounters();
+	ACADO::Control u;
+	u.clearStaticCounters();
+	ACADO::IntermediateState is;
+	is.clearStaticCounters();
+}
+
+
+/*
+ *  The states and controls are declared as vectors, such that single
+ *  components keep their variable type (e.g. when used in bounds).
+ */
+
+
+/** Overhead crane with cable length dynamics (8 states, 2 controls). */
+inline BenchmarkModel getCraneModel( )
+{
+	USING_NAMESPACE_ACADO
+
+	clearBenchmarkCounters();
+
+	DifferentialState x("", 8, 1);
+	Control u("", 2, 1);
+
+	Expression xT = x( 0 ), vT = x( 1 ), xL = x( 2 ), vL = x( 3 );
+	Expression phi = x( 4 ), omega = x( 5 ), uT = x( 6 ), uL = x( 7 );
+	Expression duT = u( 0 ), duL = u( 1 );
+
+	const double tau1 = 0.012790605943772;
+	const double a1   = 0.047418203070092;
+	const double tau2 = 0.024695192379264;
+	const double a2   = 0.034087337273386;
+	const double g    = 9.81;
+
+	BenchmarkModel m;
+	m.name = "crane";
+
+	m.f << dot(xT) == vT;
+	m.f << dot(vT) == -1.0 / tau1 * vT + a1 / tau1 * uT;
+	m.f << dot(xL) == vL;
+	m.f << dot(vL) == -1.0 / tau2 * vL + a2 / tau2 * uL;
+	m.f << dot(phi) == omega;
+	m.f << dot(omega) == -(g * sin(phi) + a1 * duT * cos(phi) + 2 * vL * omega) / xL;
+	m.f << dot(uT) == duT;
+	m.f << dot(uL) == duL;
+
+	m.x = x;
+	m.u = u;
+
+	m.x0 = zeros<double>( 8 );
+	m.x0( 2 ) = 0.8;
+	m.x0( 4 ) = 0.1;
+	m.u0 = zeros<double>( 2 );
+	m.uMin = -10.0 * ones<double>( 2 );
+	m.uMax =  10.0 * ones<double>( 2 );
+
+	m.T = 0.1;
+	m.N = 20;
+
+	return m;
+}
+
+
+/** Continuous stirred tank reactor (4 states, 2 controls). */
+inline BenchmarkModel getCstrModel( )
+{
+	USING_NAMESPACE_ACADO
+
+	clearBenchmarkCounters();
+
+	const double k10 =  1.287e12;
+	const double k20 =  1.287e12;
+	const double k30 =  9.043e09;
+	const double E1  =  -9758.3;
+	const double E2  =  -9758.3;
+	const double E3  =  -8560.0;
+	const double H1  =      4.2;
+	const double H2  =    -11.0;
+	const double H3  =    -41.85;
+	const double rho =      0.9342;
+	const double Cp  =      3.01;
+	const double kw  =   4032.0;
+	const double AR  =      0.215;
+	const double VR  =     10.0;
+	const double mK  =      5.0;
+	const double CPK =      2.0;
+	const double cA0    =    5.1;
+	const double theta0 =  104.9;
+	const double TIMEUNITS_PER_HOUR = 3600.0;
+
+	DifferentialState x("", 4, 1);
+	Control u("", 2, 1);
+
+	Expression cA = x( 0 ), cB = x( 1 ), theta = x( 2 ), thetaK = x( 3 );
+
+	IntermediateState k1, k2, k3;
+	k1 = k10*exp(E1/(273.15 +theta));
+	k2 = k20*exp(E2/(273.15 +theta));
+	k3 = k30*exp(E3/(273.15 +theta));
+
+	BenchmarkModel m;
+	m.name = "cstr";
+
+	m.f << dot(cA) == (1/TIMEUNITS_PER_HOUR)*(u(0)*(cA0-cA) - k1*cA - k3*cA*cA);
+	m.f << dot(cB) == (1/TIMEUNITS_PER_HOUR)* (- u(0)*cB + k1*cA - k2*cB);
+	m.f << dot(theta) == (1/TIMEUNITS_PER_HOUR)*(u(0)*(theta0-theta) - (1/(rho*Cp)) *(k1*cA*H1 + k2*cB*H2 + k3*cA*cA*H3)+(kw*AR/(rho*Cp*VR))*(thetaK -theta));
+	m.f << dot(thetaK) == (1/TIMEUNITS_PER_HOUR)*((1/(mK*CPK))*(u(1) + kw*AR*(theta-thetaK)));
+
+	m.x = x;
+	m.u = u;
+
+	m.x0 = DVector( 4 );
+	m.x0( 0 ) = 2.1402105301746182e00;
+	m.x0( 1 ) = 1.0903043613077321e00;
+	m.x0( 2 ) = 1.1419108442079495e02;
+	m.x0( 3 ) = 1.1290659291045561e02;
+	m.u0 = DVector( 2 );
+	m.u0( 0 ) = 14.19;
+	m.u0( 1 ) = -1113.50;
+	m.uMin = DVector( 2 );
+	m.uMin( 0 ) = 3.0;
+	m.uMin( 1 ) = -9000.0;
+	m.uMax = DVector( 2 );
+	m.uMax( 0 ) = 35.0;
+	m.uMax( 1 ) = 0.0;
+
+	m.T = 150.0;
+	m.N = 10;
+
+	return m;
+}
+
+
+/** Kite on a rotating carousel (4 states, 2 controls). */
+inline BenchmarkModel getKiteModel( )
+{
+	USING_NAMESPACE_ACADO
+
+	clearBenchmarkCounters();
+
+	DifferentialState x("", 4, 1);
+	Control u("", 2, 1);
+
+	Expression phi = x( 0 ), theta = x( 1 ), dphi = x( 2 ), dtheta = x( 3 );
+	Expression u1 = u( 0 ), u2 = u( 1 );
+
+	const double R     = 1.00;
+	const double Omega = 1.00;
+	const double mass  = 0.80;
+	const double r     = 1.00;
+	const double A     = 0.15;
+	const double rho   = 1.20;
+	const double CL    = 1.00;
+	const double CD    = 0.15;
+	const double b     = 15.00;
+	const double g     = 9.81;
+
+	IntermediateState c;
+	c = ( (R*R*Omega*Omega)
+			+ (r*r)*( (Omega+dphi)*(Omega+dphi) + dtheta*dtheta )
+			+ (2.0*r*R*Omega)*( (Omega+dphi)*sin(theta)*cos(phi)
+					+ dtheta*cos(theta)*sin(phi) ) ) * ( A*rho/( 2.0*mass ) );
+
+	BenchmarkModel m;
+	m.name = "kite";
+
+	m.f << dot( phi ) == dphi;
+	m.f << dot( theta ) == dtheta;
+	m.f << dot( dphi ) == ( 2.0*r*(Omega+dphi)*dtheta*cos(theta)
+			+ (R*Omega*Omega)*sin(phi)
+			+ c*(CD*(1.0+u2)+CL*(1.0+0.5*u2)*phi) ) / (-r*sin(theta));
+	m.f << dot( dtheta ) == ( (R*Omega*Omega)*cos(theta)*cos(phi)
+			+ r*(Omega+dphi)*sin(theta)*cos(theta)
+			+ g*sin(theta) - c*( CL*u1 + b*dtheta ) ) / r;
+
+	m.x = x;
+	m.u = u;
+
+	m.x0 = zeros<double>( 4 );
+	m.x0( 0 ) = -4.2155955213988627e-02;
+	m.x0( 1 ) =  1.8015724412870739e+00;
+	m.u0 = DVector( 2 );
+	m.u0( 0 ) = 20.5;
+	m.u0( 1 ) = -0.1;
+	m.uMin = DVector( 2 );
+	m.uMin( 0 ) = 18.0;
+	m.uMin( 1 ) = -0.2;
+	m.uMax = DVector( 2 );
+	m.uMax( 0 ) = 22.0;
+	m.uMax( 1 ) = 0.2;
+
+	m.T = 2.0 * M_PI / 10.0;
+	m.N = 10;
+
+	return m;
+}
+
+
+/** Returns all reference models. */
+inline std::vector< BenchmarkModel > getBenchmarkModels( )
+{
+	std::vector< BenchmarkModel > models;
+
+	models.push_back( getCraneModel() );
+	models.push_back( getCstrModel() );
+	models.push_back( getKiteModel() );
+
+	return models;
+}
+
+
+#endif  // ACADO_BENCHMARKS_BENCHMARK_MODELS_HPP
+
+/*
+ *  end of file
+ */
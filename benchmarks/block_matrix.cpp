@@ -0,0 +1,111 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file benchmarks/block_matrix.cpp
+ *    \date 2014
+ *
+ *    Times the basic operations of the BlockMatrix class on block banded
+ *    matrices, as they occur in multiple shooting.
+ */
+
+
+#include "benchmark.hpp"
+
+#include <acado_toolkit.hpp>
+
+USING_NAMESPACE_ACADO
+
+
+/** Sets up a block tridiagonal matrix with dense blocks of size nb. */
+static BlockMatrix getBandedMatrix( unsigned N, unsigned nb )
+{
+	BlockMatrix B( N, N );
+
+	for (unsigned i = 0; i < N; ++i)
+	{
+		for (unsigned j = (i > 0 ? i - 1 : 0); j < N && j <= i + 1; ++j)
+		{
+			DMatrix block = DMatrix::Random(nb, nb);
+			B.setDense(i, j, block);
+		}
+	}
+
+	return B;
+}
+
+
+int main( int argc, char** argv )
+{
+	BenchmarkSuite suite( "block_matrix", argc, argv );
+
+	const unsigned sizes[][ 2 ] = { { 20, 4 }, { 20, 12 }, { 50, 8 } };
+
+	for (unsigned s = 0; s < sizeof( sizes ) / sizeof( sizes[ 0 ] ); ++s)
+	{
+		unsigned N  = sizes[ s ][ 0 ];
+		unsigned nb = sizes[ s ][ 1 ];
+
+		std::string name = "N" + std::to_string( N ) + "_nb" + std::to_string( nb );
+
+		BlockMatrix A = getBandedMatrix(N, nb);
+		BlockMatrix B = getBandedMatrix(N, nb);
+		BlockMatrix C;
+
+		suite.run(name + "/add", [&]( ) {
+			C = A + B;
+		});
+
+		suite.run(name + "/multiply", [&]( ) {
+			C = A * B;
+		});
+
+		suite.run(name + "/transposeMultiply", [&]( ) {
+			C = A ^ B;
+		});
+
+		suite.run(name + "/transpose", [&]( ) {
+			C = A.transpose();
+		});
+
+		suite.run(name + "/getAbsolute", [&]( ) {
+			C = A.getAbsolute();
+		});
+
+		suite.run(name + "/setDense", [&]( ) {
+			BlockMatrix D( N, N );
+			DMatrix block;
+			for (unsigned i = 0; i < N; ++i)
+			{
+				A.getSubBlock(i, i, block);
+				D.setDense(i, i, block);
+			}
+		});
+	}
+
+	return suite.finish();
+}
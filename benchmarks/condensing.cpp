@@ -0,0 +1,125 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file benchmarks/condensing.cpp
+ *    \date 2014
+ *
+ *    Times the condensing, the QP solution and the expansion of the
+ *    CondensingBasedCPsolver within SQP iterations on tracking problems
+ *    of the reference models. The times are taken from the log of the
+ *    solver, which measures exactly these phases.
+ */
+
+
+#include "benchmark.hpp"
+#include "benchmark_models.hpp"
+
+USING_NAMESPACE_ACADO
+
+
+/** Appends the logged values of one item to the samples. */
+static void appendSamples(	const LogRecord& logRecord,
+							LogName name,
+							std::vector< double >& samples
+							)
+{
+	MatrixVariablesGrid values;
+	logRecord.getAll(name, values);
+
+	for (unsigned k = 0; k < values.getNumPoints(); ++k)
+		if (values.getNumValues( k ) > 0)
+			samples.push_back( values(k, 0, 0) );
+}
+
+
+int main( int argc, char** argv )
+{
+	BenchmarkSuite suite( "condensing", argc, argv );
+
+	std::vector< BenchmarkModel > models = getBenchmarkModels();
+
+	for (unsigned i = 0; i < models.size(); ++i)
+	{
+		const BenchmarkModel& m = models[ i ];
+
+		Function h;
+		h << m.x << m.u;
+
+		DMatrix S = eye<double>( h.getDim() );
+		DVector r = m.x0;
+		r.append( m.u0 );
+
+		OCP ocp(0.0, m.T * m.N, m.N);
+		ocp.minimizeLSQ(S, h, r);
+		ocp.subjectTo( m.f );
+		for (unsigned j = 0; j < m.u.getDim(); ++j)
+			ocp.subjectTo( m.uMin( j ) <= m.u( j ) <= m.uMax( j ) );
+
+		// start away from the operating point
+		for (unsigned j = 0; j < m.x.getDim(); ++j)
+			ocp.subjectTo( AT_START, m.x( j ) == 1.05 * m.x0( j ) );
+
+		std::vector< double > condense, qp, expand;
+		double start = BenchmarkSuite::now();
+
+		while (condense.size() < 5 || BenchmarkSuite::now() - start < suite.getMinTime())
+		{
+			OptimizationAlgorithm algorithm( ocp );
+
+			algorithm.set(SPARSE_QP_SOLUTION, CONDENSING);
+			algorithm.set(HESSIAN_APPROXIMATION, GAUSS_NEWTON);
+			algorithm.set(MAX_NUM_ITERATIONS, 10);
+			algorithm.set(PRINTLEVEL, NONE);
+			algorithm.set(PRINT_COPYRIGHT, NO);
+
+			LogRecord logRecord( LOG_AT_EACH_ITERATION );
+			logRecord << LOG_TIME_CONDENSING;
+			logRecord << LOG_TIME_QP;
+			logRecord << LOG_TIME_EXPAND;
+			algorithm << logRecord;
+
+			if (algorithm.solve() != SUCCESSFUL_RETURN)
+			{
+				std::cerr << "Solving the " << m.name << " problem failed." << std::endl;
+				return EXIT_FAILURE;
+			}
+
+			algorithm.getLogRecord( logRecord );
+
+			appendSamples(logRecord, LOG_TIME_CONDENSING, condense);
+			appendSamples(logRecord, LOG_TIME_QP, qp);
+			appendSamples(logRecord, LOG_TIME_EXPAND, expand);
+		}
+
+		suite.add(m.name + "/condense", condense);
+		suite.add(m.name + "/solveQP", qp);
+		suite.add(m.name + "/expand", expand);
+	}
+
+	return suite.finish();
+}
@@ -0,0 +1,113 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file benchmarks/function_evaluation.cpp
+ *    \date 2014
+ *
+ *    Times the evaluation and the automatic differentiation (scalar and
+ *    vector mode) of the right-hand sides of the reference models.
+ */
+
+
+#include "benchmark.hpp"
+#include "benchmark_models.hpp"
+
+USING_NAMESPACE_ACADO
+
+
+int main( int argc, char** argv )
+{
+	BenchmarkSuite suite( "function_evaluation", argc, argv );
+
+	std::vector< BenchmarkModel > models = getBenchmarkModels();
+
+	for (unsigned i = 0; i < models.size(); ++i)
+	{
+		const BenchmarkModel& m = models[ i ];
+
+		Expression rhs;
+		models[ i ].f.getExpression( rhs );
+
+		Function F;
+		F << rhs;
+
+		int nVars = F.getNumberOfVariables() + 1;
+		int nDim  = F.getDim();
+		int nX    = m.x.getDim();
+		int nU    = m.u.getDim();
+		int nDir  = nX + nU;
+
+		std::vector< double > x( nVars, 0.0 ), result( nDim, 0.0 );
+
+		for (int j = 0; j < nX; ++j)
+			x[ F.index(VT_DIFFERENTIAL_STATE, j) ] = m.x0( j );
+		for (int j = 0; j < nU; ++j)
+			x[ F.index(VT_CONTROL, j) ] = m.u0( j );
+
+		// Forward seeds: first state direction (scalar mode), identity
+		// w.r.t. states and controls (vector mode)
+		std::vector< double > seed( nVars, 0.0 ), df( nDim, 0.0 );
+		std::vector< double > seedBlock( nVars * nDir, 0.0 ), dfBlock( nDim * nDir, 0.0 );
+
+		seed[ F.index(VT_DIFFERENTIAL_STATE, 0) ] = 1.0;
+		for (int j = 0; j < nX; ++j)
+			seedBlock[ F.index(VT_DIFFERENTIAL_STATE, j) * nDir + j ] = 1.0;
+		for (int j = 0; j < nU; ++j)
+			seedBlock[ F.index(VT_CONTROL, j) * nDir + nX + j ] = 1.0;
+
+		// Backward seeds: first output (scalar mode), all outputs (vector mode)
+		std::vector< double > bSeed( nDim, 0.0 ), bDf( nVars, 0.0 );
+		std::vector< double > bSeedBlock( nDim * nDim, 0.0 ), bDfBlock( nVars * nDim, 0.0 );
+
+		bSeed[ 0 ] = 1.0;
+		for (int j = 0; j < nDim; ++j)
+			bSeedBlock[ j * nDim + j ] = 1.0;
+
+		suite.run(m.name + "/evaluate", [&]( ) {
+			F.evaluate(0, x.data(), result.data());
+		});
+
+		suite.run(m.name + "/AD_forward", [&]( ) {
+			F.AD_forward(0, seed.data(), df.data());
+		});
+
+		suite.run(m.name + "/AD_forward_block", [&]( ) {
+			F.AD_forward(0, nDir, seedBlock.data(), dfBlock.data());
+		});
+
+		suite.run(m.name + "/AD_backward", [&]( ) {
+			F.AD_backward(0, bSeed.data(), bDf.data());
+		});
+
+		suite.run(m.name + "/AD_backward_block", [&]( ) {
+			F.AD_backward(0, nDim, bSeedBlock.data(), bDfBlock.data());
+		});
+	}
+
+	return suite.finish();
+}
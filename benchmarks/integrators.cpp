@@ -0,0 +1,129 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file benchmarks/integrators.cpp
+ *    \date 2014
+ *
+ *    Times every integrator type on one shooting interval of the reference
+ *    models, and the first order forward and backward sensitivity sweeps
+ *    along a stored trajectory.
+ */
+
+
+#include "benchmark.hpp"
+#include "benchmark_models.hpp"
+
+#include <memory>
+
+USING_NAMESPACE_ACADO
+
+
+static Integrator* createIntegrator(	const std::string& type,
+										const DifferentialEquation& f
+										)
+{
+	if (type == "RK12")
+		return new IntegratorRK12( f );
+	if (type == "RK23")
+		return new IntegratorRK23( f );
+	if (type == "RK45")
+		return new IntegratorRK45( f );
+	if (type == "RK78")
+		return new IntegratorRK78( f );
+
+	return new IntegratorBDF( f );
+}
+
+
+int main( int argc, char** argv )
+{
+	BenchmarkSuite suite( "integrators", argc, argv );
+
+	std::vector< BenchmarkModel > models = getBenchmarkModels();
+
+	// the tolerances are chosen such that the low order methods do not
+	// end up taking thousands of steps on the crane model
+	const char* types[] = { "RK12", "RK23", "RK45", "RK78", "BDF" };
+	const double tolerances[] = { 1.0e-3, 1.0e-4, 1.0e-6, 1.0e-6, 1.0e-6 };
+
+	for (unsigned i = 0; i < models.size(); ++i)
+	{
+		const BenchmarkModel& m = models[ i ];
+
+		for (unsigned t = 0; t < sizeof( types ) / sizeof( types[ 0 ] ); ++t)
+		{
+			std::string name = m.name + "/" + types[ t ];
+
+			std::unique_ptr< Integrator > integrator( createIntegrator(types[ t ], m.f) );
+			std::unique_ptr< Integrator > forward( createIntegrator(types[ t ], m.f) );
+			std::unique_ptr< Integrator > backward( createIntegrator(types[ t ], m.f) );
+
+			// separate instances, as forward seeds block backward sweeps;
+			// the sensitivity instances store their trajectory once and
+			// only the sweeps are timed
+			Integrator* all[] = { integrator.get(), forward.get(), backward.get() };
+			for (unsigned k = 0; k < 3; ++k)
+			{
+				all[ k ]->set(INTEGRATOR_TOLERANCE, tolerances[ t ]);
+				all[ k ]->set(MAX_NUM_INTEGRATOR_STEPS, 100000);
+				if (k > 0)
+					all[ k ]->freezeAll();
+			}
+
+			for (unsigned k = 0; k < 3; ++k)
+			{
+				if (all[ k ]->integrate(0.0, m.T, m.x0, emptyVector, emptyVector, m.u0) != SUCCESSFUL_RETURN)
+				{
+					std::cerr << "Integration of " << name << " failed." << std::endl;
+					return EXIT_FAILURE;
+				}
+			}
+
+			DVector seedX = zeros<double>( m.x.getDim() );
+			DVector seedBackward = zeros<double>( m.x.getDim() );
+			seedX( 0 ) = 1.0;
+			seedBackward( 0 ) = 1.0;
+
+			suite.run(name + "/integrate", [&]( ) {
+				integrator->integrate(0.0, m.T, m.x0, emptyVector, emptyVector, m.u0);
+			});
+
+			suite.run(name + "/forward_sweep", [&]( ) {
+				forward->setForwardSeed(1, seedX);
+				forward->integrateSensitivities();
+			});
+
+			suite.run(name + "/backward_sweep", [&]( ) {
+				backward->setBackwardSeed(1, seedBackward);
+				backward->integrateSensitivities();
+			});
+		}
+	}
+
+	return suite.finish();
+}
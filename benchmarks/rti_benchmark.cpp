@@ -0,0 +1,105 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file benchmarks/rti_benchmark.cpp
+ *    \date 2014
+ *
+ *    Times the preparation and the feedback step of an exported RTI
+ *    scheme, which is compiled together with the code generated by
+ *    rti_export. The problem is solved repeatedly from an initial state
+ *    slightly away from the nominal operating point.
+ */
+
+
+#include "benchmark.hpp"
+
+#include "acado_common.h"
+#include "acado_auxiliary_functions.h"
+
+#include "benchmark_init.h"
+
+
+ACADOvariables acadoVariables;
+ACADOworkspace acadoWorkspace;
+
+
+int main( int argc, char** argv )
+{
+	BenchmarkSuite suite( "rti", argc, argv );
+
+	acado_initializeSolver();
+
+	for (int i = 0; i < ACADO_N + 1; ++i)
+		for (int j = 0; j < ACADO_NX; ++j)
+			acadoVariables.x[i * ACADO_NX + j] = benchmarkX0[ j ];
+
+	for (int i = 0; i < ACADO_N; ++i)
+		for (int j = 0; j < ACADO_NU; ++j)
+			acadoVariables.u[i * ACADO_NU + j] = benchmarkU0[ j ];
+
+	for (int i = 0; i < ACADO_N; ++i)
+	{
+		for (int j = 0; j < ACADO_NX; ++j)
+			acadoVariables.y[i * ACADO_NY + j] = benchmarkX0[ j ];
+		for (int j = 0; j < ACADO_NU; ++j)
+			acadoVariables.y[i * ACADO_NY + ACADO_NX + j] = benchmarkU0[ j ];
+	}
+
+	for (int j = 0; j < ACADO_NYN; ++j)
+		acadoVariables.yN[ j ] = benchmarkX0[ j ];
+
+	for (int j = 0; j < ACADO_NX; ++j)
+		acadoVariables.x0[ j ] = 1.05 * benchmarkX0[ j ];
+
+	// warm-up
+	for (int k = 0; k < 10; ++k)
+	{
+		acado_preparationStep();
+		acado_feedbackStep();
+	}
+
+	std::vector< double > preparation, feedback;
+	double start = BenchmarkSuite::now();
+
+	while (preparation.size() < 100 || BenchmarkSuite::now() - start < suite.getMinTime())
+	{
+		double t0 = BenchmarkSuite::now();
+		acado_preparationStep();
+		double t1 = BenchmarkSuite::now();
+		acado_feedbackStep();
+		double t2 = BenchmarkSuite::now();
+
+		preparation.push_back(t1 - t0);
+		feedback.push_back(t2 - t1);
+	}
+
+	suite.add(std::string( BENCHMARK_MODEL ) + "/preparationStep", preparation);
+	suite.add(std::string( BENCHMARK_MODEL ) + "/feedbackStep", feedback);
+
+	return suite.finish();
+}
@@ -0,0 +1,123 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2014 by Boris Houska, Hans Joachim Ferreau,
+ *    Milan Vukov, Rien Quirynen, KU Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC)
+ *    under supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file benchmarks/rti_export.cpp
+ *    \date 2014
+ *
+ *    Exports an RTI tracking MPC for one of the reference models, together
+ *    with a header benchmark_init.h holding the nominal operating point.
+ *
+ *    Usage: rti_export <model> <export folder>
+ */
+
+
+#include "benchmark_models.hpp"
+
+#include <fstream>
+#include <iomanip>
+
+USING_NAMESPACE_ACADO
+
+
+/** Writes a vector as a static C array. */
+static void writeArray(	std::ostream& stream,
+						const char* name,
+						const DVector& values
+						)
+{
+	stream << "static const real_t " << name << "[ " << values.getDim() << " ] = {";
+	for (unsigned i = 0; i < values.getDim(); ++i)
+		stream << (i > 0 ? ", " : " ") << std::setprecision( 16 ) << values( i );
+	stream << " };" << std::endl;
+}
+
+
+int main( int argc, char** argv )
+{
+	if (argc != 3)
+	{
+		std::cerr << "Usage: " << argv[ 0 ] << " <crane|cstr|kite> <export folder>" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::string modelName = argv[ 1 ];
+	std::string exportFolder = argv[ 2 ];
+
+	BenchmarkModel m;
+	if (modelName == "crane")
+		m = getCraneModel();
+	else if (modelName == "cstr")
+		m = getCstrModel();
+	else if (modelName == "kite")
+		m = getKiteModel();
+	else
+	{
+		std::cerr << "Unknown model " << modelName << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	Function h, hN;
+	h << m.x << m.u;
+	hN << m.x;
+
+	DMatrix W = eye<double>( h.getDim() );
+	DMatrix WN = eye<double>( hN.getDim() );
+
+	OCP ocp(0.0, m.T * m.N, m.N);
+
+	ocp.subjectTo( m.f );
+
+	ocp.minimizeLSQ(W, h);
+	ocp.minimizeLSQEndTerm(WN, hN);
+
+	for (unsigned j = 0; j < m.u.getDim(); ++j)
+		ocp.subjectTo( m.uMin( j ) <= m.u( j ) <= m.uMax( j ) );
+
+	OCPexport mpc( ocp );
+
+	mpc.set( HESSIAN_APPROXIMATION, GAUSS_NEWTON       );
+	mpc.set( DISCRETIZATION_TYPE,   MULTIPLE_SHOOTING  );
+	mpc.set( INTEGRATOR_TYPE,       INT_RK4            );
+	mpc.set( NUM_INTEGRATOR_STEPS,  (int)(2 * m.N)     );
+	mpc.set( QP_SOLVER,             QP_QPOASES         );
+	mpc.set( GENERATE_TEST_FILE,    NO                 );
+	mpc.set( GENERATE_MAKE_FILE,    NO                 );
+
+	if (mpc.exportCode( exportFolder.c_str() ) != SUCCESSFUL_RETURN)
+		return EXIT_FAILURE;
+
+	std::ofstream init( (exportFolder + "/benchmark_init.h").c_str() );
+	if (init.is_open() == false)
+		return EXIT_FAILURE;
+
+	init << "#define BENCHMARK_MODEL \"" << modelName << "\"" << std::endl;
+	writeArray(init, "benchmarkX0", m.x0);
+	writeArray(init, "benchmarkU0", m.u0);
+
+	return EXIT_SUCCESS;
+}
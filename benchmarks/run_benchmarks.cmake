@@ -0,0 +1,41 @@
+################################################################################
+#
+# Description:
+#	Runs all benchmark applications, such that a regression in one of them
+#	does not prevent the others from being run.
+#
+# Usage:
+#	cmake -DAPPS=<app,...> -DBIN_DIR=<dir> -DOUTPUT_DIR=<dir>
+#	      [-DBASELINE_DIR=<dir> -DTOLERANCE=<tol>] -P run_benchmarks.cmake
+#
+#	Without BASELINE_DIR, the results are only written to OUTPUT_DIR.
+#
+################################################################################
+
+FILE( MAKE_DIRECTORY ${OUTPUT_DIR} )
+
+STRING( REPLACE "," ";" APPS "${APPS}" )
+
+SET( FAILED_APPS )
+
+FOREACH( APP ${APPS} )
+	SET( ARGS --output ${OUTPUT_DIR}/${APP}.txt )
+	IF( BASELINE_DIR )
+		LIST( APPEND ARGS --baseline ${BASELINE_DIR}/${APP}.txt --tolerance ${TOLERANCE} )
+	ENDIF()
+
+	EXECUTE_PROCESS(
+		COMMAND
+			${BIN_DIR}/${APP}_benchmark ${ARGS}
+		RESULT_VARIABLE
+			RESULT
+	)
+
+	IF( NOT RESULT EQUAL 0 )
+		LIST( APPEND FAILED_APPS ${APP} )
+	ENDIF()
+ENDFOREACH( APP )
+
+IF( FAILED_APPS )
+	MESSAGE( FATAL_ERROR "Benchmarks with regressions or errors: ${FAILED_APPS}" )
+ENDIF()
@@ -46,6 +46,22 @@ IF ( ACADO_WITH_TESTING )
 	ADD_DEFINITIONS( -D__NO_PLOTTING__ )
 ENDIF()
 
+IF ( ACADO_WITH_OPENMP )
+	FIND_PACKAGE( OpenMP )
+	IF ( OPENMP_FOUND )
+		SET( CMAKE_C_FLAGS "${CMAKE_C_FLAGS} ${OpenMP_C_FLAGS}" )
+		SET( CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} ${OpenMP_CXX_FLAGS}" )
+	ENDIF()
+ENDIF()
+
+IF ( ACADO_WITH_JIT AND UNIX )
+	ADD_DEFINITIONS( -DACADO_WITH_JIT )
+ENDIF()
+
+IF ( ACADO_WITH_ALLOCATION_COUNTER )
+	ADD_DEFINITIONS( -DACADO_WITH_ALLOCATION_COUNTER )
+ENDIF()
+
 #
 # CMake RPATH handling, http://www.cmake.org/Wiki/CMake_RPATH_handling
 #
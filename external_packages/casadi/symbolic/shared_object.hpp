@@ -25,6 +25,7 @@
 
 #include "printable_object.hpp"
 #include "casadi_exception.hpp"
+#include <atomic>
 #include <map>
 #include <vector>
 
@@ -203,8 +204,8 @@ class SharedObjectNode{
     bool is_init_;
 
   private:
-    /// Number of references pointing to the object
-    unsigned int count;
+    /// Number of references pointing to the object (atomic, since shared nodes are copied from several threads during code export)
+    std::atomic<unsigned int> count;
 };
 
 /// Typecast a shared object to a base class to a shared object to a derived class, cf. dynamic_cast
@@ -0,0 +1,100 @@
+/**
+ *	Helpers for the unit tests of the code generation tool: the exported
+ *	code is compiled together with a small driver and the embedded version
+ *	of qpOASES, and the exit code of the resulting program is checked.
+ */
+
+#ifndef ACADO_TESTS_CODE_EXPORT_UTILS_HPP
+#define ACADO_TESTS_CODE_EXPORT_UTILS_HPP
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+/** Creates a fresh directory for exported code and returns its name. */
+inline std::string makeExportFolder(const std::string& name)
+{
+	std::string folder = "/tmp/acado_" + name + "_XXXXXX";
+
+	std::vector< char > tmp(folder.begin(), folder.end());
+	tmp.push_back( 0 );
+
+	if (mkdtemp( &tmp[ 0 ] ) == 0)
+		return std::string();
+
+	return std::string( &tmp[ 0 ] );
+}
+
+/** Writes the given source into a file. */
+inline bool writeSource(const std::string& fileName, const std::string& source)
+{
+	std::ofstream file( fileName.c_str() );
+	file << source;
+
+	return file.good();
+}
+
+/** Runs a shell command and returns its exit code, or -1. */
+inline int runCommand(const std::string& command)
+{
+	int status = system( command.c_str() );
+
+	if (status == -1 || WIFEXITED( status ) == 0)
+		return -1;
+
+	return WEXITSTATUS( status );
+}
+
+/** Compiles the given C files in folder (the exported code and a driver)
+ *  and, if useQpOASES, the qpOASES interface together with the embedded
+ *  version of qpOASES into folder/run. The compiler output is written to
+ *  folder/build.log. */
+inline bool buildExportedCode(	const std::string& folder,
+								const std::vector< std::string >& sources,
+								bool useQpOASES = true,
+								const std::string& flags = ""
+								)
+{
+	const std::string qp = ACADO_QPOASES_EMBEDDED_FOLDER;
+
+	std::string cc = std::string( ACADO_TESTS_CC ) + " -O2 " + flags + " -I" + folder;
+	std::string cxx = std::string( ACADO_TESTS_CXX ) + " -O2 -Dregister= " + flags + " -I" + folder
+			+ " -I" + qp + " -I" + qp + "/INCLUDE -I" + qp + "/SRC";
+
+	std::string log = " >> " + folder + "/build.log 2>&1";
+	std::string objects;
+
+	for (unsigned i = 0; i < sources.size(); ++i)
+	{
+		std::string src = folder + "/" + sources[ i ];
+		std::string obj = src + ".o";
+
+		if (runCommand(cc + " -c " + src + " -o " + obj + log) != 0)
+			return false;
+
+		objects += " " + obj;
+	}
+
+	std::string link = cxx + objects;
+
+	if (useQpOASES == true)
+	{
+		const char* qpSources[] = {"Bounds", "Constraints", "CyclingManager", "Indexlist",
+				"MessageHandling", "QProblem", "QProblemB", "SubjectTo", "Utils",
+				"EXTRAS/SolutionAnalysis"};
+
+		link += " " + folder + "/acado_qpoases_interface.cpp";
+		for (unsigned i = 0; i < sizeof( qpSources ) / sizeof( qpSources[ 0 ] ); ++i)
+			link += " " + qp + "/SRC/" + qpSources[ i ] + ".cpp";
+	}
+
+	link += " -o " + folder + "/run -lpthread -lm" + log;
+
+	return runCommand( link ) == 0;
+}
+
+#endif // ACADO_TESTS_CODE_EXPORT_UTILS_HPP
@@ -0,0 +1,237 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE CollocationMethodTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado/acado_optimal_control.hpp>
+#include <acado/dynamic_discretization/collocation_method.hpp>
+
+USING_NAMESPACE_ACADO
+
+using namespace std;
+
+/** Solves the rocket OCP from examples/ocp with the given discretization,
+ *  Hessian approximation and number of threads. */
+static double solveRocket(	int discretization,
+							int hessian,
+							int numThreads,
+							VariablesGrid& xOpt
+							)
+{
+	clearAllStaticCounters();
+
+	DifferentialState v, s, m;
+	Control u;
+	DifferentialEquation f;
+
+	f << dot( s ) == v;
+	f << dot( v ) == (u - 0.02 * v * v) / m;
+	f << dot( m ) == -0.01 * u * u;
+
+	OCP ocp(0.0, 10.0, 10);
+	ocp.minimizeLagrangeTerm(u * u);
+	ocp.subjectTo( f );
+
+	ocp.subjectTo(AT_START, s == 0.0);
+	ocp.subjectTo(AT_START, v == 0.0);
+	ocp.subjectTo(AT_START, m == 1.0);
+	ocp.subjectTo(AT_END, s == 10.0);
+	ocp.subjectTo(AT_END, v == 0.0);
+
+	ocp.subjectTo(-0.01 <= v <= 1.3);
+
+	OptimizationAlgorithm algorithm( ocp );
+	algorithm.set(PRINTLEVEL, NONE);
+	algorithm.set(MAX_NUM_ITERATIONS, 20);
+	algorithm.set(KKT_TOLERANCE, 1e-8);
+	algorithm.set(DISCRETIZATION_TYPE, discretization);
+	algorithm.set(HESSIAN_APPROXIMATION, hessian);
+	algorithm.set(NUM_THREADS, numThreads);
+
+	BOOST_REQUIRE( algorithm.solve() == SUCCESSFUL_RETURN );
+
+	algorithm.getDifferentialStates( xOpt );
+
+	return algorithm.getObjectiveValue();
+}
+
+/** Evaluates a CollocationMethod with unit forward seeds and, if seed is
+ *  given, the Hessian; returns the sensitivities of the interval k. */
+static void differentiate(	const DifferentialEquation& f,
+							const Grid& grid,
+							VariablesGrid& x,
+							VariablesGrid& u,
+							int k,
+							DMatrix& Gx,
+							DMatrix& Gu,
+							const BlockMatrix* seed = 0,
+							BlockMatrix* hessian = 0
+							)
+{
+	CollocationMethod collocation;
+	collocation.set(COLLOCATION_NUM_STEPS, 3);
+	BOOST_REQUIRE( collocation.addStage(f, grid) == SUCCESSFUL_RETURN );
+
+	OCPiterate iter(&x, 0, 0, &u, 0);
+	BOOST_REQUIRE( collocation.evaluate( iter ) == SUCCESSFUL_RETURN );
+
+	collocation.setUnitForwardSeed();
+	if (hessian != 0)
+		BOOST_REQUIRE( collocation.evaluateSensitivities(*seed, *hessian) == SUCCESSFUL_RETURN );
+	else
+		BOOST_REQUIRE( collocation.evaluateSensitivities() == SUCCESSFUL_RETURN );
+
+	BlockMatrix D;
+	collocation.getForwardSensitivities( D );
+	D.getSubBlock(k, 0, Gx);
+	D.getSubBlock(k, 3, Gu);
+}
+
+BOOST_AUTO_TEST_CASE( collocation_matches_shooting )
+{
+	VariablesGrid xS, xC, xB, xP;
+
+	double objS = solveRocket(MULTIPLE_SHOOTING, EXACT_HESSIAN, 1, xS);
+	double objC = solveRocket(COLLOCATION, EXACT_HESSIAN, 1, xC);
+	double objB = solveRocket(COLLOCATION, BLOCK_BFGS_UPDATE, 1, xB);
+	double objP = solveRocket(COLLOCATION, EXACT_HESSIAN, 4, xP);
+
+	// both discretizations have to agree up to their discretization errors
+	BOOST_CHECK_SMALL(objC - objS, 1e-6);
+	BOOST_CHECK_SMALL(objB - objC, 1e-8);
+	BOOST_CHECK_SMALL(objP - objC, 1e-10);
+
+	BOOST_REQUIRE( xC.getNumPoints() == xS.getNumPoints() );
+
+	for (unsigned i = 0; i < xC.getNumPoints(); ++i)
+		for (unsigned j = 0; j < xC.getNumValues(); ++j)
+			BOOST_CHECK_SMALL(xC(i, j) - xS(i, j), 1e-4);
+
+	// the terminal constraint s(T) = 10 has to be met
+	BOOST_CHECK_SMALL(xC(xC.getLastIndex(), 1) - 10.0, 1e-6);
+}
+
+BOOST_AUTO_TEST_CASE( collocation_exact_hessian )
+{
+	clearAllStaticCounters();
+
+	DifferentialState v, s, m;
+	Control u;
+	DifferentialEquation f;
+
+	f << dot( s ) == v * s;
+	f << dot( v ) == (u * u - 0.02 * v * v) / m;
+	f << dot( m ) == -0.01 * u * u * v;
+
+	Grid grid(0.0, 3.0, 4);
+	VariablesGrid x(3, grid), w(1, grid);
+
+	for (unsigned i = 0; i < 4; ++i)
+	{
+		x(i, 0) = 0.2 + 0.1 * i; x(i, 1) = 0.5 + i; x(i, 2) = 1.0 - 0.01 * i;
+		w(i, 0) = 0.3 - 0.05 * i;
+	}
+	x.disableAutoInit();
+	w.disableAutoInit();
+
+	const int k = 1, NN = 4;
+
+	DMatrix S(3, 1);
+	S(0, 0) = 0.3; S(1, 0) = -1.2; S(2, 0) = 0.7;
+
+	BlockMatrix seed(3, 1), hessian(5 * NN, 5 * NN);
+	for (int i = 0; i < 3; ++i)
+		seed.setDense(i, 0, S);
+
+	DMatrix Gx, Gu, Hxx, Hxu, Huu;
+	differentiate(f, grid, x, w, k, Gx, Gu, &seed, &hessian);
+
+	hessian.getSubBlock(k, k, Hxx);
+	hessian.getSubBlock(k, 3 * NN + k, Hxu);
+	hessian.getSubBlock(3 * NN + k, 3 * NN + k, Huu);
+
+	// The second order derivatives of S^T x_end by automatic differentiation
+	// have to match central differences of the first order sensitivities.
+	const double delta = 1e-5;
+
+	for (int j = 0; j < 4; ++j)
+	{
+		VariablesGrid x1 = x, x2 = x, w1 = w, w2 = w;
+
+		if (j < 3)
+		{
+			x1(k, j) += delta; x2(k, j) -= delta;
+		}
+		else
+		{
+			w1(k, 0) += delta; w2(k, 0) -= delta;
+		}
+
+		DMatrix Gx1, Gu1, Gx2, Gu2;
+		differentiate(f, grid, x1, w1, k, Gx1, Gu1);
+		differentiate(f, grid, x2, w2, k, Gx2, Gu2);
+
+		DMatrix dGx = S.transpose() * (Gx1 - Gx2) / (2.0 * delta);
+		DMatrix dGu = S.transpose() * (Gu1 - Gu2) / (2.0 * delta);
+
+		for (int i = 0; i < 3; ++i)
+			BOOST_CHECK_SMALL(dGx(0, i) - (j < 3 ? Hxx(j, i) : Hxu(i, 0)), 1e-7);
+
+		BOOST_CHECK_SMALL(dGu(0, 0) - (j < 3 ? Hxu(j, 0) : Huu(0, 0)), 1e-7);
+	}
+}
+
+BOOST_AUTO_TEST_CASE( collocation_finer_state_grid )
+{
+	clearAllStaticCounters();
+
+	DifferentialState x;
+	DifferentialEquation f;
+
+	f << dot( x ) == -x;
+
+	CollocationMethod collocation;
+	BOOST_REQUIRE( collocation.addStage(f, Grid(0.0, 2.0, 3)) == SUCCESSFUL_RETURN );
+
+	// the state grid has three additional points within each interval
+	VariablesGrid xGrid(1, Grid(0.0, 2.0, 9));
+	xGrid.setZero();
+	xGrid(0, 0) = 1.0;
+
+	OCPiterate iter(&xGrid, 0, 0, 0, 0);
+	iter.enableSimulationMode();
+	BOOST_REQUIRE( collocation.evaluate( iter ) == SUCCESSFUL_RETURN );
+
+	// the intermediate states are given by the collocation polynomials,
+	// whose order is lower than the one at the step boundaries
+	for (unsigned i = 0; i < xGrid.getNumPoints(); ++i)
+		BOOST_CHECK_SMALL(iter.x->operator()(i, 0) - exp( -xGrid.getTime( i ) ), 1e-3);
+}
+
+BOOST_AUTO_TEST_CASE( collocation_two_stages )
+{
+	clearAllStaticCounters();
+
+	DifferentialState x;
+	DifferentialEquation f1, f2;
+
+	f1 << dot( x ) == -x;
+	f2 << dot( x ) == -2.0 * x;
+
+	CollocationMethod collocation;
+	BOOST_REQUIRE( collocation.addStage(f1, Grid(0.0, 1.0, 3)) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( collocation.addStage(f2, Grid(1.0, 2.0, 3)) == SUCCESSFUL_RETURN );
+
+	VariablesGrid xGrid(1, Grid(0.0, 2.0, 5));
+	xGrid.setZero();
+	xGrid(0, 0) = 1.0;
+
+	OCPiterate iter(&xGrid, 0, 0, 0, 0);
+	iter.enableSimulationMode();
+	BOOST_REQUIRE( collocation.evaluate( iter ) == SUCCESSFUL_RETURN );
+
+	// every stage is discretized with its own dynamics
+	BOOST_CHECK_SMALL(iter.x->operator()(2, 0) - exp( -1.0 ), 1e-4);
+	BOOST_CHECK_SMALL(iter.x->operator()(4, 0) - exp( -3.0 ), 1e-4);
+}
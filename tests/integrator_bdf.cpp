@@ -0,0 +1,155 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE IntegratorBDFTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado/acado_integrators.hpp>
+
+USING_NAMESPACE_ACADO
+
+using namespace std;
+
+static const double TOL = 1e-5;
+
+/** Integrates the harmonic oscillator over one period with the given
+ *  linear algebra solver and computes first-order forward and backward
+ *  sensitivities w.r.t. the initial state. */
+static void integrateOscillator(	LinearAlgebraSolver las,
+									DVector& xEnd,
+									DVector& fwd,
+									DVector& bwd
+									)
+{
+	clearAllStaticCounters();
+
+	DifferentialState x, y;
+	DifferentialEquation f;
+
+	f << dot( x ) ==  y;
+	f << dot( y ) == -x;
+
+	IntegratorBDF integrator( f );
+	integrator.set( INTEGRATOR_PRINTLEVEL, NONE );
+	integrator.set( INTEGRATOR_TOLERANCE, 1e-10 );
+	integrator.set( ABSOLUTE_TOLERANCE, 1e-10 );
+	integrator.set( LINEAR_ALGEBRA_SOLVER, las );
+
+	double x0[ 2 ] = {0.0, 1.0};
+
+	integrator.freezeAll();
+	BOOST_REQUIRE( integrator.integrate(0.0, 2.0 * M_PI, x0) == SUCCESSFUL_RETURN );
+	integrator.getX( xEnd );
+
+	DVector seed( 2 );
+	seed( 0 ) = 1.0; seed( 1 ) = 0.0;
+
+	integrator.setForwardSeed(1, seed);
+	BOOST_REQUIRE( integrator.integrateSensitivities() == SUCCESSFUL_RETURN );
+	integrator.getForwardSensitivities(fwd, 1);
+	integrator.deleteAllSeeds();
+
+	bwd.init( 2 );
+	integrator.setBackwardSeed(1, seed);
+	BOOST_REQUIRE( integrator.integrateSensitivities() == SUCCESSFUL_RETURN );
+	integrator.getBackwardSensitivities(bwd, emptyVector, emptyVector, emptyVector, 1);
+}
+
+static void requireClose(const DVector& a, const DVector& b, double tol)
+{
+	BOOST_REQUIRE( a.getDim() == b.getDim() );
+	for (unsigned i = 0; i < a.getDim(); ++i)
+		BOOST_CHECK_SMALL(a( i ) - b( i ), tol);
+}
+
+BOOST_AUTO_TEST_CASE( bdf_cached_factorizations )
+{
+	DVector xRef( 2 ), eRef( 2 );
+	xRef( 0 ) = 0.0; xRef( 1 ) = 1.0;
+	eRef( 0 ) = 1.0; eRef( 1 ) = 0.0;
+
+	// The Householder, the dense LU and the sparse LU factorization are
+	// all cached across Newton iterations; each has to reproduce the exact
+	// solution and the (identity) sensitivities after one period.
+	LinearAlgebraSolver solvers[ 3 ] = {HOUSEHOLDER_METHOD, GAUSS_LU, SPARSE_LU};
+
+	for (unsigned i = 0; i < 3; ++i)
+	{
+		DVector xEnd, fwd, bwd;
+		integrateOscillator(solvers[ i ], xEnd, fwd, bwd);
+
+		requireClose(xEnd, xRef, TOL);
+		requireClose(fwd, eRef, TOL);
+		requireClose(bwd, eRef, TOL);
+	}
+}
+
+BOOST_AUTO_TEST_CASE( bdf_copy_keeps_results )
+{
+	clearAllStaticCounters();
+
+	DifferentialState x;
+	AlgebraicState z;
+	DifferentialEquation f;
+
+	f << dot( x ) == -x * x * z;
+	f << 0 == 1.0 - z * z;
+
+	IntegratorBDF integrator( f );
+	integrator.set( INTEGRATOR_PRINTLEVEL, NONE );
+	integrator.set( INTEGRATOR_TOLERANCE, 1e-10 );
+	integrator.set( ABSOLUTE_TOLERANCE, 1e-10 );
+
+	double x0 = 1.0, z0 = 1.0;
+	BOOST_REQUIRE( integrator.integrate(0.0, 1.0, &x0, &z0) == SUCCESSFUL_RETURN );
+
+	// A copy must not reuse the factorizations of the original.
+	IntegratorBDF copy( integrator );
+	x0 = 1.0; z0 = 1.0;
+	BOOST_REQUIRE( copy.integrate(0.0, 1.0, &x0, &z0) == SUCCESSFUL_RETURN );
+
+	DVector x1, x2;
+	integrator.getX( x1 );
+	copy.getX( x2 );
+
+	BOOST_CHECK_SMALL(x1( 0 ) - 0.5, TOL);
+	BOOST_CHECK_SMALL(x2( 0 ) - 0.5, TOL);
+}
+
+BOOST_AUTO_TEST_CASE( bdf_sparse_lu_assignment )
+{
+	clearAllStaticCounters();
+
+	DifferentialState x1, x2, x3;
+	DifferentialEquation f, g;
+
+	f << dot( x1 ) == -x1;
+	f << dot( x2 ) == x1 - 2.0 * x2;
+	f << dot( x3 ) == x2 - 3.0 * x3;
+
+	g << dot( x1 ) == -x1;
+
+	IntegratorBDF integrator( f ), other( g );
+	integrator.set( INTEGRATOR_PRINTLEVEL, NONE );
+	integrator.set( INTEGRATOR_TOLERANCE, 1e-10 );
+	integrator.set( ABSOLUTE_TOLERANCE, 1e-10 );
+	integrator.set( LINEAR_ALGEBRA_SOLVER, SPARSE_LU );
+	other.set( INTEGRATOR_PRINTLEVEL, NONE );
+	other.set( LINEAR_ALGEBRA_SOLVER, SPARSE_LU );
+
+	double x0[ 3 ] = {1.0, 0.0, 0.0};
+	BOOST_REQUIRE( other.integrate(0.0, 1.0, x0) == SUCCESSFUL_RETURN );
+
+	// The sparsity pattern of the assigned integrator must replace the one
+	// that has been set up for the smaller system.
+	other = integrator;
+	BOOST_REQUIRE( other.integrate(0.0, 1.0, x0) == SUCCESSFUL_RETURN );
+
+	DVector xEnd;
+	other.getX( xEnd );
+
+	const double e1 = exp( -1.0 ), e2 = exp( -2.0 ), e3 = exp( -3.0 );
+	BOOST_CHECK_SMALL(xEnd( 0 ) - e1, TOL);
+	BOOST_CHECK_SMALL(xEnd( 1 ) - (e1 - e2), TOL);
+	BOOST_CHECK_SMALL(xEnd( 2 ) - (0.5 * e1 - e2 + 0.5 * e3), TOL);
+}
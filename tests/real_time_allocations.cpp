@@ -0,0 +1,307 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE RealTimeAllocationsTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado/acado_optimal_control.hpp>
+#include <acado/conic_solver/condensing_based_cp_solver.hpp>
+#include <acado/bindings/acado_qpoases/qp_solver_qpoases.hpp>
+#include <acado/utils/allocation_counter.hpp>
+
+USING_NAMESPACE_ACADO
+
+using namespace std;
+
+/*
+ * This test is compiled together with allocation_counter.cpp and
+ * ACADO_WITH_ALLOCATION_COUNTER (see tests/CMakeLists.txt), hence every
+ * heap allocation of the process is counted. The counted regions must not
+ * contain any Boost macros, which allocate themselves.
+ */
+
+static const int NUM_WARM_UP = 3;
+static const int NUM_CALLS   = 10;
+
+static const int N  = 5;
+static const int NX = 2;
+static const int NU = 1;
+
+/** A stand-alone condensing solver with the options of the SCP method,
+ *  which are shared with its QP solvers as within the SCP method. */
+class Condensing : public CondensingBasedCPsolver
+{
+public:
+
+	Condensing(const DVector& blockDims) : CondensingBasedCPsolver(0, 1, blockDims)
+	{
+		addOption(PRINTLEVEL, NONE);
+		addOption(HESSIAN_APPROXIMATION, GAUSS_NEWTON);
+		addOption(DYNAMIC_SENSITIVITY, FORWARD_SENSITIVITY);
+
+		delete cpSolver;
+		delete cpSolverRelaxed;
+
+		cpSolver = new QPsolver_qpOASES( userInteraction );
+		cpSolverRelaxed = new QPsolver_qpOASES( userInteraction );
+	}
+};
+
+static DMatrix matrix(int nRows, int nCols, double value)
+{
+	DMatrix m(nRows, nCols);
+	m.setAll( value );
+
+	return m;
+}
+
+/** Sets up the banded QP of a double integrator with N points, a box on the
+ *  controls and a general constraint on the first state. */
+static void setupBandedCP(BandedCP& cp)
+{
+	DMatrix Gx(NX, NX), Gu(NX, NU);
+	Gx(0, 0) = 1.0; Gx(0, 1) = 0.1; Gx(1, 0) = 0.0; Gx(1, 1) = 1.0;
+	Gu(0, 0) = 0.005; Gu(1, 0) = 0.1;
+
+	DMatrix Q(NX, NX), R(NU, NU);
+	Q.setIdentity();
+	R.setIdentity();
+
+	cp.hessian.init(5 * N, 5 * N);
+	cp.objectiveGradient.init(1, 5 * N);
+	cp.lowerBoundResiduum.init(4 * N + 1, 1);
+	cp.upperBoundResiduum.init(4 * N + 1, 1);
+
+	for (int i = 0; i < N; ++i)
+	{
+		cp.hessian.setDense(i, i, Q);
+		cp.objectiveGradient.setDense(0, i, matrix(1, NX, 0.1 * (i + 1)));
+
+		cp.lowerBoundResiduum.setDense(i, 0, matrix(NX, 1, -10.0));
+		cp.upperBoundResiduum.setDense(i, 0, matrix(NX, 1,  10.0));
+	}
+
+	for (int i = 0; i < N - 1; ++i)
+	{
+		cp.hessian.setDense(3 * N + i, 3 * N + i, R);
+		cp.objectiveGradient.setDense(0, 3 * N + i, matrix(1, NU, -0.2));
+
+		cp.lowerBoundResiduum.setDense(2 * N + 1 + i, 0, matrix(NU, 1, -0.5));
+		cp.upperBoundResiduum.setDense(2 * N + 1 + i, 0, matrix(NU, 1,  0.5));
+	}
+
+	cp.dynGradient.init(N - 1, 5);
+	cp.dynResiduum.init(N - 1, 1);
+
+	for (int i = 0; i < N - 1; ++i)
+	{
+		cp.dynGradient.setDense(i, 0, Gx);
+		cp.dynGradient.setDense(i, 3, Gu);
+		cp.dynResiduum.setDense(i, 0, matrix(NX, 1, 0.01 * i));
+	}
+
+	cp.constraintGradient.init(1, 5 * N);
+	cp.lowerConstraintResiduum.init(1, 1);
+	cp.upperConstraintResiduum.init(1, 1);
+
+	cp.constraintGradient.setDense(0, 0, matrix(1, NX, 1.0));
+	cp.lowerConstraintResiduum.setDense(0, 0, matrix(1, 1, -1.0));
+	cp.upperConstraintResiduum.setDense(0, 0, matrix(1, 1,  1.0));
+}
+
+/** Compares two block matrices, where an empty block equals a zero block. */
+static void requireEqual(const BlockMatrix& a, const BlockMatrix& b)
+{
+	BOOST_REQUIRE( a.getNumRows() == b.getNumRows() );
+	BOOST_REQUIRE( a.getNumCols() == b.getNumCols() );
+
+	for (unsigned i = 0; i < a.getNumRows(); ++i)
+		for (unsigned j = 0; j < a.getNumCols(); ++j)
+		{
+			DMatrix A, B;
+			a.getSubBlock(i, j, A);
+			b.getSubBlock(i, j, B);
+
+			if (A.getDim() == 0)
+				A = B.getDim() == 0 ? A : matrix(B.getNumRows(), B.getNumCols(), 0.0);
+			if (B.getDim() == 0)
+				B = matrix(A.getNumRows(), A.getNumCols(), 0.0);
+
+			BOOST_REQUIRE( A.getNumRows() == B.getNumRows() );
+			BOOST_REQUIRE( A.getNumCols() == B.getNumCols() );
+
+			for (unsigned k = 0; k < A.getNumRows(); ++k)
+				for (unsigned l = 0; l < A.getNumCols(); ++l)
+					BOOST_CHECK_SMALL(A(k, l) - B(k, l), 1e-12);
+		}
+}
+
+BOOST_AUTO_TEST_CASE( counter_is_available )
+{
+	BOOST_REQUIRE( AllocationCounter::isAvailable() == BT_TRUE );
+
+	unsigned long before = AllocationCounter::getNumAllocations();
+	double* tmp = new double[ 10 ];
+	delete[] tmp;
+
+	BOOST_CHECK( AllocationCounter::getNumAllocations() > before );
+}
+
+BOOST_AUTO_TEST_CASE( block_matrix_products )
+{
+	clearAllStaticCounters();
+
+	BlockMatrix A(2, 3), B(3, 2), C(2, 3), AB, AtC, AmC;
+
+	A.setDense(0, 0, matrix(2, 2, 1.0));
+	A.setDense(1, 2, matrix(3, 1, 2.0));
+	A.setIdentity(0, 2, 2);
+	B.setDense(0, 1, matrix(2, 4, -1.0));
+	B.setDense(2, 0, matrix(1, 3, 0.5));
+	C.setDense(0, 0, matrix(2, 2, 3.0));
+	C.setDense(1, 1, matrix(3, 5, 1.0));
+
+	// the storage of the results is reused after the first products
+	for (int i = 0; i < NUM_WARM_UP; ++i)
+	{
+		A.multiply(B, AB);
+		A.multiplyTransposed(C, AtC);
+		A.subtract(C, AmC);
+	}
+
+	unsigned long before = AllocationCounter::getNumAllocations();
+
+	for (int i = 0; i < NUM_CALLS; ++i)
+	{
+		A.multiply(B, AB);
+		A.multiplyTransposed(C, AtC);
+		A.subtract(C, AmC);
+	}
+
+	BOOST_CHECK_EQUAL(AllocationCounter::getNumAllocations() - before, 0ul);
+
+	requireEqual(AB, A * B);
+	requireEqual(AtC, A ^ C);
+	requireEqual(AmC, A - C);
+}
+
+BOOST_AUTO_TEST_CASE( condensing_and_expansion )
+{
+	clearAllStaticCounters();
+
+	Grid grid(0.0, 1.0, N);
+	VariablesGrid x(NX, grid), u(NU, grid);
+	x.setZero();
+	u.setZero();
+
+	DVector blockDims( 1 );
+	blockDims( 0 ) = 1.0;
+
+	Condensing solver( blockDims );
+	BOOST_REQUIRE( solver.init( OCPiterate(&x, 0, 0, &u, 0) ) == SUCCESSFUL_RETURN );
+
+	BandedCP cp;
+	setupBandedCP( cp );
+
+	// the first solution sizes the workspaces and the dense QP
+	BOOST_REQUIRE( solver.solve( cp ) == SUCCESSFUL_RETURN );
+
+	BlockMatrix deltaX = cp.deltaX;
+	BlockMatrix lambdaDynamic = cp.lambdaDynamic;
+
+	bool succeeded = true;
+
+	for (int i = 0; i < NUM_WARM_UP; ++i)
+	{
+		succeeded &= solver.prepareSolve( cp ) == SUCCESSFUL_RETURN;
+		succeeded &= solver.finalizeSolve( cp ) == SUCCESSFUL_RETURN;
+	}
+
+	unsigned long before = AllocationCounter::getNumAllocations();
+
+	for (int i = 0; i < NUM_CALLS; ++i)
+	{
+		succeeded &= solver.prepareSolve( cp ) == SUCCESSFUL_RETURN;
+		succeeded &= solver.finalizeSolve( cp ) == SUCCESSFUL_RETURN;
+	}
+
+	BOOST_CHECK_EQUAL(AllocationCounter::getNumAllocations() - before, 0ul);
+	BOOST_REQUIRE( succeeded == true );
+
+	// the expansion of the unchanged QP solution has to be reproduced
+	requireEqual(cp.deltaX, deltaX);
+	requireEqual(cp.lambdaDynamic, lambdaDynamic);
+}
+
+BOOST_AUTO_TEST_CASE( objective_and_path_constraint )
+{
+	clearAllStaticCounters();
+
+	DifferentialState p, v;
+	Control a;
+
+	Grid grid(0.0, 1.0, 8);
+	VariablesGrid x(2, grid), u(1, grid);
+
+	for (unsigned i = 0; i < grid.getNumPoints(); ++i)
+	{
+		x(i, 0) = 0.1 * i; x(i, 1) = 1.0 - 0.1 * i;
+		u(i, 0) = 0.5;
+	}
+
+	OCPiterate iter(&x, 0, 0, &u, 0);
+
+	Function h;
+	h << p;
+	h << v * v;
+	h << a;
+
+	DMatrix S(3, 3);
+	S.setIdentity();
+	DVector r(3);
+	r.setAll( 0.1 );
+
+	MatrixVariablesGrid SGrid(S);
+	VariablesGrid rGrid(r);
+
+	LSQTerm lsq(&SGrid, h, &rGrid);
+	BOOST_REQUIRE( lsq.setGrid( grid ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( lsq.setNumThreads( 2 ) == SUCCESSFUL_RETURN );
+
+	DVector lb(8), ub(8);
+	lb.setAll( -1.0 );
+	ub.setAll(  1.0 );
+
+	PathConstraint constraint( grid );
+	BOOST_REQUIRE( constraint.add(lb, p * a + v, ub) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( constraint.init( iter ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( constraint.setNumThreads( 2 ) == SUCCESSFUL_RETURN );
+
+	// the copies of the functions for the threads are made by the first
+	// evaluation and kept afterwards
+	bool succeeded = true;
+
+	for (int i = 0; i < NUM_WARM_UP; ++i)
+	{
+		succeeded &= lsq.evaluate( iter ) == SUCCESSFUL_RETURN;
+		succeeded &= constraint.evaluate( iter ) == SUCCESSFUL_RETURN;
+	}
+
+	double objective, objective1;
+	lsq.getObjectiveValue( objective );
+
+	unsigned long before = AllocationCounter::getNumAllocations();
+
+	for (int i = 0; i < NUM_CALLS; ++i)
+	{
+		succeeded &= lsq.evaluate( iter ) == SUCCESSFUL_RETURN;
+		succeeded &= constraint.evaluate( iter ) == SUCCESSFUL_RETURN;
+	}
+
+	BOOST_CHECK_EQUAL(AllocationCounter::getNumAllocations() - before, 0ul);
+	BOOST_REQUIRE( succeeded == true );
+
+	lsq.getObjectiveValue( objective1 );
+	BOOST_CHECK_SMALL(objective1 - objective, 1e-14);
+	BOOST_CHECK( objective > 0.0 );
+}
@@ -0,0 +1,151 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE ReentrantExportTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado_code_generation.hpp>
+
+#include "code_export_utils.hpp"
+
+USING_NAMESPACE_ACADO
+
+using namespace std;
+
+/** Runs two solver instances serially and on two threads, and requires
+ *  that the controls and KKT values of all real-time iterations coincide
+ *  bitwise. The return codes are 2 (solver failure), 3 (mismatch) and
+ *  4 (instances do not differ). */
+static const char* driver =
+"#include \"acado_common.h\"\n"
+"#include \"acado_auxiliary_functions.h\"\n"
+"\n"
+"#include <pthread.h>\n"
+"#include <stdio.h>\n"
+"#include <string.h>\n"
+"\n"
+"#define NUM_STEPS 20\n"
+"\n"
+"typedef struct\n"
+"{\n"
+"	ACADOcontext context;\n"
+"	real_t phi0;\n"
+"	real_t u[ NUM_STEPS ];\n"
+"	real_t kkt[ NUM_STEPS ];\n"
+"	int status;\n"
+"} Instance;\n"
+"\n"
+"static void* runInstance( void* arg )\n"
+"{\n"
+"	Instance* inst = (Instance*)arg;\n"
+"	ACADOvariables* v = &inst->context.variables;\n"
+"	int i, iter;\n"
+"\n"
+"	memset(&inst->context, 0, sizeof( ACADOcontext ));\n"
+"	acado_initializeSolver( &inst->context );\n"
+"\n"
+"	for (i = 0; i < ACADO_NX; ++i) v->x0[ i ] = 0.0;\n"
+"	v->x0[ 2 ] = inst->phi0;\n"
+"	for (i = 0; i < ACADO_N + 1; ++i) v->x[i * ACADO_NX + 2] = inst->phi0;\n"
+"\n"
+"	inst->status = acado_preparationStep( &inst->context );\n"
+"	for (iter = 0; iter < NUM_STEPS; ++iter)\n"
+"	{\n"
+"		inst->status |= acado_feedbackStep( &inst->context );\n"
+"		inst->u[ iter ] = v->u[ 0 ];\n"
+"		inst->kkt[ iter ] = acado_getKKT( &inst->context );\n"
+"\n"
+"		/* closed loop: the predicted next state is the new initial state */\n"
+"		for (i = 0; i < ACADO_NX; ++i) v->x0[ i ] = v->x[ACADO_NX + i];\n"
+"\n"
+"		inst->status |= acado_preparationStep( &inst->context );\n"
+"	}\n"
+"\n"
+"	return 0;\n"
+"}\n"
+"\n"
+"int main( )\n"
+"{\n"
+"	static Instance serial[ 2 ], parallel[ 2 ];\n"
+"	pthread_t threads[ 2 ];\n"
+"	int i;\n"
+"\n"
+"	for (i = 0; i < 2; ++i)\n"
+"	{\n"
+"		serial[ i ].phi0 = parallel[ i ].phi0 = i == 0 ? 0.5 : -0.3;\n"
+"		runInstance( &serial[ i ] );\n"
+"	}\n"
+"\n"
+"	for (i = 0; i < 2; ++i)\n"
+"		pthread_create(&threads[ i ], 0, runInstance, &parallel[ i ]);\n"
+"	for (i = 0; i < 2; ++i)\n"
+"		pthread_join(threads[ i ], 0);\n"
+"\n"
+"	for (i = 0; i < 2; ++i)\n"
+"	{\n"
+"		if (serial[ i ].status != 0 || parallel[ i ].status != 0)\n"
+"			return 2;\n"
+"		if (memcmp(serial[ i ].u, parallel[ i ].u, sizeof( serial[ i ].u )) != 0 ||\n"
+"			memcmp(serial[ i ].kkt, parallel[ i ].kkt, sizeof( serial[ i ].kkt )) != 0)\n"
+"			return 3;\n"
+"	}\n"
+"\n"
+"	/* the two instances must actually differ */\n"
+"	if (memcmp(serial[ 0 ].u, serial[ 1 ].u, sizeof( serial[ 0 ].u )) == 0)\n"
+"		return 4;\n"
+"\n"
+"	return 0;\n"
+"}\n";
+
+BOOST_AUTO_TEST_CASE( reentrant_contexts_on_threads )
+{
+	clearAllStaticCounters();
+
+	DifferentialState p, v, phi, omega;
+	Control a;
+	DifferentialEquation f;
+
+	f << dot( p ) == v;
+	f << dot( v ) == a;
+	f << dot( phi ) == omega;
+	f << dot( omega ) == -9.81 * sin( phi ) - a * cos( phi ) - 0.1 * omega;
+
+	Function h, hN;
+	h << p << v << phi << omega << a;
+	hN << p << v << phi << omega;
+
+	OCP ocp(0.0, 2.0, 10);
+	ocp.subjectTo( f );
+	ocp.minimizeLSQ(eye< double >( 5 ), h);
+	ocp.minimizeLSQEndTerm(eye< double >( 4 ), hN);
+	ocp.subjectTo(-2.0 <= a <= 2.0);
+
+	OCPexport mpc( ocp );
+	mpc.set(HESSIAN_APPROXIMATION, GAUSS_NEWTON);
+	mpc.set(DISCRETIZATION_TYPE, MULTIPLE_SHOOTING);
+	mpc.set(INTEGRATOR_TYPE, INT_RK4);
+	mpc.set(NUM_INTEGRATOR_STEPS, 20);
+	mpc.set(SPARSE_QP_SOLUTION, FULL_CONDENSING);
+	mpc.set(QP_SOLVER, QP_QPOASES);
+	mpc.set(HOTSTART_QP, YES);
+	mpc.set(CG_REENTRANT_CODE, YES);
+	mpc.set(GENERATE_TEST_FILE, NO);
+	mpc.set(GENERATE_MAKE_FILE, NO);
+
+	string folder = makeExportFolder( "reentrant" );
+	BOOST_REQUIRE( folder.empty() == false );
+
+	BOOST_REQUIRE( mpc.exportCode( folder.c_str() ) == SUCCESSFUL_RETURN );
+	BOOST_REQUIRE( writeSource(folder + "/main.c", driver) );
+
+	vector< string > sources;
+	sources.push_back( "acado_solver.c" );
+	sources.push_back( "acado_integrator.c" );
+	sources.push_back( "acado_auxiliary_functions.c" );
+	sources.push_back( "main.c" );
+
+	BOOST_REQUIRE( buildExportedCode(folder, sources) );
+	BOOST_REQUIRE_EQUAL(runCommand(folder + "/run"), 0);
+
+	runCommand("rm -rf " + folder);
+}
@@ -0,0 +1,89 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE RiccatiBasedCPsolverTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado/acado_optimal_control.hpp>
+
+USING_NAMESPACE_ACADO
+
+using namespace std;
+
+/** Solves the rocket OCP from examples/ocp, extended by a control bound
+ *  and a free parameter, with the given method for the sparse QPs. */
+static double solveRocket(	int sparseQPsolution,
+							VariablesGrid& xOpt,
+							VariablesGrid& uOpt,
+							VariablesGrid& pOpt
+							)
+{
+	clearAllStaticCounters();
+
+	DifferentialState v, s, m;
+	Control u;
+	Parameter c;
+	DifferentialEquation f;
+
+	f << dot( s ) == v;
+	f << dot( v ) == (u - c * v * v) / m;
+	f << dot( m ) == -0.01 * u * u;
+
+	OCP ocp(0.0, 10.0, 10);
+	ocp.minimizeLagrangeTerm(u * u + (c - 0.02) * (c - 0.02));
+	ocp.subjectTo( f );
+
+	ocp.subjectTo(AT_START, s == 0.0);
+	ocp.subjectTo(AT_START, v == 0.0);
+	ocp.subjectTo(AT_START, m == 1.0);
+	ocp.subjectTo(AT_END, s == 10.0);
+	ocp.subjectTo(AT_END, v == 0.0);
+
+	ocp.subjectTo(-0.01 <= v <= 1.3);
+	ocp.subjectTo(-1.1 <= u <= 1.1);
+	ocp.subjectTo(0.0 <= c <= 0.1);
+
+	OptimizationAlgorithm algorithm( ocp );
+	algorithm.set(PRINTLEVEL, NONE);
+	algorithm.set(MAX_NUM_ITERATIONS, 20);
+	algorithm.set(KKT_TOLERANCE, 1e-8);
+	algorithm.set(SPARSE_QP_SOLUTION, sparseQPsolution);
+
+	BOOST_REQUIRE( algorithm.solve() == SUCCESSFUL_RETURN );
+
+	algorithm.getDifferentialStates( xOpt );
+	algorithm.getControls( uOpt );
+	algorithm.getParameters( pOpt );
+
+	return algorithm.getObjectiveValue();
+}
+
+static void requireClose(const VariablesGrid& a, const VariablesGrid& b, double tol)
+{
+	BOOST_REQUIRE( a.getNumPoints() == b.getNumPoints() );
+	BOOST_REQUIRE( a.getNumValues() == b.getNumValues() );
+
+	for (unsigned i = 0; i < a.getNumPoints(); ++i)
+		for (unsigned j = 0; j < a.getNumValues(); ++j)
+			BOOST_CHECK_SMALL(a(i, j) - b(i, j), tol);
+}
+
+BOOST_AUTO_TEST_CASE( riccati_matches_condensing )
+{
+	VariablesGrid xC, uC, pC, xR, uR, pR;
+
+	double objC = solveRocket(CONDENSING, xC, uC, pC);
+	double objR = solveRocket(SPARSE_SOLVER, xR, uR, pR);
+
+	// The Riccati recursion solves the very same QPs as condensing
+	// followed by qpOASES, hence both have to converge to the same KKT
+	// point, up to the accuracy of the interior point method.
+	BOOST_CHECK_SMALL(objR - objC, 1e-6);
+
+	requireClose(xR, xC, 1e-5);
+	requireClose(uR, uC, 1e-5);
+	requireClose(pR, pC, 1e-5);
+
+	// the terminal constraint s(T) = 10 has to be met
+	BOOST_CHECK_SMALL(xR(xR.getLastIndex(), 1) - 10.0, 1e-6);
+}
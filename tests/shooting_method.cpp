@@ -0,0 +1,89 @@
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#define BOOST_TEST_MODULE ShootingMethodTests
+#include <boost/test/unit_test.hpp>
+
+#include <acado/acado_optimal_control.hpp>
+
+USING_NAMESPACE_ACADO
+
+using namespace std;
+
+/** Solves the rocket OCP from examples/ocp with the given number of
+ *  threads for the shooting intervals and the given sensitivity mode. */
+static double solveRocket(	int numThreads,
+							int sensitivityMode,
+							VariablesGrid& xOpt,
+							VariablesGrid& uOpt
+							)
+{
+	clearAllStaticCounters();
+
+	DifferentialState v, s, m;
+	Control u;
+	DifferentialEquation f;
+
+	f << dot( s ) == v;
+	f << dot( v ) == (u - 0.02 * v * v) / m;
+	f << dot( m ) == -0.01 * u * u;
+
+	OCP ocp(0.0, 10.0, 10);
+	ocp.minimizeLagrangeTerm(u * u);
+	ocp.subjectTo( f );
+
+	ocp.subjectTo(AT_START, s == 0.0);
+	ocp.subjectTo(AT_START, v == 0.0);
+	ocp.subjectTo(AT_START, m == 1.0);
+	ocp.subjectTo(AT_END, s == 10.0);
+	ocp.subjectTo(AT_END, v == 0.0);
+
+	ocp.subjectTo(-0.01 <= v <= 1.3);
+
+	OptimizationAlgorithm algorithm( ocp );
+	algorithm.set(PRINTLEVEL, NONE);
+	algorithm.set(MAX_NUM_ITERATIONS, 20);
+	algorithm.set(KKT_TOLERANCE, 1e-8);
+	algorithm.set(NUM_THREADS, numThreads);
+	algorithm.set(DYNAMIC_SENSITIVITY, sensitivityMode);
+
+	BOOST_REQUIRE( algorithm.solve() == SUCCESSFUL_RETURN );
+
+	algorithm.getDifferentialStates( xOpt );
+	algorithm.getControls( uOpt );
+
+	return algorithm.getObjectiveValue();
+}
+
+static void requireEqual(const VariablesGrid& a, const VariablesGrid& b)
+{
+	BOOST_REQUIRE( a.getNumPoints() == b.getNumPoints() );
+	BOOST_REQUIRE( a.getNumValues() == b.getNumValues() );
+
+	for (unsigned i = 0; i < a.getNumPoints(); ++i)
+		for (unsigned j = 0; j < a.getNumValues(); ++j)
+			BOOST_CHECK_SMALL(a(i, j) - b(i, j), 1e-10);
+}
+
+BOOST_AUTO_TEST_CASE( parallel_intervals_match_serial )
+{
+	// The intervals write into separate slots and the derivative blocks
+	// are assembled after the parallel loop, hence the iterates must not
+	// depend on the number of threads.
+	int modes[ 2 ] = {FORWARD_SENSITIVITY, BACKWARD_SENSITIVITY};
+
+	for (unsigned i = 0; i < 2; ++i)
+	{
+		VariablesGrid x1, u1, x4, u4;
+
+		double obj1 = solveRocket(1, modes[ i ], x1, u1);
+		double obj4 = solveRocket(4, modes[ i ], x4, u4);
+
+		// the terminal constraint s(T) = 10 has to be met
+		BOOST_CHECK_SMALL(x1(x1.getLastIndex(), 1) - 10.0, 1e-6);
+
+		BOOST_CHECK_SMALL(obj1 - obj4, 1e-10);
+		requireEqual(x1, x4);
+		requireEqual(u1, u4);
+	}
+}